@@ -0,0 +1,29 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "benchmark.hpp"
+#include "string\format.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::benchmark {
+
+	void Report(std::string_view name, F64 time) {
+		Print("  {:<48} {:>10.3f} ms\n", name, time);
+	}
+
+	void Report(std::string_view name, F64 baseline_time, F64 time) {
+		const auto speedup = (0.0 < time) ? baseline_time / time : 0.0;
+		Print("  {:<48} {:>10.3f} ms ({:.2f}x)\n", name, time, speedup);
+	}
+
+	void Run(std::string_view name, BenchmarkFunction benchmark) {
+		Print("[ {} ]\n", name);
+		benchmark();
+	}
+}
\ No newline at end of file
@@ -0,0 +1,100 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "type\types.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <string_view>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations
+//-----------------------------------------------------------------------------
+namespace mage::benchmark {
+
+	/**
+	 A pointer to a benchmark function.
+	 */
+	using BenchmarkFunction = void (*)();
+
+	/**
+	 Measures the wall clock time of the given action. The action is run once
+	 to warm up the caches, followed by the given number of measured runs.
+
+	 @tparam		ActionT
+					An action type.
+	 @param[in]		action
+					The action.
+	 @param[in]		nb_runs
+					The number of measured runs.
+	 @return		The minimum wall clock time (in milliseconds) of the
+					measured runs of the given action.
+	 */
+	template< typename ActionT >
+	[[nodiscard]]
+	F64 Measure(ActionT&& action, std::size_t nb_runs = 5u);
+
+	/**
+	 Prevents the compiler from discarding the computation of the given
+	 value.
+
+	 @tparam		T
+					The data type.
+	 @param[in]		value
+					A reference to the value.
+	 */
+	template< typename T >
+	void DoNotOptimize(const T& value) noexcept;
+
+	/**
+	 Reports the given time.
+
+	 @param[in]		name
+					The name of the measurement.
+	 @param[in]		time
+					The time (in milliseconds).
+	 */
+	void Report(std::string_view name, F64 time);
+
+	/**
+	 Reports the given time relative to the given baseline time.
+
+	 @param[in]		name
+					The name of the measurement.
+	 @param[in]		baseline_time
+					The baseline time (in milliseconds).
+	 @param[in]		time
+					The time (in milliseconds).
+	 */
+	void Report(std::string_view name, F64 baseline_time, F64 time);
+
+	/**
+	 Runs the given benchmark.
+
+	 @param[in]		name
+					The name of the benchmark.
+	 @param[in]		benchmark
+					The benchmark function.
+	 */
+	void Run(std::string_view name, BenchmarkFunction benchmark);
+}
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "benchmark.tpp"
+
+#pragma endregion
\ No newline at end of file
@@ -0,0 +1,49 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "system\timer.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <limits>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::benchmark {
+
+	template< typename ActionT >
+	F64 Measure(ActionT&& action, std::size_t nb_runs) {
+		// Warm up.
+		action();
+
+		WallClockTimer timer;
+		auto min_time = std::numeric_limits< F64 >::max();
+		for (std::size_t i = 0u; i < nb_runs; ++i) {
+			timer.Restart();
+			action();
+			const auto time = timer.GetTotalDeltaTime().count() * 1000.0;
+			min_time = std::min(min_time, time);
+		}
+
+		return min_time;
+	}
+
+	template< typename T >
+	inline void DoNotOptimize(const T& value) noexcept {
+		static const void* volatile s_sink;
+		s_sink = &value;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,37 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "benchmark.hpp"
+#include "benchmarks.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <cstdlib>
+
+#pragma endregion
+
+/**
+ The entry point of the engine benchmarks. The benchmarks only exercise CPU
+ code and do not require a display or Direct3D device. Use the Release
+ configuration.
+
+ @return		@c EXIT_SUCCESS.
+ */
+int main() {
+	using namespace mage::benchmark;
+
+	Run("Culling", BenchmarkCulling);
+	Run("LightClusterGrid", BenchmarkLightClusterGrid);
+	Run("LineReader", BenchmarkLineReader);
+	Run("ShadowAtlasAllocator", BenchmarkShadowAtlasAllocator);
+	Run("StringToF32", BenchmarkStringToF32);
+
+	return EXIT_SUCCESS;
+}
\ No newline at end of file
@@ -0,0 +1,36 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Declarations
+//-----------------------------------------------------------------------------
+namespace mage::benchmark {
+
+	/**
+	 Benchmarks the batched culling of AABBs and bounding spheres against
+	 the culling of each object with its own bounding frustum.
+	 */
+	void BenchmarkCulling();
+
+	/**
+	 Benchmarks the building of light cluster grids for a thousand lights.
+	 */
+	void BenchmarkLightClusterGrid();
+
+	/**
+	 Benchmarks the load time of line readers against the regex tokenizer
+	 they replaced.
+	 */
+	void BenchmarkLineReader();
+
+	/**
+	 Benchmarks the per-frame allocation of shadow atlas tiles for drifting
+	 lights against reallocating all tiles every frame.
+	 */
+	void BenchmarkShadowAtlasAllocator();
+
+	/**
+	 Benchmarks the conversion of OBJ vertex coordinate tokens to @c F32
+	 values against the standard library.
+	 */
+	void BenchmarkStringToF32();
+}
\ No newline at end of file
@@ -0,0 +1,225 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "benchmark.hpp"
+#include "benchmarks.hpp"
+#include "collection\vector.hpp"
+#include "geometry\culling.hpp"
+#include "string\format.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <random>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::benchmark {
+
+	namespace {
+
+		/**
+		 A struct of culling scenes: objects with an object-space AABB and
+		 bounding sphere, and an object-to-world transformation matrix.
+		 */
+		struct CullingScene {
+
+			/**
+			 The object-to-world transformation matrices of the objects of
+			 this culling scene.
+			 */
+			AlignedVector< XMMATRIX > m_object_to_world;
+
+			/**
+			 The object-space AABBs of the objects of this culling scene.
+			 */
+			AlignedVector< AABB > m_aabbs;
+
+			/**
+			 The object-space bounding spheres of the objects of this culling
+			 scene.
+			 */
+			AlignedVector< BoundingSphere > m_spheres;
+		};
+
+		/**
+		 Creates a culling scene with the given number of objects scattered
+		 (translated and uniformly scaled) in a cube with a side of 1000
+		 units. The culling scene is deterministic.
+
+		 @param[in]		nb_objects
+						The number of objects.
+		 @return		The culling scene.
+		 */
+		[[nodiscard]]
+		CullingScene CreateCullingScene(std::size_t nb_objects) {
+			std::mt19937 generator(0x4D414745u);
+			std::uniform_real_distribution< F32 > position(-500.0f, 500.0f);
+			std::uniform_real_distribution< F32 > scale(0.5f, 5.0f);
+
+			CullingScene scene;
+			scene.m_object_to_world.reserve(nb_objects);
+			scene.m_aabbs.reserve(nb_objects);
+			scene.m_spheres.reserve(nb_objects);
+
+			for (std::size_t i = 0u; i < nb_objects; ++i) {
+				const auto s = scale(generator);
+				const auto x = position(generator);
+				const auto y = position(generator);
+				const auto z = position(generator);
+				scene.m_object_to_world.push_back(XMMatrixScaling(s, s, s)
+												  * XMMatrixTranslation(x, y, z));
+
+				const AABB aabb(Point3(-1.0f, -1.0f, -1.0f), Point3(1.0f, 1.0f, 1.0f));
+				scene.m_aabbs.push_back(aabb);
+				scene.m_spheres.emplace_back(Point3(0.0f, 0.0f, 0.0f), 1.0f);
+			}
+
+			return scene;
+		}
+
+		/**
+		 Returns the world-to-projection transformation matrix of a
+		 perspective camera at the center of the culling scene (i.e. which
+		 sees roughly a tenth of the objects).
+
+		 @return		The world-to-projection transformation matrix.
+		 */
+		[[nodiscard]]
+		const XMMATRIX XM_CALLCONV GetWorldToProjection() noexcept {
+			const auto world_to_view = XMMatrixLookAtLH(
+				XMVectorSet(0.0f, 0.0f, 0.0f, 1.0f),
+				XMVectorSet(1.0f, 0.2f, 0.5f, 1.0f),
+				XMVectorSet(0.0f, 1.0f, 0.0f, 0.0f));
+			const auto view_to_projection = XMMatrixPerspectiveFovLH(
+				XM_PIDIV4, 16.0f / 9.0f, 0.1f, 1000.0f);
+
+			return world_to_view * view_to_projection;
+		}
+
+		/**
+		 Culls the objects of the given culling scene one by one (i.e. the
+		 culling before batched culling): a bounding frustum is constructed
+		 for each object from its object-to-projection transformation matrix.
+
+		 @tparam		BoundingVolumeT
+						The bounding volume type.
+		 @param[in]		scene
+						A reference to the culling scene.
+		 @param[in]		volumes
+						A reference to the vector containing the object-space
+						bounding volumes.
+		 @param[in]		world_to_projection
+						The world-to-projection transformation matrix.
+		 @return		The number of visible objects.
+		 */
+		template< typename BoundingVolumeT >
+		[[nodiscard]]
+		std::size_t XM_CALLCONV CullObjects(const CullingScene& scene,
+											const AlignedVector< BoundingVolumeT >& volumes,
+											FXMMATRIX world_to_projection) noexcept {
+
+			std::size_t nb_visible = 0u;
+			for (std::size_t i = 0u; i < volumes.size(); ++i) {
+				const auto object_to_projection
+					= scene.m_object_to_world[i] * world_to_projection;
+				if (!BoundingFrustum::Cull(object_to_projection, volumes[i])) {
+					++nb_visible;
+				}
+			}
+
+			return nb_visible;
+		}
+
+		/**
+		 Counts the visible bounding volumes of the given visibility mask.
+
+		 @param[in]		mask
+						A reference to the vector containing the visibility
+						mask.
+		 @return		The number of visible bounding volumes.
+		 */
+		[[nodiscard]]
+		std::size_t CountVisible(const std::vector< U64 >& mask) noexcept {
+			std::size_t nb_visible = 0u;
+			for (auto word : mask) {
+				for (; 0u != word; word &= word - 1u) {
+					++nb_visible;
+				}
+			}
+
+			return nb_visible;
+		}
+	}
+
+	void BenchmarkCulling() {
+		const auto world_to_projection = GetWorldToProjection();
+		const BoundingFrustum frustum(world_to_projection);
+		const gsl::span< const BoundingFrustum > frustums(&frustum, 1);
+
+		for (const std::size_t nb_objects : { 1000u, 10000u, 100000u }) {
+			const auto scene = CreateCullingScene(nb_objects);
+			std::vector< U64 > mask(GetNumberOfMaskWords(nb_objects));
+
+			// AABBs
+			std::size_t nb_visible_objects = 0u;
+			const auto object_time = Measure([&]() {
+				nb_visible_objects = CullObjects(scene, scene.m_aabbs, world_to_projection);
+			});
+
+			AABBArray aabbs;
+			aabbs.resize(nb_objects);
+			const auto batch_time = Measure([&]() {
+				for (std::size_t i = 0u; i < nb_objects; ++i) {
+					aabbs.Set(i, AABB::Transform(scene.m_aabbs[i], scene.m_object_to_world[i]));
+				}
+				Cull(frustums, aabbs, gsl::make_span(mask));
+			});
+			const auto kernel_time = Measure([&]() {
+				Cull(frustums, aabbs, gsl::make_span(mask));
+			});
+			const auto nb_visible_aabbs = CountVisible(mask);
+
+			Print("  {} AABBs ({} vs. {} visible)\n",
+				  nb_objects, nb_visible_objects, nb_visible_aabbs);
+			Report("per object frustum (baseline)", object_time);
+			Report("batched (including world-space AABBs)", object_time, batch_time);
+			Report("batched (kernel only)", object_time, kernel_time);
+
+			// Bounding spheres
+			const auto sphere_object_time = Measure([&]() {
+				nb_visible_objects = CullObjects(scene, scene.m_spheres, world_to_projection);
+			});
+
+			BoundingSphereArray spheres;
+			spheres.resize(nb_objects);
+			const auto sphere_batch_time = Measure([&]() {
+				for (std::size_t i = 0u; i < nb_objects; ++i) {
+					const auto& transform = scene.m_object_to_world[i];
+					const auto  scale     = XMVectorGetX(XMVector3Length(transform.r[0]));
+					spheres.Set(i, BoundingSphere(transform.r[3], scale * scene.m_spheres[i].Radius()));
+				}
+				Cull(frustums, spheres, gsl::make_span(mask));
+			});
+			const auto sphere_kernel_time = Measure([&]() {
+				Cull(frustums, spheres, gsl::make_span(mask));
+			});
+			const auto nb_visible_spheres = CountVisible(mask);
+
+			Print("  {} bounding spheres ({} vs. {} visible)\n",
+				  nb_objects, nb_visible_objects, nb_visible_spheres);
+			Report("per object frustum (baseline)", sphere_object_time);
+			Report("batched (including world-space spheres)", sphere_object_time, sphere_batch_time);
+			Report("batched (kernel only)", sphere_object_time, sphere_kernel_time);
+		}
+	}
+}
\ No newline at end of file
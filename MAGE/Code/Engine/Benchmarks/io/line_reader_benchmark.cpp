@@ -0,0 +1,138 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "benchmark.hpp"
+#include "benchmarks.hpp"
+#include "io\line_reader.hpp"
+#include "io\obj_generator.hpp"
+#include "string\format.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <regex>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::benchmark {
+
+	namespace {
+
+		/**
+		 A class of token counters: line readers which read and count all
+		 tokens.
+		 */
+		class TokenCounter final : public LineReader {
+
+		public:
+
+			TokenCounter()
+				: LineReader(),
+				m_nb_tokens(0u) {}
+
+			[[nodiscard]]
+			std::size_t GetNumberOfTokens() const noexcept {
+				return m_nb_tokens;
+			}
+
+		private:
+
+			void Preprocess() override {
+				m_nb_tokens = 0u;
+			}
+
+			void ReadLine() override {
+				while (ContainsTokens()) {
+					DoNotOptimize(Read< std::string_view >());
+					++m_nb_tokens;
+				}
+			}
+
+			std::size_t m_nb_tokens;
+		};
+
+		/**
+		 Reads and counts all tokens of the file associated with the given
+		 path in the same way as the original regex-based line reader: each
+		 line is copied with @c std::getline and tokenized with a
+		 @c std::sregex_iterator and a selection function.
+
+		 @param[in]		path
+						A reference to the path.
+		 @return		The number of tokens.
+		 */
+		[[nodiscard]]
+		std::size_t CountTokensWithRegex(const std::filesystem::path& path) {
+			static const std::regex s_regex(R"((\"([^\"]*)\")|(\S+))");
+			static const std::function< std::ssub_match(const std::smatch&) >
+				s_selection_function = [](const std::smatch& match) {
+					return match[2].length() ? match[2] : match[3];
+				};
+			static const std::sregex_iterator s_end;
+
+			std::ifstream stream(path.c_str());
+			std::size_t nb_tokens = 0u;
+
+			std::string line;
+			while (std::getline(stream, line)) {
+				for (std::sregex_iterator it(line.cbegin(), line.cend(), s_regex);
+					 s_end != it; ++it) {
+
+					const auto token = s_selection_function(*it);
+					const auto view  = token.matched
+						? std::string_view(&*token.first,
+							static_cast< std::size_t >(token.second - token.first))
+						: std::string_view();
+					DoNotOptimize(view);
+					++nb_tokens;
+				}
+			}
+
+			return nb_tokens;
+		}
+	}
+
+	void BenchmarkLineReader() {
+		for (const std::size_t nb_vertices : { 10000u, 100000u, 300000u }) {
+			const auto path = std::filesystem::temp_directory_path()
+				            / L"mage_line_reader_benchmark.obj";
+			{
+				const auto text = GenerateOBJ(nb_vertices);
+				std::ofstream stream(path.c_str(), std::ios::binary);
+				stream.write(text.data(), static_cast< std::streamsize >(text.size()));
+			}
+
+			std::size_t nb_regex_tokens = 0u;
+			const auto regex_time = Measure([&path, &nb_regex_tokens]() {
+				nb_regex_tokens = CountTokensWithRegex(path);
+			}, 3u);
+
+			TokenCounter counter;
+			const auto time = Measure([&path, &counter]() {
+				counter.ReadFromFile(path);
+			}, 3u);
+
+			std::filesystem::remove(path);
+
+			Print("  OBJ file: {} vertices, {} triangles\n", nb_vertices, 2u * nb_vertices);
+			Report("regex tokenizer (baseline)", regex_time);
+			Report("LineReader", regex_time, time);
+			if (nb_regex_tokens != counter.GetNumberOfTokens()) {
+				Print("  Token count mismatch: {} (regex) vs. {} (LineReader)\n",
+					  nb_regex_tokens, counter.GetNumberOfTokens());
+			}
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,65 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "io\obj_generator.hpp"
+#include "string\format.hpp"
+#include "type\types.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <iterator>
+#include <random>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::benchmark {
+
+	std::string GenerateOBJ(std::size_t nb_vertices) {
+		std::mt19937 generator(0x4D414745u);
+		std::uniform_real_distribution< F32 > position(-100.0f, 100.0f);
+		std::uniform_real_distribution< F32 > unit(-1.0f, 1.0f);
+		std::uniform_real_distribution< F32 > tex(0.0f, 1.0f);
+		std::uniform_int_distribution< std::size_t > index(1u, nb_vertices);
+
+		std::string text;
+		// ~40 characters per record, five records per vertex.
+		text.reserve(nb_vertices * 200u);
+		auto it = std::back_inserter(text);
+
+		it = AppendWrite(it, "# Generated OBJ file\nmtllib generated.mtl\no \"generated object\"\n");
+
+		for (std::size_t i = 0u; i < nb_vertices; ++i) {
+			it = AppendWrite(it, "v {:.6f} {:.6f} {:.6f}\n",
+							 position(generator), position(generator), position(generator));
+		}
+		for (std::size_t i = 0u; i < nb_vertices; ++i) {
+			it = AppendWrite(it, "vt {:.6f} {:.6f}\n",
+							 tex(generator), tex(generator));
+		}
+		for (std::size_t i = 0u; i < nb_vertices; ++i) {
+			it = AppendWrite(it, "vn {:.6f} {:.6f} {:.6f}\n",
+							 unit(generator), unit(generator), unit(generator));
+		}
+
+		it = AppendWrite(it, "usemtl generated\r\n");
+		for (std::size_t i = 0u; i < 2u * nb_vertices; ++i) {
+			const auto v0 = index(generator);
+			const auto v1 = index(generator);
+			const auto v2 = index(generator);
+			it = AppendWrite(it, "f {}/{}/{} {}/{}/{} {}/{}/{}\n",
+							 v0, v0, v0, v1, v1, v1, v2, v2, v2);
+		}
+
+		return text;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,28 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <string>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations
+//-----------------------------------------------------------------------------
+namespace mage::benchmark {
+
+	/**
+	 Generates the text of an OBJ file with the given number of vertex
+	 positions, texture coordinates and normals, and twice as many
+	 triangles. The text is deterministic.
+
+	 @param[in]		nb_vertices
+					The number of vertices.
+	 @return		The text of the OBJ file.
+	 */
+	[[nodiscard]]
+	std::string GenerateOBJ(std::size_t nb_vertices);
+}
\ No newline at end of file
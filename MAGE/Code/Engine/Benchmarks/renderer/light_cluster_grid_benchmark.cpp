@@ -0,0 +1,94 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "benchmark.hpp"
+#include "benchmarks.hpp"
+#include "renderer\light_cluster_grid.hpp"
+#include "string\format.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <random>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::benchmark {
+
+	using namespace rendering;
+
+	namespace {
+
+		/**
+		 Creates the given number of random camera-space bounding spheres
+		 scattered in front of a camera with a far z-plane at 100 units. The
+		 bounding spheres are deterministic.
+
+		 @param[in]		nb_lights
+						The number of lights.
+		 @param[in]		seed
+						The seed.
+		 @return		A vector containing the bounding spheres.
+		 */
+		[[nodiscard]]
+		AlignedVector< BoundingSphere > CreateLights(std::size_t nb_lights,
+													  U32 seed) {
+			std::mt19937 generator(seed);
+			std::uniform_real_distribution< F32 > xy(-50.0f, 50.0f);
+			std::uniform_real_distribution< F32 > z(0.0f, 100.0f);
+			std::uniform_real_distribution< F32 > radius(1.0f, 8.0f);
+
+			AlignedVector< BoundingSphere > lights;
+			lights.reserve(nb_lights);
+			for (std::size_t i = 0u; i < nb_lights; ++i) {
+				const auto x = xy(generator);
+				const auto y = xy(generator);
+				lights.emplace_back(Point3(x, y, z(generator)), radius(generator));
+			}
+
+			return lights;
+		}
+	}
+
+	void BenchmarkLightClusterGrid() {
+		static constexpr F32 s_near_z = 0.1f;
+		static constexpr F32 s_far_z  = 100.0f;
+
+		const auto omni_lights = CreateLights(750u, 0x4D414745u);
+		const auto spot_lights = CreateLights(250u, 0x4C494748u);
+		Print("  {} omni lights and {} spotlights, {} clusters\n",
+			  omni_lights.size(), spot_lights.size(), LightClusterGrid::s_nb_clusters);
+
+		const auto benchmark = [&omni_lights, &spot_lights](std::string_view name,
+															const XMMATRIX& camera_to_projection) {
+			// The grid is rebuilt every frame (reusing its buffers).
+			LightClusterGrid grid;
+			const auto build_time = Measure([&]() {
+				grid.Build(camera_to_projection, s_near_z, s_far_z,
+						   gsl::make_span(omni_lights), gsl::make_span(spot_lights));
+			}, 20u);
+
+			const auto nb_indices = grid.GetLightIndexList().size()
+				                  - 2u * LightClusterGrid::s_nb_clusters;
+			DoNotOptimize(nb_indices);
+
+			Report(name, build_time);
+			Print("    {:.2f} lights per cluster\n",
+				  static_cast< F64 >(nb_indices) / LightClusterGrid::s_nb_clusters);
+		};
+
+		benchmark("perspective",
+				  XMMatrixPerspectiveFovLH(XM_PI / 3.0f, 16.0f / 9.0f, s_near_z, s_far_z));
+		benchmark("orthographic",
+				  XMMatrixOrthographicLH(100.0f, 56.25f, s_near_z, s_far_z));
+	}
+}
\ No newline at end of file
@@ -0,0 +1,139 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "benchmark.hpp"
+#include "benchmarks.hpp"
+#include "renderer\shadow_atlas_allocator.hpp"
+#include "string\format.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::benchmark {
+
+	using namespace rendering;
+
+	namespace {
+
+		using Request = ShadowAtlasAllocator::Request;
+
+		/**
+		 Creates the requests of the given number of frames for the given
+		 number of lights. The desired tile size of each light drifts by a
+		 few percent per frame around its initial size, and every 16 frames
+		 one light is replaced by a new light. The requests are
+		 deterministic.
+
+		 @param[in]		nb_lights
+						The number of lights.
+		 @param[in]		nb_frames
+						The number of frames.
+		 @param[in]		max_tile_size
+						The maximum tile size of the shadow atlas allocator.
+		 @return		A vector containing the requests of each frame.
+		 */
+		[[nodiscard]]
+		std::vector< std::vector< Request > >
+			CreateFrames(std::size_t nb_lights, std::size_t nb_frames,
+						 F32 max_tile_size) {
+
+			std::mt19937 generator(0x4D414745u);
+			std::uniform_real_distribution< F32 > size(128.0f, 768.0f);
+			std::normal_distribution< F32 > drift(0.0f, 0.03f);
+
+			std::vector< U64 > keys(nb_lights);
+			std::vector< F32 > base_sizes(nb_lights);
+			std::vector< F32 > scales(nb_lights, 1.0f);
+			for (std::size_t i = 0u; i < nb_lights; ++i) {
+				keys[i]       = i;
+				base_sizes[i] = size(generator);
+			}
+			auto next_key = static_cast< U64 >(nb_lights);
+
+			std::vector< std::vector< Request > > frames(nb_frames);
+			for (std::size_t f = 0u; f < nb_frames; ++f) {
+				if (0u != f && 0u == f % 16u) {
+					const auto i  = f % nb_lights;
+					keys[i]       = next_key++;
+					base_sizes[i] = size(generator);
+					scales[i]     = 1.0f;
+				}
+
+				auto& requests = frames[f];
+				requests.reserve(nb_lights);
+				for (std::size_t i = 0u; i < nb_lights; ++i) {
+					scales[i] = std::clamp(scales[i] * std::exp(drift(generator)),
+										   0.75f, 1.25f);
+					const auto ratio = base_sizes[i] * scales[i] / max_tile_size;
+					requests.push_back({ keys[i], ratio * ratio, 1.0f });
+				}
+			}
+
+			return frames;
+		}
+	}
+
+	void BenchmarkShadowAtlasAllocator() {
+		static constexpr std::size_t s_nb_lights = 64u;
+		static constexpr std::size_t s_nb_frames = 256u;
+		static constexpr U32 s_max_tile_size     = 1024u;
+
+		const auto frames = CreateFrames(s_nb_lights, s_nb_frames,
+										 static_cast< F32 >(s_max_tile_size));
+		Print("  {} lights over {} frames\n", s_nb_lights, s_nb_frames);
+
+		const auto benchmark = [&frames](bool reuse, std::size_t& nb_relocations,
+										 F64& occupancy) {
+			return Measure([&]() {
+				ShadowAtlasAllocator allocator(4096u, 128u, s_max_tile_size);
+				nb_relocations = 0u;
+				occupancy      = 0.0;
+
+				for (const auto& requests : frames) {
+					if (!reuse) {
+						allocator.Clear();
+					}
+					allocator.Allocate(gsl::make_span(requests));
+
+					nb_relocations += allocator.GetNumberOfRelocations();
+					occupancy      += allocator.GetOccupancy();
+				}
+
+				DoNotOptimize(allocator.GetTiles().data());
+			});
+		};
+
+		std::size_t nb_relocations = 0u;
+		F64 occupancy = 0.0;
+
+		// Reallocating all tiles every frame (i.e. without reuse).
+		const auto clear_time = benchmark(false, nb_relocations, occupancy);
+		Report("reallocate every frame (baseline)", clear_time);
+		Print("    {:.2f} relocations per frame, {:.2f} occupancy\n",
+			  static_cast< F64 >(nb_relocations) / s_nb_frames,
+			  occupancy / s_nb_frames);
+
+		// Reusing the tiles of the previous frame.
+		const auto reuse_time = benchmark(true, nb_relocations, occupancy);
+		Report("reuse with hysteresis", clear_time, reuse_time);
+		Print("    {:.2f} relocations per frame, {:.2f} occupancy\n",
+			  static_cast< F64 >(nb_relocations) / s_nb_frames,
+			  occupancy / s_nb_frames);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,136 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "benchmark.hpp"
+#include "benchmarks.hpp"
+#include "string\format.hpp"
+#include "string\string_utils.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <charconv>
+#include <cstdlib>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::benchmark {
+
+	namespace {
+
+		/**
+		 A struct of number tokens: null-terminated tokens stored
+		 back-to-back in a single buffer.
+		 */
+		struct NumberTokens {
+
+			/**
+			 The characters of the tokens (each followed by a null
+			 character).
+			 */
+			std::string m_buffer;
+
+			/**
+			 The tokens (excluding the null characters).
+			 */
+			std::vector< std::string_view > m_tokens;
+		};
+
+		/**
+		 Generates the given number of OBJ vertex coordinate tokens (i.e.
+		 @c F32 values printed with six decimals). The tokens are
+		 deterministic.
+
+		 @param[in]		nb_tokens
+						The number of tokens.
+		 @return		The tokens.
+		 */
+		[[nodiscard]]
+		NumberTokens GenerateNumberTokens(std::size_t nb_tokens) {
+			std::mt19937 generator(0x4D414745u);
+			std::uniform_real_distribution< F32 > distribution(-100.0f, 100.0f);
+
+			NumberTokens tokens;
+			tokens.m_buffer.reserve(nb_tokens * 12u);
+			std::vector< std::size_t > offsets;
+			offsets.reserve(nb_tokens + 1u);
+
+			auto it = std::back_inserter(tokens.m_buffer);
+			for (std::size_t i = 0u; i < nb_tokens; ++i) {
+				offsets.push_back(tokens.m_buffer.size());
+				it = AppendWrite(it, "{:.6f}", distribution(generator));
+				tokens.m_buffer.push_back('\0');
+			}
+			offsets.push_back(tokens.m_buffer.size());
+
+			// The buffer does not grow anymore.
+			tokens.m_tokens.reserve(nb_tokens);
+			for (std::size_t i = 0u; i < nb_tokens; ++i) {
+				tokens.m_tokens.emplace_back(tokens.m_buffer.data() + offsets[i],
+											 offsets[i + 1u] - offsets[i] - 1u);
+			}
+
+			return tokens;
+		}
+	}
+
+	void BenchmarkStringToF32() {
+		static constexpr std::size_t s_nb_tokens = 3000000u;
+		const auto tokens = GenerateNumberTokens(s_nb_tokens);
+
+		F64 strtof_sum = 0.0;
+		const auto strtof_time = Measure([&tokens, &strtof_sum]() {
+			F64 sum = 0.0;
+			for (const auto token : tokens.m_tokens) {
+				sum += std::strtof(token.data(), nullptr);
+			}
+			strtof_sum = sum;
+		});
+
+		F64 from_chars_sum = 0.0;
+		const auto from_chars_time = Measure([&tokens, &from_chars_sum]() {
+			F64 sum = 0.0;
+			for (const auto token : tokens.m_tokens) {
+				F32 value = {};
+				std::from_chars(token.data(), token.data() + token.size(), value);
+				sum += value;
+			}
+			from_chars_sum = sum;
+		});
+
+		F64 string_to_sum = 0.0;
+		const auto string_to_time = Measure([&tokens, &string_to_sum]() {
+			F64 sum = 0.0;
+			for (const auto token : tokens.m_tokens) {
+				sum += *StringTo< F32 >(token);
+			}
+			string_to_sum = sum;
+		});
+
+		DoNotOptimize(strtof_sum);
+		DoNotOptimize(from_chars_sum);
+		DoNotOptimize(string_to_sum);
+
+		Print("  {} OBJ vertex coordinate tokens\n", s_nb_tokens);
+		Report("std::strtof (baseline)", strtof_time);
+		Report("std::from_chars", strtof_time, from_chars_time);
+		Report("StringTo< F32 >", strtof_time, string_to_time);
+		if (strtof_sum != string_to_sum || from_chars_sum != string_to_sum) {
+			Print("  Sum mismatch: {} (strtof) vs. {} (from_chars) vs. {} (StringTo)\n",
+				  strtof_sum, from_chars_sum, string_to_sum);
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,226 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "scene\component.hpp"
+#include "collection\slot_map.hpp"
+#include "parallel\job_system.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	/**
+	 A class of active index lists.
+
+	 An active index list contains the indices of the active components of a
+	 slot map of components. The list is rebuilt lazily, only if the state
+	 version of the component type changed since the last rebuild (i.e.
+	 after a component of that type was created, destroyed or changed its
+	 state). Changes to components of other types do not affect the list.
+	 */
+	class ActiveIndexList {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs an active index list.
+		 */
+		ActiveIndexList() noexcept
+			: m_indices(),
+			m_state_version(0u) {}
+
+		/**
+		 Constructs an active index list from the given active index list.
+
+		 @param[in]		list
+						A reference to the active index list to copy.
+		 */
+		ActiveIndexList(const ActiveIndexList& list) = default;
+
+		/**
+		 Constructs an active index list by moving the given active index
+		 list.
+
+		 @param[in]		list
+						A reference to the active index list to move.
+		 */
+		ActiveIndexList(ActiveIndexList&& list) noexcept = default;
+
+		/**
+		 Destructs this active index list.
+		 */
+		~ActiveIndexList() = default;
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given active index list to this active index list.
+
+		 @param[in]		list
+						A reference to the active index list to copy.
+		 @return		A reference to the copy of the given active index
+						list (i.e. this active index list).
+		 */
+		ActiveIndexList& operator=(const ActiveIndexList& list) = default;
+
+		/**
+		 Moves the given active index list to this active index list.
+
+		 @param[in]		list
+						A reference to the active index list to move.
+		 @return		A reference to the moved active index list (i.e. this
+						active index list).
+		 */
+		ActiveIndexList& operator=(ActiveIndexList&& list) noexcept = default;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the number of active components of the given components.
+
+		 @tparam		ComponentT
+						The component type.
+		 @param[in]		components
+						A reference to the slot map containing the components
+						this active index list refers to.
+		 @return		The number of active components.
+		 */
+		template< typename ComponentT >
+		[[nodiscard]]
+		std::size_t Count(const SlotMap< ComponentT >& components);
+
+		/**
+		 Performs the given action on each active component of the given
+		 components.
+
+		 @tparam		ComponentT
+						The component type.
+		 @tparam		ActionT
+						The action type.
+		 @param[in]		components
+						A reference to the slot map containing the components
+						this active index list refers to.
+		 @param[in]		action
+						A reference to the action.
+		 */
+		template< typename ComponentT, typename ActionT >
+		void ForEach(SlotMap< ComponentT >& components, ActionT&& action);
+
+		/**
+		 Performs the given action on each active component of the given
+		 components.
+
+		 @tparam		ComponentT
+						The component type.
+		 @tparam		ActionT
+						The action type.
+		 @param[in]		components
+						A reference to the slot map containing the components
+						this active index list refers to.
+		 @param[in]		action
+						A reference to the action.
+		 */
+		template< typename ComponentT, typename ActionT >
+		void ForEach(const SlotMap< ComponentT >& components,
+					 ActionT&& action);
+
+		/**
+		 Performs the given action on each active component of the given
+		 components in parallel.
+
+		 @tparam		ComponentT
+						The component type.
+		 @tparam		ActionT
+						The action type.
+		 @param[in]		components
+						A reference to the slot map containing the components
+						this active index list refers to.
+		 @param[in,out]	job_system
+						A reference to the job system.
+		 @param[in]		action
+						A reference to the action (i.e.
+						@c action(component, index) with @a index the
+						position of the component among the active
+						components).
+		 */
+		template< typename ComponentT, typename ActionT >
+		void ForEach(const SlotMap< ComponentT >& components,
+					 JobSystem& job_system,
+					 ActionT&& action);
+
+		/**
+		 Clears this active index list.
+		 */
+		void Clear() noexcept {
+			m_indices.clear();
+			m_state_version = 0u;
+		}
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Rebuilds this active index list if the state version of the given
+		 component type changed since the last rebuild.
+
+		 @tparam		ComponentT
+						The component type.
+		 @param[in]		components
+						A reference to the slot map containing the components
+						this active index list refers to.
+		 */
+		template< typename ComponentT >
+		void Update(const SlotMap< ComponentT >& components);
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 A vector containing the indices of the active components.
+		 */
+		std::vector< U32 > m_indices;
+
+		/**
+		 The state version of the component type at the last rebuild of this
+		 active index list.
+		 */
+		U64 m_state_version;
+	};
+}
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "scene\active_index_list.tpp"
+
+#pragma endregion
\ No newline at end of file
@@ -0,0 +1,75 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	template< typename ComponentT >
+	[[nodiscard]]
+	inline std::size_t ActiveIndexList
+		::Count(const SlotMap< ComponentT >& components) {
+
+		Update(components);
+
+		return m_indices.size();
+	}
+
+	template< typename ComponentT, typename ActionT >
+	void ActiveIndexList::ForEach(SlotMap< ComponentT >& components,
+								  ActionT&& action) {
+		Update(components);
+
+		const auto data = components.data();
+		for (const auto index : m_indices) {
+			action(data[index]);
+		}
+	}
+
+	template< typename ComponentT, typename ActionT >
+	void ActiveIndexList::ForEach(const SlotMap< ComponentT >& components,
+								  ActionT&& action) {
+		Update(components);
+
+		const auto data = components.data();
+		for (const auto index : m_indices) {
+			action(data[index]);
+		}
+	}
+
+	template< typename ComponentT, typename ActionT >
+	void ActiveIndexList::ForEach(const SlotMap< ComponentT >& components,
+								  JobSystem& job_system,
+								  ActionT&& action) {
+		// Rebuild on the calling thread before forking.
+		Update(components);
+
+		const auto data    = components.data();
+		const auto indices = m_indices.data();
+		job_system.ParallelFor(m_indices.size(),
+							   [data, indices, &action](std::size_t i) {
+			action(data[indices[i]], i);
+		});
+	}
+
+	template< typename ComponentT >
+	void ActiveIndexList::Update(const SlotMap< ComponentT >& components) {
+		const auto state_version = Component::GetStateVersion< ComponentT >();
+		if (m_state_version == state_version) {
+			return;
+		}
+
+		m_indices.clear();
+
+		U32 index = 0u;
+		for (const auto& component : components) {
+			if (State::Active == component.GetState()) {
+				m_indices.push_back(index);
+			}
+
+			++index;
+		}
+
+		m_state_version = state_version;
+	}
+}
\ No newline at end of file
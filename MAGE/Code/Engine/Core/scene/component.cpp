@@ -15,35 +15,66 @@ namespace mage {
 
 	Component::Component() noexcept
 		: m_state(State::Active),
+		m_state_version(&s_state_version< Component >),
 		m_guid(GetNextGuid()),
-		m_owner() {}
+		m_owner() {
+
+		IncrementStateVersion();
+	}
 
 	Component::Component(const Component& component) noexcept
 		: m_state(component.m_state),
+		m_state_version(component.m_state_version),
 		m_guid(GetNextGuid()),
-		m_owner() {}
+		m_owner() {
+
+		IncrementStateVersion();
+	}
 
-	Component::Component(Component&& component) noexcept = default;
+	Component::Component(Component&& component) noexcept
+		: m_state(component.m_state),
+		m_state_version(component.m_state_version),
+		m_guid(component.m_guid),
+		m_owner(std::move(component.m_owner)) {
+
+		IncrementStateVersion();
+	}
 
-	Component::~Component() = default;
+	Component::~Component() {
+		IncrementStateVersion();
+	}
 
 	Component& Component::operator=(const Component& component) noexcept {
 		SetState(component.m_state);
 		return *this;
 	}
 
-	Component& Component::operator=(Component&& component) noexcept = default;
+	Component& Component::operator=(Component&& component) noexcept {
+		m_state         = component.m_state;
+		m_state_version = component.m_state_version;
+		m_guid          = component.m_guid;
+		m_owner         = std::move(component.m_owner);
+
+		IncrementStateVersion();
+		return *this;
+	}
 
 	void Component::SetState(State state) noexcept {
 		if (State::Terminated == state) {
 			return;
 		}
 
+		const auto old_state = m_state;
+
 		if (HasOwner() && State::Terminated == m_owner->GetState()) {
 			m_state = State::Terminated;
 		}
 		else {
 			m_state = state;
 		}
+
+		if (old_state != m_state) {
+			IncrementStateVersion();
+		}
 	}
 }
\ No newline at end of file
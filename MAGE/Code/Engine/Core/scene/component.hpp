@@ -6,6 +6,7 @@
 #pragma region
 
 #include "scene\state.hpp"
+#include "type\atomic_types.hpp"
 #include "type\types.hpp"
 
 #pragma endregion
@@ -20,8 +21,11 @@ namespace mage {
 	//-------------------------------------------------------------------------
 	#pragma region
 
-	// Forward declaration.
+	// Forward declarations.
 	class Node;
+	namespace rendering {
+		class World;
+	}
 
 	/**
 	 A class of components.
@@ -85,6 +89,22 @@ namespace mage {
 		 */
 		void SetState(State state) noexcept;
 
+		/**
+		 Returns the state version of the components of the given type. The
+		 state version changes whenever a component of that type is created,
+		 moved, destructed or changes its state.
+
+		 @tparam		ComponentT
+						The (concrete) component type.
+		 @return		The state version of the components of the given
+						type.
+		 */
+		template< typename ComponentT >
+		[[nodiscard]]
+		static U64 GetStateVersion() noexcept {
+			return s_state_version< ComponentT >.load(std::memory_order_relaxed);
+		}
+
 		//---------------------------------------------------------------------
 		// Member Methods: Identification
 		//---------------------------------------------------------------------
@@ -179,6 +199,39 @@ namespace mage {
 			m_owner = std::move(owner);
 		}
 
+		/**
+		 Binds this component to the state version of the components of the
+		 given type.
+
+		 @tparam		ComponentT
+						The (concrete) component type of this component.
+		 */
+		template< typename ComponentT >
+		void BindStateVersion() noexcept {
+			m_state_version = &s_state_version< ComponentT >;
+			IncrementStateVersion();
+		}
+
+		/**
+		 Increments the state version this component is bound to.
+		 */
+		void IncrementStateVersion() const noexcept {
+			m_state_version->fetch_add(1u, std::memory_order_relaxed);
+		}
+
+		//---------------------------------------------------------------------
+		// Class Member Variables: State
+		//---------------------------------------------------------------------
+
+		/**
+		 The state version of the components of the given type.
+
+		 @tparam		ComponentT
+						The (concrete) component type.
+		 */
+		template< typename ComponentT >
+		static inline AtomicU64 s_state_version{ 1u };
+
 		//---------------------------------------------------------------------
 		// Member Variables: State
 		//---------------------------------------------------------------------
@@ -188,6 +241,12 @@ namespace mage {
 		 */
 		State m_state;
 
+		/**
+		 A pointer to the state version this component is bound to. Unbound
+		 components use the state version of the base component type.
+		 */
+		AtomicU64* m_state_version;
+
 		//---------------------------------------------------------------------
 		// Member Variables: Identification
 		//---------------------------------------------------------------------
@@ -222,11 +281,27 @@ namespace mage {
 		//---------------------------------------------------------------------
 
 		friend class Node;
+		friend class rendering::World;
 
 		//---------------------------------------------------------------------
 		// Static Member Methods
 		//---------------------------------------------------------------------
 
+		/**
+		 Binds the given component to the state version of the components of
+		 the given type.
+
+		 @tparam		ComponentT
+						The (concrete) component type.
+		 @param[in,out]	component
+						A reference to the component.
+		 */
+		template< typename ComponentT >
+		static void BindStateVersion(ComponentT& component) noexcept {
+			static_cast< Component& >(component)
+				.BindStateVersion< ComponentT >();
+		}
+
 		/**
 		 Sets the owner of the given component to the given owner.
 
@@ -79,7 +79,7 @@ namespace mage {
 		}
 
 		node->m_parent = m_this;
-		node->m_transform.SetDirty();
+		TransformClient::SetParent(node->m_transform, &m_transform);
 
 		m_childs.push_back(std::move(node));
 	}
@@ -94,7 +94,7 @@ namespace mage {
 		}
 
 		node->m_parent = nullptr;
-		node->m_transform.SetDirty();
+		TransformClient::SetParent(node->m_transform, nullptr);
 
 		if (const auto it = std::find(cbegin(m_childs), cend(m_childs), node);
 			it != cend(m_childs)) {
@@ -109,7 +109,7 @@ namespace mage {
 	void Node::RemoveAllChilds() noexcept {
 		ForEachChild([](Node& node) noexcept {
 			node.m_parent = nullptr;
-			node.m_transform.SetDirty();
+			TransformClient::SetParent(node.m_transform, nullptr);
 		});
 
 		m_childs.clear();
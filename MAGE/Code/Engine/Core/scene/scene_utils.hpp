@@ -5,7 +5,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "collection\vector.hpp"
+#include "collection\slot_map.hpp"
 
 #pragma endregion
 
@@ -15,12 +15,15 @@
 namespace mage {
 
 	template< typename ElementT, typename... ConstructorArgsT >
-	ProxyPtr< ElementT > AddElement(AlignedVector< ElementT >& elements,
+	ProxyPtr< ElementT > AddElement(SlotMap< ElementT >& elements,
 									ConstructorArgsT&&... args);
 
 	template< typename ElementT, typename BaseT, typename... ConstructorArgsT >
-	ProxyPtr< ElementT > AddElementPtr(AlignedVector< UniquePtr< BaseT > >& elements,
+	ProxyPtr< ElementT > AddElementPtr(SlotMap< UniquePtr< BaseT > >& elements,
 									   ConstructorArgsT&&... args);
+
+	template< typename ElementT >
+	void RemoveElement(SlotMap< ElementT >& elements, const ElementT& element);
 }
 
 //-----------------------------------------------------------------------------
@@ -1,56 +1,40 @@
 #pragma once
 
-//-----------------------------------------------------------------------------
-// Engine Includes
-//-----------------------------------------------------------------------------
-#pragma region
-
-#include "scene\state.hpp"
-
-#pragma endregion
-
 //-----------------------------------------------------------------------------
 // Engine Definitions
 //-----------------------------------------------------------------------------
 namespace mage {
 
 	template< typename ElementT, typename... ConstructorArgsT >
-	ProxyPtr< ElementT > AddElement(AlignedVector< ElementT >& elements,
+	ProxyPtr< ElementT > AddElement(SlotMap< ElementT >& elements,
 									ConstructorArgsT&&... args) {
-		std::size_t index = 0u;
-		for (auto& element : elements) {
-			if (State::Terminated == element.GetState()) {
-				element = ElementT(std::forward< ConstructorArgsT >(args)...);
-				return ProxyPtr< ElementT >(elements, index);
-			}
-
-			++index;
-		}
-
-		elements.emplace_back(std::forward< ConstructorArgsT >(args)...);
-		return ProxyPtr< ElementT >(elements, index);
+
+		const auto handle
+			= elements.emplace(std::forward< ConstructorArgsT >(args)...);
+
+		// The pointer becomes a null pointer once the element is removed.
+		return ProxyPtr< ElementT >([&elements, handle]() noexcept {
+				return elements.get(handle);
+		});
 	}
 
 	template< typename ElementT, typename BaseT, typename... ConstructorArgsT >
-	ProxyPtr< ElementT > AddElementPtr(AlignedVector< UniquePtr< BaseT > >& elements,
+	ProxyPtr< ElementT > AddElementPtr(SlotMap< UniquePtr< BaseT > >& elements,
 									   ConstructorArgsT&&... args) {
-		std::size_t index = 0u;
-		for (auto& element : elements) {
-			if (State::Terminated == element->GetState()) {
-				element = MakeUnique< ElementT >(
-					std::forward< ConstructorArgsT >(args)...);
-				return ProxyPtr< ElementT >([&elements, index]() noexcept {
-						return static_cast< ElementT* >(elements[index].get());
-				});
-			}
-
-			++index;
-		}
-
-		elements.push_back(MakeUnique< ElementT >(
+
+		const auto handle = elements.emplace(MakeUnique< ElementT >(
 			std::forward< ConstructorArgsT >(args)...));
-		return ProxyPtr< ElementT >([&elements, index]() noexcept {
-				return static_cast< ElementT * >(elements[index].get());
+
+		// The pointer becomes a null pointer once the element is removed.
+		return ProxyPtr< ElementT >([&elements, handle]() noexcept {
+				const auto element = elements.get(handle);
+				return element ? static_cast< ElementT* >(element->get())
+					           : nullptr;
 		});
 	}
+
+	template< typename ElementT >
+	void RemoveElement(SlotMap< ElementT >& elements, const ElementT& element) {
+		elements.erase(elements.handle_of(element));
+	}
 }
\ No newline at end of file
@@ -4,6 +4,7 @@
 #pragma region
 
 #include "scene\node.hpp"
+#include "parallel\id_generator.hpp"
 
 #pragma endregion
 
@@ -12,48 +13,126 @@
 //-----------------------------------------------------------------------------
 namespace mage {
 
-	void Transform::SetDirty() const noexcept {
-		m_dirty_object_to_world = true;
-		m_dirty_world_to_object = true;
+	namespace {
 
-		if (HasOwner()) {
-			m_owner->ForEachChild([](const Node& node) noexcept {
-				node.GetTransform().SetDirty();
-			});
+		/**
+		 Returns the next version for an object-to-world matrix.
+
+		 @return		The next version for an object-to-world matrix. This
+						version is never equal to zero.
+		 */
+		[[nodiscard]]
+		U64 GetNextVersion() noexcept {
+			static IdGenerator< U64 > s_version_generator(1u);
+			return s_version_generator.GetNextId();
 		}
 	}
 
+	U64 Transform::s_epoch = 1u;
+
+	void Transform::Synchronize(const Transform* parent,
+								const XMMATRIX& object_to_world,
+								const XMMATRIX& world_to_object) const noexcept {
+
+		m_object_to_world         = object_to_world;
+		m_world_to_object         = world_to_object;
+		m_object_to_world_version = GetNextVersion();
+		m_parent_version
+			= (nullptr != parent) ? parent->m_object_to_world_version : 0u;
+		m_world_to_object_version = m_object_to_world_version;
+		m_epoch                   = s_epoch;
+		m_dirty                   = false;
+	}
+
+	bool Transform::IsValidated() const noexcept {
+		// No transform changed since the last validation of this transform
+		// or since the last synchronization of its transform hierarchy.
+		return m_epoch == s_epoch
+			|| (nullptr != m_hierarchy && m_hierarchy->GetEpoch() == s_epoch);
+	}
+
+	void Transform::Validate(TransformHierarchy& hierarchy) noexcept {
+		hierarchy.SetEpoch(s_epoch);
+	}
+
 	void Transform::UpdateObjectToWorldMatrix() const noexcept {
-		if (m_dirty_object_to_world) {
-			m_dirty_object_to_world = false;
+		if (IsValidated()) {
+			return;
+		}
+
+		Assert(HasOwner());
+		const auto parent = m_owner->GetParent();
+
+		if (nullptr != parent) {
+			const auto& parent_transform = parent->GetTransform();
+			parent_transform.UpdateObjectToWorldMatrix();
+			UpdateObjectToWorldMatrix(&parent_transform);
+		}
+		else {
+			UpdateObjectToWorldMatrix(nullptr);
+		}
+
+		m_epoch = s_epoch;
+	}
+
+	void Transform::UpdateObjectToWorldMatrix(const Transform* parent) const noexcept {
+		const auto parent_version
+			= (nullptr != parent) ? parent->m_object_to_world_version : 0u;
 
-			Assert(HasOwner());
-			const auto parent = m_owner->GetParent();
+		if (!m_dirty && m_parent_version == parent_version) {
+			return;
+		}
 
-			if (nullptr != parent) {
-				m_object_to_world = GetObjectToParentMatrix()
-					              * parent->GetTransform().GetObjectToWorldMatrix();
-			}
-			else {
-				m_object_to_world = GetObjectToParentMatrix();
-			}
+		if (nullptr != parent) {
+			m_object_to_world = GetObjectToParentMatrix()
+				              * parent->m_object_to_world;
+		}
+		else {
+			m_object_to_world = GetObjectToParentMatrix();
 		}
+
+		m_object_to_world_version = GetNextVersion();
+		m_parent_version          = parent_version;
+		m_dirty                   = false;
 	}
 
-	void Transform::UpdateWorldToObjectMatrix() const noexcept {
-		if (m_dirty_world_to_object) {
-			m_dirty_world_to_object = false;
+	void Transform::UpdateWorldMatrices() const noexcept {
+		// The world-to-object matrix must match the object-to-world matrix.
+		if (IsValidated()
+			&& m_world_to_object_version == m_object_to_world_version) {
+			return;
+		}
 
-			Assert(HasOwner());
-			const auto parent = m_owner->GetParent();
+		Assert(HasOwner());
+		const auto parent = m_owner->GetParent();
 
-			if (nullptr != parent) {
-				m_world_to_object = parent->GetTransform().GetWorldToObjectMatrix()
-					              * GetParentToObjectMatrix();
-			}
-			else {
-				m_world_to_object = GetParentToObjectMatrix();
-			}
+		if (nullptr != parent) {
+			const auto& parent_transform = parent->GetTransform();
+			parent_transform.UpdateWorldMatrices();
+			UpdateObjectToWorldMatrix(&parent_transform);
+			UpdateWorldToObjectMatrix(&parent_transform);
 		}
+		else {
+			UpdateObjectToWorldMatrix(nullptr);
+			UpdateWorldToObjectMatrix(nullptr);
+		}
+
+		m_epoch = s_epoch;
+	}
+
+	void Transform::UpdateWorldToObjectMatrix(const Transform* parent) const noexcept {
+		if (m_world_to_object_version == m_object_to_world_version) {
+			return;
+		}
+
+		if (nullptr != parent) {
+			m_world_to_object = parent->m_world_to_object
+				              * GetParentToObjectMatrix();
+		}
+		else {
+			m_world_to_object = GetParentToObjectMatrix();
+		}
+
+		m_world_to_object_version = m_object_to_world_version;
 	}
 }
\ No newline at end of file
@@ -5,7 +5,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "transform\transform.hpp"
+#include "scene\transform_hierarchy.hpp"
 
 #pragma endregion
 
@@ -40,9 +40,14 @@ namespace mage {
 			: m_transform(),
 			m_object_to_world(),
 			m_world_to_object(),
-			m_dirty_object_to_world(true),
-			m_dirty_world_to_object(true),
-			m_owner() {}
+			m_object_to_world_version(0u),
+			m_parent_version(0u),
+			m_world_to_object_version(0u),
+			m_epoch(0u),
+			m_dirty(true),
+			m_owner(),
+			m_hierarchy(nullptr),
+			m_hierarchy_index(TransformHierarchy::s_invalid_index) {}
 
 		/**
 		 Constructs a transform from the given transform.
@@ -54,9 +59,14 @@ namespace mage {
 			: m_transform(transform.m_transform),
 			m_object_to_world(),
 			m_world_to_object(),
-			m_dirty_object_to_world(true),
-			m_dirty_world_to_object(true),
-			m_owner() {}
+			m_object_to_world_version(0u),
+			m_parent_version(0u),
+			m_world_to_object_version(0u),
+			m_epoch(0u),
+			m_dirty(true),
+			m_owner(),
+			m_hierarchy(nullptr),
+			m_hierarchy_index(TransformHierarchy::s_invalid_index) {}
 
 		/**
 		 Constructs a transform by moving the given transform.
@@ -97,12 +107,7 @@ namespace mage {
 		 @return		A reference to the copy of the given transform (i.e.
 						this transform).
 		 */
-		Transform& operator=(Transform&& transform) noexcept {
-			m_transform = std::move(transform.m_transform);
-			m_owner     = std::move(transform.m_owner);
-			SetDirty();
-			return *this;
-		}
+		Transform& operator=(Transform&& transform) noexcept = default;
 
 		//---------------------------------------------------------------------
 		// Member Methods: Translation
@@ -1199,10 +1204,24 @@ namespace mage {
 		 */
 		[[nodiscard]]
 		const XMMATRIX XM_CALLCONV GetWorldToObjectMatrix() const noexcept {
-			UpdateWorldToObjectMatrix();
+			UpdateWorldMatrices();
 			return m_world_to_object;
 		}
 
+		/**
+		 Returns the version of the object-to-world matrix of this transform.
+		 The version changes each time the object-to-world matrix of this
+		 transform is recomputed.
+
+		 @return		The version of the object-to-world matrix of this
+						transform.
+		 */
+		[[nodiscard]]
+		U64 GetObjectToWorldVersion() const noexcept {
+			UpdateObjectToWorldMatrix();
+			return m_object_to_world_version;
+		}
+
 		/**
 		 Transforms the given vector expressed in object space coordinates
 		 to parent space coordinates.
@@ -1442,8 +1461,29 @@ namespace mage {
 
 		/**
 		 Sets this transform to dirty.
+
+		 Only this transform is marked. The transforms of the descendants
+		 detect the change lazily through the version of the object-to-world
+		 matrix of this transform.
 		 */
-		void SetDirty() const noexcept;
+		void SetDirty() const noexcept {
+			m_dirty = true;
+			++s_epoch;
+
+			if (nullptr != m_hierarchy) {
+				m_hierarchy->SetLocalTransform(m_hierarchy_index, m_transform);
+			}
+		}
+
+		/**
+		 Updates the object-to-world and world-to-object matrices of this
+		 transform if stale.
+
+		 @pre			This transform must have an owner.
+		 */
+		void Update() const noexcept {
+			UpdateWorldMatrices();
+		}
 
 		#pragma endregion
 
@@ -1472,21 +1512,160 @@ namespace mage {
 		}
 
 		/**
-		 Updates the object-to-world matrix of this transform if dirty.
+		 Registers this transform as the entry with the given index in the
+		 given transform hierarchy.
+
+		 @param[in,out]	hierarchy
+						A reference to the transform hierarchy.
+		 @param[in]		index
+						The index of the entry.
+		 */
+		void SetHierarchy(TransformHierarchy& hierarchy, U32 index) {
+			hierarchy.Register(index);
+
+			m_hierarchy       = &hierarchy;
+			m_hierarchy_index = index;
+			SetDirty();
+		}
+
+		/**
+		 Sets the transform hierarchy containing this transform to the given
+		 transform hierarchy without changing the index of this transform.
+
+		 @pre			The given transform hierarchy must be the result of
+						moving the transform hierarchy containing this
+						transform.
+		 @param[in,out]	hierarchy
+						A reference to the transform hierarchy.
+		 */
+		void SetHierarchy(TransformHierarchy& hierarchy) noexcept {
+			m_hierarchy = &hierarchy;
+		}
+
+		/**
+		 Sets the parent of this transform to the given transform.
+
+		 @param[in]		parent
+						A pointer to the transform of the new parent of the
+						owner of this transform (or @c nullptr if the owner has
+						no parent).
+		 */
+		void SetParent(const Transform* parent) noexcept {
+			if (nullptr != m_hierarchy) {
+				const auto parent_index
+					= (nullptr != parent && m_hierarchy == parent->m_hierarchy)
+					? parent->m_hierarchy_index
+					: TransformHierarchy::s_invalid_index;
+				m_hierarchy->SetParent(m_hierarchy_index, parent_index);
+			}
+
+			SetDirty();
+		}
+
+		/**
+		 Sets the cached world matrices of this transform to the given
+		 matrices computed by the transform hierarchy of this transform.
+
+		 @pre			The world matrices of the given parent transform must
+						be up-to-date.
+		 @param[in]		parent
+						A pointer to the transform of the parent of the owner
+						of this transform (or @c nullptr if the owner has no
+						parent).
+		 @param[in]		object_to_world
+						A reference to the object-to-world matrix.
+		 @param[in]		world_to_object
+						A reference to the world-to-object matrix.
+		 */
+		void Synchronize(const Transform* parent,
+						 const XMMATRIX& object_to_world,
+						 const XMMATRIX& world_to_object) const noexcept;
+
+		/**
+		 Marks all transforms of the given transform hierarchy as up-to-date
+		 (i.e. validated at the current transform epoch).
+
+		 Clean transforms are then neither walked nor written by the world
+		 matrix getters until the next transform is set to dirty, which
+		 allows to read them concurrently.
+
+		 @pre			All dirty entries of the given transform hierarchy
+						must be synchronized with their transforms.
+		 @param[in,out]	hierarchy
+						A reference to the transform hierarchy.
+		 */
+		static void Validate(TransformHierarchy& hierarchy) noexcept;
+
+		/**
+		 Checks whether the cached world matrices of this transform are
+		 validated at the current transform epoch.
+
+		 @return		@c true if the cached world matrices of this
+						transform are validated at the current transform
+						epoch. @c false otherwise.
+		 */
+		[[nodiscard]]
+		bool IsValidated() const noexcept;
+
+		/**
+		 Updates the object-to-world matrix of this transform if stale.
+
+		 The object-to-world matrices of the ancestors are updated first.
 
 		 @pre			This transform must have an owner.
 		 */
 		void UpdateObjectToWorldMatrix() const noexcept;
 
 		/**
-		 Updates the world-to-object matrix of this transform if dirty.
+		 Updates the object-to-world matrix of this transform if stale.
+
+		 @pre			The object-to-world matrix of the given parent
+						transform must be up-to-date.
+		 @param[in]		parent
+						A pointer to the transform of the parent of the owner
+						of this transform (or @c nullptr if the owner has no
+						parent).
+		 */
+		void UpdateObjectToWorldMatrix(const Transform* parent) const noexcept;
+
+		/**
+		 Updates the object-to-world and world-to-object matrices of this
+		 transform if stale.
+
+		 The ancestors are walked once and updated top-down: the
+		 object-to-world and world-to-object matrices of each ancestor are
+		 updated before those of its child.
 
 		 @pre			This transform must have an owner.
 		 */
-		void UpdateWorldToObjectMatrix() const noexcept;
+		void UpdateWorldMatrices() const noexcept;
+
+		/**
+		 Updates the world-to-object matrix of this transform if stale.
+
+		 @pre			The object-to-world matrix of this transform must be
+						up-to-date.
+		 @pre			The world-to-object matrix of the given parent
+						transform must be up-to-date.
+		 @param[in]		parent
+						A pointer to the transform of the parent of the owner
+						of this transform (or @c nullptr if the owner has no
+						parent).
+		 */
+		void UpdateWorldToObjectMatrix(const Transform* parent) const noexcept;
 
 		#pragma endregion
 
+		//---------------------------------------------------------------------
+		// Class Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The transform epoch. The epoch changes each time a transform is set
+		 to dirty.
+		 */
+		static U64 s_epoch;
+
 		//---------------------------------------------------------------------
 		// Member Variables
 		//---------------------------------------------------------------------
@@ -1507,21 +1686,55 @@ namespace mage {
 		mutable XMMATRIX m_world_to_object;
 
 		/**
-		 A flag indicating whether the object-to-world matrix of this transform
-		 is dirty.
+		 The version of the cached object-to-world matrix of this transform.
+		 A version of zero denotes a matrix which has never been computed.
+		 Each recomputation obtains a new, globally unique version.
+		 */
+		mutable U64 m_object_to_world_version;
+
+		/**
+		 The version of the object-to-world matrix of the parent transform
+		 used for computing the cached object-to-world matrix of this
+		 transform.
+		 */
+		mutable U64 m_parent_version;
+
+		/**
+		 The version of the object-to-world matrix of this transform for
+		 which the cached world-to-object matrix of this transform is
+		 computed.
 		 */
-		mutable bool m_dirty_object_to_world;
+		mutable U64 m_world_to_object_version;
 
 		/**
-		 A flag indicating whether the world-to-object matrix of this transform
-		 is dirty.
+		 The transform epoch at which the cached object-to-world matrix of
+		 this transform was last validated. No transform changed since then
+		 if this epoch equals the current transform epoch.
 		 */
-		mutable bool m_dirty_world_to_object;
+		mutable U64 m_epoch;
+
+		/**
+		 A flag indicating whether the local transform of this transform
+		 changed since the last update of the object-to-world matrix of this
+		 transform.
+		 */
+		mutable bool m_dirty;
 
 		/**
 		 A pointer to the node owning this transform.
 		 */
 		ProxyPtr< Node > m_owner;
+
+		/**
+		 A pointer to the transform hierarchy containing this transform.
+		 */
+		TransformHierarchy* m_hierarchy;
+
+		/**
+		 The index of this transform in the transform hierarchy containing
+		 this transform.
+		 */
+		U32 m_hierarchy_index;
 	};
 
 	#pragma endregion
@@ -1543,6 +1756,7 @@ namespace mage {
 		//---------------------------------------------------------------------
 
 		friend class Node;
+		friend class Scene;
 
 		//---------------------------------------------------------------------
 		// Static Member Methods
@@ -1561,6 +1775,86 @@ namespace mage {
 
 			transform.SetOwner(std::move(owner));
 		}
+
+		/**
+		 Registers the given transform as the entry with the given index in
+		 the given transform hierarchy.
+
+		 @param[in,out]	transform
+						A reference to the transform.
+		 @param[in,out]	hierarchy
+						A reference to the transform hierarchy.
+		 @param[in]		index
+						The index of the entry.
+		 */
+		static void Register(Transform& transform,
+							 TransformHierarchy& hierarchy,
+							 U32 index) {
+
+			transform.SetHierarchy(hierarchy, index);
+		}
+
+		/**
+		 Sets the transform hierarchy containing the given transform to the
+		 given transform hierarchy (i.e. after the latter has been moved).
+
+		 @param[in,out]	transform
+						A reference to the transform.
+		 @param[in,out]	hierarchy
+						A reference to the transform hierarchy.
+		 */
+		static void Rebind(Transform& transform,
+						   TransformHierarchy& hierarchy) noexcept {
+
+			transform.SetHierarchy(hierarchy);
+		}
+
+		/**
+		 Sets the parent of the given transform to the given transform.
+
+		 @param[in,out]	transform
+						A reference to the transform.
+		 @param[in]		parent
+						A pointer to the parent transform (or @c nullptr).
+		 */
+		static void SetParent(Transform& transform,
+							  const Transform* parent) noexcept {
+
+			transform.SetParent(parent);
+		}
+
+		/**
+		 Sets the cached world matrices of the given transform to the given
+		 matrices.
+
+		 @param[in]		transform
+						A reference to the transform.
+		 @param[in]		parent
+						A pointer to the parent transform (or @c nullptr).
+		 @param[in]		object_to_world
+						A reference to the object-to-world matrix.
+		 @param[in]		world_to_object
+						A reference to the world-to-object matrix.
+		 */
+		static void Synchronize(const Transform& transform,
+								const Transform* parent,
+								const XMMATRIX& object_to_world,
+								const XMMATRIX& world_to_object) noexcept {
+
+			transform.Synchronize(parent, object_to_world, world_to_object);
+		}
+
+		/**
+		 Marks all transforms of the given transform hierarchy as up-to-date.
+
+		 @pre			All dirty entries of the given transform hierarchy
+						must be synchronized with their transforms.
+		 @param[in,out]	hierarchy
+						A reference to the transform hierarchy.
+		 */
+		static void Validate(TransformHierarchy& hierarchy) noexcept {
+			Transform::Validate(hierarchy);
+		}
 	};
 
 	#pragma endregion
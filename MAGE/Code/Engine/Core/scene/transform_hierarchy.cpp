@@ -0,0 +1,238 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "scene\transform_hierarchy.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	namespace {
+
+		/**
+		 Permutes the given elements.
+
+		 @tparam		VectorT
+						The vector type.
+		 @param[in,out]	elements
+						A reference to the vector containing the elements.
+		 @param[in]		positions
+						A reference to the vector containing the new position
+						of each element.
+		 */
+		template< typename VectorT >
+		void Permute(VectorT& elements, const std::vector< U32 >& positions) {
+			using std::size;
+
+			VectorT permuted(size(elements));
+			for (std::size_t i = 0u; i < size(elements); ++i) {
+				permuted[positions[i]] = std::move(elements[i]);
+			}
+
+			elements.swap(permuted);
+		}
+	}
+
+	TransformHierarchy::TransformHierarchy()
+		: m_translations(),
+		m_rotations(),
+		m_scales(),
+		m_object_to_world(),
+		m_world_to_object(),
+		m_parents(),
+		m_dirty(),
+		m_indices(),
+		m_dense_indices(),
+		m_sorted(true),
+		m_epoch(0u) {}
+
+	TransformHierarchy::TransformHierarchy(
+		TransformHierarchy&& hierarchy) noexcept = default;
+
+	TransformHierarchy::~TransformHierarchy() = default;
+
+	TransformHierarchy& TransformHierarchy
+		::operator=(TransformHierarchy&& hierarchy) noexcept = default;
+
+	void TransformHierarchy::Register(U32 index) {
+		if (index < size()) {
+			const auto dense = m_dense_indices[index];
+			m_translations[dense] = F32x3(0.0f, 0.0f, 0.0f);
+			m_rotations[dense]    = F32x3(0.0f, 0.0f, 0.0f);
+			m_scales[dense]       = F32x3(1.0f, 1.0f, 1.0f);
+			m_parents[dense]      = s_invalid_index;
+			m_dirty[dense]        = 1u;
+			return;
+		}
+
+		while (size() <= index) {
+			const auto dense = static_cast< U32 >(size());
+
+			m_translations.emplace_back(0.0f, 0.0f, 0.0f);
+			m_rotations.emplace_back(0.0f, 0.0f, 0.0f);
+			m_scales.emplace_back(1.0f, 1.0f, 1.0f);
+			m_object_to_world.push_back(XMMatrixIdentity());
+			m_world_to_object.push_back(XMMatrixIdentity());
+			m_parents.push_back(s_invalid_index);
+			m_dirty.push_back(1u);
+			m_indices.push_back(dense);
+			m_dense_indices.push_back(dense);
+		}
+	}
+
+	void TransformHierarchy::Unregister(U32 index) noexcept {
+		const auto dense = m_dense_indices[index];
+
+		// A clean root entry is never reported by Update.
+		m_parents[dense] = s_invalid_index;
+		m_dirty[dense]   = 0u;
+	}
+
+	void TransformHierarchy::SetParent(U32 index, U32 parent_index) noexcept {
+		const auto dense  = m_dense_indices[index];
+		const auto parent = (s_invalid_index != parent_index)
+			              ? m_dense_indices[parent_index] : s_invalid_index;
+
+		m_parents[dense] = parent;
+		m_dirty[dense]   = 1u;
+
+		// Parents must precede their childs.
+		if (s_invalid_index != parent && dense < parent) {
+			m_sorted = false;
+		}
+	}
+
+	void TransformHierarchy::SetLocalTransform(U32 index,
+		                                       const SETTransform3D& transform) noexcept {
+
+		const auto dense = m_dense_indices[index];
+
+		m_translations[dense] = transform.GetTranslationView();
+		m_rotations[dense]    = transform.GetRotationView();
+		m_scales[dense]       = transform.GetScaleView();
+		m_dirty[dense]        = 1u;
+	}
+
+	void TransformHierarchy::Clear() noexcept {
+		m_translations.clear();
+		m_rotations.clear();
+		m_scales.clear();
+		m_object_to_world.clear();
+		m_world_to_object.clear();
+		m_parents.clear();
+		m_dirty.clear();
+		m_indices.clear();
+		m_dense_indices.clear();
+		m_sorted = true;
+		m_epoch  = 0u;
+	}
+
+	void TransformHierarchy::Sort() {
+		const auto count = size();
+
+		// Compute the depth of each entry. Each path is walked up to the
+		// first ancestor with a known depth only.
+		std::vector< U32 > depths(count, s_invalid_index);
+		std::vector< U32 > path;
+		U32 max_depth = 0u;
+		for (std::size_t i = 0u; i < count; ++i) {
+			auto j = static_cast< U32 >(i);
+			while (s_invalid_index == depths[j]) {
+				const auto parent = m_parents[j];
+				if (s_invalid_index == parent) {
+					depths[j] = 0u;
+					break;
+				}
+
+				path.push_back(j);
+				j = parent;
+			}
+
+			auto depth = depths[j];
+			while (!path.empty()) {
+				depths[path.back()] = ++depth;
+				path.pop_back();
+			}
+
+			max_depth = std::max(max_depth, depth);
+		}
+
+		// Stable counting sort of the entries by depth.
+		std::vector< U32 > offsets(max_depth + 2u, 0u);
+		for (const auto depth : depths) {
+			++offsets[depth + 1u];
+		}
+		for (std::size_t depth = 1u; depth < offsets.size(); ++depth) {
+			offsets[depth] += offsets[depth - 1u];
+		}
+
+		std::vector< U32 > positions(count);
+		for (std::size_t i = 0u; i < count; ++i) {
+			positions[i] = offsets[depths[i]]++;
+		}
+
+		// Permute the entries.
+		Permute(m_translations,    positions);
+		Permute(m_rotations,       positions);
+		Permute(m_scales,          positions);
+		Permute(m_object_to_world, positions);
+		Permute(m_world_to_object, positions);
+		Permute(m_parents,         positions);
+		Permute(m_dirty,           positions);
+		Permute(m_indices,         positions);
+
+		for (auto& parent : m_parents) {
+			if (s_invalid_index != parent) {
+				parent = positions[parent];
+			}
+		}
+
+		for (std::size_t i = 0u; i < count; ++i) {
+			m_dense_indices[m_indices[i]] = static_cast< U32 >(i);
+		}
+
+		m_sorted = true;
+	}
+
+	void TransformHierarchy::Sweep() noexcept {
+		const auto count = size();
+		for (std::size_t i = 0u; i < count; ++i) {
+			const auto parent = m_parents[i];
+
+			// Parents precede their childs: the dirty flag of the parent is
+			// final at this point.
+			if (s_invalid_index != parent) {
+				m_dirty[i] |= m_dirty[parent];
+			}
+
+			if (!m_dirty[i]) {
+				continue;
+			}
+
+			const auto scale       = XMLoad(m_scales[i]);
+			const auto rotation    = XMLoad(m_rotations[i]);
+			const auto translation = XMLoad(m_translations[i]);
+
+			// Scale . Rotation . Translation
+			const auto object_to_parent
+				= GetAffineTransformationMatrix(scale, rotation, translation);
+			// Translation . Rotation . Scale
+			const auto parent_to_object
+				= GetInverseAffineTransformationMatrix(scale, rotation, translation);
+
+			if (s_invalid_index != parent) {
+				m_object_to_world[i] = object_to_parent * m_object_to_world[parent];
+				m_world_to_object[i] = m_world_to_object[parent] * parent_to_object;
+			}
+			else {
+				m_object_to_world[i] = object_to_parent;
+				m_world_to_object[i] = parent_to_object;
+			}
+		}
+	}
+}
\ No newline at end of file
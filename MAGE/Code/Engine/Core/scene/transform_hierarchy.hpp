@@ -0,0 +1,353 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "collection\vector.hpp"
+#include "transform\transform.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	/**
+	 A class of transform hierarchies.
+
+	 A transform hierarchy stores the local transforms, the world matrices and
+	 the parent relations of a set of transforms as separate arrays (i.e. a
+	 structure of arrays). The entries are kept sorted such that each parent
+	 precedes all its childs, which allows to compute all world matrices in a
+	 single linear sweep.
+
+	 Entries are identified by stable indices which are independent of the
+	 internal order of the entries.
+	 */
+	class TransformHierarchy {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Class Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The invalid index (i.e. denoting no entry).
+		 */
+		static constexpr U32 s_invalid_index = U32(-1);
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a transform hierarchy.
+		 */
+		TransformHierarchy();
+
+		/**
+		 Constructs a transform hierarchy from the given transform hierarchy.
+
+		 @param[in]		hierarchy
+						A reference to the transform hierarchy to copy.
+		 */
+		TransformHierarchy(const TransformHierarchy& hierarchy) = delete;
+
+		/**
+		 Constructs a transform hierarchy by moving the given transform
+		 hierarchy.
+
+		 @param[in]		hierarchy
+						A reference to the transform hierarchy to move.
+		 */
+		TransformHierarchy(TransformHierarchy&& hierarchy) noexcept;
+
+		/**
+		 Destructs this transform hierarchy.
+		 */
+		~TransformHierarchy();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given transform hierarchy to this transform hierarchy.
+
+		 @param[in]		hierarchy
+						A reference to the transform hierarchy to copy.
+		 @return		A reference to the copy of the given transform
+						hierarchy (i.e. this transform hierarchy).
+		 */
+		TransformHierarchy& operator=(
+			const TransformHierarchy& hierarchy) = delete;
+
+		/**
+		 Moves the given transform hierarchy to this transform hierarchy.
+
+		 @param[in]		hierarchy
+						A reference to the transform hierarchy to move.
+		 @return		A reference to the moved transform hierarchy (i.e.
+						this transform hierarchy).
+		 */
+		TransformHierarchy& operator=(
+			TransformHierarchy&& hierarchy) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the number of entries of this transform hierarchy.
+
+		 @return		The number of entries of this transform hierarchy.
+		 */
+		[[nodiscard]]
+		std::size_t size() const noexcept {
+			using std::size;
+			return size(m_parents);
+		}
+
+		/**
+		 Registers an entry with the given index in this transform hierarchy.
+		 The entry becomes a root entry with an identity local transform.
+
+		 @param[in]		index
+						The index of the entry.
+		 */
+		void Register(U32 index);
+
+		/**
+		 Unregisters the entry with the given index from this transform
+		 hierarchy. The entry becomes a clean root entry which is no longer
+		 reported by updates until it is registered again.
+
+		 @pre			@a index must be registered.
+		 @pre			No other entry may have the given entry as parent.
+		 @param[in]		index
+						The index of the entry.
+		 */
+		void Unregister(U32 index) noexcept;
+
+		/**
+		 Sets the parent of the given entry to the given entry.
+
+		 @pre			@a index must be registered.
+		 @pre			@a parent_index must be registered or equal to
+						{@link mage::TransformHierarchy::s_invalid_index}.
+		 @param[in]		index
+						The index of the entry.
+		 @param[in]		parent_index
+						The index of the parent entry.
+		 */
+		void SetParent(U32 index, U32 parent_index) noexcept;
+
+		/**
+		 Sets the local transform of the given entry to the given transform.
+
+		 @pre			@a index must be registered.
+		 @param[in]		index
+						The index of the entry.
+		 @param[in]		transform
+						A reference to the local transform.
+		 */
+		void SetLocalTransform(U32 index,
+							   const SETTransform3D& transform) noexcept;
+
+		/**
+		 Returns the object-to-world matrix of the given entry.
+
+		 @pre			@a index must be registered.
+		 @param[in]		index
+						The index of the entry.
+		 @return		The object-to-world matrix of the given entry as
+						computed by the last update.
+		 */
+		[[nodiscard]]
+		const XMMATRIX XM_CALLCONV
+			GetObjectToWorldMatrix(U32 index) const noexcept {
+
+			return m_object_to_world[m_dense_indices[index]];
+		}
+
+		/**
+		 Returns the world-to-object matrix of the given entry.
+
+		 @pre			@a index must be registered.
+		 @param[in]		index
+						The index of the entry.
+		 @return		The world-to-object matrix of the given entry as
+						computed by the last update.
+		 */
+		[[nodiscard]]
+		const XMMATRIX XM_CALLCONV
+			GetWorldToObjectMatrix(U32 index) const noexcept {
+
+			return m_world_to_object[m_dense_indices[index]];
+		}
+
+		/**
+		 Updates the world matrices of all dirty entries of this transform
+		 hierarchy and of their descendants.
+
+		 @tparam		ActionT
+						The action type.
+		 @param[in]		action
+						A forwarding reference to an action to perform on
+						each updated entry, in parent before child order. The
+						action must accept the index of the entry, the index
+						of its parent entry, and the object-to-world and
+						world-to-object matrices of the entry.
+		 */
+		template< typename ActionT >
+		void Update(ActionT&& action);
+
+		/**
+		 Returns the epoch at which all entries of this transform hierarchy
+		 were last synchronized with their transforms.
+
+		 @return		The epoch at which all entries of this transform
+						hierarchy were last synchronized with their
+						transforms. An epoch of zero denotes a transform
+						hierarchy which has never been synchronized.
+		 */
+		[[nodiscard]]
+		U64 GetEpoch() const noexcept {
+			return m_epoch;
+		}
+
+		/**
+		 Sets the epoch at which all entries of this transform hierarchy were
+		 last synchronized with their transforms to the given epoch.
+
+		 @param[in]		epoch
+						The epoch.
+		 */
+		void SetEpoch(U64 epoch) noexcept {
+			m_epoch = epoch;
+		}
+
+		/**
+		 Clears this transform hierarchy.
+		 */
+		void Clear() noexcept;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Sorts the entries of this transform hierarchy such that each parent
+		 entry precedes its child entries.
+		 */
+		void Sort();
+
+		/**
+		 Recomputes the world matrices of all dirty entries of this transform
+		 hierarchy and of their descendants in a single linear sweep.
+		 */
+		void Sweep() noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Variables: Local Transforms
+		//---------------------------------------------------------------------
+
+		/**
+		 A vector containing the local translations of the entries of this
+		 transform hierarchy.
+		 */
+		AlignedVector< F32x3 > m_translations;
+
+		/**
+		 A vector containing the local rotations (i.e. Euler angles) of the
+		 entries of this transform hierarchy.
+		 */
+		AlignedVector< F32x3 > m_rotations;
+
+		/**
+		 A vector containing the local scales of the entries of this
+		 transform hierarchy.
+		 */
+		AlignedVector< F32x3 > m_scales;
+
+		//---------------------------------------------------------------------
+		// Member Variables: World Matrices
+		//---------------------------------------------------------------------
+
+		/**
+		 A vector containing the object-to-world matrices of the entries of
+		 this transform hierarchy.
+		 */
+		AlignedVector< XMMATRIX > m_object_to_world;
+
+		/**
+		 A vector containing the world-to-object matrices of the entries of
+		 this transform hierarchy.
+		 */
+		AlignedVector< XMMATRIX > m_world_to_object;
+
+		//---------------------------------------------------------------------
+		// Member Variables: Hierarchy
+		//---------------------------------------------------------------------
+
+		/**
+		 A vector containing the (internal) positions of the parents of the
+		 entries of this transform hierarchy.
+		 */
+		std::vector< U32 > m_parents;
+
+		/**
+		 A vector containing the dirty flags of the entries of this transform
+		 hierarchy.
+		 */
+		std::vector< U8 > m_dirty;
+
+		/**
+		 A vector mapping the (internal) positions of the entries of this
+		 transform hierarchy to their indices.
+		 */
+		std::vector< U32 > m_indices;
+
+		/**
+		 A vector mapping the indices of the entries of this transform
+		 hierarchy to their (internal) positions.
+		 */
+		std::vector< U32 > m_dense_indices;
+
+		/**
+		 A flag indicating whether each parent entry of this transform
+		 hierarchy precedes its child entries.
+		 */
+		bool m_sorted;
+
+		/**
+		 The epoch at which all entries of this transform hierarchy were last
+		 synchronized with their transforms.
+		 */
+		U64 m_epoch;
+	};
+}
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "scene\transform_hierarchy.tpp"
+
+#pragma endregion
\ No newline at end of file
@@ -0,0 +1,32 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	template< typename ActionT >
+	void TransformHierarchy::Update(ActionT&& action) {
+		if (!m_sorted) {
+			Sort();
+		}
+
+		Sweep();
+
+		const auto count = size();
+		for (std::size_t i = 0u; i < count; ++i) {
+			if (!m_dirty[i]) {
+				continue;
+			}
+
+			const auto parent = m_parents[i];
+			const auto parent_index
+				= (s_invalid_index != parent) ? m_indices[parent] : s_invalid_index;
+
+			action(m_indices[i], parent_index,
+				   m_object_to_world[i], m_world_to_object[i]);
+
+			m_dirty[i] = 0u;
+		}
+	}
+}
\ No newline at end of file
@@ -122,6 +122,7 @@ namespace mage {
 				   const rendering::DisplayConfiguration& display_config)
 		: m_window(),
 		m_message_handler(),
+		m_job_system(),
 		m_input_manager(),
 		m_rendering_manager(),
 		m_scene(),
@@ -187,11 +188,16 @@ namespace mage {
 
 		const auto window = NotNull< HWND >(m_window->GetWindow());
 
+		// Initialize the job system.
+		m_job_system = MakeUnique< JobSystem >();
+
 		// Initialize the input system.
 		m_input_manager = MakeUnique< input::Manager >(window);
 
 		// Initialize the rendering system.
-		m_rendering_manager = MakeUnique< rendering::Manager >(window, display_config);
+		m_rendering_manager = MakeUnique< rendering::Manager >(window,
+															   display_config,
+															   *m_job_system);
 		m_rendering_manager->BindPersistentState();
 
 		// Initializes the COM library for use by the calling thread and sets
@@ -212,6 +218,8 @@ namespace mage {
 		m_rendering_manager.reset();
 		// Uninitialize the input system.
 		m_input_manager.reset();
+		// Uninitialize the job system.
+		m_job_system.reset();
 		// Uninitialize the window system.
 		m_window.reset();
 	}
@@ -366,6 +374,9 @@ namespace mage {
 				continue;
 			}
 
+			// Propagate the transform changes of this frame.
+			m_scene->UpdateTransforms(*this);
+
 			m_rendering_manager->Render(m_time);
 		}
 
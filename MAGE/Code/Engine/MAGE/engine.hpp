@@ -9,6 +9,7 @@
 #include "input_manager.hpp"
 #include "rendering_manager.hpp"
 #include "ui\window.hpp"
+#include "parallel\job_system.hpp"
 
 #pragma endregion
 
@@ -221,6 +222,16 @@ namespace mage {
 		[[nodiscard]]
 		int Run(UniquePtr< Scene >&& scene, int nCmdShow = SW_NORMAL);
 
+		/**
+		 Returns the job system of this engine.
+
+		 @return		A reference to the job system of this engine.
+		 */
+		[[nodiscard]]
+		JobSystem& GetJobSystem() const noexcept {
+			return *m_job_system;
+		}
+
 		/**
 		 Returns the input manager of this engine.
 
@@ -318,6 +329,11 @@ namespace mage {
 		 */
 		EngineMessageHandler m_message_handler;
 
+		/**
+		 A pointer to the job system of this engine.
+		 */
+		UniquePtr< JobSystem > m_job_system;
+
 		/**
 		 A pointer to the input manager of this engine.
 		 */
@@ -16,13 +16,30 @@ namespace mage {
 	Scene::Scene(std::string name)
 		: m_name(std::move(name)),
 		m_nodes(),
+		m_hierarchy(),
 		m_scripts() {}
 
-	Scene::Scene(Scene&& scene) noexcept = default;
+	Scene::Scene(Scene&& scene) noexcept
+		: m_nodes(std::move(scene.m_nodes)),
+		m_hierarchy(std::move(scene.m_hierarchy)),
+		m_scripts(std::move(scene.m_scripts)),
+		m_name(std::move(scene.m_name)) {
+
+		RebindTransforms();
+	}
 
 	Scene::~Scene() = default;
 
-	Scene& Scene::operator=(Scene&& scene) noexcept = default;
+	Scene& Scene::operator=(Scene&& scene) noexcept {
+		m_nodes     = std::move(scene.m_nodes);
+		m_hierarchy = std::move(scene.m_hierarchy);
+		m_scripts   = std::move(scene.m_scripts);
+		m_name      = std::move(scene.m_name);
+
+		RebindTransforms();
+
+		return *this;
+	}
 
 	//-------------------------------------------------------------------------
 	// Scene Member Methods: Lifecycle
@@ -59,9 +76,47 @@ namespace mage {
 
 	void Scene::Clear() noexcept {
 		m_nodes.clear();
+		m_hierarchy.Clear();
 		m_scripts.clear();
 	}
 
+	//-------------------------------------------------------------------------
+	// Scene Member Methods: Transforms
+	//-------------------------------------------------------------------------
+
+	void Scene::RebindTransforms() noexcept {
+		for (auto& node : m_nodes) {
+			TransformClient::Rebind(node.GetTransform(), m_hierarchy);
+		}
+	}
+
+	void Scene::UpdateTransforms(Engine& engine) {
+		auto& world = engine.GetRenderingManager().GetWorld();
+
+		m_hierarchy.Update([this, &world](U32 index,
+										  U32 parent_index,
+										  const XMMATRIX& object_to_world,
+										  const XMMATRIX& world_to_object) {
+
+			const auto parent = (TransformHierarchy::s_invalid_index != parent_index)
+				              ? &m_nodes.at_slot(parent_index).GetTransform()
+				              : nullptr;
+
+			auto& node = m_nodes.at_slot(index);
+			TransformClient::Synchronize(node.GetTransform(),
+										 parent, object_to_world, world_to_object);
+
+			// Refit the moved models at the next model hierarchy update.
+			node.ForEach< rendering::Model >([&world](const rendering::Model& model) {
+				world.NotifyModelMoved(model);
+			});
+		});
+
+		// All transforms are up-to-date: the world matrix getters are pure
+		// reads during the parallel phases of the frame.
+		TransformClient::Validate(m_hierarchy);
+	}
+
 	//-------------------------------------------------------------------------
 	// Scene Member Methods
 	//-------------------------------------------------------------------------
@@ -103,7 +158,9 @@ namespace mage {
 						   model_part.m_start_index,
 						   model_part.m_nb_indices,
 						   model_part.m_aabb,
-						   model_part.m_sphere);
+						   model_part.m_sphere,
+						   model_part.m_index_format,
+						   model_part.m_base_vertex);
 
 			// Set the material of the model component.
 			const auto material = desc.GetMaterial(model_part.m_material);
@@ -159,4 +216,33 @@ namespace mage {
 
 		return root;
 	}
+
+	void Scene::Destroy(Engine& engine, ProxyPtr< Node > node) {
+		if (nullptr == node) {
+			return;
+		}
+
+		if (const auto parent = node->GetParent(); nullptr != parent) {
+			parent->RemoveChild(node);
+		}
+
+		// Collect the subtree. Removing a node moves another node of the slot
+		// map, so the nodes are referred to by their pointers only.
+		std::vector< ProxyPtr< Node > > nodes = { std::move(node) };
+		for (std::size_t i = 0u; i < nodes.size(); ++i) {
+			nodes[i]->ForEachChild([&nodes](const Node& child) {
+				nodes.push_back(child.Get());
+			});
+		}
+
+		auto& world = engine.GetRenderingManager().GetWorld();
+		for (const auto& subtree_node : nodes) {
+			world.Destroy(*subtree_node);
+
+			const auto index = m_nodes.handle_of(*subtree_node).m_slot;
+			m_hierarchy.Unregister(index);
+
+			RemoveElement(m_nodes, *subtree_node);
+		}
+	}
 }
\ No newline at end of file
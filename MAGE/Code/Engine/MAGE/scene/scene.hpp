@@ -90,6 +90,17 @@ namespace mage {
 								const rendering::ModelDescriptor& desc,
 								std::vector< ProxyPtr< Node > >& nodes);
 
+		/**
+		 Destroys the given node, all its descendants and all their
+		 components. Each destruction takes constant time.
+
+		 @param[in,out]	engine
+						A reference to the engine.
+		 @param[in]		node
+						A pointer to the node.
+		 */
+		void Destroy(Engine& engine, ProxyPtr< Node > node);
+
 		template< typename ElementT, typename... ConstructorArgsT >
 		typename std::enable_if_t< std::is_same_v< Node, ElementT >,
 			ProxyPtr< ElementT > > Create(ConstructorArgsT&&... args);
@@ -108,6 +119,21 @@ namespace mage {
 		template< typename ElementT, typename ActionT >
 		void ForEach(ActionT&& action) const;
 
+		//---------------------------------------------------------------------
+		// Member Methods: Transforms
+		//---------------------------------------------------------------------
+
+		/**
+		 Updates the stale world matrices of the transforms of all nodes of
+		 this scene in a single, linear parent before child sweep over the
+		 transform hierarchy of this scene. The models of the updated nodes
+		 are reported to the rendering world of the given engine.
+
+		 @param[in,out]	engine
+						A reference to the engine.
+		 */
+		void UpdateTransforms(Engine& engine);
+
 		//---------------------------------------------------------------------
 		// Member Methods: Identification
 		//---------------------------------------------------------------------
@@ -205,19 +231,36 @@ namespace mage {
 		 */
 		void Clear() noexcept;
 
+		//---------------------------------------------------------------------
+		// Member Methods: Transforms
+		//---------------------------------------------------------------------
+
+		/**
+		 Points the transforms of all nodes of this scene to the transform
+		 hierarchy of this scene. The transforms keep pointing to the moved
+		 from transform hierarchy otherwise.
+		 */
+		void RebindTransforms() noexcept;
+
 		//---------------------------------------------------------------------
 		// Member Variables: Nodes and Components
 		//---------------------------------------------------------------------
 
 		/**
-		 A vector containing the nodes of this scene.
+		 A slot map containing the nodes of this scene.
+		 */
+		SlotMap< Node > m_nodes;
+
+		/**
+		 The transform hierarchy of the nodes of this scene. The index of each
+		 entry is equal to the slot of the corresponding node.
 		 */
-		AlignedVector< Node > m_nodes;
+		TransformHierarchy m_hierarchy;
 
 		/**
-		 A vector containing the pointers to the scripts of this scene.
+		 A slot map containing the pointers to the scripts of this scene.
 		 */
-		AlignedVector< UniquePtr< BehaviorScript > > m_scripts;
+		SlotMap< UniquePtr< BehaviorScript > > m_scripts;
 
 		//---------------------------------------------------------------------
 		// Member Variables: Identification
@@ -19,6 +19,10 @@ namespace mage {
 
 		ptr->Set(ptr);
 
+		// Register the transform of the node in the transform hierarchy.
+		const auto index = m_nodes.handle_of(*ptr).m_slot;
+		TransformClient::Register(ptr->GetTransform(), m_hierarchy, index);
+
 		return ptr;
 	}
 
@@ -62,17 +66,13 @@ namespace mage {
 
 		if constexpr (std::is_same_v< Node, ElementT >) {
 			for (auto& element : m_nodes) {
-				if (State::Terminated != element.GetState()) {
-					action(element);
-				}
+				action(element);
 			}
 		}
 
 		if constexpr (std::is_same_v< BehaviorScript, ElementT >) {
 			for (auto& element : m_scripts) {
-				if (State::Terminated != element->GetState()) {
-					action(*element);
-				}
+				action(*element);
 			}
 		}
 	}
@@ -82,17 +82,13 @@ namespace mage {
 
 		if constexpr (std::is_same_v< Node, ElementT >) {
 			for (const auto& element : m_nodes) {
-				if (State::Terminated != element.GetState()) {
-					action(element);
-				}
+				action(element);
 			}
 		}
 
 		if constexpr (std::is_same_v< BehaviorScript, ElementT >) {
 			for (const auto& element : m_scripts) {
-				if (State::Terminated != element->GetState()) {
-					action(static_cast< const BehaviorScript& >(*element));
-				}
+				action(static_cast< const BehaviorScript& >(*element));
 			}
 		}
 	}
@@ -235,6 +235,20 @@ namespace mage {
 		return true;
 	}
 
+	//-------------------------------------------------------------------------
+	// Bounding Sphere: Overlapping = Partial | Full Coverage
+	//-------------------------------------------------------------------------
+
+	[[nodiscard]]
+	bool BoundingSphere::Overlaps(const AABB& aabb) const noexcept {
+		return aabb.Overlaps(*this);
+	}
+
+	[[nodiscard]]
+	bool BoundingSphere::OverlapsStrict(const AABB& aabb) const noexcept {
+		return aabb.OverlapsStrict(*this);
+	}
+
 	//-------------------------------------------------------------------------
 	// Bounding Frustum
 	//-------------------------------------------------------------------------
@@ -367,6 +367,32 @@ namespace mage {
 		// Member Methods: Overlapping = Partial | Full Coverage
 		//---------------------------------------------------------------------
 
+		/**
+		 Checks whether this bounding sphere overlaps the given AABB.
+
+		 @param[in]		aabb
+						A reference to the AABB.
+		 @return		@c true if this bounding sphere overlaps @a aabb.
+						@c false otherwise.
+		 @note			This is a (partial or full) coverage test of an AABB
+						with regard to a bounding sphere.
+		 */
+		[[nodiscard]]
+		bool Overlaps(const AABB& aabb) const noexcept;
+
+		/**
+		 Checks whether this bounding sphere strictly overlaps the given AABB.
+
+		 @param[in]		aabb
+						A reference to the AABB.
+		 @return		@c true if this bounding sphere strictly overlaps
+						@a aabb. @c false otherwise.
+		 @note			This is a (partial or full) coverage test of an AABB
+						with regard to a bounding sphere.
+		 */
+		[[nodiscard]]
+		bool OverlapsStrict(const AABB& aabb) const noexcept;
+
 		/**
 		 Checks whether this bounding sphere overlaps the given bounding
 		 sphere.
@@ -575,6 +601,31 @@ namespace mage {
 			return aabb1.OverlapsStrict(aabb2) ? AABB(p_min, p_max) : AABB();
 		}
 
+		/**
+		 Returns the AABB enclosing the given AABB transformed with the given
+		 transformation matrix.
+
+		 @pre			@a transform is an affine transformation matrix.
+		 @param[in]		aabb
+						A reference to the AABB.
+		 @param[in]		transform
+						The transformation matrix.
+		 @return		The AABB enclosing @a aabb transformed with
+						@a transform.
+		 */
+		[[nodiscard]]
+		static const AABB XM_CALLCONV Transform(const AABB& aabb,
+												FXMMATRIX transform) noexcept {
+
+			const auto centroid = XMVector3TransformCoord(aabb.Centroid(),
+														  transform);
+			const auto r        = aabb.Radius();
+			const auto radius   = XMVectorAbs(transform.r[0]) * XMVectorSplatX(r)
+				                + XMVectorAbs(transform.r[1]) * XMVectorSplatY(r)
+				                + XMVectorAbs(transform.r[2]) * XMVectorSplatZ(r);
+			return AABB(centroid - radius, centroid + radius);
+		}
+
 		/**
 		 Returns the minimum AABB (i.e. the AABB that is variant for union
 		 operations).
@@ -1403,6 +1454,25 @@ namespace mage {
 			return !(*this == frustum);
 		}
 
+		//---------------------------------------------------------------------
+		// Member Methods: Planes
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the plane with the given index of this bounding frustum.
+
+		 @pre			@a index is smaller than 6.
+		 @param[in]		index
+						The index of the plane (i.e. left, right, bottom, top,
+						near and far).
+		 @return		The (inward facing, normalized) plane with index
+						@a index of this bounding frustum.
+		 */
+		[[nodiscard]]
+		const XMVECTOR XM_CALLCONV GetPlane(std::size_t index) const noexcept {
+			return m_planes[index];
+		}
+
 	private:
 
 		//---------------------------------------------------------------------
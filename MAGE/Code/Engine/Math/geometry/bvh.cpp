@@ -0,0 +1,340 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "geometry\bvh.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	namespace {
+
+		/**
+		 Returns the half surface area of the given AABB.
+
+		 @param[in]		aabb
+						A reference to the AABB.
+		 @return		The half surface area of @a aabb.
+		 */
+		[[nodiscard]]
+		F32 GetHalfSurfaceArea(const AABB& aabb) noexcept {
+			const auto d = XMVectorMax(aabb.Diagonal(), XMVectorZero());
+			const auto x = XMVectorGetX(d);
+			const auto y = XMVectorGetY(d);
+			const auto z = XMVectorGetZ(d);
+			return x * y + y * z + z * x;
+		}
+
+		/**
+		 A struct of SAH bins.
+		 */
+		struct Bin {
+
+		public:
+
+			/**
+			 The AABB of the primitives of this bin.
+			 */
+			AABB m_aabb;
+
+			/**
+			 The number of primitives of this bin.
+			 */
+			std::size_t m_count = 0u;
+		};
+	}
+
+	BVH::BVH() noexcept
+		: m_aabbs(),
+		m_nodes(),
+		m_indices(),
+		m_leaves(),
+		m_dirty_nodes(),
+		m_dirty(false),
+		m_build_cost(0.0f),
+		m_cost(0.0f) {}
+
+	BVH::BVH(const BVH& bvh) = default;
+
+	BVH::BVH(BVH&& bvh) noexcept = default;
+
+	BVH::~BVH() = default;
+
+	BVH& BVH::operator=(const BVH& bvh) = default;
+
+	BVH& BVH::operator=(BVH&& bvh) noexcept = default;
+
+	void BVH::Build(gsl::span< const AABB > aabbs) {
+		m_aabbs.assign(aabbs.begin(), aabbs.end());
+
+		Rebuild();
+	}
+
+	void BVH::Rebuild() {
+		const auto nb_primitives = m_aabbs.size();
+
+		m_nodes.clear();
+		m_indices.resize(nb_primitives);
+		std::iota(m_indices.begin(), m_indices.end(), 0u);
+		m_leaves.resize(nb_primitives);
+		m_dirty       = false;
+		m_build_cost  = 0.0f;
+		m_cost        = 0.0f;
+
+		if (0u == nb_primitives) {
+			m_dirty_nodes.clear();
+			return;
+		}
+
+		std::vector< F32x3 > centroids;
+		centroids.reserve(nb_primitives);
+		for (const auto& aabb : m_aabbs) {
+			centroids.push_back(XMStore< F32x3 >(aabb.Centroid()));
+		}
+
+		m_nodes.reserve(2u * nb_primitives - 1u);
+		m_nodes.push_back({ AABB(), 0u, static_cast< U32 >(nb_primitives), 0u, 0u });
+		BuildNode(0u, centroids, 0u);
+
+		m_dirty_nodes.assign(m_nodes.size(), 0u);
+
+		m_build_cost = ComputeCost();
+		m_cost       = m_build_cost;
+	}
+
+	void BVH::BuildNode(std::size_t node, gsl::span< const F32x3 > centroids,
+						std::size_t depth) {
+
+		const auto first = m_nodes[node].m_first;
+		const auto count = m_nodes[node].m_count;
+		const auto begin = m_indices.begin() + first;
+		const auto end   = begin + count;
+
+		AABB aabb;
+		AABB centroid_aabb;
+		for (auto it = begin; it != end; ++it) {
+			aabb          = AABB::Union(aabb, m_aabbs[*it]);
+			centroid_aabb = AABB::Union(centroid_aabb, XMLoad(centroids[*it]));
+		}
+		m_nodes[node].m_aabb = aabb;
+
+		const auto make_leaf = [this, node, begin, end]() noexcept {
+			for (auto it = begin; it != end; ++it) {
+				m_leaves[*it] = static_cast< U32 >(node);
+			}
+		};
+
+		if (count <= s_max_leaf_size) {
+			make_leaf();
+			return;
+		}
+
+		// Nodes close to the maximum depth are split at the median.
+		const auto use_sah = (depth + s_nb_median_levels < s_max_depth);
+
+		// Evaluate the SAH for the bin boundaries along each axis.
+		const auto c_min = XMStore< F32x3 >(centroid_aabb.MinPoint());
+		const auto c_max = XMStore< F32x3 >(centroid_aabb.MaxPoint());
+
+		auto best_cost  = static_cast< F32 >(count);
+		auto best_axis  = std::size_t(3u);
+		auto best_split = std::size_t(0u);
+
+		const auto get_bin = [&c_min, &c_max](const F32x3& centroid,
+											  std::size_t axis) noexcept {
+			const auto extent = c_max[axis] - c_min[axis];
+			const auto t      = (centroid[axis] - c_min[axis]) / extent;
+			return std::min(static_cast< std::size_t >(t * s_nb_bins),
+							s_nb_bins - 1u);
+		};
+
+		const auto inv_area = 1.0f / std::max(GetHalfSurfaceArea(aabb),
+											  std::numeric_limits< F32 >::min());
+		for (std::size_t axis = 0u; use_sah && axis < 3u; ++axis) {
+			if (c_max[axis] <= c_min[axis]) {
+				continue;
+			}
+
+			Bin bins[s_nb_bins];
+			for (auto it = begin; it != end; ++it) {
+				auto& bin = bins[get_bin(centroids[*it], axis)];
+				bin.m_aabb = AABB::Union(bin.m_aabb, m_aabbs[*it]);
+				++bin.m_count;
+			}
+
+			// Sweep from the right to obtain the costs of the right parts.
+			F32 right_costs[s_nb_bins];
+			AABB right_aabb;
+			std::size_t right_count = 0u;
+			for (auto i = s_nb_bins - 1u; 0u < i; --i) {
+				right_aabb   = AABB::Union(right_aabb, bins[i].m_aabb);
+				right_count += bins[i].m_count;
+				right_costs[i] = GetHalfSurfaceArea(right_aabb)
+					           * static_cast< F32 >(right_count);
+			}
+
+			// Sweep from the left to evaluate each split.
+			AABB left_aabb;
+			std::size_t left_count = 0u;
+			for (std::size_t i = 0u; i < s_nb_bins - 1u; ++i) {
+				left_aabb   = AABB::Union(left_aabb, bins[i].m_aabb);
+				left_count += bins[i].m_count;
+				if (0u == left_count || count == left_count) {
+					continue;
+				}
+
+				const auto cost = 1.0f + inv_area
+					* (GetHalfSurfaceArea(left_aabb) * static_cast< F32 >(left_count)
+					   + right_costs[i + 1u]);
+				if (cost < best_cost) {
+					best_cost  = cost;
+					best_axis  = axis;
+					best_split = i;
+				}
+			}
+		}
+
+		// Split large nodes along the largest centroid extent, even if the
+		// SAH prefers a leaf node.
+		if (3u == best_axis) {
+			std::size_t axis = 0u;
+			for (std::size_t i = 1u; i < 3u; ++i) {
+				if (c_max[axis] - c_min[axis] < c_max[i] - c_min[i]) {
+					axis = i;
+				}
+			}
+
+			if (c_max[axis] <= c_min[axis]) {
+				// All centroids coincide.
+				make_leaf();
+				return;
+			}
+
+			best_axis  = axis;
+			best_split = s_nb_bins / 2u - 1u;
+		}
+
+		auto left_count = U32(0u);
+		if (use_sah) {
+			const auto middle = std::partition(begin, end,
+				[&centroids, &get_bin, best_axis, best_split](U32 primitive) noexcept {
+					return get_bin(centroids[primitive], best_axis) <= best_split;
+				});
+			left_count = static_cast< U32 >(middle - begin);
+		}
+
+		if (0u == left_count || count == left_count) {
+			// Fall back to a median split (e.g., for clustered centroids or
+			// close to the maximum depth).
+			left_count = count / 2u;
+			std::nth_element(begin, begin + left_count, end,
+				[&centroids, best_axis](U32 lhs, U32 rhs) noexcept {
+					return centroids[lhs][best_axis] < centroids[rhs][best_axis];
+				});
+		}
+
+		const auto left = static_cast< U32 >(m_nodes.size());
+		m_nodes[node].m_left = left;
+		m_nodes.push_back({ AABB(), first, left_count,
+							0u, static_cast< U32 >(node) });
+		m_nodes.push_back({ AABB(), first + left_count, count - left_count,
+							0u, static_cast< U32 >(node) });
+
+		BuildNode(left,      centroids, depth + 1u);
+		BuildNode(left + 1u, centroids, depth + 1u);
+	}
+
+	void BVH::Update(std::size_t primitive, const AABB& aabb) noexcept {
+		m_aabbs[primitive] = aabb;
+
+		// Mark the path to the root node as dirty.
+		auto node = static_cast< std::size_t >(m_leaves[primitive]);
+		while (0u == m_dirty_nodes[node]) {
+			m_dirty_nodes[node] = 1u;
+			if (0u == node) {
+				break;
+			}
+
+			node = m_nodes[node].m_parent;
+		}
+
+		m_dirty = true;
+	}
+
+	void BVH::Refit() noexcept {
+		if (!m_dirty) {
+			return;
+		}
+
+		// Child nodes are stored after their parent node.
+		for (auto i = m_nodes.size(); 0u < i--; ) {
+			if (0u == m_dirty_nodes[i]) {
+				continue;
+			}
+
+			auto& node = m_nodes[i];
+			if (0u != node.m_left) {
+				node.m_aabb = AABB::Union(m_nodes[node.m_left].m_aabb,
+										  m_nodes[node.m_left + 1u].m_aabb);
+			}
+			else {
+				AABB aabb;
+				const auto first = m_indices.cbegin() + node.m_first;
+				const auto last  = first + node.m_count;
+				for (auto it = first; it != last; ++it) {
+					aabb = AABB::Union(aabb, m_aabbs[*it]);
+				}
+				node.m_aabb = aabb;
+			}
+
+			m_dirty_nodes[i] = 0u;
+		}
+
+		m_dirty = false;
+		m_cost  = ComputeCost();
+	}
+
+	void BVH::Clear() noexcept {
+		m_aabbs.clear();
+		m_nodes.clear();
+		m_indices.clear();
+		m_leaves.clear();
+		m_dirty_nodes.clear();
+		m_dirty      = false;
+		m_build_cost = 0.0f;
+		m_cost       = 0.0f;
+	}
+
+	[[nodiscard]]
+	F32 BVH::ComputeCost() const noexcept {
+		if (m_nodes.empty()) {
+			return 0.0f;
+		}
+
+		F32 cost = 0.0f;
+		for (const auto& node : m_nodes) {
+			const auto area = GetHalfSurfaceArea(node.m_aabb);
+			cost += (0u != node.m_left) ? area
+				                        : area * static_cast< F32 >(node.m_count);
+		}
+
+		const auto root_area = GetHalfSurfaceArea(m_nodes[0u].m_aabb);
+		return cost / std::max(root_area, std::numeric_limits< F32 >::min());
+	}
+}
\ No newline at end of file
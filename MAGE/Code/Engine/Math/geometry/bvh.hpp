@@ -0,0 +1,448 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "geometry\bounding_volume.hpp"
+#include "collection\vector.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <gsl\span>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	/**
+	 A class of Bounding Volume Hierarchies (BVHs) of AABBs.
+
+	 A BVH is built top-down with the Surface Area Heuristic (SAH). Moving
+	 primitives are handled by refitting the AABBs of the nodes bottom-up,
+	 which preserves the topology of the BVH. Once the quality of the
+	 refitted BVH degrades too much, the BVH should be rebuilt.
+
+	 The primitives of each subtree occupy a contiguous range, so subtrees
+	 which are completely enclosed by a query bounding volume are reported
+	 without further tests.
+	 */
+	class BVH {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Class Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The maximum number of primitives per leaf node of BVHs (unless the
+		 primitives cannot be split).
+		 */
+		static constexpr std::size_t s_max_leaf_size = 4u;
+
+		/**
+		 The number of bins used for evaluating the SAH while building BVHs.
+		 */
+		static constexpr std::size_t s_nb_bins = 16u;
+
+		/**
+		 The maximum depth of the nodes of BVHs. Nodes close to this depth are
+		 split at the median instead of with the SAH, which halves the number
+		 of primitives per level and thus bounds the depth (and the traversal
+		 stack) regardless of the distribution of the primitives.
+		 */
+		static constexpr std::size_t s_max_depth = 64u;
+
+		/**
+		 The number of levels above the maximum depth of BVHs below which
+		 nodes are split at the median (i.e. enough levels to split any
+		 number of primitives into leaf nodes).
+		 */
+		static constexpr std::size_t s_nb_median_levels = 32u;
+
+		/**
+		 The factor by which the SAH cost of a refitted BVH may exceed the SAH
+		 cost of the originally built BVH before a rebuild is needed.
+		 */
+		static constexpr F32 s_rebuild_factor = 1.5f;
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a BVH.
+		 */
+		BVH() noexcept;
+
+		/**
+		 Constructs a BVH from the given BVH.
+
+		 @param[in]		bvh
+						A reference to the BVH to copy.
+		 */
+		BVH(const BVH& bvh);
+
+		/**
+		 Constructs a BVH by moving the given BVH.
+
+		 @param[in]		bvh
+						A reference to the BVH to move.
+		 */
+		BVH(BVH&& bvh) noexcept;
+
+		/**
+		 Destructs this BVH.
+		 */
+		~BVH();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given BVH to this BVH.
+
+		 @param[in]		bvh
+						A reference to the BVH to copy.
+		 @return		A reference to the copy of the given BVH (i.e. this
+						BVH).
+		 */
+		BVH& operator=(const BVH& bvh);
+
+		/**
+		 Moves the given BVH to this BVH.
+
+		 @param[in]		bvh
+						A reference to the BVH to move.
+		 @return		A reference to the moved BVH (i.e. this BVH).
+		 */
+		BVH& operator=(BVH&& bvh) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Methods: Construction
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the number of primitives of this BVH.
+
+		 @return		The number of primitives of this BVH.
+		 */
+		[[nodiscard]]
+		std::size_t GetNumberOfPrimitives() const noexcept {
+			return m_aabbs.size();
+		}
+
+		/**
+		 Returns the AABB of the given primitive of this BVH.
+
+		 @pre			@a primitive is smaller than the number of primitives
+						of this BVH.
+		 @param[in]		primitive
+						The primitive index.
+		 @return		A reference to the AABB of the given primitive of this
+						BVH.
+		 */
+		[[nodiscard]]
+		const AABB& GetAABB(std::size_t primitive) const noexcept {
+			return m_aabbs[primitive];
+		}
+
+		/**
+		 Builds this BVH for the given AABBs. The index of each AABB is used
+		 as its primitive index.
+
+		 @param[in]		aabbs
+						The AABBs of the primitives.
+		 */
+		void Build(gsl::span< const AABB > aabbs);
+
+		/**
+		 Rebuilds this BVH for the current AABBs of its primitives.
+		 */
+		void Rebuild();
+
+		/**
+		 Updates the AABB of the given primitive of this BVH. The nodes of this
+		 BVH are only refitted on the next call to
+		 {@link mage::BVH::Refit()}.
+
+		 @pre			@a primitive is smaller than the number of primitives
+						of this BVH.
+		 @param[in]		primitive
+						The primitive index.
+		 @param[in]		aabb
+						A reference to the AABB of the primitive.
+		 */
+		void Update(std::size_t primitive, const AABB& aabb) noexcept;
+
+		/**
+		 Refits the nodes of this BVH containing updated primitives.
+		 */
+		void Refit() noexcept;
+
+		/**
+		 Checks whether this BVH needs to be rebuilt (i.e. the SAH cost of
+		 this BVH became too large due to refitting).
+
+		 @return		@c true if this BVH needs to be rebuilt. @c false
+						otherwise.
+		 */
+		[[nodiscard]]
+		bool NeedsRebuild() const noexcept {
+			return m_build_cost * s_rebuild_factor < m_cost;
+		}
+
+		/**
+		 Clears this BVH.
+		 */
+		void Clear() noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Methods: Queries
+		//---------------------------------------------------------------------
+
+		/**
+		 Performs the given action on each primitive of this BVH whose AABB
+		 overlaps the given bounding volume.
+
+		 @tparam		BoundingVolumeT
+						The bounding volume type (e.g., bounding frustum,
+						bounding sphere or AABB).
+		 @tparam		ActionT
+						The action type.
+		 @param[in]		volume
+						A reference to the bounding volume.
+		 @param[in]		action
+						A reference to the action (i.e.
+						@c action(primitive)).
+		 */
+		template< typename BoundingVolumeT, typename ActionT >
+		void ForEachOverlapping(const BoundingVolumeT& volume,
+								ActionT&& action) const {
+
+			Traverse(volume, [&action](std::size_t primitive) {
+				action(primitive);
+				return false;
+			});
+		}
+
+		/**
+		 Checks whether any primitive of this BVH which satisfies the given
+		 predicate, overlaps the given bounding volume.
+
+		 @tparam		BoundingVolumeT
+						The bounding volume type (e.g., bounding frustum,
+						bounding sphere or AABB).
+		 @tparam		PredicateT
+						The predicate type.
+		 @param[in]		volume
+						A reference to the bounding volume.
+		 @param[in]		predicate
+						A reference to the predicate (i.e.
+						@c predicate(primitive)).
+		 @return		@c true if a primitive of this BVH which satisfies
+						@a predicate, overlaps @a volume. @c false otherwise.
+		 */
+		template< typename BoundingVolumeT, typename PredicateT >
+		[[nodiscard]]
+		bool AnyOverlapping(const BoundingVolumeT& volume,
+							PredicateT&& predicate) const {
+
+			return Traverse(volume, predicate);
+		}
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		/**
+		 A struct of BVH nodes.
+		 */
+		struct Node {
+
+		public:
+
+			/**
+			 The AABB of this node.
+			 */
+			AABB m_aabb;
+
+			/**
+			 The index of the first primitive index of the subtree of this
+			 node.
+			 */
+			U32 m_first;
+
+			/**
+			 The number of primitives of the subtree of this node.
+			 */
+			U32 m_count;
+
+			/**
+			 The index of the left child node of this node (the right child
+			 node is stored next to it). A zero indicates a leaf node.
+			 */
+			U32 m_left;
+
+			/**
+			 The index of the parent node of this node.
+			 */
+			U32 m_parent;
+		};
+
+		static_assert(48 == sizeof(Node));
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Builds the subtree of the given node of this BVH.
+
+		 @param[in]		node
+						The node index.
+		 @param[in]		centroids
+						The centroids of the AABBs of the primitives.
+		 @param[in]		depth
+						The depth of the node.
+		 */
+		void BuildNode(std::size_t node, gsl::span< const F32x3 > centroids,
+					   std::size_t depth);
+
+		/**
+		 Computes the (normalized) SAH cost of this BVH.
+
+		 @return		The SAH cost of this BVH.
+		 */
+		[[nodiscard]]
+		F32 ComputeCost() const noexcept;
+
+		/**
+		 Traverses this BVH and performs the given action on each primitive
+		 whose AABB overlaps the given bounding volume, until the action
+		 returns @c true.
+
+		 @tparam		BoundingVolumeT
+						The bounding volume type.
+		 @tparam		ActionT
+						The action type.
+		 @param[in]		volume
+						A reference to the bounding volume.
+		 @param[in]		action
+						A reference to the action (i.e.
+						@c action(primitive)).
+		 @return		@c true if the traversal was stopped by @a action.
+						@c false otherwise.
+		 */
+		template< typename BoundingVolumeT, typename ActionT >
+		bool Traverse(const BoundingVolumeT& volume, ActionT&& action) const {
+			if (m_nodes.empty()) {
+				return false;
+			}
+
+			// The stack holds at most one pending sibling per level and the
+			// two child nodes of the deepest internal node.
+			U32 stack[s_max_depth + 1u];
+			std::size_t stack_size = 0u;
+			stack[stack_size++] = 0u;
+
+			while (0u != stack_size) {
+				const auto& node = m_nodes[stack[--stack_size]];
+
+				if (!volume.Overlaps(node.m_aabb)) {
+					continue;
+				}
+
+				const auto first = m_indices.cbegin() + node.m_first;
+				const auto last  = first + node.m_count;
+
+				// Report all primitives of enclosed subtrees without testing.
+				if (volume.Encloses(node.m_aabb)) {
+					for (auto it = first; it != last; ++it) {
+						if (action(static_cast< std::size_t >(*it))) {
+							return true;
+						}
+					}
+
+					continue;
+				}
+
+				if (0u != node.m_left) {
+					stack[stack_size++] = node.m_left + 1u;
+					stack[stack_size++] = node.m_left;
+					continue;
+				}
+
+				for (auto it = first; it != last; ++it) {
+					if (volume.Overlaps(m_aabbs[*it])
+						&& action(static_cast< std::size_t >(*it))) {
+
+						return true;
+					}
+				}
+			}
+
+			return false;
+		}
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 A vector containing the AABBs of the primitives of this BVH.
+		 */
+		AlignedVector< AABB > m_aabbs;
+
+		/**
+		 A vector containing the nodes of this BVH. The root node is stored
+		 first and child nodes are always stored after their parent node.
+		 */
+		AlignedVector< Node > m_nodes;
+
+		/**
+		 A vector containing the primitive indices of this BVH ordered by
+		 subtree.
+		 */
+		std::vector< U32 > m_indices;
+
+		/**
+		 A vector containing the leaf node index of each primitive of this
+		 BVH.
+		 */
+		std::vector< U32 > m_leaves;
+
+		/**
+		 A vector containing the dirty flag of each node of this BVH.
+		 */
+		std::vector< U8 > m_dirty_nodes;
+
+		/**
+		 A flag indicating whether this BVH contains dirty nodes.
+		 */
+		bool m_dirty;
+
+		/**
+		 The SAH cost of this BVH after the last build.
+		 */
+		F32 m_build_cost;
+
+		/**
+		 The SAH cost of this BVH after the last refit.
+		 */
+		F32 m_cost;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,504 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "geometry\culling.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <immintrin.h>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	namespace {
+
+		//---------------------------------------------------------------------
+		// Lanes
+		//---------------------------------------------------------------------
+
+		#ifdef __AVX__
+
+		/**
+		 The type of the lanes of the culling kernels.
+		 */
+		using Lanes = __m256;
+
+		/**
+		 The number of lanes of the culling kernels.
+		 */
+		constexpr std::size_t s_nb_lanes = 8u;
+
+		/**
+		 Loads the given (aligned) values into lanes.
+
+		 @param[in]		data
+						A pointer to the values.
+		 @return		The lanes.
+		 */
+		[[nodiscard]]
+		inline const Lanes LoadLanes(const F32* data) noexcept {
+			return _mm256_load_ps(data);
+		}
+
+		/**
+		 Replicates the given value into all lanes.
+
+		 @param[in]		value
+						The value.
+		 @return		The lanes.
+		 */
+		[[nodiscard]]
+		inline const Lanes SplatLanes(F32 value) noexcept {
+			return _mm256_set1_ps(value);
+		}
+
+		/**
+		 Computes a * b + c per lane.
+
+		 @param[in]		a
+						A reference to the first lanes.
+		 @param[in]		b
+						A reference to the second lanes.
+		 @param[in]		c
+						A reference to the third lanes.
+		 @return		The lanes of a * b + c.
+		 */
+		[[nodiscard]]
+		inline const Lanes MultiplyAddLanes(const Lanes& a,
+											const Lanes& b,
+											const Lanes& c) noexcept {
+
+			return _mm256_add_ps(_mm256_mul_ps(a, b), c);
+		}
+
+		/**
+		 Computes a + b per lane.
+
+		 @param[in]		a
+						A reference to the first lanes.
+		 @param[in]		b
+						A reference to the second lanes.
+		 @return		The lanes of a + b.
+		 */
+		[[nodiscard]]
+		inline const Lanes AddLanes(const Lanes& a,
+									const Lanes& b) noexcept {
+
+			return _mm256_add_ps(a, b);
+		}
+
+		/**
+		 Computes mask | (a < b) per lane.
+
+		 @param[in]		mask
+						A reference to the mask lanes.
+		 @param[in]		a
+						A reference to the first lanes.
+		 @param[in]		b
+						A reference to the second lanes.
+		 @return		The mask lanes of mask | (a < b).
+		 */
+		[[nodiscard]]
+		inline const Lanes OrLessLanes(const Lanes& mask,
+									   const Lanes& a,
+									   const Lanes& b) noexcept {
+
+			return _mm256_or_ps(mask, _mm256_cmp_ps(a, b, _CMP_LT_OQ));
+		}
+
+		/**
+		 Returns the sign bits of the given mask lanes.
+
+		 @param[in]		mask
+						A reference to the mask lanes.
+		 @return		The sign bits of @a mask (i.e. one bit per lane).
+		 */
+		[[nodiscard]]
+		inline U64 MoveMaskLanes(const Lanes& mask) noexcept {
+			return static_cast< U64 >(_mm256_movemask_ps(mask));
+		}
+
+		#else  // __AVX__
+
+		/**
+		 The type of the lanes of the culling kernels.
+		 */
+		using Lanes = __m128;
+
+		/**
+		 The number of lanes of the culling kernels.
+		 */
+		constexpr std::size_t s_nb_lanes = 4u;
+
+		/**
+		 Loads the given (aligned) values into lanes.
+
+		 @param[in]		data
+						A pointer to the values.
+		 @return		The lanes.
+		 */
+		[[nodiscard]]
+		inline const Lanes LoadLanes(const F32* data) noexcept {
+			return _mm_load_ps(data);
+		}
+
+		/**
+		 Replicates the given value into all lanes.
+
+		 @param[in]		value
+						The value.
+		 @return		The lanes.
+		 */
+		[[nodiscard]]
+		inline const Lanes SplatLanes(F32 value) noexcept {
+			return _mm_set1_ps(value);
+		}
+
+		/**
+		 Computes a * b + c per lane.
+
+		 @param[in]		a
+						A reference to the first lanes.
+		 @param[in]		b
+						A reference to the second lanes.
+		 @param[in]		c
+						A reference to the third lanes.
+		 @return		The lanes of a * b + c.
+		 */
+		[[nodiscard]]
+		inline const Lanes MultiplyAddLanes(const Lanes& a,
+											const Lanes& b,
+											const Lanes& c) noexcept {
+
+			return _mm_add_ps(_mm_mul_ps(a, b), c);
+		}
+
+		/**
+		 Computes a + b per lane.
+
+		 @param[in]		a
+						A reference to the first lanes.
+		 @param[in]		b
+						A reference to the second lanes.
+		 @return		The lanes of a + b.
+		 */
+		[[nodiscard]]
+		inline const Lanes AddLanes(const Lanes& a,
+									const Lanes& b) noexcept {
+
+			return _mm_add_ps(a, b);
+		}
+
+		/**
+		 Computes mask | (a < b) per lane.
+
+		 @param[in]		mask
+						A reference to the mask lanes.
+		 @param[in]		a
+						A reference to the first lanes.
+		 @param[in]		b
+						A reference to the second lanes.
+		 @return		The mask lanes of mask | (a < b).
+		 */
+		[[nodiscard]]
+		inline const Lanes OrLessLanes(const Lanes& mask,
+									   const Lanes& a,
+									   const Lanes& b) noexcept {
+
+			return _mm_or_ps(mask, _mm_cmplt_ps(a, b));
+		}
+
+		/**
+		 Returns the sign bits of the given mask lanes.
+
+		 @param[in]		mask
+						A reference to the mask lanes.
+		 @return		The sign bits of @a mask (i.e. one bit per lane).
+		 */
+		[[nodiscard]]
+		inline U64 MoveMaskLanes(const Lanes& mask) noexcept {
+			return static_cast< U64 >(_mm_movemask_ps(mask));
+		}
+
+		#endif // __AVX__
+
+		static_assert(0u == g_culling_batch_size % s_nb_lanes);
+		static_assert(0u == g_culling_mask_word_size % s_nb_lanes);
+
+		//---------------------------------------------------------------------
+		// Planes
+		//---------------------------------------------------------------------
+
+		/**
+		 The maximum number of bounding frustums tested in a single sweep.
+		 More bounding frustums are tested in multiple sweeps.
+		 */
+		constexpr std::size_t s_max_frustums_per_sweep = 8u;
+
+		/**
+		 A struct of culling planes.
+		 */
+		struct CullingPlane {
+
+		public:
+
+			/**
+			 The normal and offset of this culling plane.
+			 */
+			F32x4 m_plane;
+
+			/**
+			 The absolute value of the normal of this culling plane.
+			 */
+			F32x3 m_abs_normal;
+		};
+
+		/**
+		 Extracts the culling planes of the given bounding frustum.
+
+		 @param[in]		frustum
+						A reference to the bounding frustum.
+		 @param[out]	planes
+						A pointer to the six culling planes.
+		 */
+		void ExtractCullingPlanes(const BoundingFrustum& frustum,
+								  CullingPlane* planes) noexcept {
+
+			for (std::size_t i = 0u; i < 6u; ++i) {
+				const auto plane = frustum.GetPlane(i);
+				planes[i].m_plane      = XMStore< F32x4 >(plane);
+				planes[i].m_abs_normal = XMStore< F32x3 >(XMVectorAbs(plane));
+			}
+		}
+
+		/**
+		 Clears the visibility bits of the padding bounding volumes of the
+		 given visibility masks.
+
+		 @param[in]		nb_frustums
+						The number of bounding frustums.
+		 @param[in]		nb_volumes
+						The number of bounding volumes.
+		 @param[in,out]	masks
+						The visibility masks.
+		 */
+		void ClearPaddingBits(std::size_t nb_frustums,
+							  std::size_t nb_volumes,
+							  gsl::span< U64 > masks) noexcept {
+
+			const auto nb_bits = nb_volumes % g_culling_mask_word_size;
+			if (0u == nb_bits) {
+				return;
+			}
+
+			const auto nb_words = GetNumberOfMaskWords(nb_volumes);
+			for (std::size_t f = 0u; f < nb_frustums; ++f) {
+				masks[(f + 1u) * nb_words - 1u] &= (U64(1u) << nb_bits) - 1u;
+			}
+		}
+
+		/**
+		 Culls the given bounding volumes against the given bounding frustums.
+
+		 @tparam		IsAABB
+						@c true if the bounding volumes are AABBs (i.e. with
+						six components). @c false if the bounding volumes are
+						bounding spheres (i.e. with four components).
+		 @tparam		BoundingVolumeArrayT
+						The bounding volume array type.
+		 @param[in]		frustums
+						The bounding frustums.
+		 @param[in]		volumes
+						A reference to the bounding volume array.
+		 @param[out]	masks
+						The visibility masks.
+		 */
+		template< bool IsAABB, typename BoundingVolumeArrayT >
+		void CullVolumes(gsl::span< const BoundingFrustum > frustums,
+						 const BoundingVolumeArrayT& volumes,
+						 gsl::span< U64 > masks) noexcept {
+
+			const auto nb_frustums = static_cast< std::size_t >(frustums.size());
+			const auto nb_volumes  = volumes.size();
+			const auto nb_words    = GetNumberOfMaskWords(nb_volumes);
+			std::fill(masks.begin(), masks.begin() + nb_frustums * nb_words, U64(0u));
+
+			const F32* const cx = volumes.GetData(0u);
+			const F32* const cy = volumes.GetData(1u);
+			const F32* const cz = volumes.GetData(2u);
+			const F32* const rx = volumes.GetData(3u);
+			const F32* const ry = IsAABB ? volumes.GetData(4u) : nullptr;
+			const F32* const rz = IsAABB ? volumes.GetData(5u) : nullptr;
+
+			CullingPlane planes[s_max_frustums_per_sweep][6u];
+
+			for (std::size_t first = 0u; first < nb_frustums;
+				 first += s_max_frustums_per_sweep) {
+
+				const auto nb_sweep_frustums
+					= std::min(nb_frustums - first, s_max_frustums_per_sweep);
+				for (std::size_t f = 0u; f < nb_sweep_frustums; ++f) {
+					ExtractCullingPlanes(frustums[first + f], planes[f]);
+				}
+
+				// Sweep once over the bounding volumes for all bounding
+				// frustums of this sweep.
+				for (std::size_t i = 0u; i < nb_volumes; i += s_nb_lanes) {
+					const auto cx_i = LoadLanes(cx + i);
+					const auto cy_i = LoadLanes(cy + i);
+					const auto cz_i = LoadLanes(cz + i);
+					const auto rx_i = LoadLanes(rx + i);
+					const auto ry_i = IsAABB ? LoadLanes(ry + i) : rx_i;
+					const auto rz_i = IsAABB ? LoadLanes(rz + i) : rx_i;
+					const auto zero = SplatLanes(0.0f);
+
+					for (std::size_t f = 0u; f < nb_sweep_frustums; ++f) {
+						auto culled = zero;
+
+						for (const auto& plane : planes[f]) {
+							// Signed distance of the centroid to the plane.
+							auto distance = SplatLanes(plane.m_plane[3]);
+							distance = MultiplyAddLanes(SplatLanes(plane.m_plane[0]), cx_i, distance);
+							distance = MultiplyAddLanes(SplatLanes(plane.m_plane[1]), cy_i, distance);
+							distance = MultiplyAddLanes(SplatLanes(plane.m_plane[2]), cz_i, distance);
+
+							// Signed distance of the point furthest along the
+							// plane normal (AABB) or of the centroid offset
+							// by the radius (bounding sphere).
+							if constexpr (IsAABB) {
+								distance = MultiplyAddLanes(SplatLanes(plane.m_abs_normal[0]), rx_i, distance);
+								distance = MultiplyAddLanes(SplatLanes(plane.m_abs_normal[1]), ry_i, distance);
+								distance = MultiplyAddLanes(SplatLanes(plane.m_abs_normal[2]), rz_i, distance);
+							}
+							else {
+								distance = AddLanes(rx_i, distance);
+							}
+
+							culled = OrLessLanes(culled, distance, zero);
+						}
+
+						const auto visible = ~MoveMaskLanes(culled)
+							               & ((U64(1u) << s_nb_lanes) - 1u);
+						masks[(first + f) * nb_words + i / g_culling_mask_word_size]
+							|= visible << (i % g_culling_mask_word_size);
+					}
+				}
+			}
+
+			ClearPaddingBits(nb_frustums, nb_volumes, masks);
+		}
+	}
+
+	//-------------------------------------------------------------------------
+	// AABBArray
+	//-------------------------------------------------------------------------
+
+	AABBArray::AABBArray() noexcept
+		: m_components{},
+		m_size(0u) {}
+
+	AABBArray::AABBArray(const AABBArray& aabbs) = default;
+
+	AABBArray::AABBArray(AABBArray&& aabbs) noexcept = default;
+
+	AABBArray::~AABBArray() = default;
+
+	AABBArray& AABBArray::operator=(const AABBArray& aabbs) = default;
+
+	AABBArray& AABBArray::operator=(AABBArray&& aabbs) noexcept = default;
+
+	void AABBArray::resize(std::size_t size) {
+		const auto padded_size = (size + g_culling_batch_size - 1u)
+			                   / g_culling_batch_size * g_culling_batch_size;
+		for (auto& component : m_components) {
+			component.assign(padded_size, 0.0f);
+		}
+
+		m_size = size;
+	}
+
+	void AABBArray::Set(std::size_t index, const AABB& aabb) noexcept {
+		const auto centroid = XMStore< F32x3 >(aabb.Centroid());
+		const auto radius   = XMStore< F32x3 >(aabb.Radius());
+
+		m_components[0u][index] = centroid[0];
+		m_components[1u][index] = centroid[1];
+		m_components[2u][index] = centroid[2];
+		m_components[3u][index] = radius[0];
+		m_components[4u][index] = radius[1];
+		m_components[5u][index] = radius[2];
+	}
+
+	//-------------------------------------------------------------------------
+	// BoundingSphereArray
+	//-------------------------------------------------------------------------
+
+	BoundingSphereArray::BoundingSphereArray() noexcept
+		: m_components{},
+		m_size(0u) {}
+
+	BoundingSphereArray::BoundingSphereArray(
+		const BoundingSphereArray& spheres) = default;
+
+	BoundingSphereArray::BoundingSphereArray(
+		BoundingSphereArray&& spheres) noexcept = default;
+
+	BoundingSphereArray::~BoundingSphereArray() = default;
+
+	BoundingSphereArray& BoundingSphereArray::operator=(
+		const BoundingSphereArray& spheres) = default;
+
+	BoundingSphereArray& BoundingSphereArray::operator=(
+		BoundingSphereArray&& spheres) noexcept = default;
+
+	void BoundingSphereArray::resize(std::size_t size) {
+		const auto padded_size = (size + g_culling_batch_size - 1u)
+			                   / g_culling_batch_size * g_culling_batch_size;
+		for (auto& component : m_components) {
+			component.assign(padded_size, 0.0f);
+		}
+
+		m_size = size;
+	}
+
+	void BoundingSphereArray::Set(std::size_t index,
+								  const BoundingSphere& sphere) noexcept {
+
+		const auto centroid = XMStore< F32x3 >(sphere.Centroid());
+
+		m_components[0u][index] = centroid[0];
+		m_components[1u][index] = centroid[1];
+		m_components[2u][index] = centroid[2];
+		m_components[3u][index] = sphere.Radius();
+	}
+
+	//-------------------------------------------------------------------------
+	// Batched Culling
+	//-------------------------------------------------------------------------
+
+	void Cull(gsl::span< const BoundingFrustum > frustums,
+			  const AABBArray& aabbs,
+			  gsl::span< U64 > masks) noexcept {
+
+		CullVolumes< true >(frustums, aabbs, masks);
+	}
+
+	void Cull(gsl::span< const BoundingFrustum > frustums,
+			  const BoundingSphereArray& spheres,
+			  gsl::span< U64 > masks) noexcept {
+
+		CullVolumes< false >(frustums, spheres, masks);
+	}
+}
\ No newline at end of file
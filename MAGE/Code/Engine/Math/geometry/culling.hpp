@@ -0,0 +1,416 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "geometry\bounding_volume.hpp"
+#include "memory\allocation.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <gsl\span>
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	//-------------------------------------------------------------------------
+	// Culling Masks
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 The number of bounding volumes per word of a visibility mask.
+	 */
+	constexpr std::size_t g_culling_mask_word_size = 64u;
+
+	/**
+	 The number of bounding volumes processed at once by the culling kernels.
+	 The size of bounding volume arrays is padded to a multiple of this
+	 number.
+	 */
+	constexpr std::size_t g_culling_batch_size = 8u;
+
+	/**
+	 Returns the number of visibility mask words needed for the given number
+	 of bounding volumes.
+
+	 @param[in]		nb_volumes
+					The number of bounding volumes.
+	 @return		The number of visibility mask words needed for
+					@a nb_volumes bounding volumes.
+	 */
+	[[nodiscard]]
+	constexpr std::size_t GetNumberOfMaskWords(std::size_t nb_volumes) noexcept {
+		return (nb_volumes + g_culling_mask_word_size - 1u)
+			 / g_culling_mask_word_size;
+	}
+
+	/**
+	 Checks whether the bounding volume with the given index is visible
+	 according to the given visibility mask.
+
+	 @param[in]		mask
+					The visibility mask.
+	 @param[in]		index
+					The index of the bounding volume.
+	 @return		@c true if the bounding volume with index @a index is
+					visible according to @a mask. @c false otherwise.
+	 */
+	[[nodiscard]]
+	inline bool IsVisible(gsl::span< const U64 > mask,
+						  std::size_t index) noexcept {
+
+		return 0u != (mask[index / g_culling_mask_word_size]
+					  & (U64(1u) << (index % g_culling_mask_word_size)));
+	}
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// AABBArray
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A class of AABB arrays stored as structures of arrays (SoA) of centroids
+	 and radii for batched culling.
+	 */
+	class AABBArray {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs an AABB array.
+		 */
+		AABBArray() noexcept;
+
+		/**
+		 Constructs an AABB array from the given AABB array.
+
+		 @param[in]		aabbs
+						A reference to the AABB array to copy.
+		 */
+		AABBArray(const AABBArray& aabbs);
+
+		/**
+		 Constructs an AABB array by moving the given AABB array.
+
+		 @param[in]		aabbs
+						A reference to the AABB array to move.
+		 */
+		AABBArray(AABBArray&& aabbs) noexcept;
+
+		/**
+		 Destructs this AABB array.
+		 */
+		~AABBArray();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given AABB array to this AABB array.
+
+		 @param[in]		aabbs
+						A reference to the AABB array to copy.
+		 @return		A reference to the copy of the given AABB array (i.e.
+						this AABB array).
+		 */
+		AABBArray& operator=(const AABBArray& aabbs);
+
+		/**
+		 Moves the given AABB array to this AABB array.
+
+		 @param[in]		aabbs
+						A reference to the AABB array to move.
+		 @return		A reference to the moved AABB array (i.e. this AABB
+						array).
+		 */
+		AABBArray& operator=(AABBArray&& aabbs) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the number of AABBs of this AABB array.
+
+		 @return		The number of AABBs of this AABB array.
+		 */
+		[[nodiscard]]
+		std::size_t size() const noexcept {
+			return m_size;
+		}
+
+		/**
+		 Resizes this AABB array.
+
+		 @param[in]		size
+						The number of AABBs.
+		 @note			The AABBs (including the padding AABBs) are reset.
+		 */
+		void resize(std::size_t size);
+
+		/**
+		 Sets the AABB with the given index of this AABB array.
+
+		 @pre			@a index is smaller than the size of this AABB array.
+		 @param[in]		index
+						The index.
+		 @param[in]		aabb
+						A reference to the AABB.
+		 @note			Different AABBs can be set concurrently.
+		 */
+		void Set(std::size_t index, const AABB& aabb) noexcept;
+
+		/**
+		 Returns the components of the centroids and radii of this AABB array.
+
+		 @param[in]		component
+						The component index (i.e. 0-2 for the x, y and z
+						components of the centroids and 3-5 for the x, y and z
+						components of the radii).
+		 @return		A pointer to the (padded, 32-byte aligned) components
+						of the centroids and radii of this AABB array.
+		 */
+		[[nodiscard]]
+		const F32* GetData(std::size_t component) const noexcept {
+			return m_components[component].data();
+		}
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The components of the centroids and radii of this AABB array.
+		 */
+		std::vector< F32, AlignedAllocator< F32, 32u > > m_components[6];
+
+		/**
+		 The number of AABBs of this AABB array.
+		 */
+		std::size_t m_size;
+	};
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// BoundingSphereArray
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A class of bounding sphere arrays stored as structures of arrays (SoA) of
+	 centroids and radii for batched culling.
+	 */
+	class BoundingSphereArray {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a bounding sphere array.
+		 */
+		BoundingSphereArray() noexcept;
+
+		/**
+		 Constructs a bounding sphere array from the given bounding sphere
+		 array.
+
+		 @param[in]		spheres
+						A reference to the bounding sphere array to copy.
+		 */
+		BoundingSphereArray(const BoundingSphereArray& spheres);
+
+		/**
+		 Constructs a bounding sphere array by moving the given bounding
+		 sphere array.
+
+		 @param[in]		spheres
+						A reference to the bounding sphere array to move.
+		 */
+		BoundingSphereArray(BoundingSphereArray&& spheres) noexcept;
+
+		/**
+		 Destructs this bounding sphere array.
+		 */
+		~BoundingSphereArray();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given bounding sphere array to this bounding sphere array.
+
+		 @param[in]		spheres
+						A reference to the bounding sphere array to copy.
+		 @return		A reference to the copy of the given bounding sphere
+						array (i.e. this bounding sphere array).
+		 */
+		BoundingSphereArray& operator=(const BoundingSphereArray& spheres);
+
+		/**
+		 Moves the given bounding sphere array to this bounding sphere array.
+
+		 @param[in]		spheres
+						A reference to the bounding sphere array to move.
+		 @return		A reference to the moved bounding sphere array (i.e.
+						this bounding sphere array).
+		 */
+		BoundingSphereArray& operator=(BoundingSphereArray&& spheres) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the number of bounding spheres of this bounding sphere array.
+
+		 @return		The number of bounding spheres of this bounding sphere
+						array.
+		 */
+		[[nodiscard]]
+		std::size_t size() const noexcept {
+			return m_size;
+		}
+
+		/**
+		 Resizes this bounding sphere array.
+
+		 @param[in]		size
+						The number of bounding spheres.
+		 @note			The bounding spheres (including the padding bounding
+						spheres) are reset.
+		 */
+		void resize(std::size_t size);
+
+		/**
+		 Sets the bounding sphere with the given index of this bounding sphere
+		 array.
+
+		 @pre			@a index is smaller than the size of this bounding
+						sphere array.
+		 @param[in]		index
+						The index.
+		 @param[in]		sphere
+						A reference to the bounding sphere.
+		 @note			Different bounding spheres can be set concurrently.
+		 */
+		void Set(std::size_t index, const BoundingSphere& sphere) noexcept;
+
+		/**
+		 Returns the components of the centroids and radii of this bounding
+		 sphere array.
+
+		 @param[in]		component
+						The component index (i.e. 0-2 for the x, y and z
+						components of the centroids and 3 for the radii).
+		 @return		A pointer to the (padded, 32-byte aligned) components
+						of the centroids and radii of this bounding sphere
+						array.
+		 */
+		[[nodiscard]]
+		const F32* GetData(std::size_t component) const noexcept {
+			return m_components[component].data();
+		}
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The components of the centroids and radii of this bounding sphere
+		 array.
+		 */
+		std::vector< F32, AlignedAllocator< F32, 32u > > m_components[4];
+
+		/**
+		 The number of bounding spheres of this bounding sphere array.
+		 */
+		std::size_t m_size;
+	};
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// Batched Culling
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 Culls the given AABBs against the given bounding frustums.
+
+	 All bounding frustums are tested in a single sweep over the AABBs, using
+	 8-wide (AVX) or 4-wide (SSE) kernels.
+
+	 @pre			The bounding frustums and AABBs are expressed in the same
+					coordinate system (e.g., world space).
+	 @pre			The size of @a masks is at least the number of bounding
+					frustums times the number of mask words for the AABBs.
+	 @param[in]		frustums
+					The bounding frustums.
+	 @param[in]		aabbs
+					A reference to the AABB array.
+	 @param[out]	masks
+					The visibility masks (i.e. one bit per AABB which is set
+					if the AABB is not culled). The visibility mask of the
+					i-th bounding frustum starts at word
+					i * GetNumberOfMaskWords(aabbs.size()).
+	 */
+	void Cull(gsl::span< const BoundingFrustum > frustums,
+			  const AABBArray& aabbs,
+			  gsl::span< U64 > masks) noexcept;
+
+	/**
+	 Culls the given bounding spheres against the given bounding frustums.
+
+	 All bounding frustums are tested in a single sweep over the bounding
+	 spheres, using 8-wide (AVX) or 4-wide (SSE) kernels.
+
+	 @pre			The bounding frustums and bounding spheres are expressed
+					in the same coordinate system (e.g., world space).
+	 @pre			The size of @a masks is at least the number of bounding
+					frustums times the number of mask words for the bounding
+					spheres.
+	 @param[in]		frustums
+					The bounding frustums.
+	 @param[in]		spheres
+					A reference to the bounding sphere array.
+	 @param[out]	masks
+					The visibility masks (i.e. one bit per bounding sphere
+					which is set if the bounding sphere is not culled). The
+					visibility mask of the i-th bounding frustum starts at
+					word i * GetNumberOfMaskWords(spheres.size()).
+	 */
+	void Cull(gsl::span< const BoundingFrustum > frustums,
+			  const BoundingSphereArray& spheres,
+			  gsl::span< U64 > masks) noexcept;
+
+	#pragma endregion
+}
\ No newline at end of file
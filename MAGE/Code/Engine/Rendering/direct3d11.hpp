@@ -55,7 +55,8 @@ namespace mage::rendering {
 	using D3D11Device = ID3D11Device;
 
 	/**
-	 The type of D3D11 device context.
+	 The type of D3D11 device context (i.e. supports binding ranges of
+	 constant buffers).
 	 */
-	using D3D11DeviceContext = ID3D11DeviceContext;
+	using D3D11DeviceContext = ID3D11DeviceContext1;
 }
\ No newline at end of file
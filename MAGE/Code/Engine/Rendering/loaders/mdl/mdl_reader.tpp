@@ -37,6 +37,7 @@ namespace mage::rendering::loader {
 
 		ImportMSHMeshFromFile(msh_path, m_model_output.m_vertex_buffer,
 							  m_model_output.m_index_buffer);
+		m_model_output.m_dependencies.push_back(std::move(msh_path));
 	}
 
 	template< typename VertexT, typename IndexT >
@@ -90,5 +91,6 @@ namespace mage::rendering::loader {
 		ImportMaterialFromFile(mtl_path,
 							   m_resource_manager,
 							   m_model_output.m_material_buffer);
+		m_model_output.m_dependencies.push_back(std::move(mtl_path));
 	}
 }
\ No newline at end of file
@@ -0,0 +1,93 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "resource\model\model_output.hpp"
+#include "resource\mesh\mesh_descriptor.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+	// Forward declaration.
+	class ResourceManager;
+}
+
+namespace mage::rendering::loader {
+
+	/**
+	 Imports the model from the MDLB file associated with the given path if
+	 that MDLB file is fresh (i.e. if it matches the given source model file
+	 and its dependencies, and the given mesh descriptor).
+
+	 @tparam		VertexT
+					The vertex type.
+	 @tparam		IndexT
+					The index type.
+	 @param[in]		path
+					A reference to the path of the MDLB file.
+	 @param[in]		source_path
+					A reference to the path of the source model file.
+	 @param[in,out]	resource_manager
+					A reference to the resource manager.
+	 @param[in,out]	model_output
+					A reference to the model output.
+	 @param[in]		mesh_desc
+					A reference to the mesh descriptor.
+	 @return		@c true if the MDLB file is fresh and the model has been
+					imported. @c false if the MDLB file does not exist, is
+					stale or is invalid (in which case the model output is
+					left empty).
+	 */
+	template< typename VertexT, typename IndexT >
+	[[nodiscard]]
+	bool ImportMDLBModelFromFile(const std::filesystem::path& path,
+								 const std::filesystem::path& source_path,
+								 ResourceManager& resource_manager,
+								 ModelOutput< VertexT, IndexT >& model_output,
+								 const MeshDescriptor< VertexT, IndexT >& mesh_desc);
+
+	/**
+	 Exports the given model to the MDLB file associated with the given path.
+
+	 The MDLB file is first written to a temporary file which replaces the
+	 MDLB file on success: an interrupted export never leaves a truncated
+	 MDLB file behind.
+
+	 @tparam		VertexT
+					The vertex type.
+	 @tparam		IndexT
+					The index type.
+	 @param[in]		path
+					A reference to the path of the MDLB file.
+	 @param[in]		source_path
+					A reference to the path of the source model file.
+	 @param[in]		model_output
+					A reference to the model output imported from the given
+					source model file.
+	 @param[in]		mesh_desc
+					A reference to the mesh descriptor used for importing the
+					model output.
+	 @throws		Exception
+					Failed to export the model to file.
+	 */
+	template< typename VertexT, typename IndexT >
+	void ExportMDLBModelToFile(const std::filesystem::path& path,
+							   const std::filesystem::path& source_path,
+							   const ModelOutput< VertexT, IndexT >& model_output,
+							   const MeshDescriptor< VertexT, IndexT >& mesh_desc);
+}
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "loaders\mdlb\mdlb_loader.tpp"
+
+#pragma endregion
\ No newline at end of file
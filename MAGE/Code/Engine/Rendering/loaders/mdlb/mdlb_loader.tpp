@@ -0,0 +1,100 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "loaders\mdlb\mdlb_reader.hpp"
+#include "loaders\mdlb\mdlb_writer.hpp"
+#include "io\checksum.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering::loader {
+
+	namespace details {
+
+		/**
+		 Returns the initial checksum value of the source hash of MDLB files
+		 for the given mesh descriptor.
+
+		 @tparam		VertexT
+						The vertex type.
+		 @tparam		IndexT
+						The index type.
+		 @param[in]		mesh_desc
+						A reference to the mesh descriptor.
+		 @return		The initial checksum value.
+		 */
+		template< typename VertexT, typename IndexT >
+		[[nodiscard]]
+		U64 GetMDLBSeed(const MeshDescriptor< VertexT, IndexT >& mesh_desc) noexcept {
+			const U8 flags[] = {
+				static_cast< U8 >(mesh_desc.InvertHandness()),
+				static_cast< U8 >(mesh_desc.ClockwiseOrder()),
+				static_cast< U8 >(mesh_desc.WeldVertices()),
+				static_cast< U8 >(mesh_desc.OptimizeMesh())
+			};
+
+			return ComputeChecksum(gsl::make_span(flags));
+		}
+	}
+
+	template< typename VertexT, typename IndexT >
+	[[nodiscard]]
+	bool ImportMDLBModelFromFile(const std::filesystem::path& path,
+								 const std::filesystem::path& source_path,
+								 ResourceManager& resource_manager,
+								 ModelOutput< VertexT, IndexT >& model_output,
+								 const MeshDescriptor< VertexT, IndexT >& mesh_desc) {
+
+		if (!std::filesystem::exists(path)) {
+			return false;
+		}
+
+		try {
+			MDLBReader< VertexT, IndexT > reader(resource_manager,
+												 model_output,
+												 source_path,
+												 details::GetMDLBSeed(mesh_desc));
+			if (reader.ReadFromFile(path)) {
+				return true;
+			}
+		}
+		catch (const std::exception& exception) {
+			Warning("{}: ignoring invalid MDLB file: {}", path, exception.what());
+		}
+
+		model_output = ModelOutput< VertexT, IndexT >();
+		return false;
+	}
+
+	template< typename VertexT, typename IndexT >
+	void ExportMDLBModelToFile(const std::filesystem::path& path,
+							   const std::filesystem::path& source_path,
+							   const ModelOutput< VertexT, IndexT >& model_output,
+							   const MeshDescriptor< VertexT, IndexT >& mesh_desc) {
+
+		const auto source_hash = ComputeMDLBSourceHash(source_path,
+													   model_output.m_dependencies,
+													   details::GetMDLBSeed(mesh_desc));
+
+		auto tmp_path = path;
+		tmp_path += L".tmp";
+
+		{
+			MDLBWriter< VertexT, IndexT > writer(model_output, source_hash);
+			writer.WriteToFile(tmp_path);
+		}
+
+		std::error_code error_code;
+		std::filesystem::rename(tmp_path, path, error_code);
+		ThrowIfFailed(!error_code,
+					  "{}: could not replace the MDLB file: {}",
+					  path, error_code.message());
+	}
+}
\ No newline at end of file
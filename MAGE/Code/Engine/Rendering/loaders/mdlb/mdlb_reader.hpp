@@ -0,0 +1,233 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "io\binary_reader.hpp"
+#include "resource\model\model_output.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+	// Forward declaration.
+	class ResourceManager;
+}
+
+namespace mage::rendering::loader {
+
+	/**
+	 A class of MDLB file readers for reading (compiled) models.
+
+	 MDLB files are read directly from a memory-mapped file view. A MDLB file
+	 is only read if it is fresh (i.e. if its version, vertex layout and
+	 source hash match).
+
+	 @tparam		VertexT
+					The vertex type.
+	 @tparam		IndexT
+					The index type.
+	 */
+	template< typename VertexT, typename IndexT >
+	class MDLBReader : private BigEndianBinaryReader {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a MDLB reader.
+
+		 @param[in,out]	resource_manager
+						A reference to the resource manager.
+		 @param[in,out]	model_output
+						A reference to the model output for storing the model
+						data from file.
+		 @param[in]		source_path
+						The path of the source model file of the MDLB file.
+		 @param[in]		seed
+						The initial checksum value of the source hash.
+		 */
+		explicit MDLBReader(ResourceManager& resource_manager,
+							ModelOutput< VertexT, IndexT >& model_output,
+							std::filesystem::path source_path,
+							U64 seed);
+
+		/**
+		 Constructs a MDLB reader from the given MDLB reader.
+
+		 @param[in]		reader
+						A reference to the MDLB reader to copy.
+		 */
+		MDLBReader(const MDLBReader& reader) = delete;
+
+		/**
+		 Constructs a MDLB reader by moving the given MDLB reader.
+
+		 @param[in]		reader
+						A reference to the MDLB reader to move.
+		 */
+		MDLBReader(MDLBReader&& reader) noexcept;
+
+		/**
+		 Destructs this MDLB reader.
+		 */
+		~MDLBReader();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given MDLB reader to this MDLB reader.
+
+		 @param[in]		reader
+						A reference to a MDLB reader to copy.
+		 @return		A reference to the copy of the given MDLB reader (i.e.
+						this MDLB reader).
+		 */
+		MDLBReader& operator=(const MDLBReader& reader) = delete;
+
+		/**
+		 Moves the given MDLB reader to this MDLB reader.
+
+		 @param[in]		reader
+						A reference to a MDLB reader to move.
+		 @return		A reference to the moved MDLB reader (i.e. this MDLB
+						reader).
+		 */
+		MDLBReader& operator=(MDLBReader&& reader) = delete;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Reads from the file associated with the given path.
+
+		 @param[in]		path
+						A reference to the path.
+		 @return		@c true if the MDLB file is fresh and has been read.
+						@c false if the MDLB file is stale (i.e. nothing but
+						the dependencies has been read).
+		 @throws		Exception
+						Failed to read from the file.
+		 */
+		bool ReadFromFile(const std::filesystem::path& path);
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Starts reading.
+
+		 @throws		Exception
+						Failed to read from the given file.
+		 */
+		virtual void ReadData() override;
+
+		/**
+		 Checks whether the header of the file is valid.
+
+		 @return		@c true if the header of the file is valid. @c false
+						otherwise.
+		 */
+		[[nodiscard]]
+		bool IsHeaderValid();
+
+		/**
+		 Reads the source hash and the dependencies, and checks whether the
+		 source hash matches the current source model file and dependencies.
+
+		 @return		@c true if the source hash is valid. @c false
+						otherwise.
+		 @throws		Exception
+						Failed to read the source hash or the dependencies.
+		 */
+		[[nodiscard]]
+		bool IsSourceHashValid();
+
+		/**
+		 Reads a material.
+
+		 @throws		Exception
+						Failed to read a material.
+		 */
+		void ReadMDLBMaterial();
+
+		/**
+		 Reads a model part.
+
+		 @throws		Exception
+						Failed to read a model part.
+		 */
+		void ReadMDLBModelPart();
+
+		/**
+		 Reads a (length-prefixed) string.
+
+		 @return		The string.
+		 @throws		Exception
+						Failed to read a string.
+		 */
+		[[nodiscard]]
+		const std::string ReadMDLBString();
+
+		/**
+		 Reads a (length-prefixed) wide string.
+
+		 @return		The wide string.
+		 @throws		Exception
+						Failed to read a wide string.
+		 */
+		[[nodiscard]]
+		const std::wstring ReadMDLBWideString();
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 A reference to the resource manager of this MDLB reader.
+		 */
+		ResourceManager& m_resource_manager;
+
+		/**
+		 A reference to the model output of this MDLB reader.
+		 */
+		ModelOutput< VertexT, IndexT >& m_model_output;
+
+		/**
+		 The path of the source model file of this MDLB reader.
+		 */
+		std::filesystem::path m_source_path;
+
+		/**
+		 The initial checksum value of the source hash of this MDLB reader.
+		 */
+		U64 m_seed;
+
+		/**
+		 A flag indicating whether the read MDLB file is fresh.
+		 */
+		bool m_fresh;
+	};
+}
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "loaders\mdlb\mdlb_reader.tpp"
+
+#pragma endregion
\ No newline at end of file
@@ -0,0 +1,198 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "loaders\mdlb\mdlb_tokens.hpp"
+#include "loaders\mdlb\mdlb_utils.hpp"
+#include "loaders\msh\msh_header.hpp"
+#include "io\mapped_file.hpp"
+#include "exception\exception.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <type_traits>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering::loader {
+
+	template< typename VertexT, typename IndexT >
+	MDLBReader< VertexT, IndexT >
+		::MDLBReader(ResourceManager& resource_manager,
+					 ModelOutput< VertexT, IndexT >& model_output,
+					 std::filesystem::path source_path,
+					 U64 seed)
+		: BigEndianBinaryReader(),
+		m_resource_manager(resource_manager),
+		m_model_output(model_output),
+		m_source_path(std::move(source_path)),
+		m_seed(seed),
+		m_fresh(false) {}
+
+	template< typename VertexT, typename IndexT >
+	MDLBReader< VertexT, IndexT >::MDLBReader(
+		MDLBReader&& reader) noexcept = default;
+
+	template< typename VertexT, typename IndexT >
+	MDLBReader< VertexT, IndexT >::~MDLBReader() = default;
+
+	template< typename VertexT, typename IndexT >
+	bool MDLBReader< VertexT, IndexT >
+		::ReadFromFile(const std::filesystem::path& path) {
+
+		const MappedFile file(path);
+		ReadFromMemory(file.GetData(), path);
+		return m_fresh;
+	}
+
+	template< typename VertexT, typename IndexT >
+	void MDLBReader< VertexT, IndexT >::ReadData() {
+		static_assert(std::is_trivially_copyable_v< VertexT >);
+		static_assert(std::is_trivially_copyable_v< IndexT >);
+
+		using std::empty;
+		ThrowIfFailed(empty(m_model_output.m_vertex_buffer),
+					  "{}: vertex buffer must be empty.", GetPath());
+		ThrowIfFailed(empty(m_model_output.m_index_buffer),
+					  "{}: index buffer must be empty.", GetPath());
+
+		// Validate the header and the source hash before touching any
+		// resources.
+		m_fresh = IsHeaderValid() && IsSourceHashValid();
+		if (!m_fresh) {
+			return;
+		}
+
+		const auto nb_vertices = static_cast< std::size_t >(Read< U64 >());
+		const auto vertices    = ReadArray< VertexT >(nb_vertices);
+		m_model_output.m_vertex_buffer.assign(vertices, vertices + nb_vertices);
+
+		const auto nb_indices  = static_cast< std::size_t >(Read< U64 >());
+		const auto indices     = ReadArray< IndexT >(nb_indices);
+		m_model_output.m_index_buffer.assign(indices, indices + nb_indices);
+
+		const auto nb_materials = Read< U32 >();
+		m_model_output.m_material_buffer.reserve(nb_materials);
+		for (U32 i = 0u; i < nb_materials; ++i) {
+			ReadMDLBMaterial();
+		}
+
+		const auto nb_model_parts = Read< U32 >();
+		m_model_output.m_model_parts.reserve(nb_model_parts);
+		for (U32 i = 0u; i < nb_model_parts; ++i) {
+			ReadMDLBModelPart();
+		}
+
+		ThrowIfFailed(!ContainsChars(),
+					  "{}: unexpected trailing bytes.", GetPath());
+	}
+
+	template< typename VertexT, typename IndexT >
+	[[nodiscard]]
+	bool MDLBReader< VertexT, IndexT >::IsHeaderValid() {
+		for (auto magic = g_mdlb_token_magic; *magic != '\0'; ++magic) {
+			if (*magic != Read< char >()) {
+				return false;
+			}
+		}
+
+		return g_mdlb_version                     == Read< U32 >()
+			&& GetMSHVertexLayout< VertexT >()    == Read< U32 >()
+			&& static_cast< U32 >(sizeof(VertexT)) == Read< U32 >()
+			&& static_cast< U32 >(sizeof(IndexT))  == Read< U32 >();
+	}
+
+	template< typename VertexT, typename IndexT >
+	[[nodiscard]]
+	bool MDLBReader< VertexT, IndexT >::IsSourceHashValid() {
+		const auto source_hash     = Read< U64 >();
+		const auto nb_dependencies = Read< U32 >();
+
+		auto& dependencies = m_model_output.m_dependencies;
+		dependencies.clear();
+		dependencies.reserve(nb_dependencies);
+		for (U32 i = 0u; i < nb_dependencies; ++i) {
+			dependencies.emplace_back(ReadMDLBWideString());
+		}
+
+		return source_hash == ComputeMDLBSourceHash(m_source_path,
+													dependencies,
+													m_seed);
+	}
+
+	template< typename VertexT, typename IndexT >
+	void MDLBReader< VertexT, IndexT >::ReadMDLBMaterial() {
+		Material material(ReadMDLBString());
+
+		material.GetBaseColor() = Read< RGBA >();
+		material.SetRoughness(Read< F32 >());
+		material.SetMetalness(Read< F32 >());
+		material.SetTransparent(0u != Read< U8 >());
+		material.SetRadiance(Read< F32 >());
+
+		material.SetBaseColorTexture(
+			ImportMDLBTexture(ReadMDLBWideString(), m_resource_manager));
+		material.SetMaterialTexture(
+			ImportMDLBTexture(ReadMDLBWideString(), m_resource_manager));
+		material.SetNormalTexture(
+			ImportMDLBTexture(ReadMDLBWideString(), m_resource_manager));
+
+		m_model_output.m_material_buffer.push_back(std::move(material));
+	}
+
+	template< typename VertexT, typename IndexT >
+	void MDLBReader< VertexT, IndexT >::ReadMDLBModelPart() {
+		ModelPart model_part;
+		model_part.m_child       = ReadMDLBString();
+		model_part.m_parent      = ReadMDLBString();
+		model_part.m_material    = ReadMDLBString();
+		model_part.m_transform.SetTranslation(Read< F32x3 >());
+		model_part.m_transform.SetRotation(   Read< F32x3 >());
+		model_part.m_transform.SetScale(      Read< F32x3 >());
+		model_part.m_start_index = Read< U32 >();
+		model_part.m_nb_indices  = Read< U32 >();
+
+		const auto p_min    = Read< F32x3 >();
+		const auto p_max    = Read< F32x3 >();
+		model_part.m_aabb   = AABB(XMLoad(p_min), XMLoad(p_max));
+
+		const auto centroid = Read< F32x3 >();
+		const auto radius   = Read< F32 >();
+		model_part.m_sphere = BoundingSphere(XMLoad(centroid), radius);
+
+		ThrowIfFailed((model_part.m_start_index <= m_model_output.m_index_buffer.size()
+					   && model_part.m_nb_indices <= m_model_output.m_index_buffer.size()
+						                             - model_part.m_start_index),
+					  "{}: invalid index range of model part: {}.",
+					  GetPath(), model_part.m_child);
+
+		m_model_output.m_model_parts.push_back(std::move(model_part));
+	}
+
+	template< typename VertexT, typename IndexT >
+	[[nodiscard]]
+	const std::string MDLBReader< VertexT, IndexT >::ReadMDLBString() {
+		const auto size = Read< U32 >();
+		const auto str  = ReadArray< char >(size);
+		return std::string(str, size);
+	}
+
+	template< typename VertexT, typename IndexT >
+	[[nodiscard]]
+	const std::wstring MDLBReader< VertexT, IndexT >::ReadMDLBWideString() {
+		const auto size = Read< U32 >();
+		const auto str  = ReadArray< wchar_t >(size);
+		return std::wstring(str, size);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,30 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "type\types.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering::loader {
+
+	constexpr const_zstring g_mdlb_token_magic = "MAGEmdlb";
+
+	/**
+	 The version of MDLB files. Cached MDLB files of another version are
+	 considered stale.
+	 */
+	constexpr U32 g_mdlb_version = 1u;
+
+	/**
+	 The extension which is appended to the path of a source model file to
+	 obtain the path of its cached MDLB file.
+	 */
+	constexpr const wchar_t* g_mdlb_extension = L".mdlb";
+}
\ No newline at end of file
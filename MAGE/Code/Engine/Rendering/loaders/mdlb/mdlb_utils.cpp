@@ -0,0 +1,57 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "loaders\mdlb\mdlb_utils.hpp"
+#include "loaders\mdlb\mdlb_tokens.hpp"
+#include "resource\rendering_resource_manager.hpp"
+#include "io\checksum.hpp"
+#include "io\mapped_file.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering::loader {
+
+	[[nodiscard]]
+	const std::filesystem::path
+		GetMDLBPath(const std::filesystem::path& source_path) {
+
+		// Append (instead of replace) the extension to avoid collisions
+		// between source model files with the same stem.
+		auto path = source_path;
+		path += g_mdlb_extension;
+		return path;
+	}
+
+	[[nodiscard]]
+	U64 ComputeMDLBSourceHash(const std::filesystem::path& source_path,
+							  gsl::span< const std::filesystem::path > dependencies,
+							  U64 seed) {
+
+		const MappedFile source_file(source_path);
+		auto hash = ComputeChecksum(source_file.GetData(), seed);
+
+		for (const auto& dependency : dependencies) {
+			const MappedFile file(dependency);
+			hash = ComputeChecksum(file.GetData(), hash);
+		}
+
+		return hash;
+	}
+
+	[[nodiscard]]
+	TexturePtr ImportMDLBTexture(const std::wstring& guid,
+								 ResourceManager& resource_manager) {
+
+		using std::empty;
+		if (empty(guid)) {
+			return nullptr;
+		}
+
+		return resource_manager.GetOrCreate< Texture >(guid);
+	}
+}
\ No newline at end of file
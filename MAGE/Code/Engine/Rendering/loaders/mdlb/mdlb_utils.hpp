@@ -0,0 +1,82 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "resource\texture\texture.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <filesystem>
+#include <gsl\span>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+	// Forward declaration.
+	class ResourceManager;
+}
+
+namespace mage::rendering::loader {
+
+	/**
+	 Returns the path of the MDLB file caching the model of the source model
+	 file associated with the given path.
+
+	 @param[in]		source_path
+					A reference to the path of the source model file.
+	 @return		The path of the MDLB file.
+	 */
+	[[nodiscard]]
+	const std::filesystem::path
+		GetMDLBPath(const std::filesystem::path& source_path);
+
+	/**
+	 Computes the source hash of a MDLB file (i.e. the checksum of the
+	 contents of the source model file and all its dependencies).
+
+	 @param[in]		source_path
+					A reference to the path of the source model file.
+	 @param[in]		dependencies
+					The paths of the files (e.g., MSH and MTL files) the
+					source model file depends on.
+	 @param[in]		seed
+					The initial checksum value.
+	 @return		The source hash.
+	 @throws		Exception
+					Failed to read the source model file or one of its
+					dependencies.
+	 */
+	[[nodiscard]]
+	U64 ComputeMDLBSourceHash(const std::filesystem::path& source_path,
+							  gsl::span< const std::filesystem::path > dependencies,
+							  U64 seed);
+
+	/**
+	 Imports the texture associated with the given globally unique identifier
+	 of a MDLB file.
+
+	 @param[in]		guid
+					A reference to the globally unique identifier of the
+					texture. An empty identifier denotes the absence of a
+					texture.
+	 @param[in,out]	resource_manager
+					A reference to the resource manager.
+	 @return		A pointer to the texture. @c nullptr if @a guid is empty.
+	 @throws		Exception
+					Failed to import the texture.
+	 */
+	[[nodiscard]]
+	TexturePtr ImportMDLBTexture(const std::wstring& guid,
+								 ResourceManager& resource_manager);
+}
\ No newline at end of file
@@ -0,0 +1,189 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "io\binary_writer.hpp"
+#include "resource\model\model_output.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations
+//-----------------------------------------------------------------------------
+namespace mage::rendering::loader {
+
+	/**
+	 A class of MDLB file writers for writing (compiled) models.
+
+	 A MDLB file contains the vertices, indices, resolved materials and model
+	 parts (including their transforms and bounding volumes) of a model, and
+	 a hash of the source model file and its dependencies. All values are
+	 stored in the native byte order of the engine.
+
+	 @tparam		VertexT
+					The vertex type.
+	 @tparam		IndexT
+					The index type.
+	 */
+	template< typename VertexT, typename IndexT >
+	class MDLBWriter : private BigEndianBinaryWriter {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a MDLB writer.
+
+		 @param[in]		model_output
+						A reference to the model output.
+		 @param[in]		source_hash
+						The source hash of the model output.
+		 */
+		explicit MDLBWriter(const ModelOutput< VertexT, IndexT >& model_output,
+							U64 source_hash);
+
+		/**
+		 Constructs a MDLB writer from the given MDLB writer.
+
+		 @param[in]		writer
+						A reference to the MDLB writer to copy.
+		 */
+		MDLBWriter(const MDLBWriter& writer) = delete;
+
+		/**
+		 Constructs a MDLB writer by moving the given MDLB writer.
+
+		 @param[in]		writer
+						A reference to the MDLB writer to move.
+		 */
+		MDLBWriter(MDLBWriter&& writer) noexcept;
+
+		/**
+		 Destructs this MDLB writer.
+		 */
+		~MDLBWriter();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given MDLB writer to this MDLB writer.
+
+		 @param[in]		writer
+						A reference to a MDLB writer to copy.
+		 @return		A reference to the copy of the given MDLB writer (i.e.
+						this MDLB writer).
+		 */
+		MDLBWriter& operator=(const MDLBWriter& writer) = delete;
+
+		/**
+		 Moves the given MDLB writer to this MDLB writer.
+
+		 @param[in]		writer
+						A reference to a MDLB writer to move.
+		 @return		A reference to the moved MDLB writer (i.e. this MDLB
+						writer).
+		 */
+		MDLBWriter& operator=(MDLBWriter&& writer) = delete;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		using BigEndianBinaryWriter::WriteToFile;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Starts writing.
+
+		 @throws		Exception
+						Failed to write.
+		 */
+		virtual void WriteData() override;
+
+		/**
+		 Writes the given material.
+
+		 @param[in]		material
+						A reference to the material.
+		 @throws		Exception
+						Failed to write the given material.
+		 */
+		void WriteMDLBMaterial(const Material& material);
+
+		/**
+		 Writes the given model part.
+
+		 @param[in]		model_part
+						A reference to the model part.
+		 @throws		Exception
+						Failed to write the given model part.
+		 */
+		void WriteMDLBModelPart(const ModelPart& model_part);
+
+		/**
+		 Writes the given (length-prefixed) string.
+
+		 @param[in]		str
+						The string.
+		 @throws		Exception
+						Failed to write the given string.
+		 */
+		void WriteMDLBString(std::string_view str);
+
+		/**
+		 Writes the given (length-prefixed) wide string.
+
+		 @param[in]		str
+						The wide string.
+		 @throws		Exception
+						Failed to write the given wide string.
+		 */
+		void WriteMDLBWideString(std::wstring_view str);
+
+		/**
+		 Writes the globally unique identifier of the given texture.
+
+		 @param[in]		texture
+						A pointer to the texture.
+		 @throws		Exception
+						Failed to write the globally unique identifier.
+		 */
+		void WriteMDLBTexture(const TexturePtr& texture);
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 A reference to the model output of this MDLB writer.
+		 */
+		const ModelOutput< VertexT, IndexT >& m_model_output;
+
+		/**
+		 The source hash of this MDLB writer.
+		 */
+		U64 m_source_hash;
+	};
+}
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "loaders\mdlb\mdlb_writer.tpp"
+
+#pragma endregion
\ No newline at end of file
@@ -0,0 +1,143 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "loaders\mdlb\mdlb_tokens.hpp"
+#include "loaders\msh\msh_header.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <type_traits>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering::loader {
+
+	template< typename VertexT, typename IndexT >
+	MDLBWriter< VertexT, IndexT >
+		::MDLBWriter(const ModelOutput< VertexT, IndexT >& model_output,
+					 U64 source_hash)
+		: BigEndianBinaryWriter(),
+		m_model_output(model_output),
+		m_source_hash(source_hash) {}
+
+	template< typename VertexT, typename IndexT >
+	MDLBWriter< VertexT, IndexT >
+		::MDLBWriter(MDLBWriter&& writer) noexcept = default;
+
+	template< typename VertexT, typename IndexT >
+	MDLBWriter< VertexT, IndexT >::~MDLBWriter() = default;
+
+	template< typename VertexT, typename IndexT >
+	void MDLBWriter< VertexT, IndexT >::WriteData() {
+		static_assert(std::is_trivially_copyable_v< VertexT >);
+		static_assert(std::is_trivially_copyable_v< IndexT >);
+
+		// Write the header.
+		WriteString(g_mdlb_token_magic);
+		Write(g_mdlb_version);
+		Write(GetMSHVertexLayout< VertexT >());
+		Write(static_cast< U32 >(sizeof(VertexT)));
+		Write(static_cast< U32 >(sizeof(IndexT)));
+
+		// Write the source hash and the dependencies.
+		Write(m_source_hash);
+		Write(static_cast< U32 >(m_model_output.m_dependencies.size()));
+		for (const auto& dependency : m_model_output.m_dependencies) {
+			WriteMDLBWideString(dependency.native());
+		}
+
+		// Write the vertices and indices.
+		Write(static_cast< U64 >(m_model_output.m_vertex_buffer.size()));
+		WriteArray(gsl::make_span(m_model_output.m_vertex_buffer));
+		Write(static_cast< U64 >(m_model_output.m_index_buffer.size()));
+		WriteArray(gsl::make_span(m_model_output.m_index_buffer));
+
+		// Write the materials.
+		Write(static_cast< U32 >(m_model_output.m_material_buffer.size()));
+		for (const auto& material : m_model_output.m_material_buffer) {
+			WriteMDLBMaterial(material);
+		}
+
+		// Write the model parts.
+		Write(static_cast< U32 >(m_model_output.m_model_parts.size()));
+		for (const auto& model_part : m_model_output.m_model_parts) {
+			WriteMDLBModelPart(model_part);
+		}
+	}
+
+	template< typename VertexT, typename IndexT >
+	void MDLBWriter< VertexT, IndexT >
+		::WriteMDLBMaterial(const Material& material) {
+
+		WriteMDLBString(material.GetName());
+		Write(material.GetBaseColor());
+		Write(material.GetRoughness());
+		Write(material.GetMetalness());
+		Write(static_cast< U8 >(material.IsTransparant() ? 1u : 0u));
+		Write(material.GetRadiance());
+
+		WriteMDLBTexture(material.GetBaseColorTexture());
+		WriteMDLBTexture(material.GetMaterialTexture());
+		WriteMDLBTexture(material.GetNormalTexture());
+	}
+
+	template< typename VertexT, typename IndexT >
+	void MDLBWriter< VertexT, IndexT >
+		::WriteMDLBModelPart(const ModelPart& model_part) {
+
+		WriteMDLBString(model_part.m_child);
+		WriteMDLBString(model_part.m_parent);
+		WriteMDLBString(model_part.m_material);
+		Write(model_part.m_transform.GetTranslationView());
+		Write(model_part.m_transform.GetRotationView());
+		Write(model_part.m_transform.GetScaleView());
+		Write(model_part.m_start_index);
+		Write(model_part.m_nb_indices);
+
+		Write(XMStore< F32x3 >(model_part.m_aabb.MinPoint()));
+		Write(XMStore< F32x3 >(model_part.m_aabb.MaxPoint()));
+
+		Write(XMStore< F32x3 >(model_part.m_sphere.Centroid()));
+		Write(model_part.m_sphere.Radius());
+	}
+
+	template< typename VertexT, typename IndexT >
+	void MDLBWriter< VertexT, IndexT >
+		::WriteMDLBString(std::string_view str) {
+
+		Write(static_cast< U32 >(str.size()));
+		WriteArray(gsl::make_span(str.data(), str.size()));
+	}
+
+	template< typename VertexT, typename IndexT >
+	void MDLBWriter< VertexT, IndexT >
+		::WriteMDLBWideString(std::wstring_view str) {
+
+		Write(static_cast< U32 >(str.size()));
+		WriteArray(gsl::make_span(str.data(), str.size()));
+	}
+
+	template< typename VertexT, typename IndexT >
+	void MDLBWriter< VertexT, IndexT >
+		::WriteMDLBTexture(const TexturePtr& texture) {
+
+		if (texture) {
+			WriteMDLBWideString(texture->GetGuid());
+		}
+		else {
+			WriteMDLBWideString({});
+		}
+	}
+}
\ No newline at end of file
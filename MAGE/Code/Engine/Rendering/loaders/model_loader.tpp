@@ -6,10 +6,20 @@
 #pragma region
 
 #include "loaders\mdl\mdl_loader.hpp"
+#include "loaders\mdlb\mdlb_loader.hpp"
 #include "loaders\obj\obj_loader.hpp"
 
 #pragma endregion
 
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <utility>
+
+#pragma endregion
+
 //-----------------------------------------------------------------------------
 // Engine Definitions
 //-----------------------------------------------------------------------------
@@ -33,6 +43,22 @@ namespace mage::rendering::loader {
 		else {
 			throw Exception("Unknown model file extension: {}", path);
 		}
+
+		if (mesh_desc.OptimizeMesh()) {
+			const auto nb_vertices = model_output.m_vertex_buffer.size();
+			const auto before = AnalyzeVertexCache(
+				gsl::make_span(std::as_const(model_output.m_index_buffer)), nb_vertices);
+
+			model_output.OptimizeModelParts(mesh_desc.ClockwiseOrder());
+
+			const auto after  = AnalyzeVertexCache(
+				gsl::make_span(std::as_const(model_output.m_index_buffer)), nb_vertices);
+
+			Info("{}: vertex cache ACMR: {:.3f} -> {:.3f}, ATVR: {:.3f} -> {:.3f}.",
+				 path,
+				 before.GetACMR(), after.GetACMR(),
+				 before.GetATVR(), after.GetATVR());
+		}
 	}
 
 	template< typename VertexT, typename IndexT >
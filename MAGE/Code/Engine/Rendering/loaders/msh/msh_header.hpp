@@ -0,0 +1,130 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "type\types.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering::loader {
+
+	/**
+	 The version of MSH v2 files.
+	 */
+	constexpr U32 g_msh_version = 2u;
+
+	/**
+	 The alignment (in bytes) of the vertex and index data of MSH v2 files.
+	 */
+	constexpr std::size_t g_msh_alignment = 16u;
+
+	/**
+	 A struct of MSH v2 file headers.
+
+	 A MSH v2 file consists of the header followed by the vertices and the
+	 indices, each starting at a multiple of @c g_msh_alignment bytes. All
+	 values are stored in little endian byte order (i.e. the native byte
+	 order of the engine) so that the vertices and indices can be used
+	 directly from a memory-mapped file.
+	 */
+	struct alignas(16) MSHHeader {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The magic (not null-terminated) of this MSH header.
+		 */
+		char m_magic[8];
+
+		/**
+		 The version of this MSH header.
+		 */
+		U32 m_version;
+
+		/**
+		 The vertex layout (i.e. a bit mask of the vertex components) of this
+		 MSH header.
+		 */
+		U32 m_vertex_layout;
+
+		/**
+		 The size (in bytes) of a vertex of this MSH header.
+		 */
+		U32 m_vertex_size;
+
+		/**
+		 The size (in bytes) of an index of this MSH header.
+		 */
+		U32 m_index_size;
+
+		/**
+		 The number of vertices of this MSH header.
+		 */
+		U64 m_nb_vertices;
+
+		/**
+		 The number of indices of this MSH header.
+		 */
+		U64 m_nb_indices;
+
+		/**
+		 The offset (in bytes) of the vertices from the start of the file of
+		 this MSH header.
+		 */
+		U64 m_vertices_offset;
+
+		/**
+		 The offset (in bytes) of the indices from the start of the file of
+		 this MSH header.
+		 */
+		U64 m_indices_offset;
+
+		/**
+		 The checksum of the vertices and indices (in that order) of this MSH
+		 header.
+		 */
+		U64 m_checksum;
+	};
+
+	static_assert(64u == sizeof(MSHHeader));
+
+	/**
+	 Returns the MSH vertex layout of the given vertex type.
+
+	 @tparam		VertexT
+					The vertex type.
+	 @return		The MSH vertex layout (i.e. a bit mask of the vertex
+					components) of the given vertex type.
+	 */
+	template< typename VertexT >
+	[[nodiscard]]
+	constexpr U32 GetMSHVertexLayout() noexcept {
+		return (VertexT::HasPosition() ? 1u : 0u)
+			 | (VertexT::HasNormal()   ? 2u : 0u)
+			 | (VertexT::HasTexture()  ? 4u : 0u)
+			 | (VertexT::HasColor()    ? 8u : 0u);
+	}
+
+	/**
+	 Aligns the given offset to the MSH alignment.
+
+	 @param[in]		offset
+					The offset (in bytes).
+	 @return		The smallest multiple of @c g_msh_alignment which is not
+					smaller than @a offset.
+	 */
+	[[nodiscard]]
+	constexpr U64 AlignMSHOffset(U64 offset) noexcept {
+		return (offset + (g_msh_alignment - 1u)) & ~U64(g_msh_alignment - 1u);
+	}
+}
\ No newline at end of file
@@ -48,6 +48,7 @@ namespace mage::rendering::loader {
 
 	/**
 	 Exports the given mesh to the MSH file associated with the given path.
+	 The mesh is written in the MSH v2 format.
 
 	 @tparam		VertexT
 					The vertex type.
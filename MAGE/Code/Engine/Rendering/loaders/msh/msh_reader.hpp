@@ -26,6 +26,9 @@ namespace mage::rendering::loader {
 	/**
 	 A class of MSH file readers for reading meshes.
 
+	 MSH v2 files are read directly from a memory-mapped file view. Legacy
+	 (v1) MSH files are read with a big endian binary reader.
+
 	 @tparam		VertexT
 					The vertex type.
 	 @tparam		IndexT
@@ -102,9 +105,25 @@ namespace mage::rendering::loader {
 		// Member Methods
 		//---------------------------------------------------------------------
 
-		using BigEndianBinaryReader::ReadFromFile;
+		/**
+		 Reads from the file associated with the given path.
+
+		 @param[in]		path
+						A reference to the path.
+		 @throws		Exception
+						Failed to read from the file.
+		 */
+		void ReadFromFile(const std::filesystem::path& path);
+
+		/**
+		 Reads the input string.
 
-		using BigEndianBinaryReader::ReadFromMemory;
+		 @param[in]		input
+						The input byte string.
+		 @throws		Exception
+						Failed to read from the given input string.
+		 */
+		void ReadFromMemory(gsl::span< const U8 > input);
 
 	private:
 
@@ -112,6 +131,34 @@ namespace mage::rendering::loader {
 		// Member Methods
 		//---------------------------------------------------------------------
 
+		/**
+		 Reads the given input string (of any MSH version).
+
+		 @param[in]		input
+						The input byte string.
+		 @param[in]		path
+						A reference to the path of the file containing the
+						given input string.
+		 @throws		Exception
+						Failed to read from the given input string.
+		 */
+		void Read(gsl::span< const U8 > input,
+				  const std::filesystem::path& path);
+
+		/**
+		 Reads the given MSH v2 input string.
+
+		 @param[in]		input
+						The input byte string.
+		 @param[in]		path
+						A reference to the path of the file containing the
+						given input string.
+		 @throws		Exception
+						Failed to read from the given input string.
+		 */
+		void ReadMSHv2(gsl::span< const U8 > input,
+					   const std::filesystem::path& path);
+
 		/**
 		 Starts reading.
 
@@ -5,11 +5,24 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
+#include "loaders\msh\msh_header.hpp"
 #include "loaders\msh\msh_tokens.hpp"
+#include "io\checksum.hpp"
+#include "io\mapped_file.hpp"
 #include "exception\exception.hpp"
 
 #pragma endregion
 
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <cstring>
+#include <type_traits>
+
+#pragma endregion
+
 //-----------------------------------------------------------------------------
 // Engine Definitions
 //-----------------------------------------------------------------------------
@@ -30,6 +43,104 @@ namespace mage::rendering::loader {
 	template< typename VertexT, typename IndexT >
 	MSHReader< VertexT, IndexT >::~MSHReader() = default;
 
+	template< typename VertexT, typename IndexT >
+	void MSHReader< VertexT, IndexT >
+		::ReadFromFile(const std::filesystem::path& path) {
+
+		const MappedFile file(path);
+		Read(file.GetData(), path);
+	}
+
+	template< typename VertexT, typename IndexT >
+	void MSHReader< VertexT, IndexT >
+		::ReadFromMemory(gsl::span< const U8 > input) {
+
+		Read(input, L"input string");
+	}
+
+	template< typename VertexT, typename IndexT >
+	void MSHReader< VertexT, IndexT >
+		::Read(gsl::span< const U8 > input, const std::filesystem::path& path) {
+
+		constexpr std::size_t magic_size = sizeof(MSHHeader::m_magic);
+		static_assert(magic_size == std::char_traits< char >::length(g_msh_v2_token_magic));
+
+		const auto is_v2 = magic_size <= input.size()
+			&& 0 == std::memcmp(input.data(), g_msh_v2_token_magic, magic_size);
+		if (is_v2) {
+			ReadMSHv2(input, path);
+		}
+		else {
+			BigEndianBinaryReader::ReadFromMemory(input, path);
+		}
+	}
+
+	template< typename VertexT, typename IndexT >
+	void MSHReader< VertexT, IndexT >
+		::ReadMSHv2(gsl::span< const U8 > input,
+					const std::filesystem::path& path) {
+
+		static_assert(std::is_trivially_copyable_v< VertexT >);
+		static_assert(std::is_trivially_copyable_v< IndexT >);
+
+		using std::empty;
+		ThrowIfFailed(empty(m_vertices),
+					  "{}: vertex buffer must be empty.", path);
+		ThrowIfFailed(empty(m_indices),
+					  "{}: index buffer must be empty.", path);
+
+		// Read the header.
+		ThrowIfFailed((sizeof(MSHHeader) <= input.size()),
+					  "{}: end of file: no mesh header found.", path);
+		MSHHeader header;
+		std::memcpy(&header, input.data(), sizeof(MSHHeader));
+
+		ThrowIfFailed((g_msh_version == header.m_version),
+					  "{}: unsupported mesh version: {}.", path, header.m_version);
+		ThrowIfFailed((GetMSHVertexLayout< VertexT >() == header.m_vertex_layout
+					   && sizeof(VertexT) == header.m_vertex_size),
+					  "{}: vertex layout mismatch.", path);
+		ThrowIfFailed((sizeof(IndexT) == header.m_index_size),
+					  "{}: index size mismatch: {} bytes expected, {} bytes found.",
+					  path, sizeof(IndexT), header.m_index_size);
+
+		// Validate the vertex and index ranges.
+		const auto size = static_cast< U64 >(input.size());
+		const auto is_range_valid = [size](U64 offset, U64 count, U64 stride) {
+			return sizeof(MSHHeader) <= offset
+				&& 0u == offset % g_msh_alignment
+				&& offset <= size
+				&& count <= (size - offset) / stride;
+		};
+		ThrowIfFailed(is_range_valid(header.m_vertices_offset,
+									 header.m_nb_vertices, sizeof(VertexT)),
+					  "{}: invalid vertex range.", path);
+		ThrowIfFailed(is_range_valid(header.m_indices_offset,
+									 header.m_nb_indices, sizeof(IndexT)),
+					  "{}: invalid index range.", path);
+
+		const auto vertex_bytes = input.subspan(
+			static_cast< std::size_t >(header.m_vertices_offset),
+			static_cast< std::size_t >(header.m_nb_vertices * sizeof(VertexT)));
+		const auto index_bytes = input.subspan(
+			static_cast< std::size_t >(header.m_indices_offset),
+			static_cast< std::size_t >(header.m_nb_indices * sizeof(IndexT)));
+
+		// Validate the checksum.
+		const auto checksum = ComputeChecksum(index_bytes,
+											  ComputeChecksum(vertex_bytes));
+		ThrowIfFailed((header.m_checksum == checksum),
+					  "{}: checksum mismatch.", path);
+
+		// Copy the vertices and indices directly from the (mapped) input
+		// string: no intermediate buffers and no byte swapping.
+		const auto vertices = reinterpret_cast< const VertexT* >(vertex_bytes.data());
+		m_vertices.assign(vertices, vertices + header.m_nb_vertices);
+
+		const auto indices  = reinterpret_cast< const IndexT* >(index_bytes.data());
+		m_indices.assign(indices, indices + header.m_nb_indices);
+	}
+
 	template< typename VertexT, typename IndexT >
 	void MSHReader< VertexT, IndexT >::ReadData() {
 		using std::empty;
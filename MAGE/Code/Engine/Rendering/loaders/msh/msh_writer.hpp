@@ -24,7 +24,7 @@
 namespace mage::rendering::loader {
 
 	/**
-	 A class of MSH file writers for writing meshes.
+	 A class of MSH file writers for writing meshes (in the MSH v2 format).
 
 	 @tparam		VertexT
 					The vertex type.
@@ -5,7 +5,19 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
+#include "loaders\msh\msh_header.hpp"
 #include "loaders\msh\msh_tokens.hpp"
+#include "io\checksum.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <cstring>
+#include <type_traits>
 
 #pragma endregion
 
@@ -31,15 +43,38 @@ namespace mage::rendering::loader {
 
 	template< typename VertexT, typename IndexT >
 	void MSHWriter< VertexT, IndexT >::WriteData() {
+		static_assert(std::is_trivially_copyable_v< VertexT >);
+		static_assert(std::is_trivially_copyable_v< IndexT >);
+
+		const auto vertices = gsl::make_span(m_vertices);
+		const auto indices  = gsl::make_span(m_indices);
+		const gsl::span< const U8 > vertex_bytes(
+			reinterpret_cast< const U8* >(vertices.data()), vertices.size_bytes());
+		const gsl::span< const U8 > index_bytes(
+			reinterpret_cast< const U8* >(indices.data()), indices.size_bytes());
 
-		WriteString(NotNull< const_zstring >(g_msh_token_magic));
+		MSHHeader header = {};
+		std::memcpy(header.m_magic, g_msh_v2_token_magic, sizeof(header.m_magic));
+		header.m_version         = g_msh_version;
+		header.m_vertex_layout   = GetMSHVertexLayout< VertexT >();
+		header.m_vertex_size     = static_cast< U32 >(sizeof(VertexT));
+		header.m_index_size      = static_cast< U32 >(sizeof(IndexT));
+		header.m_nb_vertices     = static_cast< U64 >(vertices.size());
+		header.m_nb_indices      = static_cast< U64 >(indices.size());
+		header.m_vertices_offset = AlignMSHOffset(sizeof(MSHHeader));
+		header.m_indices_offset  = AlignMSHOffset(header.m_vertices_offset
+												  + vertices.size_bytes());
+		header.m_checksum        = ComputeChecksum(index_bytes,
+												   ComputeChecksum(vertex_bytes));
 
-		const auto nb_vertices = static_cast< U32 >(m_vertices.size());
-		Write< U32 >(nb_vertices);
-		const auto nb_indices  = static_cast< U32 >(m_indices.size());
-		Write< U32 >(nb_indices);
+		static constexpr U8 s_padding[g_msh_alignment] = {};
+		const auto nb_padding_bytes = static_cast< std::size_t >(
+			header.m_indices_offset - header.m_vertices_offset
+			- vertices.size_bytes());
 
-		WriteArray(gsl::make_span(m_vertices));
-		WriteArray(gsl::make_span(m_indices));
+		Write(header);
+		WriteArray(vertices);
+		WriteArray(gsl::make_span(s_padding, nb_padding_bytes));
+		WriteArray(indices);
 	}
 }
\ No newline at end of file
@@ -0,0 +1,270 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "loaders\obj\obj_chunk_reader.hpp"
+#include "loaders\obj\obj_tokens.hpp"
+#include "resource\rendering_resource_manager.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <charconv>
+#include <exception>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering::loader {
+
+	namespace {
+
+		/**
+		 The minimum number of bytes of an OBJ chunk. Smaller inputs are read
+		 as a single OBJ chunk on the calling thread.
+		 */
+		constexpr std::size_t s_min_chunk_size = 1u << 20u;
+	}
+
+	OBJChunkReader::OBJChunkReader(OBJChunk& chunk, bool invert_handness)
+		: LineReader(),
+		m_chunk(chunk),
+		m_invert_handness(invert_handness) {}
+
+	OBJChunkReader::OBJChunkReader(OBJChunkReader&& reader) noexcept = default;
+
+	OBJChunkReader::~OBJChunkReader() = default;
+
+	void OBJChunkReader::ReadLine() {
+		const auto token = Read< std::string_view >();
+
+		if (g_obj_token_comment == token[0]) {
+			return;
+		}
+		else if (g_obj_token_vertex           == token) {
+			ReadOBJVertex();
+		}
+		else if (g_obj_token_texture          == token) {
+			ReadOBJVertexTexture();
+		}
+		else if (g_obj_token_normal           == token) {
+			ReadOBJVertexNormal();
+		}
+		else if (g_obj_token_face             == token) {
+			ReadOBJFace();
+		}
+		else if (g_obj_token_material_library == token) {
+			ReadOBJStatement(OBJStatementType::MaterialLibrary);
+		}
+		else if (g_obj_token_material_use     == token) {
+			ReadOBJStatement(OBJStatementType::MaterialUse);
+		}
+		else if (g_obj_token_group            == token) {
+			ReadOBJStatement(OBJStatementType::Group);
+		}
+		else if (g_obj_token_object           == token) {
+			ReadOBJStatement(OBJStatementType::Group);
+		}
+		else if (g_obj_token_smoothing_group  == token) {
+			ReadOBJSmoothingGroup();
+		}
+		else {
+			Warning("{}: line {}: unsupported keyword token: {}.",
+					GetPath(), GetCurrentLineNumber(), token);
+			return;
+		}
+
+		ReadRemainingTokens();
+	}
+
+	void OBJChunkReader::ReadOBJStatement(OBJStatementType type) {
+		m_chunk.m_statements.push_back({
+			type,
+			m_chunk.m_face_sizes.size(),
+			std::string(Read< std::string_view >())
+		});
+	}
+
+	void OBJChunkReader::ReadOBJSmoothingGroup() {
+		// Silently ignore smoothing group declarations.
+		Read< std::string_view >();
+	}
+
+	void OBJChunkReader::ReadOBJVertex() {
+		const Point3 read_vertex(Read< F32, 3u >());
+		const auto vertex = m_invert_handness ?
+			InvertHandness(read_vertex) : read_vertex;
+
+		m_chunk.m_vertex_coordinates.push_back(vertex);
+	}
+
+	void OBJChunkReader::ReadOBJVertexTexture() {
+		const UV read_texture(Read< F32, 2u >());
+		if (Contains< F32 >()) {
+			// Silently ignore 3D vertex texture coordinates.
+			Read< F32 >();
+		}
+
+		const auto texture = m_invert_handness ?
+			InvertHandness(read_texture) : read_texture;
+
+		m_chunk.m_vertex_texture_coordinates.push_back(texture);
+	}
+
+	void OBJChunkReader::ReadOBJVertexNormal() {
+		const Normal3 read_normal(Read< F32, 3u >());
+		const auto normal = m_invert_handness ?
+			InvertHandness(read_normal) : read_normal;
+
+		m_chunk.m_vertex_normal_coordinates.push_back(normal);
+	}
+
+	void OBJChunkReader::ReadOBJFace() {
+		U32 nb_vertices = 0u;
+		while (nb_vertices < 3u || ContainsTokens()) {
+			m_chunk.m_face_vertices.push_back(ReadOBJVertexIndices());
+			++nb_vertices;
+		}
+
+		m_chunk.m_face_sizes.push_back(nb_vertices);
+	}
+
+	[[nodiscard]]
+	const OBJFaceVertex OBJChunkReader::ReadOBJVertexIndices() {
+		const auto token = Read< std::string_view >();
+
+		static constexpr const_zstring s_token_names[] = {
+			"v",
+			"vt",
+			"vn"
+		};
+
+		OBJFaceVertex vertex = {};
+		const S32x3 sizes = {
+			static_cast< S32 >(m_chunk.m_vertex_coordinates.size()),
+			static_cast< S32 >(m_chunk.m_vertex_texture_coordinates.size()),
+			static_cast< S32 >(m_chunk.m_vertex_normal_coordinates.size())
+		};
+
+		// Parse the v, v/vt, v//vn or v/vt/vn token in a single pass.
+		const char*       first = token.data();
+		const char* const last  = token.data() + token.size();
+		for (std::size_t i = 0u; i < std::size(s_token_names); ++i) {
+			if (0u != i) {
+				if (first == last) {
+					break;
+				}
+
+				// Skip the separator.
+				++first;
+
+				// Skip the omitted vt index (i.e. v//vn).
+				if (1u == i && first != last && '/' == *first) {
+					continue;
+				}
+			}
+
+			S32 index = 0;
+			const auto [ptr, error_code] = std::from_chars(first, last, index);
+			if (std::errc() != error_code
+				|| (ptr != last && ('/' != *ptr || 2u == i))) {
+
+				throw Exception("{}: line {}: invalid {} index value found in {}.",
+								GetPath(), GetCurrentLineNumber(), s_token_names[i], token);
+			}
+
+			first = ptr;
+			if (0 <= index) {
+				vertex.m_indices[i] = static_cast< U32 >(index);
+			}
+			else {
+				// Relative to the vertex coordinates read so far: the vertex
+				// coordinates of the preceding OBJ chunks are added while
+				// merging.
+				vertex.m_indices[i] = static_cast< U32 >(sizes[i] + index);
+				vertex.m_relative_mask |= static_cast< U8 >(1u << i);
+			}
+		}
+
+		return vertex;
+	}
+
+	[[nodiscard]]
+	std::vector< OBJChunk > ReadOBJChunks(std::string_view input,
+										  const std::filesystem::path& path,
+										  bool invert_handness,
+										  ResourceManager& resource_manager) {
+
+		auto& job_system = resource_manager.GetJobSystem();
+
+		const auto nb_chunks = std::clamp(input.size() / s_min_chunk_size,
+										  std::size_t(1u),
+										  job_system.GetNumberOfWorkers() + 1u);
+
+		// Split the input string on line boundaries.
+		std::vector< std::string_view > inputs;
+		std::vector< U32 > first_line_numbers;
+		inputs.reserve(nb_chunks);
+		first_line_numbers.reserve(nb_chunks);
+
+		const auto chunk_size = input.size() / nb_chunks;
+		U32 line_number = 0u;
+		while (!input.empty()) {
+			auto size = input.size();
+			if (inputs.size() + 1u < nb_chunks) {
+				if (const auto end = input.find('\n', chunk_size - 1u);
+					std::string_view::npos != end) {
+
+					size = end + 1u;
+				}
+			}
+
+			const auto chunk_input = input.substr(0u, size);
+			inputs.push_back(chunk_input);
+			first_line_numbers.push_back(line_number);
+
+			line_number += static_cast< U32 >(
+				std::count(chunk_input.cbegin(), chunk_input.cend(), '\n'));
+			input.remove_prefix(size);
+		}
+
+		std::vector< OBJChunk > chunks(inputs.size());
+		std::vector< std::exception_ptr > exceptions(inputs.size());
+
+		const auto read_chunk = [&](std::size_t index) {
+			try {
+				OBJChunkReader reader(chunks[index], invert_handness);
+				reader.ReadFromMemory(inputs[index], path,
+									  first_line_numbers[index]);
+			}
+			catch (...) {
+				exceptions[index] = std::current_exception();
+			}
+		};
+
+		if (1u == chunks.size()) {
+			read_chunk(0u);
+		}
+		else {
+			job_system.ParallelFor(chunks.size(), read_chunk, 1u);
+		}
+
+		// Report the failure of the first chunk (i.e. the first failure of a
+		// serial read).
+		for (const auto& exception : exceptions) {
+			if (exception) {
+				std::rethrow_exception(exception);
+			}
+		}
+
+		return chunks;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,380 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "io\line_reader.hpp"
+#include "geometry\geometry.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <string>
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+	// Forward declaration.
+	class ResourceManager;
+}
+
+namespace mage::rendering::loader {
+
+	//-------------------------------------------------------------------------
+	// OBJStatementType
+	//-------------------------------------------------------------------------
+
+	/**
+	 An enumeration of the different OBJ statement types which need to be
+	 replayed in order while merging OBJ chunks.
+
+	 This contains:
+	 @c MaterialLibrary,
+	 @c MaterialUse and
+	 @c Group.
+	 */
+	enum class OBJStatementType : U8 {
+		MaterialLibrary,
+		MaterialUse,
+		Group
+	};
+
+	//-------------------------------------------------------------------------
+	// OBJStatement
+	//-------------------------------------------------------------------------
+
+	/**
+	 A struct of OBJ statements.
+	 */
+	struct OBJStatement {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The type of this OBJ statement.
+		 */
+		OBJStatementType m_type;
+
+		/**
+		 The number of faces of the OBJ chunk preceding this OBJ statement.
+		 */
+		std::size_t m_nb_preceding_faces;
+
+		/**
+		 The name (i.e. argument) of this OBJ statement.
+		 */
+		std::string m_name;
+	};
+
+	//-------------------------------------------------------------------------
+	// OBJFaceVertex
+	//-------------------------------------------------------------------------
+
+	/**
+	 A struct of OBJ face vertices.
+	 */
+	struct OBJFaceVertex {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The vertex position/texture/normal coordinates' indices of this OBJ
+		 face vertex. A zero indicates the absence of a component. Relative
+		 indices are resolved against the vertex coordinates of the OBJ chunk
+		 only.
+		 */
+		U32x3 m_indices;
+
+		/**
+		 A bit mask indicating which indices of this OBJ face vertex are
+		 relative (i.e. need to be offset by the number of vertex coordinates
+		 of all preceding OBJ chunks).
+		 */
+		U8 m_relative_mask;
+	};
+
+	//-------------------------------------------------------------------------
+	// OBJChunk
+	//-------------------------------------------------------------------------
+
+	/**
+	 A struct of OBJ chunks (i.e. the records read from a range of lines of an
+	 OBJ file).
+	 */
+	struct OBJChunk {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 A vector containing the read vertex position coordinates of this OBJ
+		 chunk.
+		 */
+		std::vector< Point3 > m_vertex_coordinates;
+
+		/**
+		 A vector containing the read vertex texture coordinates of this OBJ
+		 chunk.
+		 */
+		std::vector< UV > m_vertex_texture_coordinates;
+
+		/**
+		 A vector containing the read vertex normal coordinates of this OBJ
+		 chunk.
+		 */
+		std::vector< Normal3 > m_vertex_normal_coordinates;
+
+		/**
+		 A vector containing the read face vertices of all faces of this OBJ
+		 chunk.
+		 */
+		std::vector< OBJFaceVertex > m_face_vertices;
+
+		/**
+		 A vector containing the number of face vertices of each face of this
+		 OBJ chunk.
+		 */
+		std::vector< U32 > m_face_sizes;
+
+		/**
+		 A vector containing the read statements of this OBJ chunk.
+		 */
+		std::vector< OBJStatement > m_statements;
+	};
+
+	//-------------------------------------------------------------------------
+	// OBJChunkReader
+	//-------------------------------------------------------------------------
+
+	/**
+	 A class of OBJ chunk readers for reading ranges of lines of OBJ files.
+
+	 An OBJ chunk reader does not depend on any preceding range of lines: only
+	 the vertex coordinates, faces and statements are recorded. Relative
+	 indices and model part boundaries are resolved while merging the OBJ
+	 chunks in order.
+	 */
+	class OBJChunkReader : private LineReader {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs an OBJ chunk reader.
+
+		 @param[in,out]	chunk
+						A reference to an OBJ chunk for storing the read data.
+		 @param[in]		invert_handness
+						@c true if the handness of the vertex coordinates
+						should be inverted. @c false otherwise.
+		 */
+		explicit OBJChunkReader(OBJChunk& chunk, bool invert_handness);
+
+		/**
+		 Constructs an OBJ chunk reader from the given OBJ chunk reader.
+
+		 @param[in]		reader
+						A reference to the OBJ chunk reader to copy.
+		 */
+		OBJChunkReader(const OBJChunkReader& reader) = delete;
+
+		/**
+		 Constructs an OBJ chunk reader by moving the given OBJ chunk reader.
+
+		 @param[in]		reader
+						A reference to the OBJ chunk reader to move.
+		 */
+		OBJChunkReader(OBJChunkReader&& reader) noexcept;
+
+		/**
+		 Destructs this OBJ chunk reader.
+		 */
+		~OBJChunkReader();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given OBJ chunk reader to this OBJ chunk reader.
+
+		 @param[in]		reader
+						A reference to a OBJ chunk reader to copy.
+		 @return		A reference to the copy of the given OBJ chunk reader
+						(i.e. this OBJ chunk reader).
+		 */
+		OBJChunkReader& operator=(const OBJChunkReader& reader) = delete;
+
+		/**
+		 Moves the given OBJ chunk reader to this OBJ chunk reader.
+
+		 @param[in]		reader
+						A reference to a OBJ chunk reader to move.
+		 @return		A reference to the moved OBJ chunk reader (i.e. this
+						OBJ chunk reader).
+		 */
+		OBJChunkReader& operator=(OBJChunkReader&& reader) = delete;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		using LineReader::ReadFromMemory;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Reads the current line of this OBJ chunk reader.
+
+		 @throws		Exception
+						Failed to the current line of this OBJ chunk reader.
+		 */
+		virtual void ReadLine() override;
+
+		/**
+		 Reads a statement definition.
+
+		 @param[in]		type
+						The statement type.
+		 @throws		Exception
+						Failed to read a statement definition.
+		 */
+		void ReadOBJStatement(OBJStatementType type);
+
+		/**
+		 Reads a Smoothing Group definition.
+
+		 @note			A smoothing group is, if present,
+						silently ignored.
+		 @throws		Exception
+						Failed to read a Smoothing Group definition.
+		 */
+		void ReadOBJSmoothingGroup();
+
+		/**
+		 Reads a Vertex Position Coordinates definition.
+
+		 @throws		Exception
+						Failed to read a Vertex Position Coordinates
+						definition.
+		 */
+		void ReadOBJVertex();
+
+		/**
+		 Reads a Vertex Texture Coordinates definition.
+
+		 @note			Only UV texture coordinates are supported,
+						The W component of UVW texture coordinates
+						is, if present, silently ignored.
+		 @throws		Exception
+						Failed to read a Vertex Texture Coordinates definition.
+		 */
+		void ReadOBJVertexTexture();
+
+		/**
+		 Reads a Vertex Normal Coordinates definition.
+
+		 @pre			All the vertex normals in the OBJ file are normalized.
+		 @throws		Exception
+						Failed to read a Vertex Normal Coordinates definition.
+		 */
+		void ReadOBJVertexNormal();
+
+		/**
+		 Reads a Face definition.
+
+		 @throws		Exception
+						Failed to read a Face definition.
+		 */
+		void ReadOBJFace();
+
+		/**
+		 Reads a set of vertex indices.
+
+		 @return		The face vertex represented by the next token of this
+						OBJ chunk reader.
+		 @throws		Exception
+						Failed to read the vertex indices.
+		 */
+		[[nodiscard]]
+		const OBJFaceVertex ReadOBJVertexIndices();
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 A reference to the OBJ chunk containing the read data of this OBJ
+		 chunk reader.
+		 */
+		OBJChunk& m_chunk;
+
+		/**
+		 A flag indicating whether the handness of the vertex coordinates
+		 needs to be inverted for this OBJ chunk reader.
+		 */
+		bool m_invert_handness;
+	};
+
+	//-------------------------------------------------------------------------
+	// Reading
+	//-------------------------------------------------------------------------
+
+	/**
+	 Reads the given OBJ input string in chunks (in parallel).
+
+	 The given input string is split on line boundaries in a number of chunks
+	 which depends on the size of the input string and the number of workers
+	 of the job system of the given resource manager. The chunks are read
+	 independently of each other.
+
+	 @param[in]		input
+					The input string.
+	 @param[in]		path
+					A reference to the path of the file containing the given
+					input string (used for reporting only).
+	 @param[in]		invert_handness
+					@c true if the handness of the vertex coordinates should
+					be inverted. @c false otherwise.
+	 @param[in,out]	resource_manager
+					A reference to the resource manager.
+	 @return		A vector containing the read OBJ chunks in order of
+					appearance in the given input string.
+	 @throws		Exception
+					Failed to read the given input string. If multiple chunks
+					fail, the failure of the first chunk is reported.
+	 */
+	[[nodiscard]]
+	std::vector< OBJChunk > ReadOBJChunks(std::string_view input,
+										  const std::filesystem::path& path,
+										  bool invert_handness,
+										  ResourceManager& resource_manager);
+}
\ No newline at end of file
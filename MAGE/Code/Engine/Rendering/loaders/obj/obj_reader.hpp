@@ -5,7 +5,8 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "io\line_reader.hpp"
+#include "loaders\obj\obj_chunk_reader.hpp"
+#include "collection\hash_map.hpp"
 #include "resource\model\model_output.hpp"
 #include "resource\mesh\mesh_descriptor.hpp"
 
@@ -16,7 +17,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include <map>
+#include <string_view>
 
 #pragma endregion
 
@@ -39,7 +40,7 @@ namespace mage::rendering::loader {
 					The index type.
 	 */
 	template< typename VertexT, typename IndexT >
-	class OBJReader : private LineReader {
+	class OBJReader {
 
 	public:
 
@@ -111,170 +112,121 @@ namespace mage::rendering::loader {
 		// Member Methods
 		//---------------------------------------------------------------------
 
-		using LineReader::ReadFromFile;
-
-		using LineReader::ReadFromMemory;
-
-	private:
-
-		//---------------------------------------------------------------------
-		// Member Methods
-		//---------------------------------------------------------------------
-
-		/**
-		 Pre-process before reading the current file of this OBJ reader.
-
-		 @throws		Exception
-						Failed to finish the pre-processing successfully.
-		 */
-		virtual void Preprocess() override;
-
 		/**
-		 Reads the current line of this OBJ reader.
+		 Reads from the file associated with the given path.
 
+		 @param[in]		path
+						A reference to the path.
 		 @throws		Exception
-						Failed to the current line of this OBJ reader.
+						Failed to read from the file.
 		 */
-		virtual void ReadLine() override;
+		void ReadFromFile(const std::filesystem::path& path);
 
 		/**
-		 Post-processes after reading the current file of this OBJ reader.
-
-		 @throws		Exception
-						Failed to finish post-processing successfully.
-		 */
-		virtual void Postprocess() override;
-
-		/**
-		 Reads a Material Library Include definition.
+		 Reads from the given input string.
 
+		 @param[in]		input
+						The input string.
 		 @throws		Exception
-						Failed to read a Material Library Include definition.
-		 */
-		void ReadOBJMaterialLibrary();
-
-		/**
-		 Reads a Material Usage definition and imports the materials
-		 corresponding to the mesh.
-
-		 @throws		Exception
-						Failed to read a Material Usage definition.
-		 @throws		Exception
-						Failed to import the materials.
+						Failed to read from the given input string.
 		 */
-		void ReadOBJMaterialUse();
+		void ReadFromMemory(std::string_view input);
 
-		/**
-		 Reads a Group definition.
+	private:
 
-		 @throws		Exception
-						Failed to read a Group definition.
-		 */
-		void ReadOBJGroup();
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
 
 		/**
-		 Reads an Object definition.
+		 Processes the given input string.
 
-		 @throws		Exception
-						Failed to read a Object definition.
-		 */
-		void ReadOBJObject();
-
-		/**
-		 Reads a Smoothing Group definition.
+		 The given input string is read in chunks (in parallel) which are
+		 merged in order afterwards. The result does not depend on the number
+		 of chunks.
 
-		 @note			A smoothing group is, if present,
-						silently ignored.
+		 @param[in]		input
+						The input string.
 		 @throws		Exception
-						Failed to read a Smoothing Group definition.
+						Failed to process the given input string.
 		 */
-		void ReadOBJSmoothingGroup();
+		void Process(std::string_view input);
 
 		/**
-		 Reads a Vertex Position Coordinates definition.
+		 Pre-process before reading the current file of this OBJ reader.
 
 		 @throws		Exception
-						Failed to read a Vertex Position Coordinates
-						definition.
+						Failed to finish the pre-processing successfully.
 		 */
-		void ReadOBJVertex();
+		void Preprocess();
 
 		/**
-		 Reads a Vertex Texture Coordinates definition.
+		 Post-processes after reading the current file of this OBJ reader.
 
-		 @note			Only UV texture coordinates are supported,
-						The W component of UVW texture coordinates
-						is, if present, silently ignored.
 		 @throws		Exception
-						Failed to read a Vertex Texture Coordinates definition.
+						Failed to finish post-processing successfully.
 		 */
-		void ReadOBJVertexTexture();
+		void Postprocess();
 
 		/**
-		 Reads a Vertex Normal Coordinates definition.
+		 Merges the given OBJ chunk.
 
-		 @pre			All the vertex normals in the OBJ file are normalized.
+		 @pre			All OBJ chunks preceding the given OBJ chunk are
+						merged.
+		 @param[in]		chunk
+						A reference to the OBJ chunk.
 		 @throws		Exception
-						Failed to read a Vertex Normal Coordinates definition.
+						Failed to merge the given OBJ chunk.
 		 */
-		void ReadOBJVertexNormal();
+		void ReadOBJChunk(const OBJChunk& chunk);
 
 		/**
-		 Reads a Face definition.
+		 Reads the given statement.
 
+		 @param[in]		statement
+						A reference to the statement.
 		 @throws		Exception
-						Failed to read a Face definition.
+						Failed to read the given statement.
 		 */
-		void ReadOBJFace();
+		void ReadOBJStatement(const OBJStatement& statement);
 
 		/**
-		 Reads a set of vertex position coordinates.
+		 Reads a Material Library Include definition.
 
-		 @return		The @c Point3 represented by the next token of this OBJ
-						reader (modified according to the mesh descriptor of
-						this OBj reader).
+		 @param[in]		name
+						The name of the material library.
 		 @throws		Exception
-						Failed to read a @c Point3.
+						Failed to read a Material Library Include definition.
 		 */
-		[[nodiscard]]
-		const Point3 ReadOBJVertexCoordinates();
+		void ReadOBJMaterialLibrary(std::string_view name);
 
 		/**
-		 Reads a set of vertex normal coordinates.
+		 Reads a Material Usage definition.
 
-		 @pre			All the vertex normals in the OBJ file are normalized.
-		 @return		The @c Normal3 represented by the next token of this
-						OBJ reader (modified according to the mesh descriptor
-						of this OBj reader).
-		 @throws		Exception
-						Failed to read a @c Normal3.
+		 @param[in]		name
+						A reference to the name of the material.
 		 */
-		[[nodiscard]]
-		const Normal3 ReadOBJVertexNormalCoordinates();
+		void ReadOBJMaterialUse(const std::string& name);
 
 		/**
-		 Reads a set of vertex texture coordinates.
+		 Reads a Group or Object definition.
 
-		 @return		The @c UV represented by the next token of this OBJ
-						reader (modified according to the mesh descriptor of
-						this OBj reader).
-		 @throws		Exception
-						Failed to read a @c UV.
+		 @param[in]		name
+						A reference to the name of the group or object.
 		 */
-		[[nodiscard]]
-		const UV ReadOBJVertexTextureCoordinates();
+		void ReadOBJGroup(const std::string& name);
 
 		/**
-		 Reads a set of vertex indices.
+		 Reads a Face definition.
 
-		 @return		The vertex indices represented by the next token of
-						this OBJ reader. A zero indicates the absence of a
-						component.
-		 @throws		Exception
-						Failed to read the vertex indices.
+		 @param[in]		vertices
+						The face vertices of the face.
+		 @param[in]		offsets
+						A reference to the number of vertex position/texture/
+						normal coordinates of all preceding OBJ chunks.
 		 */
-		[[nodiscard]]
-		const U32x3 ReadOBJVertexIndices();
+		void ReadOBJFace(gsl::span< const OBJFaceVertex > vertices,
+						 const U32x3& offsets);
 
 		/**
 		 Constructs or retrieves (if already existing) the vertex matching the
@@ -289,26 +241,30 @@ namespace mage::rendering::loader {
 		const VertexT ConstructVertex(const U32x3& vertex_indices);
 
 		/**
-		 A struct of @c U32x3 comparators for OBJ vertex indices.
+		 A struct of @c U32x3 hash functions for OBJ vertex indices.
 		 */
-		struct OBJComparator {
+		struct OBJIndicesHash {
 
 		public:
 
 			/**
-			 Compares the two given @c U32x3 vectors against each other.
-
-			 @param[in]		lhs
-							A reference to the first vector.
-			 @param[in]		rhs
-							A reference to the second vector.
-			 @return		@c true if the @a lhs is smaller than @a rhs.
-							@c false otherwise.
+			 Hashes the given @c U32x3 vector.
+
+			 @param[in]		indices
+							A reference to the vector.
+			 @return		The hash of the given vector.
 			 */
 			[[nodiscard]]
-			bool operator()(const U32x3& lhs, const U32x3& rhs) const noexcept {
-				return std::tie(lhs[0], lhs[1], lhs[2])
-					 < std::tie(rhs[0], rhs[1], rhs[2]);
+			std::size_t operator()(const U32x3& indices) const noexcept {
+				// Pack the position and normal indices, mix in the texture
+				// index and finalize (splitmix64) so that the low bits used
+				// for the probing depend on all the indices.
+				auto hash = (static_cast< U64 >(indices[0u]) << 32u
+							 | static_cast< U64 >(indices[2u]))
+					      ^ (static_cast< U64 >(indices[1u]) * 0x9E3779B97F4A7C15ull);
+				hash = (hash ^ (hash >> 30u)) * 0xBF58476D1CE4E5B9ull;
+				hash = (hash ^ (hash >> 27u)) * 0x94D049BB133111EBull;
+				return static_cast< std::size_t >(hash ^ (hash >> 31u));
 			}
 		};
 
@@ -322,6 +278,11 @@ namespace mage::rendering::loader {
 		// Member Variables
 		//---------------------------------------------------------------------
 
+		/**
+		 The current path of this OBJ reader.
+		 */
+		std::filesystem::path m_path;
+
 		/**
 		 The current model part of this OBJ reader.
 		 */
@@ -350,7 +311,7 @@ namespace mage::rendering::loader {
 		 and the index of a vertex in the vertex buffer (@c m_model_output) of
 		 this OBJ reader.
 		 */
-		std::map< U32x3, IndexT, OBJComparator > m_mapping;
+		HashMap< U32x3, IndexT, OBJIndicesHash > m_mapping;
 
 		/**
 		 A reference to the resource manager of this OBJ reader.
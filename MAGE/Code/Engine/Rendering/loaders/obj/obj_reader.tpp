@@ -6,6 +6,7 @@
 #pragma region
 
 #include "loaders\obj\obj_tokens.hpp"
+#include "io\binary_reader.hpp"
 #include "loaders\material_loader.hpp"
 #include "resource\mesh\vertex.hpp"
 
@@ -21,7 +22,7 @@ namespace mage::rendering::loader {
 		::OBJReader(ResourceManager& resource_manager,
 					ModelOutput< VertexT, IndexT >& model_output,
 			        const MeshDescriptor< VertexT, IndexT >& mesh_desc)
-		: LineReader(),
+		: m_path(),
 		m_model_part(),
 		m_vertex_coordinates(),
 		m_vertex_texture_coordinates(),
@@ -37,6 +38,42 @@ namespace mage::rendering::loader {
 	template< typename VertexT, typename IndexT >
 	OBJReader< VertexT, IndexT >::~OBJReader() = default;
 
+	template< typename VertexT, typename IndexT >
+	void OBJReader< VertexT, IndexT >
+		::ReadFromFile(const std::filesystem::path& path) {
+
+		m_path = path;
+
+		UniquePtr< U8[] > data;
+		std::size_t size = 0u;
+		ReadBinaryFile(m_path, data, size);
+		Process({ reinterpret_cast< const char* >(data.get()), size });
+	}
+
+	template< typename VertexT, typename IndexT >
+	void OBJReader< VertexT, IndexT >::ReadFromMemory(std::string_view input) {
+		m_path = L"input string";
+
+		Process(input);
+	}
+
+	template< typename VertexT, typename IndexT >
+	void OBJReader< VertexT, IndexT >::Process(std::string_view input) {
+		// Preprocessing
+		Preprocess();
+
+		// Processing
+		const auto chunks = ReadOBJChunks(input, m_path,
+										  m_mesh_desc.InvertHandness(),
+										  m_resource_manager);
+		for (const auto& chunk : chunks) {
+			ReadOBJChunk(chunk);
+		}
+
+		// Postprocessing
+		Postprocess();
+	}
+
 	template< typename VertexT, typename IndexT >
 	void OBJReader< VertexT, IndexT >::FinalizeModelPart() {
 		const auto size = static_cast< U32 >(m_model_output.m_index_buffer.size());
@@ -52,154 +89,146 @@ namespace mage::rendering::loader {
 	void OBJReader< VertexT, IndexT >::Preprocess() {
 		using std::empty;
 		ThrowIfFailed(empty(m_model_output.m_vertex_buffer),
-					  "{}: vertex buffer must be empty.", GetPath());
+					  "{}: vertex buffer must be empty.", m_path);
 		ThrowIfFailed(empty(m_model_output.m_index_buffer),
-					  "{}: index buffer must be empty.", GetPath());
+					  "{}: index buffer must be empty.", m_path);
 	}
 
 	template< typename VertexT, typename IndexT >
 	void OBJReader< VertexT, IndexT >::Postprocess() {
 		FinalizeModelPart();
 
+		if (m_mesh_desc.WeldVertices()) {
+			m_model_output.WeldModelParts();
+		}
+
 		m_model_output.NormalizeModelParts();
 	}
 
 	template< typename VertexT, typename IndexT >
-	void OBJReader< VertexT, IndexT >::ReadLine() {
-		const auto token = Read< std::string_view >();
+	void OBJReader< VertexT, IndexT >::ReadOBJChunk(const OBJChunk& chunk) {
+		const U32x3 offsets = {
+			static_cast< U32 >(m_vertex_coordinates.size()),
+			static_cast< U32 >(m_vertex_texture_coordinates.size()),
+			static_cast< U32 >(m_vertex_normal_coordinates.size())
+		};
 
-		if (g_obj_token_comment == token[0]) {
-			return;
-		}
-		else if (g_obj_token_vertex           == token) {
-			ReadOBJVertex();
-		}
-		else if (g_obj_token_texture          == token) {
-			ReadOBJVertexTexture();
-		}
-		else if (g_obj_token_normal           == token) {
-			ReadOBJVertexNormal();
-		}
-		else if (g_obj_token_face             == token) {
-			ReadOBJFace();
-		}
-		else if (g_obj_token_material_library == token) {
-			ReadOBJMaterialLibrary();
-		}
-		else if (g_obj_token_material_use     == token) {
-			ReadOBJMaterialUse();
-		}
-		else if (g_obj_token_group            == token) {
-			ReadOBJGroup();
-		}
-		else if (g_obj_token_object           == token) {
-			ReadOBJObject();
-		}
-		else if (g_obj_token_smoothing_group  == token) {
-			ReadOBJSmoothingGroup();
+		m_vertex_coordinates.insert(m_vertex_coordinates.cend(),
+									chunk.m_vertex_coordinates.cbegin(),
+									chunk.m_vertex_coordinates.cend());
+		m_vertex_texture_coordinates.insert(m_vertex_texture_coordinates.cend(),
+											chunk.m_vertex_texture_coordinates.cbegin(),
+											chunk.m_vertex_texture_coordinates.cend());
+		m_vertex_normal_coordinates.insert(m_vertex_normal_coordinates.cend(),
+										   chunk.m_vertex_normal_coordinates.cbegin(),
+										   chunk.m_vertex_normal_coordinates.cend());
+
+		// Most vertices share a single normal and texture coordinates for each
+		// position: pre-size the mapping accordingly to avoid rehashing.
+		m_mapping.reserve(m_vertex_coordinates.size());
+
+		// Replay the faces and statements in order of appearance.
+		auto statement = chunk.m_statements.cbegin();
+		const gsl::span< const OBJFaceVertex > face_vertices(chunk.m_face_vertices);
+		std::size_t first_vertex = 0u;
+		for (std::size_t face = 0u; face < chunk.m_face_sizes.size(); ++face) {
+			for (; statement != chunk.m_statements.cend()
+				   && statement->m_nb_preceding_faces == face; ++statement) {
+				ReadOBJStatement(*statement);
+			}
+
+			const std::size_t nb_vertices = chunk.m_face_sizes[face];
+			ReadOBJFace(face_vertices.subspan(first_vertex, nb_vertices), offsets);
+			first_vertex += nb_vertices;
 		}
-		else {
-			Warning("{}: line {}: unsupported keyword token: {}.",
-					GetPath(), GetCurrentLineNumber(), token);
-			return;
+
+		for (; statement != chunk.m_statements.cend(); ++statement) {
+			ReadOBJStatement(*statement);
 		}
+	}
 
-		ReadRemainingTokens();
+	template< typename VertexT, typename IndexT >
+	void OBJReader< VertexT, IndexT >
+		::ReadOBJStatement(const OBJStatement& statement) {
+
+		switch (statement.m_type) {
+
+		case OBJStatementType::MaterialLibrary:
+			ReadOBJMaterialLibrary(statement.m_name);
+			break;
+
+		case OBJStatementType::MaterialUse:
+			ReadOBJMaterialUse(statement.m_name);
+			break;
+
+		case OBJStatementType::Group:
+			ReadOBJGroup(statement.m_name);
+			break;
+		}
 	}
 
 	template< typename VertexT, typename IndexT >
-	void OBJReader< VertexT, IndexT >::ReadOBJMaterialLibrary() {
-		const UTF8toUTF16 mtl_name(Read< std::string_view >());
-		auto mtl_path = GetPath();
+	void OBJReader< VertexT, IndexT >
+		::ReadOBJMaterialLibrary(std::string_view name) {
+
+		const UTF8toUTF16 mtl_name(name);
+		auto mtl_path = m_path;
 		mtl_path.replace_filename(std::wstring_view(mtl_name));
 
 		ImportMaterialFromFile(mtl_path,
 							   m_resource_manager,
 							   m_model_output.m_material_buffer);
+		m_model_output.m_dependencies.push_back(std::move(mtl_path));
 	}
 
 	template< typename VertexT, typename IndexT >
-	void OBJReader< VertexT, IndexT >::ReadOBJMaterialUse() {
+	void OBJReader< VertexT, IndexT >
+		::ReadOBJMaterialUse(const std::string& name) {
+
 		if (!m_model_part.HasDefaultMaterial()) {
 			FinalizeModelPart();
 		}
 
-		m_model_part.m_material = Read< std::string_view >();
+		m_model_part.m_material = name;
 	}
 
 	template< typename VertexT, typename IndexT >
-	void OBJReader< VertexT, IndexT >::ReadOBJGroup() {
+	void OBJReader< VertexT, IndexT >::ReadOBJGroup(const std::string& name) {
 		if (!m_model_part.HasDefaultChild()) {
 			FinalizeModelPart();
 		}
 
-		m_model_part.m_child = Read< std::string_view >();
-	}
-
-	template< typename VertexT, typename IndexT >
-	void OBJReader< VertexT, IndexT >::ReadOBJObject() {
-		ReadOBJGroup();
-	}
-
-	template< typename VertexT, typename IndexT >
-	void OBJReader< VertexT, IndexT >::ReadOBJSmoothingGroup() {
-		// Silently ignore smoothing group declarations.
-		Read< std::string_view >();
-	}
-
-	template< typename VertexT, typename IndexT >
-	void OBJReader< VertexT, IndexT >::ReadOBJVertex() {
-		const auto read_vertex = ReadOBJVertexCoordinates();
-		const auto vertex = m_mesh_desc.InvertHandness() ?
-			InvertHandness(read_vertex) : read_vertex;
-
-		m_vertex_coordinates.push_back(vertex);
+		m_model_part.m_child = name;
 	}
 
 	template< typename VertexT, typename IndexT >
-	void OBJReader< VertexT, IndexT >::ReadOBJVertexTexture() {
-		const auto read_texture = ReadOBJVertexTextureCoordinates();
-		const auto texture = m_mesh_desc.InvertHandness() ?
-			InvertHandness(read_texture) : read_texture;
+	void OBJReader< VertexT, IndexT >
+		::ReadOBJFace(gsl::span< const OBJFaceVertex > vertices,
+					  const U32x3& offsets) {
 
-		m_vertex_texture_coordinates.push_back(texture);
-	}
-
-	template< typename VertexT, typename IndexT >
-	void OBJReader< VertexT, IndexT >::ReadOBJVertexNormal() {
-		const auto read_normal = ReadOBJVertexNormalCoordinates();
-		const auto normal = m_mesh_desc.InvertHandness() ?
-			InvertHandness(read_normal) : read_normal;
-
-		m_vertex_normal_coordinates.push_back(normal);
-	}
-
-	template< typename VertexT, typename IndexT >
-	void OBJReader< VertexT, IndexT >::ReadOBJFace() {
 		MemoryBuffer< IndexT, 6u > indices;
-		while (indices.size() < 3u || ContainsTokens()) {
-			const auto indices3 = ReadOBJVertexIndices();
-
-			if (const auto it = m_mapping.find(indices3);
-				it != m_mapping.cend()) {
-
-				// Add the index to the already existing vertex.
-				indices.push_back(it->second);
+		for (const auto& face_vertex : vertices) {
+			// Resolve the relative indices.
+			auto indices3 = face_vertex.m_indices;
+			for (std::size_t i = 0u; i < 3u; ++i) {
+				if (face_vertex.m_relative_mask & (1u << i)) {
+					indices3[i] += offsets[i];
+				}
 			}
-			else {
-				// Create an index to a new vertex.
-				const auto index
-					= static_cast< IndexT >(m_model_output.m_vertex_buffer.size());
-				// Add the index to the new vertex.
-				indices.push_back(index);
 
+			// Create an index to a new vertex (if not already existing).
+			const auto new_index
+				= static_cast< IndexT >(m_model_output.m_vertex_buffer.size());
+			const auto [index, inserted] = m_mapping.try_emplace(
+				indices3, m_mapping.hash(indices3), new_index);
+			// Add the index to the (new) vertex.
+			indices.push_back(*index);
+
+			if (inserted) {
 				// Create a new vertex.
 				const auto vertex = ConstructVertex(indices3);
 				// Add the new vertex.
 				m_model_output.m_vertex_buffer.push_back(vertex);
-
-				// Add the new mapping.
-				m_mapping[indices3] = index;
 			}
 		}
 
@@ -219,93 +248,6 @@ namespace mage::rendering::loader {
 		}
 	}
 
-	template< typename VertexT, typename IndexT >
-	[[nodiscard]]
-	inline const Point3 OBJReader< VertexT, IndexT >
-		::ReadOBJVertexCoordinates() {
-
-		return Point3(Read< F32, 3u >());
-	}
-
-	template< typename VertexT, typename IndexT >
-	[[nodiscard]]
-	inline const Normal3 OBJReader< VertexT, IndexT >
-		::ReadOBJVertexNormalCoordinates() {
-
-		return Normal3(Read< F32, 3u >());
-	}
-
-	template< typename VertexT, typename IndexT >
-	[[nodiscard]]
-	const UV OBJReader< VertexT, IndexT >
-		::ReadOBJVertexTextureCoordinates() {
-
-		const UV result(Read< F32, 2u >());
-
-		if (Contains< F32 >()) {
-			// Silently ignore 3D vertex texture coordinates.
-			Read< F32 >();
-		}
-
-		return result;
-	}
-
-	template< typename VertexT, typename IndexT >
-	[[nodiscard]]
-	const U32x3 OBJReader< VertexT, IndexT >
-		::ReadOBJVertexIndices() {
-
-		const auto token  = Read< std::string_view >();
-
-		const auto slash1 = token.find_first_of('/');
-		const bool flag1  = (std::string::npos != slash1);
-		const auto slash2 = token.find_first_of('/', slash1 + 1u);
-		const bool flag2  = (std::string::npos != slash2);
-		const bool flagd  = (slash1 + 1u == slash2);
-
-		static constexpr const_zstring s_token_names[] = {
-			"v",
-			"vt",
-			"vn"
-		};
-		const bool contains_token[] = {
-			true,
-			flag1 && !flagd,
-			flag2
-		};
-		const std::string_view tokens[] = {
-			// If offset std::string::npos + 1u == 0u then count is don't-care;
-			// all unsigned values avoid exception.
-			token.substr(0u,          slash1),
-			token.substr(slash1 + 1u, slash2       - slash1 - 1u),
-			token.substr(slash2 + 1u, token.size() - slash2 - 1u)
-		};
-
-		U32x3 indices;
-		const S32x3 sizes = {
-			static_cast< S32 >(m_vertex_coordinates.size()),
-			static_cast< S32 >(m_vertex_texture_coordinates.size()),
-			static_cast< S32 >(m_vertex_normal_coordinates.size())
-		};
-
-		for (std::size_t i = 0u; i < std::size(s_token_names); ++i) {
-			if (!contains_token[i]) {
-				continue;
-			}
-
-			if (const auto result = StringTo< S32 >(tokens[i]); bool(result)) {
-				const auto index = *result;
-				indices[i] = static_cast< U32 >((0 <= index) ? index : sizes[i] + index);
-			}
-			else {
-				throw Exception("{}: line {}: invalid {} index value found in {}.",
-								GetPath(), GetCurrentLineNumber(), s_token_names[i], token);
-			}
-		}
-
-		return indices;
-	}
-
 	template< typename VertexT, typename IndexT >
 	[[nodiscard]]
 	const VertexT OBJReader< VertexT, IndexT >
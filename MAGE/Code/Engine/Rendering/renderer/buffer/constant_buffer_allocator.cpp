@@ -0,0 +1,143 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "renderer\buffer\constant_buffer_allocator.hpp"
+#include "renderer\factory.hpp"
+#include "exception\exception.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	namespace {
+
+		/**
+		 Creates a page.
+
+		 @param[in,out]	device
+						A reference to the device.
+		 @param[in]		page_size
+						The size of the page in bytes.
+		 @return		A pointer to the page.
+		 @throws		Exception
+						Failed to create the page.
+		 */
+		[[nodiscard]]
+		ComPtr< ID3D11Buffer > CreatePage(ID3D11Device& device,
+										  std::size_t page_size) {
+
+			ComPtr< ID3D11Buffer > page;
+			const HRESULT result = CreateDynamicConstantBuffer< U8 >(
+				device, NotNull< ID3D11Buffer** >(page.ReleaseAndGetAddressOf()),
+				page_size);
+			ThrowIfFailed(result, "Constant buffer creation failed: {:08X}.", result);
+
+			return page;
+		}
+	}
+
+	ConstantBufferAllocator::ConstantBufferAllocator(ID3D11Device& device,
+													 std::size_t page_size)
+		: m_pages(),
+		m_page_size(page_size),
+		m_page(0u),
+		m_offset(0u),
+		m_data(nullptr) {
+
+		Assert(0u == m_page_size % s_alignment);
+
+		// Check the support for binding ranges of constant buffers.
+		D3D11_FEATURE_DATA_D3D11_OPTIONS options = {};
+		{
+			const HRESULT result
+				= device.CheckFeatureSupport(D3D11_FEATURE_D3D11_OPTIONS,
+											 &options, sizeof(options));
+			ThrowIfFailed(result, "Feature support check failed: {:08X}.", result);
+		}
+		ThrowIfFailed(TRUE == options.ConstantBufferOffsetting,
+					  "Constant buffer offsetting is not supported.");
+
+		m_pages.push_back(CreatePage(device, m_page_size));
+	}
+
+	ConstantBufferAllocator::ConstantBufferAllocator(
+		ConstantBufferAllocator&& allocator) noexcept = default;
+
+	ConstantBufferAllocator::~ConstantBufferAllocator() = default;
+
+	ConstantBufferAllocator& ConstantBufferAllocator
+		::operator=(ConstantBufferAllocator&& allocator) noexcept = default;
+
+	void ConstantBufferAllocator::Begin(ID3D11DeviceContext& device_context) {
+		m_page   = 0u;
+		m_offset = 0u;
+
+		MapPage(device_context);
+	}
+
+	void ConstantBufferAllocator::End(ID3D11DeviceContext& device_context) noexcept {
+		UnmapPage(device_context);
+	}
+
+	void* ConstantBufferAllocator::Allocate(ID3D11DeviceContext& device_context,
+											std::size_t size,
+											ConstantBufferView& view) {
+
+		Assert(nullptr != m_data);
+
+		const auto aligned_size = (size + s_alignment - 1u) & ~(s_alignment - 1u);
+		ThrowIfFailed(aligned_size <= m_page_size
+					  && aligned_size <= D3D11_REQ_CONSTANT_BUFFER_ELEMENT_COUNT * 16u,
+					  "Constant buffer allocation too large: {}.", size);
+
+		// Continue with the next page if the current page is full.
+		if (m_page_size < m_offset + aligned_size) {
+			UnmapPage(device_context);
+
+			++m_page;
+			m_offset = 0u;
+			if (m_pages.size() == m_page) {
+				ComPtr< ID3D11Device > device;
+				device_context.GetDevice(device.ReleaseAndGetAddressOf());
+				m_pages.push_back(CreatePage(*device.Get(), m_page_size));
+			}
+
+			MapPage(device_context);
+		}
+
+		view.m_buffer         = m_pages[m_page].Get();
+		view.m_first_constant = static_cast< U32 >(m_offset / 16u);
+		view.m_nb_constants   = static_cast< U32 >(aligned_size / 16u);
+
+		const auto range = m_data + m_offset;
+		m_offset += aligned_size;
+		return range;
+	}
+
+	void ConstantBufferAllocator::MapPage(ID3D11DeviceContext& device_context) {
+		D3D11_MAPPED_SUBRESOURCE mapped_page;
+		const HRESULT result = Pipeline::Map(device_context,
+											 *m_pages[m_page].Get(),
+											 0u,
+											 D3D11_MAP_WRITE_DISCARD,
+											 0u,
+											 mapped_page);
+		ThrowIfFailed(result, "Buffer mapping failed: {:08X}.", result);
+
+		m_data = static_cast< U8* >(mapped_page.pData);
+	}
+
+	void ConstantBufferAllocator::UnmapPage(ID3D11DeviceContext& device_context) noexcept {
+		if (nullptr == m_data) {
+			return;
+		}
+
+		Pipeline::Unmap(device_context, *m_pages[m_page].Get(), 0u);
+		m_data = nullptr;
+	}
+}
\ No newline at end of file
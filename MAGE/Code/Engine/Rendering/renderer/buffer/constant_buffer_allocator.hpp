@@ -0,0 +1,312 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "renderer\pipeline.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	//-------------------------------------------------------------------------
+	// ConstantBufferView
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A struct of constant buffer views (i.e. ranges of constant buffers).
+	 */
+	struct ConstantBufferView {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Binds this constant buffer view.
+
+		 @pre			@a device_context must be a @c D3D11DeviceContext.
+		 @pre			@a slot <
+						@c D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT.
+		 @tparam		PipelineStageT
+						The pipeline stage type.
+		 @param[in,out]	device_context
+						A reference to the device context.
+		 @param[in]		slot
+						The index into the device's zero-based array to set the
+						constant buffer to (ranges from 0 to
+						@c D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT
+						- 1).
+		 */
+		template< typename PipelineStageT >
+		void Bind(ID3D11DeviceContext& device_context, U32 slot) const noexcept {
+			PipelineStageT::BindConstantBuffer(device_context, slot, m_buffer,
+											   m_first_constant, m_nb_constants);
+		}
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 A pointer to the constant buffer of this constant buffer view.
+		 */
+		ID3D11Buffer* m_buffer = nullptr;
+
+		/**
+		 The offset of this constant buffer view in its constant buffer (in
+		 16-byte constants).
+		 */
+		U32 m_first_constant = 0u;
+
+		/**
+		 The number of 16-byte constants of this constant buffer view.
+		 */
+		U32 m_nb_constants = 0u;
+	};
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// ConstantBufferAllocator
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A class of constant buffer allocators.
+
+	 A constant buffer allocator is a per-frame linear allocator for constant
+	 buffer data. The data of all allocations of a frame is written to a
+	 single dynamic constant buffer (page), which is mapped once per frame.
+	 Additional pages are only used if the first page is full. Allocations
+	 are bound as ranges of their page through constant buffer views.
+	 */
+	class ConstantBufferAllocator {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Class Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The alignment of allocations (in bytes) of constant buffer
+		 allocators (i.e. 16 constants of 16 bytes).
+		 */
+		static constexpr std::size_t s_alignment = 256u;
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a constant buffer allocator.
+
+		 @param[in,out]	device
+						A reference to the device.
+		 @param[in]		page_size
+						The size of a page in bytes.
+		 @throws		Exception
+						Failed to setup this constant buffer allocator.
+		 */
+		explicit ConstantBufferAllocator(ID3D11Device& device,
+										 std::size_t page_size = 1u << 20u);
+
+		/**
+		 Constructs a constant buffer allocator from the given constant
+		 buffer allocator.
+
+		 @param[in]		allocator
+						A reference to the constant buffer allocator to copy.
+		 */
+		ConstantBufferAllocator(const ConstantBufferAllocator& allocator) = delete;
+
+		/**
+		 Constructs a constant buffer allocator by moving the given constant
+		 buffer allocator.
+
+		 @param[in]		allocator
+						A reference to the constant buffer allocator to move.
+		 */
+		ConstantBufferAllocator(ConstantBufferAllocator&& allocator) noexcept;
+
+		/**
+		 Destructs this constant buffer allocator.
+		 */
+		~ConstantBufferAllocator();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given constant buffer allocator to this constant buffer
+		 allocator.
+
+		 @param[in]		allocator
+						A reference to the constant buffer allocator to copy.
+		 @return		A reference to the copy of the given constant buffer
+						allocator (i.e. this constant buffer allocator).
+		 */
+		ConstantBufferAllocator& operator=(
+			const ConstantBufferAllocator& allocator) = delete;
+
+		/**
+		 Moves the given constant buffer allocator to this constant buffer
+		 allocator.
+
+		 @param[in]		allocator
+						A reference to the constant buffer allocator to move.
+		 @return		A reference to the moved constant buffer allocator
+						(i.e. this constant buffer allocator).
+		 */
+		ConstantBufferAllocator& operator=(
+			ConstantBufferAllocator&& allocator) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Begins a new frame. All constant buffer views of the previous frame
+		 become invalid.
+
+		 @param[in,out]	device_context
+						A reference to the device context.
+		 @throws		Exception
+						Failed to map the first page.
+		 */
+		void Begin(ID3D11DeviceContext& device_context);
+
+		/**
+		 Ends the current frame. The constant buffer views of the current
+		 frame can only be bound after ending the current frame.
+
+		 @param[in,out]	device_context
+						A reference to the device context.
+		 */
+		void End(ID3D11DeviceContext& device_context) noexcept;
+
+		/**
+		 Allocates a range for the given data and copies the given data to
+		 it.
+
+		 @pre			The current frame must be begun and not ended.
+		 @tparam		T
+						The data type.
+		 @param[in,out]	device_context
+						A reference to the device context.
+		 @param[in]		data
+						A reference to the data.
+		 @return		The constant buffer view of the allocated range.
+		 @throws		Exception
+						Failed to allocate a range for the given data.
+		 */
+		template< typename T >
+		ConstantBufferView Allocate(ID3D11DeviceContext& device_context,
+									const T& data);
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Allocates a range of the given size.
+
+		 @pre			The current frame must be begun and not ended.
+		 @param[in,out]	device_context
+						A reference to the device context.
+		 @param[in]		size
+						The size of the range in bytes.
+		 @param[out]	view
+						A reference to the constant buffer view of the
+						allocated range.
+		 @return		A pointer to the allocated range.
+		 @throws		Exception
+						Failed to allocate a range of the given size.
+		 */
+		[[nodiscard]]
+		void* Allocate(ID3D11DeviceContext& device_context,
+					   std::size_t size,
+					   ConstantBufferView& view);
+
+		/**
+		 Maps the current page of this constant buffer allocator.
+
+		 @param[in,out]	device_context
+						A reference to the device context.
+		 @throws		Exception
+						Failed to map the current page.
+		 */
+		void MapPage(ID3D11DeviceContext& device_context);
+
+		/**
+		 Unmaps the current page of this constant buffer allocator.
+
+		 @param[in,out]	device_context
+						A reference to the device context.
+		 */
+		void UnmapPage(ID3D11DeviceContext& device_context) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 A vector containing the pages of this constant buffer allocator.
+		 */
+		std::vector< ComPtr< ID3D11Buffer > > m_pages;
+
+		/**
+		 The size of a page of this constant buffer allocator in bytes.
+		 */
+		std::size_t m_page_size;
+
+		/**
+		 The index of the current page of this constant buffer allocator.
+		 */
+		std::size_t m_page;
+
+		/**
+		 The offset in the current page of this constant buffer allocator in
+		 bytes.
+		 */
+		std::size_t m_offset;
+
+		/**
+		 A pointer to the data of the current page of this constant buffer
+		 allocator (or @c nullptr if the current page is not mapped).
+		 */
+		U8* m_data;
+	};
+
+	#pragma endregion
+}
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "renderer\buffer\constant_buffer_allocator.tpp"
+
+#pragma endregion
\ No newline at end of file
@@ -0,0 +1,26 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <cstring>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	template< typename T >
+	ConstantBufferView ConstantBufferAllocator
+		::Allocate(ID3D11DeviceContext& device_context, const T& data) {
+
+		ConstantBufferView view;
+		const auto range = Allocate(device_context, sizeof(T), view);
+		std::memcpy(range, &data, sizeof(T));
+		return view;
+	}
+}
\ No newline at end of file
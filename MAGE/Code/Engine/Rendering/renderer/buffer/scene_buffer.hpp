@@ -272,9 +272,37 @@ namespace mage::rendering {
 		 The padding of this light buffer.
 		 */
 		F32 m_padding2 = {};
+
+		//---------------------------------------------------------------------
+		// Member Variables: Light Clusters
+		//---------------------------------------------------------------------
+
+		/**
+		 The number of screen tiles along the x and y axis and the number of
+		 depth slices of the light cluster grid of this light buffer.
+		 */
+		U32x3 m_light_cluster_resolution;
+
+		/**
+		 The scale to apply to the logarithm of a camera-space depth to obtain
+		 its depth slice in the light cluster grid of this light buffer.
+		 */
+		F32 m_light_cluster_depth_scale = {};
+
+		/**
+		 The bias to add to the scaled logarithm of a camera-space depth to
+		 obtain its depth slice in the light cluster grid of this light
+		 buffer.
+		 */
+		F32 m_light_cluster_depth_bias = {};
+
+		/**
+		 The padding of this light buffer.
+		 */
+		U32x3 m_padding3;
 	};
 
-	static_assert(48u == sizeof(LightBuffer),
+	static_assert(80u == sizeof(LightBuffer),
 				  "CPU/GPU struct mismatch");
 
 	/**
@@ -351,6 +379,29 @@ namespace mage::rendering {
 	static_assert(96u == sizeof(DirectionalLightBuffer),
 				  "CPU/GPU struct mismatch");
 
+	/**
+	 A struct of shadow mapped directional light buffers used by shaders.
+	 */
+	struct alignas(16) ShadowMappedDirectionalLightBuffer
+		: public DirectionalLightBuffer {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Member Variables: Shadow Atlas
+		//---------------------------------------------------------------------
+
+		/**
+		 The scale (xy) and offset (zw) of the shadow atlas tile of the shadow
+		 mapped directional light of this shadow mapped directional light
+		 buffer.
+		 */
+		F32x4 m_shadow_tile;
+	};
+
+	static_assert(112u == sizeof(ShadowMappedDirectionalLightBuffer),
+				  "CPU/GPU struct mismatch");
+
 	/**
 	 A struct of omni light buffers used by shaders.
 	 */
@@ -465,9 +516,19 @@ namespace mage::rendering {
 		 buffer.
 		 */
 		XMMATRIX m_world_to_projection = {};
+
+		//---------------------------------------------------------------------
+		// Member Variables: Shadow Atlas
+		//---------------------------------------------------------------------
+
+		/**
+		 The scale (xy) and offset (zw) of the shadow atlas tile of the shadow
+		 mapped spotlight of this shadow mapped spotlight buffer.
+		 */
+		F32x4 m_shadow_tile;
 	};
 
-	static_assert(112u == sizeof(ShadowMappedSpotLightBuffer),
+	static_assert(128u == sizeof(ShadowMappedSpotLightBuffer),
 				  "CPU/GPU struct mismatch");
 
 	#pragma endregion
@@ -535,6 +596,38 @@ namespace mage::rendering {
 
 	#pragma endregion
 
+	//-------------------------------------------------------------------------
+	// Instance
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A struct of instance buffers.
+	 */
+	struct alignas(16) InstanceBuffer {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The index of the first model instance of the draw call of this
+		 instance buffer.
+		 */
+		U32 m_instance_start = 0u;
+
+		/**
+		 The padding of this instance buffer.
+		 */
+		U32x3 m_padding;
+	};
+
+	static_assert(16u == sizeof(InstanceBuffer), "CPU/GPU struct mismatch");
+
+	#pragma endregion
+
 	//-------------------------------------------------------------------------
 	// World
 	//-------------------------------------------------------------------------
@@ -14,36 +14,70 @@
 //-----------------------------------------------------------------------------
 namespace mage::rendering {
 
+	namespace {
+
+		/**
+		 Copies the texture element of the given source DSV to the texture
+		 element of the given destination DSV.
+
+		 @pre			Both DSVs have the same format, resolution and
+						(single) array slice.
+		 @param[in,out]	device_context
+						A reference to the device context.
+		 @param[in]		dst
+						A reference to the destination DSV.
+		 @param[in]		src
+						A reference to the source DSV.
+		 @param[in]		slice
+						The index of the array slice of both DSVs.
+		 */
+		void CopyDepth(ID3D11DeviceContext& device_context,
+					   ID3D11DepthStencilView& dst,
+					   ID3D11DepthStencilView& src,
+					   U32 slice) noexcept {
+
+			ComPtr< ID3D11Resource > dst_resource;
+			dst.GetResource(dst_resource.ReleaseAndGetAddressOf());
+			ComPtr< ID3D11Resource > src_resource;
+			src.GetResource(src_resource.ReleaseAndGetAddressOf());
+
+			const auto subresource = D3D11CalcSubresource(0u, slice, 1u);
+			device_context.CopySubresourceRegion(dst_resource.Get(), subresource,
+												 0u, 0u, 0u,
+												 src_resource.Get(), subresource,
+												 nullptr);
+		}
+	}
+
 	//-------------------------------------------------------------------------
-	// ShadowMapBuffer
+	// ShadowAtlasBuffer
 	//-------------------------------------------------------------------------
 	#pragma region
 
-	ShadowMapBuffer::ShadowMapBuffer(ID3D11Device& device,
-									 std::size_t nb_shadow_maps,
-		                             const U32x2& resolution,
-		                             DepthFormat format)
+	ShadowAtlasBuffer::ShadowAtlasBuffer(ID3D11Device& device,
+										 U32 resolution,
+										 DepthFormat format)
 		: m_format(format),
-		m_viewport(resolution),
+		m_resolution(resolution),
 		m_rasterizer_state(),
-		m_dsvs(),
+		m_dsv(),
 		m_srv() {
 
 		// Setup the rasterizer state.
 		SetupRasterizerState(device);
-		// Setup the resource, DSVs and SRV.
-		SetupShadowMapBuffer(device, nb_shadow_maps);
+		// Setup the resource, DSV and SRV.
+		SetupShadowAtlasBuffer(device);
 	}
 
-	ShadowMapBuffer::ShadowMapBuffer(
-		ShadowMapBuffer&& buffer) noexcept = default;
+	ShadowAtlasBuffer::ShadowAtlasBuffer(
+		ShadowAtlasBuffer&& buffer) noexcept = default;
 
-	ShadowMapBuffer::~ShadowMapBuffer() = default;
+	ShadowAtlasBuffer::~ShadowAtlasBuffer() = default;
 
-	ShadowMapBuffer& ShadowMapBuffer
-		::operator=(ShadowMapBuffer&& buffer) noexcept = default;
+	ShadowAtlasBuffer& ShadowAtlasBuffer
+		::operator=(ShadowAtlasBuffer&& buffer) noexcept = default;
 
-	void ShadowMapBuffer::SetupRasterizerState(ID3D11Device& device) {
+	void ShadowAtlasBuffer::SetupRasterizerState(ID3D11Device& device) {
 		const HRESULT result = CreateCullCounterClockwiseRasterizerState(
 			                       device,
 			                       NotNull< ID3D11RasterizerState** >(
@@ -54,49 +88,40 @@ namespace mage::rendering {
 		ThrowIfFailed(result, "Rasterizer state creation failed: {:08X}.", result);
 	}
 
-	void ShadowMapBuffer::SetupShadowMapBuffer(ID3D11Device& device,
-											   std::size_t nb_shadow_maps) {
-
+	void ShadowAtlasBuffer::SetupShadowAtlasBuffer(ID3D11Device& device) {
 		switch (m_format) {
 
 		case DepthFormat::D16: {
-			SetupShadowMapArray(device,
-				                nb_shadow_maps,
-				                DXGI_FORMAT_R16_TYPELESS,
-				                DXGI_FORMAT_D16_UNORM,
-				                DXGI_FORMAT_R16_UNORM);
+			SetupShadowAtlas(device,
+				             DXGI_FORMAT_R16_TYPELESS,
+				             DXGI_FORMAT_D16_UNORM,
+				             DXGI_FORMAT_R16_UNORM);
 			break;
 		}
 
 		default: {
-			SetupShadowMapArray(device,
-				                nb_shadow_maps,
-				                DXGI_FORMAT_R32_TYPELESS,
-				                DXGI_FORMAT_D32_FLOAT,
-				                DXGI_FORMAT_R32_FLOAT);
+			SetupShadowAtlas(device,
+				             DXGI_FORMAT_R32_TYPELESS,
+				             DXGI_FORMAT_D32_FLOAT,
+				             DXGI_FORMAT_R32_FLOAT);
 			break;
 		}
 		}
 	}
 
-	void ShadowMapBuffer::SetupShadowMapArray(ID3D11Device& device,
-											  std::size_t nb_shadow_maps,
-		                                      DXGI_FORMAT texture_format,
-		                                      DXGI_FORMAT dsv_format,
-		                                      DXGI_FORMAT srv_format) {
-		// Clear the DSV vector.
-		m_dsvs.clear();
-
-		const auto resolution = m_viewport.GetSize();
+	void ShadowAtlasBuffer::SetupShadowAtlas(ID3D11Device& device,
+		                                     DXGI_FORMAT texture_format,
+		                                     DXGI_FORMAT dsv_format,
+		                                     DXGI_FORMAT srv_format) {
 
 		// Create the texture descriptor.
 		D3D11_TEXTURE2D_DESC texture_desc = {};
 		texture_desc.BindFlags        = D3D11_BIND_DEPTH_STENCIL
 			                          | D3D11_BIND_SHADER_RESOURCE;
-		texture_desc.Width            = resolution[0];
-		texture_desc.Height           = resolution[1];
+		texture_desc.Width            = m_resolution;
+		texture_desc.Height           = m_resolution;
 		texture_desc.MipLevels        = 1u;
-		texture_desc.ArraySize        = static_cast< U32 >(nb_shadow_maps);
+		texture_desc.ArraySize        = 1u;
 		texture_desc.Format           = texture_format;
 		texture_desc.SampleDesc.Count = 1u;
 		// GPU:    read +    write
@@ -112,25 +137,16 @@ namespace mage::rendering {
 			ThrowIfFailed(result, "Texture 2D creation failed: {:08X}.", result);
 		}
 
-		// Create the DSVs.
+		// Create the DSV.
 		{
-			// Resize the DSV vector.
-			m_dsvs.resize(static_cast< std::size_t >(texture_desc.ArraySize));
-
 			// Create the DSV descriptor.
 			D3D11_DEPTH_STENCIL_VIEW_DESC dsv_desc = {};
 			dsv_desc.Format        = dsv_format;
-			dsv_desc.ViewDimension = D3D11_DSV_DIMENSION_TEXTURE2DARRAY;
-			dsv_desc.Texture2DArray.ArraySize = 1u;
-
-			// Create the DSVs for each texture element.
-			for (U32 i = 0u; i < texture_desc.ArraySize; ++i) {
-				dsv_desc.Texture2DArray.FirstArraySlice = i;
+			dsv_desc.ViewDimension = D3D11_DSV_DIMENSION_TEXTURE2D;
 
-				const HRESULT result = device.CreateDepthStencilView(
-					texture.Get(), &dsv_desc, m_dsvs[i].ReleaseAndGetAddressOf());
-				ThrowIfFailed(result, "DSV creation failed: {:08X}.", result);
-			}
+			const HRESULT result = device.CreateDepthStencilView(
+				texture.Get(), &dsv_desc, m_dsv.ReleaseAndGetAddressOf());
+			ThrowIfFailed(result, "DSV creation failed: {:08X}.", result);
 		}
 
 		// Create the SRV.
@@ -138,11 +154,9 @@ namespace mage::rendering {
 			// Create the SRV descriptor.
 			D3D11_SHADER_RESOURCE_VIEW_DESC srv_desc = {};
 			srv_desc.Format        = srv_format;
-			srv_desc.ViewDimension = D3D11_SRV_DIMENSION_TEXTURE2DARRAY;
-			srv_desc.Texture2DArray.MipLevels = 1u;
-			srv_desc.Texture2DArray.ArraySize = texture_desc.ArraySize;
+			srv_desc.ViewDimension = D3D11_SRV_DIMENSION_TEXTURE2D;
+			srv_desc.Texture2D.MipLevels = 1u;
 
-			// Create the SRV for all texture elements.
 			const HRESULT result = device.CreateShaderResourceView(
 				texture.Get(), &srv_desc, m_srv.ReleaseAndGetAddressOf());
 			ThrowIfFailed(result, "SRV creation failed: {:08X}.", result);
@@ -180,6 +194,16 @@ namespace mage::rendering {
 	ShadowCubeMapBuffer& ShadowCubeMapBuffer
 		::operator=(ShadowCubeMapBuffer&& buffer) noexcept = default;
 
+	void ShadowCubeMapBuffer::CopyDSV(ID3D11DeviceContext& device_context,
+									  std::size_t dsv_index,
+									  const ShadowCubeMapBuffer& buffer) const noexcept {
+
+		CopyDepth(device_context,
+				  *m_dsvs[dsv_index].Get(),
+				  *buffer.m_dsvs[dsv_index].Get(),
+				  static_cast< U32 >(dsv_index));
+	}
+
 	void ShadowCubeMapBuffer::SetupRasterizerState(ID3D11Device& device) {
 		const HRESULT result = CreateCullCounterClockwiseRasterizerState(
 			                       device,
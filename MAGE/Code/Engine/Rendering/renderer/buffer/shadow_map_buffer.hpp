@@ -45,11 +45,11 @@ namespace mage::rendering {
 	};
 
 	//-------------------------------------------------------------------------
-	// ShadowMapBuffer
+	// ShadowAtlasBuffer
 	//-------------------------------------------------------------------------
 	#pragma region
 
-	class ShadowMapBuffer {
+	class ShadowAtlasBuffer {
 
 	public:
 
@@ -57,51 +57,51 @@ namespace mage::rendering {
 		// Constructors and Destructors
 		//---------------------------------------------------------------------
 
-		explicit ShadowMapBuffer(ID3D11Device& device,
-								 std::size_t nb_shadow_maps,
-								 const U32x2& resolution = { 512u, 512u },
-			                     DepthFormat format = DepthFormat::D16);
-		ShadowMapBuffer(const ShadowMapBuffer& buffer) = delete;
-		ShadowMapBuffer(ShadowMapBuffer&& buffer) noexcept;
-		~ShadowMapBuffer();
+		explicit ShadowAtlasBuffer(ID3D11Device& device,
+								   U32 resolution = 4096u,
+								   DepthFormat format = DepthFormat::D16);
+		ShadowAtlasBuffer(const ShadowAtlasBuffer& buffer) = delete;
+		ShadowAtlasBuffer(ShadowAtlasBuffer&& buffer) noexcept;
+		~ShadowAtlasBuffer();
 
 		//---------------------------------------------------------------------
 		// Assignment Operators
 		//---------------------------------------------------------------------
 
-		ShadowMapBuffer& operator=(const ShadowMapBuffer& buffer) = delete;
-		ShadowMapBuffer& operator=(ShadowMapBuffer&& buffer) noexcept;
+		ShadowAtlasBuffer& operator=(const ShadowAtlasBuffer& buffer) = delete;
+		ShadowAtlasBuffer& operator=(ShadowAtlasBuffer&& buffer) noexcept;
 
 		//---------------------------------------------------------------------
 		// Member Methods
 		//---------------------------------------------------------------------
 
 		[[nodiscard]]
-		std::size_t GetNumberOfShadowMaps() const noexcept {
-			using std::size;
-			return size(m_dsvs);
+		U32 GetResolution() const noexcept {
+			return m_resolution;
 		}
 
-		void Bind(ID3D11DeviceContext& device_context) const noexcept {
-			m_viewport.Bind(device_context);
+		void BindTile(ID3D11DeviceContext& device_context,
+					  const U32x2& position,
+					  U32 size) const noexcept {
+
+			Viewport viewport(U32x2(size, size));
+			viewport.SetTopLeft(static_cast< S32 >(position[0]),
+								static_cast< S32 >(position[1]));
+			viewport.Bind(device_context);
 		}
 		void BindRasterizerState(ID3D11DeviceContext& device_context) const noexcept {
 			Pipeline::RS::BindState(device_context, m_rasterizer_state.Get());
 		}
 
-		void ClearDSVs(ID3D11DeviceContext& device_context) const noexcept {
-			for (const auto& dsv : m_dsvs) {
-				Pipeline::OM::ClearDepthOfDSV(device_context, dsv.Get());
-			}
+		void ClearDSV(ID3D11DeviceContext& device_context) const noexcept {
+			Pipeline::OM::ClearDepthOfDSV(device_context, m_dsv.Get());
 		}
-		void BindDSV(ID3D11DeviceContext& device_context,
-					 std::size_t dsv_index) const noexcept {
-
-			Pipeline::OM::BindRTVAndDSV(device_context, nullptr, m_dsvs[dsv_index].Get());
+		void BindDSV(ID3D11DeviceContext& device_context) const noexcept {
+			Pipeline::OM::BindRTVAndDSV(device_context, nullptr, m_dsv.Get());
 		}
 		[[nodiscard]]
-		ID3D11DepthStencilView& GetDSV(std::size_t dsv_index) const noexcept {
-			return *m_dsvs[dsv_index].Get();
+		ID3D11DepthStencilView& GetDSV() const noexcept {
+			return *m_dsv.Get();
 		}
 		[[nodiscard]]
 		ID3D11ShaderResourceView& GetSRV() const noexcept {
@@ -116,23 +116,21 @@ namespace mage::rendering {
 
 		void SetupRasterizerState(ID3D11Device& device);
 
-		void SetupShadowMapBuffer(ID3D11Device& device,
-								  std::size_t nb_shadow_maps);
-		void SetupShadowMapArray(ID3D11Device& device,
-								 std::size_t nb_shadow_maps,
-			                     DXGI_FORMAT texture_format,
-			                     DXGI_FORMAT dsv_format,
-			                     DXGI_FORMAT srv_format);
+		void SetupShadowAtlasBuffer(ID3D11Device& device);
+		void SetupShadowAtlas(ID3D11Device& device,
+							  DXGI_FORMAT texture_format,
+							  DXGI_FORMAT dsv_format,
+							  DXGI_FORMAT srv_format);
 
 		//---------------------------------------------------------------------
 		// Member Variables
 		//---------------------------------------------------------------------
 
 		DepthFormat m_format;
-		Viewport m_viewport;
+		U32 m_resolution;
 		ComPtr< ID3D11RasterizerState > m_rasterizer_state;
 
-		std::vector< ComPtr< ID3D11DepthStencilView > > m_dsvs;
+		ComPtr< ID3D11DepthStencilView > m_dsv;
 		ComPtr< ID3D11ShaderResourceView > m_srv;
 	};
 
@@ -193,6 +191,14 @@ namespace mage::rendering {
 				Pipeline::OM::ClearDepthOfDSV(device_context, dsv.Get());
 			}
 		}
+		void ClearDSV(ID3D11DeviceContext& device_context,
+					  std::size_t dsv_index) const noexcept {
+
+			Pipeline::OM::ClearDepthOfDSV(device_context, m_dsvs[dsv_index].Get());
+		}
+		void CopyDSV(ID3D11DeviceContext& device_context,
+					 std::size_t dsv_index,
+					 const ShadowCubeMapBuffer& buffer) const noexcept;
 		void BindDSV(ID3D11DeviceContext& device_context,
 					 std::size_t dsv_index) const noexcept {
 
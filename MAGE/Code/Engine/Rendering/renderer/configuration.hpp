@@ -175,6 +175,25 @@ namespace mage::rendering {
 
 	#pragma endregion
 
+	//-------------------------------------------------------------------------
+	// OpaqueOrder
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 An enumeration of the different draw orders of opaque models.
+
+	 This contains:
+	 @c Material (i.e. minimizes the state changes), and
+	 @c FrontToBack (i.e. maximizes the early-Z rejections).
+	 */
+	enum class OpaqueOrder : U8 {
+		Material = 0,
+		FrontToBack
+	};
+
+	#pragma endregion
+
 	//-------------------------------------------------------------------------
 	// BRDF
 	//-------------------------------------------------------------------------
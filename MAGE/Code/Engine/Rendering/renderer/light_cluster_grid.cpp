@@ -0,0 +1,330 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "renderer\light_cluster_grid.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	namespace {
+
+		/**
+		 The minimum position of the near z-plane expressed in camera space
+		 used for slicing the depth (e.g., for orthographic projections).
+		 */
+		constexpr F32 s_min_near_z = 0.001f;
+
+		/**
+		 A struct of projection coefficients (i.e. the coefficients of a
+		 perspective or orthographic camera-to-projection transformation
+		 matrix which are used for converting between camera and NDC
+		 space).
+		 */
+		struct ProjectionCoefficients {
+
+		public:
+
+			/**
+			 Constructs projection coefficients from the given
+			 camera-to-projection transformation matrix.
+
+			 @param[in]		camera_to_projection
+							The camera-to-projection transformation matrix.
+			 */
+			explicit XM_CALLCONV ProjectionCoefficients(
+				FXMMATRIX camera_to_projection) noexcept
+				: m_x(XMVectorGetX(camera_to_projection.r[0])),
+				m_y(XMVectorGetY(camera_to_projection.r[1])),
+				m_zx(XMVectorGetX(camera_to_projection.r[2])),
+				m_zy(XMVectorGetY(camera_to_projection.r[2])),
+				m_zw(XMVectorGetW(camera_to_projection.r[2])),
+				m_tx(XMVectorGetX(camera_to_projection.r[3])),
+				m_ty(XMVectorGetY(camera_to_projection.r[3])),
+				m_tw(XMVectorGetW(camera_to_projection.r[3])) {}
+
+			/**
+			 Returns the homogeneous w coordinate of the given camera-space
+			 depth.
+
+			 @param[in]		z
+							The depth expressed in camera space.
+			 @return		The homogeneous w coordinate of @a z.
+			 */
+			[[nodiscard]]
+			F32 GetW(F32 z) const noexcept {
+				return z * m_zw + m_tw;
+			}
+
+			/**
+			 The projection coefficients.
+			 */
+			F32 m_x, m_y, m_zx, m_zy, m_zw, m_tx, m_ty, m_tw;
+		};
+
+		/**
+		 Converts the given NDC coordinate to the corresponding screen tile
+		 index.
+
+		 @param[in]		ndc
+						The NDC coordinate.
+		 @param[in]		nb_tiles
+						The number of screen tiles.
+		 @return		The (clamped) screen tile index of @a ndc.
+		 */
+		[[nodiscard]]
+		U32 NDCToTile(F32 ndc, U32 nb_tiles) noexcept {
+			const auto tile = std::floor((0.5f * ndc + 0.5f)
+										 * static_cast< F32 >(nb_tiles));
+			return static_cast< U32 >(std::clamp(tile, 0.0f,
+				static_cast< F32 >(nb_tiles - 1u)));
+		}
+	}
+
+	LightClusterGrid::LightClusterGrid()
+		: m_clusters(s_nb_clusters),
+		m_counts(),
+		m_pairs(),
+		m_light_index_list(),
+		m_depth_scale(0.0f),
+		m_depth_bias(0.0f) {}
+
+	LightClusterGrid::LightClusterGrid(const LightClusterGrid& grid) = default;
+
+	LightClusterGrid::LightClusterGrid(LightClusterGrid&& grid) noexcept = default;
+
+	LightClusterGrid::~LightClusterGrid() = default;
+
+	LightClusterGrid& LightClusterGrid
+		::operator=(const LightClusterGrid& grid) = default;
+
+	LightClusterGrid& LightClusterGrid
+		::operator=(LightClusterGrid&& grid) noexcept = default;
+
+	void XM_CALLCONV LightClusterGrid
+		::Build(FXMMATRIX camera_to_projection,
+				F32 near_z,
+				F32 far_z,
+				gsl::span< const BoundingSphere > omni_lights,
+				gsl::span< const BoundingSphere > spot_lights) {
+
+		Clear();
+
+		SetupClusters(camera_to_projection, near_z, far_z);
+
+		// Collect the (cluster, light index) pairs: all omni lights precede
+		// all spotlights.
+		m_counts.assign(2u * s_nb_clusters, 0u);
+		AssignLights(camera_to_projection, omni_lights, 0u);
+		AssignLights(camera_to_projection, spot_lights, 1u);
+
+		// Compute the cluster headers.
+		auto offset = static_cast< U32 >(2u * s_nb_clusters);
+		m_light_index_list.resize(offset + m_pairs.size());
+		for (std::size_t i = 0u; i < s_nb_clusters; ++i) {
+			const auto nb_omni_lights = m_counts[2u * i];
+			const auto nb_spot_lights = m_counts[2u * i + 1u];
+
+			m_light_index_list[2u * i]      = offset;
+			m_light_index_list[2u * i + 1u] = nb_omni_lights | (nb_spot_lights << 16u);
+
+			// Reuse the counts as the write cursors of the clusters (the
+			// counts of the i-th cluster are stored at index 2i >= i).
+			m_counts[i] = offset;
+			offset += nb_omni_lights + nb_spot_lights;
+		}
+
+		// Scatter the light indices (preserving the order of the pairs).
+		for (const auto& pair : m_pairs) {
+			m_light_index_list[m_counts[pair[0]]++] = pair[1];
+		}
+	}
+
+	void LightClusterGrid::Clear() noexcept {
+		m_counts.clear();
+		m_pairs.clear();
+		m_light_index_list.clear();
+	}
+
+	[[nodiscard]]
+	gsl::span< const U32 > LightClusterGrid
+		::GetOmniLights(std::size_t cluster) const noexcept {
+
+		const auto offset = m_light_index_list[2u * cluster];
+		const auto counts = m_light_index_list[2u * cluster + 1u];
+		return { m_light_index_list.data() + offset,
+				 static_cast< std::ptrdiff_t >(counts & 0xFFFFu) };
+	}
+
+	[[nodiscard]]
+	gsl::span< const U32 > LightClusterGrid
+		::GetSpotLights(std::size_t cluster) const noexcept {
+
+		const auto offset = m_light_index_list[2u * cluster];
+		const auto counts = m_light_index_list[2u * cluster + 1u];
+		return { m_light_index_list.data() + offset + (counts & 0xFFFFu),
+				 static_cast< std::ptrdiff_t >(counts >> 16u) };
+	}
+
+	void XM_CALLCONV LightClusterGrid
+		::SetupClusters(FXMMATRIX camera_to_projection,
+						F32 near_z,
+						F32 far_z) {
+
+		near_z = std::max(near_z, s_min_near_z);
+		far_z  = std::max(far_z,  near_z * 1.001f);
+
+		// slice = log(z) * scale + bias
+		m_depth_scale = static_cast< F32 >(s_nb_slices) / std::log(far_z / near_z);
+		m_depth_bias  = -std::log(near_z) * m_depth_scale;
+
+		const ProjectionCoefficients projection(camera_to_projection);
+
+		// Converts the given NDC xy coordinates and camera-space depth to
+		// the corresponding camera-space position.
+		const auto to_camera = [&projection](F32 x, F32 y, F32 z) noexcept {
+			const auto w = projection.GetW(z);
+			return XMVectorSet(
+				(x * w - z * projection.m_zx - projection.m_tx) / projection.m_x,
+				(y * w - z * projection.m_zy - projection.m_ty) / projection.m_y,
+				z, 1.0f);
+		};
+
+		const auto inv_nb_tiles_x = 2.0f / static_cast< F32 >(s_nb_tiles_x);
+		const auto inv_nb_tiles_y = 2.0f / static_cast< F32 >(s_nb_tiles_y);
+		const auto inv_nb_slices  = 1.0f / static_cast< F32 >(s_nb_slices);
+		const auto ratio          = far_z / near_z;
+
+		for (U32 z = 0u; z < s_nb_slices; ++z) {
+			const auto z0 = near_z * std::pow(ratio, (z + 0u) * inv_nb_slices);
+			const auto z1 = near_z * std::pow(ratio, (z + 1u) * inv_nb_slices);
+
+			for (U32 y = 0u; y < s_nb_tiles_y; ++y) {
+				const auto y0 = (y + 0u) * inv_nb_tiles_y - 1.0f;
+				const auto y1 = (y + 1u) * inv_nb_tiles_y - 1.0f;
+
+				for (U32 x = 0u; x < s_nb_tiles_x; ++x) {
+					const auto x0 = (x + 0u) * inv_nb_tiles_x - 1.0f;
+					const auto x1 = (x + 1u) * inv_nb_tiles_x - 1.0f;
+
+					AABB aabb(to_camera(x0, y0, z0));
+					aabb = AABB::Union(aabb, to_camera(x1, y0, z0));
+					aabb = AABB::Union(aabb, to_camera(x0, y1, z0));
+					aabb = AABB::Union(aabb, to_camera(x1, y1, z0));
+					aabb = AABB::Union(aabb, to_camera(x0, y0, z1));
+					aabb = AABB::Union(aabb, to_camera(x1, y0, z1));
+					aabb = AABB::Union(aabb, to_camera(x0, y1, z1));
+					aabb = AABB::Union(aabb, to_camera(x1, y1, z1));
+
+					m_clusters[GetClusterIndex(x, y, z)] = aabb;
+				}
+			}
+		}
+	}
+
+	void XM_CALLCONV LightClusterGrid
+		::AssignLights(FXMMATRIX camera_to_projection,
+					   gsl::span< const BoundingSphere > lights,
+					   std::size_t type) {
+
+		const ProjectionCoefficients projection(camera_to_projection);
+
+		const auto get_slice = [this](F32 z) noexcept {
+			const auto slice = std::floor(std::log(std::max(z, s_min_near_z))
+										  * m_depth_scale + m_depth_bias);
+			return static_cast< U32 >(std::clamp(slice, 0.0f,
+				static_cast< F32 >(s_nb_slices - 1u)));
+		};
+
+		for (std::size_t i = 0u, count = lights.size(); i < count; ++i) {
+			const auto& light = lights[i];
+			const auto  p     = XMStore< F32x3 >(light.Centroid());
+			const auto  r     = light.Radius();
+
+			const F32x3 p_min = { p[0] - r, p[1] - r, p[2] - r };
+			const F32x3 p_max = { p[0] + r, p[1] + r, p[2] + r };
+
+			// Determine the range of depth slices.
+			const auto slice_log_max = std::log(std::max(p_max[2], s_min_near_z))
+				                     * m_depth_scale + m_depth_bias;
+			const auto slice_log_min = std::log(std::max(p_min[2], s_min_near_z))
+				                     * m_depth_scale + m_depth_bias;
+			if (slice_log_max < 0.0f
+				|| static_cast< F32 >(s_nb_slices) <= slice_log_min) {
+				continue;
+			}
+
+			const auto z_first = get_slice(p_min[2]);
+			const auto z_last  = get_slice(p_max[2]);
+
+			// Determine the range of screen tiles by projecting the AABB of
+			// the bounding sphere (if it does not cross the camera plane).
+			U32 x_first = 0u, x_last = s_nb_tiles_x - 1u;
+			U32 y_first = 0u, y_last = s_nb_tiles_y - 1u;
+			const auto w_min = std::min(projection.GetW(p_min[2]),
+										projection.GetW(p_max[2]));
+			if (0.0f < w_min) {
+				const auto infinity = std::numeric_limits< F32 >::infinity();
+				F32x2 ndc_x = { infinity, -infinity };
+				F32x2 ndc_y = { infinity, -infinity };
+				for (const auto z : { p_min[2], p_max[2] }) {
+					const auto inv_w = 1.0f / projection.GetW(z);
+					for (const auto x : { p_min[0], p_max[0] }) {
+						const auto ndc = (x * projection.m_x + z * projection.m_zx
+										  + projection.m_tx) * inv_w;
+						ndc_x[0] = std::min(ndc_x[0], ndc);
+						ndc_x[1] = std::max(ndc_x[1], ndc);
+					}
+					for (const auto y : { p_min[1], p_max[1] }) {
+						const auto ndc = (y * projection.m_y + z * projection.m_zy
+										  + projection.m_ty) * inv_w;
+						ndc_y[0] = std::min(ndc_y[0], ndc);
+						ndc_y[1] = std::max(ndc_y[1], ndc);
+					}
+				}
+
+				if (ndc_x[1] < -1.0f || 1.0f < ndc_x[0]
+					|| ndc_y[1] < -1.0f || 1.0f < ndc_y[0]) {
+					continue;
+				}
+
+				x_first = NDCToTile(ndc_x[0], s_nb_tiles_x);
+				x_last  = NDCToTile(ndc_x[1], s_nb_tiles_x);
+				y_first = NDCToTile(ndc_y[0], s_nb_tiles_y);
+				y_last  = NDCToTile(ndc_y[1], s_nb_tiles_y);
+			}
+
+			// Test the bounding sphere against the candidate clusters.
+			for (auto z = z_first; z <= z_last; ++z) {
+				for (auto y = y_first; y <= y_last; ++y) {
+					for (auto x = x_first; x <= x_last; ++x) {
+						const auto cluster = GetClusterIndex(x, y, z);
+						if (!light.Overlaps(m_clusters[cluster])) {
+							continue;
+						}
+
+						m_pairs.push_back({ static_cast< U32 >(cluster),
+											static_cast< U32 >(i) });
+						++m_counts[2u * cluster + type];
+					}
+				}
+			}
+		}
+	}
+}
\ No newline at end of file
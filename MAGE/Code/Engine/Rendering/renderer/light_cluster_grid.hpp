@@ -0,0 +1,317 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "geometry\bounding_volume.hpp"
+#include "collection\vector.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <gsl\span>
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	/**
+	 A class of light cluster grids.
+
+	 A light cluster grid partitions the view frustum of a camera into
+	 clusters (i.e. froxels): uniform screen tiles times exponential
+	 view-space depth slices. The omni lights and spotlights are assigned to
+	 the clusters their bounding spheres overlap, resulting in a compact
+	 light index list:
+	 - for each cluster: the offset of its light indices in the light index
+	   list, followed by its number of omni lights (lower 16 bits) and
+	   spotlights (upper 16 bits);
+	 - for each cluster: the indices of its omni lights, followed by the
+	   indices of its spotlights.
+
+	 Light cluster grids do not access the GPU.
+	 */
+	class LightClusterGrid {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Class Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The number of screen tiles along the x axis of light cluster grids.
+		 */
+		static constexpr U32 s_nb_tiles_x = 16u;
+
+		/**
+		 The number of screen tiles along the y axis of light cluster grids.
+		 */
+		static constexpr U32 s_nb_tiles_y = 9u;
+
+		/**
+		 The number of depth slices of light cluster grids.
+		 */
+		static constexpr U32 s_nb_slices = 24u;
+
+		/**
+		 The number of clusters of light cluster grids.
+		 */
+		static constexpr std::size_t s_nb_clusters
+			= s_nb_tiles_x * s_nb_tiles_y * s_nb_slices;
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a light cluster grid.
+		 */
+		LightClusterGrid();
+
+		/**
+		 Constructs a light cluster grid from the given light cluster grid.
+
+		 @param[in]		grid
+						A reference to the light cluster grid to copy.
+		 */
+		LightClusterGrid(const LightClusterGrid& grid);
+
+		/**
+		 Constructs a light cluster grid by moving the given light cluster
+		 grid.
+
+		 @param[in]		grid
+						A reference to the light cluster grid to move.
+		 */
+		LightClusterGrid(LightClusterGrid&& grid) noexcept;
+
+		/**
+		 Destructs this light cluster grid.
+		 */
+		~LightClusterGrid();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given light cluster grid to this light cluster grid.
+
+		 @param[in]		grid
+						A reference to the light cluster grid to copy.
+		 @return		A reference to the copy of the given light cluster
+						grid (i.e. this light cluster grid).
+		 */
+		LightClusterGrid& operator=(const LightClusterGrid& grid);
+
+		/**
+		 Moves the given light cluster grid to this light cluster grid.
+
+		 @param[in]		grid
+						A reference to the light cluster grid to move.
+		 @return		A reference to the moved light cluster grid (i.e. this
+						light cluster grid).
+		 */
+		LightClusterGrid& operator=(LightClusterGrid&& grid) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Builds this light cluster grid.
+
+		 @pre			The camera-to-projection transformation matrix is a
+						perspective or orthographic projection matrix.
+		 @pre			@a near_z is smaller than @a far_z.
+		 @param[in]		camera_to_projection
+						The camera-to-projection transformation matrix.
+		 @param[in]		near_z
+						The position of the near z-plane expressed in camera
+						space.
+		 @param[in]		far_z
+						The position of the far z-plane expressed in camera
+						space.
+		 @param[in]		omni_lights
+						The bounding spheres of the omni lights expressed in
+						camera space.
+		 @param[in]		spot_lights
+						The bounding spheres of the spotlights expressed in
+						camera space.
+		 */
+		void XM_CALLCONV Build(FXMMATRIX camera_to_projection,
+							   F32 near_z,
+							   F32 far_z,
+							   gsl::span< const BoundingSphere > omni_lights,
+							   gsl::span< const BoundingSphere > spot_lights);
+
+		/**
+		 Clears this light cluster grid.
+		 */
+		void Clear() noexcept;
+
+		/**
+		 Returns the index of the given cluster of this light cluster grid.
+
+		 @param[in]		x
+						The index of the screen tile along the x axis.
+		 @param[in]		y
+						The index of the screen tile along the y axis.
+		 @param[in]		z
+						The index of the depth slice.
+		 @return		The index of the given cluster.
+		 */
+		[[nodiscard]]
+		static constexpr std::size_t GetClusterIndex(U32 x,
+													 U32 y,
+													 U32 z) noexcept {
+
+			return (z * s_nb_tiles_y + y) * s_nb_tiles_x + x;
+		}
+
+		/**
+		 Returns the scale to apply to the logarithm of a camera-space depth
+		 to obtain its depth slice.
+
+		 @return		The depth scale of this light cluster grid.
+		 */
+		[[nodiscard]]
+		F32 GetDepthScale() const noexcept {
+			return m_depth_scale;
+		}
+
+		/**
+		 Returns the bias to add to the scaled logarithm of a camera-space
+		 depth to obtain its depth slice.
+
+		 @return		The depth bias of this light cluster grid.
+		 */
+		[[nodiscard]]
+		F32 GetDepthBias() const noexcept {
+			return m_depth_bias;
+		}
+
+		/**
+		 Returns the light index list of this light cluster grid.
+
+		 @return		A reference to the light index list of this light
+						cluster grid.
+		 */
+		[[nodiscard]]
+		const AlignedVector< U32 >& GetLightIndexList() const noexcept {
+			return m_light_index_list;
+		}
+
+		/**
+		 Returns the indices of the omni lights of the given cluster of this
+		 light cluster grid.
+
+		 @pre			This light cluster grid is built.
+		 @pre			@a cluster is smaller than the number of clusters.
+		 @param[in]		cluster
+						The index of the cluster.
+		 @return		The indices of the omni lights of the given cluster.
+		 */
+		[[nodiscard]]
+		gsl::span< const U32 > GetOmniLights(std::size_t cluster) const noexcept;
+
+		/**
+		 Returns the indices of the spotlights of the given cluster of this
+		 light cluster grid.
+
+		 @pre			This light cluster grid is built.
+		 @pre			@a cluster is smaller than the number of clusters.
+		 @param[in]		cluster
+						The index of the cluster.
+		 @return		The indices of the spotlights of the given cluster.
+		 */
+		[[nodiscard]]
+		gsl::span< const U32 > GetSpotLights(std::size_t cluster) const noexcept;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Sets up the AABBs of the clusters of this light cluster grid.
+
+		 @param[in]		camera_to_projection
+						The camera-to-projection transformation matrix.
+		 @param[in]		near_z
+						The position of the near z-plane expressed in camera
+						space.
+		 @param[in]		far_z
+						The position of the far z-plane expressed in camera
+						space.
+		 */
+		void XM_CALLCONV SetupClusters(FXMMATRIX camera_to_projection,
+									   F32 near_z,
+									   F32 far_z);
+
+		/**
+		 Assigns the given lights to the clusters of this light cluster grid.
+
+		 @param[in]		camera_to_projection
+						The camera-to-projection transformation matrix.
+		 @param[in]		lights
+						The bounding spheres of the lights expressed in camera
+						space.
+		 @param[in]		type
+						The light type (i.e. 0 for omni lights and 1 for
+						spotlights).
+		 */
+		void XM_CALLCONV AssignLights(FXMMATRIX camera_to_projection,
+									  gsl::span< const BoundingSphere > lights,
+									  std::size_t type);
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 A vector containing the AABBs of the clusters of this light cluster
+		 grid expressed in camera space.
+		 */
+		AlignedVector< AABB > m_clusters;
+
+		/**
+		 A vector containing the number of omni lights and spotlights of each
+		 cluster of this light cluster grid during building.
+		 */
+		std::vector< U32 > m_counts;
+
+		/**
+		 A vector containing the (cluster, light index) pairs of this light
+		 cluster grid during building.
+		 */
+		std::vector< U32x2 > m_pairs;
+
+		/**
+		 The light index list of this light cluster grid.
+		 */
+		AlignedVector< U32 > m_light_index_list;
+
+		/**
+		 The depth scale of this light cluster grid.
+		 */
+		F32 m_depth_scale;
+
+		/**
+		 The depth bias of this light cluster grid.
+		 */
+		F32 m_depth_bias;
+	};
+}
\ No newline at end of file
@@ -21,7 +21,11 @@ namespace mage::rendering {
 				   ResourceManager& resource_manager)
 		: m_device_context(device_context),
 		m_state_manager(state_manager),
-		m_resource_manager(resource_manager) {}
+		m_resource_manager(resource_manager),
+		m_preprocess_cs(CreateAAPreprocessCS(resource_manager)),
+		m_fxaa_cs(CreateFXAACS(resource_manager)),
+		m_msaa_resolve_cs(CreateMSAAResolveCS(resource_manager)),
+		m_ssaa_resolve_cs(CreateSSAAResolveCS(resource_manager)) {}
 
 	AAPass::AAPass(AAPass&& pass) noexcept = default;
 
@@ -36,8 +40,7 @@ namespace mage::rendering {
 		switch (aa) {
 
 		case AntiAliasing::FXAA: {
-			const auto cs = CreateAAPreprocessCS(m_resource_manager);
-			cs->BindShader(m_device_context);
+			m_preprocess_cs->BindShader(m_device_context);
 			break;
 		}
 
@@ -61,24 +64,21 @@ namespace mage::rendering {
 		switch (aa) {
 
 		case AntiAliasing::FXAA: {
-			const auto cs = CreateFXAACS(m_resource_manager);
-			cs->BindShader(m_device_context);
+			m_fxaa_cs->BindShader(m_device_context);
 			break;
 		}
 
 		case AntiAliasing::MSAA_2x:
 		case AntiAliasing::MSAA_4x:
 		case AntiAliasing::MSAA_8x: {
-			const auto cs = CreateMSAAResolveCS(m_resource_manager);
-			cs->BindShader(m_device_context);
+			m_msaa_resolve_cs->BindShader(m_device_context);
 			break;
 		}
 
 		case AntiAliasing::SSAA_2x:
 		case AntiAliasing::SSAA_3x:
 		case AntiAliasing::SSAA_4x: {
-			const auto cs = CreateSSAAResolveCS(m_resource_manager);
-			cs->BindShader(m_device_context);
+			m_ssaa_resolve_cs->BindShader(m_device_context);
 			break;
 		}
 
@@ -135,5 +135,25 @@ namespace mage::rendering {
 		 A reference to the resource manager of this AA pass.
 		 */
 		std::reference_wrapper< ResourceManager > m_resource_manager;
+
+		/**
+		 A pointer to the AA preprocess compute shader of this AA pass.
+		 */
+		ComputeShaderPtr m_preprocess_cs;
+
+		/**
+		 A pointer to the FXAA compute shader of this AA pass.
+		 */
+		ComputeShaderPtr m_fxaa_cs;
+
+		/**
+		 A pointer to the MSAA resolve compute shader of this AA pass.
+		 */
+		ComputeShaderPtr m_msaa_resolve_cs;
+
+		/**
+		 A pointer to the SSAA resolve compute shader of this AA pass.
+		 */
+		ComputeShaderPtr m_ssaa_resolve_cs;
 	};
 }
\ No newline at end of file
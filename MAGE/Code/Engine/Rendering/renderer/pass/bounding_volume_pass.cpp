@@ -104,11 +104,7 @@ namespace mage::rendering {
 		BindLightColor();
 
 		// Process the directional lights.
-		world.ForEach< DirectionalLight >([this, world_to_projection](const DirectionalLight& light) {
-			if (State::Active != light.GetState()) {
-				return;
-			}
-
+		world.ForEachActive< DirectionalLight >([this, world_to_projection](const DirectionalLight& light) {
 			const auto& transform            = light.GetOwner()->GetTransform();
 			const auto  object_to_world      = transform.GetObjectToWorldMatrix();
 			const auto  object_to_projection = object_to_world * world_to_projection;
@@ -123,11 +119,7 @@ namespace mage::rendering {
 		});
 
 		// Process the omni lights.
-		world.ForEach< OmniLight >([this, world_to_projection](const OmniLight& light) {
-			if (State::Active != light.GetState()) {
-				return;
-			}
-
+		world.ForEachActive< OmniLight >([this, world_to_projection](const OmniLight& light) {
 			const auto& transform            = light.GetOwner()->GetTransform();
 			const auto  object_to_world      = transform.GetObjectToWorldMatrix();
 			const auto  object_to_projection = object_to_world * world_to_projection;
@@ -141,11 +133,7 @@ namespace mage::rendering {
 		});
 
 		// Process the spot lights.
-		world.ForEach< SpotLight >([this, world_to_projection](const SpotLight& light) {
-			if (State::Active != light.GetState()) {
-				return;
-			}
-
+		world.ForEachActive< SpotLight >([this, world_to_projection](const SpotLight& light) {
 			const auto& transform            = light.GetOwner()->GetTransform();
 			const auto  object_to_world      = transform.GetObjectToWorldMatrix();
 			const auto  object_to_projection = object_to_world * world_to_projection;
@@ -163,11 +151,7 @@ namespace mage::rendering {
 		BindModelColor();
 
 		// Process the models.
-		world.ForEach< Model >([this, world_to_projection](const Model& model) {
-			if (State::Active != model.GetState()) {
-				return;
-			}
-
+		world.ForEachActive< Model >([this, world_to_projection](const Model& model) {
 			const auto& transform            = model.GetOwner()->GetTransform();
 			const auto  object_to_world      = transform.GetObjectToWorldMatrix();
 			const auto  object_to_projection = object_to_world * world_to_projection;
@@ -22,7 +22,9 @@ namespace mage::rendering {
 		: m_device_context(device_context),
 		m_state_manager(state_manager),
 		m_resource_manager(resource_manager),
-		m_msaa_vs(CreateNearFullscreenTriangleVS(resource_manager)) {}
+		m_msaa_vs(CreateNearFullscreenTriangleVS(resource_manager)),
+		m_msaa_ps(),
+		m_cs() {}
 
 	DeferredPass::DeferredPass(DeferredPass&& pass) noexcept = default;
 
@@ -57,7 +59,10 @@ namespace mage::rendering {
 		// Binds the fixed state.
 		BindFixedState();
 
-		const auto ps = CreateDeferredMSAAPS(m_resource_manager, brdf, vct);
+		const auto& ps = m_msaa_ps.Get(GetDeferredPermutation(brdf, vct),
+			[this, brdf, vct]() {
+				return CreateDeferredMSAAPS(m_resource_manager, brdf, vct);
+			});
 		// PS: Bind the pixel shader.
 		ps->BindShader(m_device_context);
 
@@ -68,7 +73,10 @@ namespace mage::rendering {
 	void DeferredPass::Dispatch(const U32x2& viewport_size,
 								BRDF brdf, bool vct) {
 
-		const auto cs = CreateDeferredCS(m_resource_manager, brdf, vct);
+		const auto& cs = m_cs.Get(GetDeferredPermutation(brdf, vct),
+			[this, brdf, vct]() {
+				return CreateDeferredCS(m_resource_manager, brdf, vct);
+			});
 		// CS: Bind the compute shader.
 		cs->BindShader(m_device_context);
 
@@ -8,6 +8,7 @@
 #include "renderer\configuration.hpp"
 #include "renderer\state_manager.hpp"
 #include "resource\rendering_resource_manager.hpp"
+#include "resource\shader\shader_permutation.hpp"
 
 #pragma endregion
 
@@ -153,5 +154,15 @@ namespace mage::rendering {
 		 A pointer to the vertex shader of this deferred pass.
 		 */
 		VertexShaderPtr m_msaa_vs;
+
+		/**
+		 The MSAA pixel shaders of this deferred pass.
+		 */
+		DeferredMSAAPSCache m_msaa_ps;
+
+		/**
+		 The compute shaders of this deferred pass.
+		 */
+		DeferredCSCache m_cs;
 	};
 }
\ No newline at end of file
@@ -22,9 +22,13 @@ namespace mage::rendering {
 						 ResourceManager& resource_manager)
 		: m_device_context(device_context),
 		m_state_manager(state_manager),
-		m_opaque_vs(CreateDepthVS(resource_manager)),
-		m_transparent_vs(CreateDepthTransparentVS(resource_manager)),
+		m_opaque_vs(CreateDepthVS(resource_manager, false)),
+		m_opaque_compact_vs(CreateDepthVS(resource_manager, true)),
+		m_transparent_vs(CreateDepthTransparentVS(resource_manager, false)),
+		m_transparent_compact_vs(CreateDepthTransparentVS(resource_manager, true)),
 		m_transparent_ps(CreateDepthTransparentPS(resource_manager)),
+		m_fullscreen_vs(CreateFarFullscreenTriangleVS(resource_manager)),
+		m_copy_ps(CreateDepthCopyPS(resource_manager)),
 		m_camera_buffer(device) {}
 
 	DepthPass::DepthPass(DepthPass&& pass) noexcept = default;
@@ -86,7 +90,8 @@ namespace mage::rendering {
 		// Bind the projection data.
 		BindCamera(world_to_camera, camera_to_projection);
 
-		const auto world_to_projection = world_to_camera * camera_to_projection;
+		// Apply view frustum culling to the world-space AABBs of the models.
+		const BoundingFrustum frustum(world_to_camera * camera_to_projection);
 
 		//---------------------------------------------------------------------
 		// All opaque models.
@@ -96,13 +101,12 @@ namespace mage::rendering {
 		BindOpaqueShaders();
 
 		// Process the opaque models.
-		world.ForEach< Model >([this, world_to_projection](const Model& model) {
-			if (State::Active != model.GetState()
-				|| model.GetMaterial().IsTransparant()) {
+		world.ForEachActiveModel(frustum, [this](const Model& model) {
+			if (model.GetMaterial().IsTransparant()) {
 				return;
 			}
 
-			RenderOpaque(model, world_to_projection);
+			RenderOpaque(model);
 		});
 
 		//---------------------------------------------------------------------
@@ -113,27 +117,28 @@ namespace mage::rendering {
 		BindTransparentShaders();
 
 		// Process the transparent models.
-		world.ForEach< Model >([this, world_to_projection](const Model& model) {
+		world.ForEachActiveModel(frustum, [this](const Model& model) {
 
 			const auto& material = model.GetMaterial();
 
-			if (State::Active != model.GetState()
-				|| !material.IsTransparant()
+			if (!material.IsTransparant()
 				|| material.GetBaseColor()[3] < TRANSPARENCY_SHADOW_THRESHOLD) {
 				return;
 			}
 
-			RenderTransparent(model, world_to_projection);
+			RenderTransparent(model);
 		});
 	}
 
 	void XM_CALLCONV DepthPass::RenderOccluders(const World& world,
 												FXMMATRIX world_to_camera,
-												CXMMATRIX camera_to_projection) {
+												CXMMATRIX camera_to_projection,
+												ModelMobility mobility) {
 		// Bind the projection data.
 		BindCamera(world_to_camera, camera_to_projection);
 
-		const auto world_to_projection = world_to_camera * camera_to_projection;
+		// Apply view frustum culling to the world-space AABBs of the models.
+		const BoundingFrustum frustum(world_to_camera * camera_to_projection);
 
 		//---------------------------------------------------------------------
 		// All opaque models.
@@ -143,15 +148,14 @@ namespace mage::rendering {
 		BindOpaqueShaders();
 
 		// Process the opaque models.
-		world.ForEach< Model >([this, world_to_projection](const Model& model) {
-			if (State::Active != model.GetState()
-				|| !model.OccludesLight()
+		world.ForEachActiveModel(frustum, [this](const Model& model) {
+			if (!model.OccludesLight()
 				|| model.GetMaterial().IsTransparant()) {
 				return;
 			}
 
-			RenderOpaque(model, world_to_projection);
-		});
+			RenderOpaque(model);
+		}, mobility);
 
 		//---------------------------------------------------------------------
 		// All transparent models.
@@ -161,33 +165,111 @@ namespace mage::rendering {
 		BindTransparentShaders();
 
 		// Process the transparent models.
-		world.ForEach< Model >([this, world_to_projection](const Model& model) {
+		world.ForEachActiveModel(frustum, [this](const Model& model) {
 
 			const auto& material = model.GetMaterial();
 
-			if (State::Active != model.GetState()
-				|| !model.OccludesLight()
+			if (!model.OccludesLight()
 				|| !material.IsTransparant()
 				|| material.GetBaseColor()[3] < TRANSPARENCY_SHADOW_THRESHOLD) {
 				return;
 			}
 
-			RenderTransparent(model, world_to_projection);
-		});
+			RenderTransparent(model);
+		}, mobility);
 	}
 
-	void XM_CALLCONV DepthPass::RenderOpaque(const Model& model,
-											 FXMMATRIX world_to_projection) const noexcept {
+	void XM_CALLCONV DepthPass::RenderOccluders(gsl::span< const Model* const > occluders,
+												FXMMATRIX world_to_camera,
+												CXMMATRIX camera_to_projection) {
+		// Bind the projection data.
+		BindCamera(world_to_camera, camera_to_projection);
+
+		//---------------------------------------------------------------------
+		// All opaque models.
+		//---------------------------------------------------------------------
+
+		// Bind the shaders.
+		BindOpaqueShaders();
+
+		// Process the opaque models.
+		for (const auto model : occluders) {
+			if (model->GetMaterial().IsTransparant()) {
+				continue;
+			}
+
+			RenderOpaque(*model);
+		}
+
+		//---------------------------------------------------------------------
+		// All transparent models.
+		//---------------------------------------------------------------------
+
+		// Bind the shaders.
+		BindTransparentShaders();
+
+		// Process the transparent models.
+		for (const auto model : occluders) {
 
-		const auto& transform            = model.GetOwner()->GetTransform();
-		const auto  object_to_world      = transform.GetObjectToWorldMatrix();
-		const auto  object_to_projection = object_to_world * world_to_projection;
+			const auto& material = model->GetMaterial();
 
-		// Apply view frustum culling.
-		if (BoundingFrustum::Cull(object_to_projection, model.GetAABB())) {
-			return;
+			if (!material.IsTransparant()
+				|| material.GetBaseColor()[3] < TRANSPARENCY_SHADOW_THRESHOLD) {
+				continue;
+			}
+
+			RenderTransparent(*model);
 		}
+	}
 
+	void DepthPass::ClearDepth() const noexcept {
+		// IA: Bind the primitive topology.
+		Pipeline::IA::BindPrimitiveTopology(m_device_context,
+											D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+		// VS: Bind the vertex shader.
+		m_fullscreen_vs->BindShader(m_device_context);
+		// RS: Bind the rasterization state.
+		m_state_manager.get().Bind(m_device_context,
+								   RasterizerStateID::NoCulling);
+		// PS: Bind no pixel shader.
+		Pipeline::PS::BindShader(m_device_context, nullptr);
+		// OM: Bind the depth-stencil state.
+		m_state_manager.get().Bind(m_device_context,
+								   DepthStencilStateID::AlwaysDepthReadWrite);
+
+		// Draw the fullscreen triangle at the far plane.
+		Pipeline::Draw(m_device_context, 3u, 0u);
+	}
+
+	void DepthPass::CopyDepth(ID3D11ShaderResourceView& srv) const noexcept {
+		// IA: Bind the primitive topology.
+		Pipeline::IA::BindPrimitiveTopology(m_device_context,
+											D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+		// VS: Bind the vertex shader.
+		m_fullscreen_vs->BindShader(m_device_context);
+		// RS: Bind the rasterization state.
+		m_state_manager.get().Bind(m_device_context,
+								   RasterizerStateID::NoCulling);
+		// PS: Bind the pixel shader.
+		m_copy_ps->BindShader(m_device_context);
+		// PS: Bind the SRV.
+		Pipeline::PS::BindSRV(m_device_context, SLOT_SRV_IMAGE, &srv);
+		// OM: Bind the depth-stencil state.
+		m_state_manager.get().Bind(m_device_context,
+								   DepthStencilStateID::AlwaysDepthReadWrite);
+
+		// Draw the fullscreen triangle (the pixel shader outputs the depth).
+		Pipeline::Draw(m_device_context, 3u, 0u);
+
+		// PS: Unbind the SRV.
+		Pipeline::PS::BindSRV(m_device_context, SLOT_SRV_IMAGE, nullptr);
+	}
+
+	void DepthPass::RenderOpaque(const Model& model) const noexcept {
+		// Bind the vertex shader matching the vertices of the model.
+		const auto& vs = model.GetMesh()->HasCompactVertices()
+			           ? m_opaque_compact_vs : m_opaque_vs;
+		vs->BindShader(m_device_context);
 		// Bind the constant buffer of the model.
 		model.BindBuffer< Pipeline::VS >(m_device_context, SLOT_CBUFFER_MODEL);
 		// Bind the mesh of the model.
@@ -196,18 +278,11 @@ namespace mage::rendering {
 		model.Draw(m_device_context);
 	}
 
-	void XM_CALLCONV DepthPass::RenderTransparent(const Model& model,
-												  FXMMATRIX world_to_projection) const noexcept {
-
-		const auto& transform            = model.GetOwner()->GetTransform();
-		const auto  object_to_world      = transform.GetObjectToWorldMatrix();
-		const auto  object_to_projection = object_to_world * world_to_projection;
-
-		// Apply view frustum culling.
-		if (BoundingFrustum::Cull(object_to_projection, model.GetAABB())) {
-			return;
-		}
-
+	void DepthPass::RenderTransparent(const Model& model) const noexcept {
+		// Bind the vertex shader matching the vertices of the model.
+		const auto& vs = model.GetMesh()->HasCompactVertices()
+			           ? m_transparent_compact_vs : m_transparent_vs;
+		vs->BindShader(m_device_context);
 		// Bind the constant buffer of the model.
 		model.BindBuffer< Pipeline::VS >(m_device_context, SLOT_CBUFFER_MODEL);
 		model.BindBuffer< Pipeline::PS >(m_device_context, SLOT_CBUFFER_MODEL);
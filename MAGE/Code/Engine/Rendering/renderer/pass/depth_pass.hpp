@@ -5,12 +5,22 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
+#include "renderer\buffer\constant_buffer.hpp"
 #include "renderer\state_manager.hpp"
 #include "resource\rendering_resource_manager.hpp"
 #include "scene\rendering_world.hpp"
 
 #pragma endregion
 
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <gsl\span>
+
+#pragma endregion
+
 //-----------------------------------------------------------------------------
 // Engine Declarations end Definitions
 //-----------------------------------------------------------------------------
@@ -104,6 +114,7 @@ namespace mage::rendering {
 		/**
 		 Renders the world.
 
+		 @pre			The model hierarchy of the given world is up-to-date.
 		 @param[in]		world
 						A reference to the world.
 		 @param[in]		world_to_camera
@@ -120,19 +131,61 @@ namespace mage::rendering {
 		/**
 		 Renders the occluders of the world.
 
+		 @pre			The model hierarchy of the given world is up-to-date.
 		 @param[in]		world
 						A reference to the world.
 		 @param[in]		world_to_camera
 						The world-to-camera transformation matrix.
 		 @param[in]		camera_to_projection
 						The camera-to-projection transformation matrix.
+		 @param[in]		mobility
+						The mobility of the occluders to render.
 		 @throws		Exception
 						Failed to render the world.
 		 */
 		void XM_CALLCONV RenderOccluders(const World& world,
+										 FXMMATRIX world_to_camera,
+										 CXMMATRIX camera_to_projection,
+										 ModelMobility mobility = ModelMobility::Any);
+
+		/**
+		 Renders the given occluders (i.e. without culling).
+
+		 @pre			The given models occlude light.
+		 @param[in]		occluders
+						The occluders (e.g., culled once for multiple views).
+		 @param[in]		world_to_camera
+						The world-to-camera transformation matrix.
+		 @param[in]		camera_to_projection
+						The camera-to-projection transformation matrix.
+		 @throws		Exception
+						Failed to render the occluders.
+		 */
+		void XM_CALLCONV RenderOccluders(gsl::span< const Model* const > occluders,
 										 FXMMATRIX world_to_camera,
 										 CXMMATRIX camera_to_projection);
 
+		/**
+		 Clears the depth of the bound viewport of the bound DSV (i.e. a
+		 depth clear restricted to a sub-rectangle of the DSV).
+
+		 The fixed state of this depth pass needs to be rebound afterwards.
+		 */
+		void ClearDepth() const noexcept;
+
+		/**
+		 Copies the depth of the given SRV to the bound viewport of the bound
+		 DSV (i.e. a depth copy restricted to a sub-rectangle of the DSV).
+
+		 The fixed state of this depth pass needs to be rebound afterwards.
+
+		 @pre			The given SRV has the same resolution as the bound
+						DSV and is not bound as DSV.
+		 @param[in]		srv
+						A reference to the SRV.
+		 */
+		void CopyDepth(ID3D11ShaderResourceView& srv) const noexcept;
+
 	private:
 
 		//---------------------------------------------------------------------
@@ -165,24 +218,20 @@ namespace mage::rendering {
 		/**
 		 Renders the given opaque model.
 
+		 @pre			The given model is not culled.
 		 @param[in]		model
 						A reference to the opaque model.
-		 @param[in]		world_to_projection
-						The world-to-projection transformation matrix.
 		 */
-		void XM_CALLCONV RenderOpaque(const Model& model,
-									  FXMMATRIX world_to_projection) const noexcept;
+		void RenderOpaque(const Model& model) const noexcept;
 
 		/**
 		 Renders the given transparent model.
 
+		 @pre			The given model is not culled.
 		 @param[in]		model
 						A reference to the transparent model.
-		 @param[in]		world_to_projection
-						The world-to-projection transformation matrix.
 		 */
-		void XM_CALLCONV RenderTransparent(const Model& model,
-										   FXMMATRIX world_to_projection) const noexcept;
+		void RenderTransparent(const Model& model) const noexcept;
 
 		//---------------------------------------------------------------------
 		// Member Variables
@@ -203,18 +252,41 @@ namespace mage::rendering {
 		 */
 		VertexShaderPtr m_opaque_vs;
 
+		/**
+		 A pointer to the vertex shader for models with compact vertices of
+		 this depth pass.
+		 */
+		VertexShaderPtr m_opaque_compact_vs;
+
 		/**
 		 A pointer to the vertex shader for transparent models
 		 of this depth pass.
 		 */
 		VertexShaderPtr m_transparent_vs;
 
+		/**
+		 A pointer to the vertex shader for transparent models with compact
+		 vertices of this depth pass.
+		 */
+		VertexShaderPtr m_transparent_compact_vs;
+
 		/**
 		 A pointer to the pixel shader for transparent models
 		 of this depth pass.
 		 */
 		PixelShaderPtr m_transparent_ps;
 
+		/**
+		 A pointer to the fullscreen triangle vertex shader for clearing and
+		 copying depth of this depth pass.
+		 */
+		VertexShaderPtr m_fullscreen_vs;
+
+		/**
+		 A pointer to the pixel shader for copying depth of this depth pass.
+		 */
+		PixelShaderPtr m_copy_ps;
+
 		/**
 		 The camera buffer of this depth pass.
 		 */
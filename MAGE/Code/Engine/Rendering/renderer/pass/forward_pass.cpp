@@ -12,6 +12,15 @@
 
 #pragma endregion
 
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+
+#pragma endregion
+
 //-----------------------------------------------------------------------------
 // Engine Definitions
 //-----------------------------------------------------------------------------
@@ -24,9 +33,19 @@ namespace mage::rendering {
 		: m_device_context(device_context),
 		m_state_manager(state_manager),
 		m_resource_manager(resource_manager),
-		m_vs(CreateTransformVS(resource_manager)),
+		m_vs(CreateTransformVS(resource_manager, false)),
+		m_instanced_vs(CreateTransformInstancedVS(resource_manager, false)),
+		m_compact_vs(CreateTransformVS(resource_manager, true)),
+		m_instanced_compact_vs(CreateTransformInstancedVS(resource_manager, true)),
+		m_solid_ps(CreateForwardSolidPS(resource_manager)),
+		m_forward_emissive_ps(),
+		m_forward_ps(),
+		m_gbuffer_ps(),
+		m_false_color_ps(),
 		m_uv(CreateReferenceTexture(resource_manager)),
-		m_color_buffer(device) {}
+		m_color_buffer(device),
+		m_instance_buffer(device),
+		m_instances(device, 64u) {}
 
 	ForwardPass::ForwardPass(ForwardPass&& pass) noexcept = default;
 
@@ -116,9 +135,51 @@ namespace mage::rendering {
 		m_color_buffer.Bind< Pipeline::PS >(m_device_context, SLOT_CBUFFER_COLOR);
 	}
 
-	void XM_CALLCONV ForwardPass::Render(const World& world,
-										 FXMMATRIX world_to_projection,
-										 BRDF brdf, bool vct) const {
+	const PixelShaderPtr& ForwardPass::GetForwardEmissivePS(bool transparency) const {
+		return m_forward_emissive_ps.Get(
+			GetForwardEmissivePermutation(transparency),
+			[this, transparency]() {
+				return CreateForwardEmissivePS(m_resource_manager, transparency);
+			});
+	}
+
+	const PixelShaderPtr& ForwardPass::GetForwardPS(BRDF brdf,
+													bool transparency,
+													bool vct,
+													bool tsnm) const {
+		return m_forward_ps.Get(
+			GetForwardPermutation(brdf, transparency, vct, tsnm),
+			[this, brdf, transparency, vct, tsnm]() {
+				return CreateForwardPS(m_resource_manager,
+									   brdf, transparency, vct, tsnm);
+			});
+	}
+
+	const PixelShaderPtr& ForwardPass::GetGBufferPS(bool tsnm) const {
+		return m_gbuffer_ps.Get(
+			GetGBufferPermutation(tsnm),
+			[this, tsnm]() {
+				return CreateGBufferPS(m_resource_manager, tsnm);
+			});
+	}
+
+	const PixelShaderPtr& ForwardPass::GetFalseColorPS(FalseColor false_color) const {
+		return m_false_color_ps.Get(
+			GetFalseColorPermutation(false_color),
+			[this, false_color]() {
+				return CreateFalseColorPS(m_resource_manager, false_color);
+			});
+	}
+
+	void ForwardPass::UpdateInstances(const RenderQueue& queue) {
+		// Update the instances.
+		m_instances.UpdateData(m_device_context, queue.GetInstances());
+		// Bind the instances.
+		m_instances.Bind< Pipeline::VS >(m_device_context, SLOT_SRV_INSTANCES);
+	}
+
+	void ForwardPass::Render(const RenderQueue& queue,
+							 BRDF brdf, bool vct) const {
 		// Bind the fixed opaque state.
 		BindFixedOpaqueState();
 
@@ -128,81 +189,42 @@ namespace mage::rendering {
 		// All emissive models.
 		//---------------------------------------------------------------------
 		{
-			const PixelShaderPtr ps = CreateForwardEmissivePS(m_resource_manager,
-															  transparency);
+			const auto& ps = GetForwardEmissivePS(transparency);
 			// PS: Bind the pixel shader.
 			ps->BindShader(m_device_context);
 		}
 
 		// Process the models.
-		world.ForEach< Model >([this, world_to_projection](const Model& model) {
-
-			const auto& material = model.GetMaterial();
-
-			if (State::Active != model.GetState()
-				|| !material.IsEmissive()
-				|| material.GetBaseColor()[3] < TRANSPARENCY_THRESHOLD) {
-				return;
-			}
-
-			Render(model, world_to_projection);
-		});
+		Render(queue, RenderBucket::OpaqueEmissive);
 
 		//---------------------------------------------------------------------
 		// All models with no TSNM.
 		//---------------------------------------------------------------------
 		{
 			constexpr bool tsnm = false;
-			const PixelShaderPtr ps = CreateForwardPS(m_resource_manager,
-													  brdf, transparency, vct, tsnm);
+			const auto& ps = GetForwardPS(brdf, transparency, vct, tsnm);
 			// PS: Bind the pixel shader.
 			ps->BindShader(m_device_context);
 		}
 
 		// Process the models.
-		world.ForEach< Model >([this, world_to_projection](const Model& model) {
-
-			const auto& material = model.GetMaterial();
-
-			if (State::Active != model.GetState()
-				|| material.IsEmissive()
-				|| nullptr != material.GetNormalSRV()
-				|| material.GetBaseColor()[3] < TRANSPARENCY_THRESHOLD) {
-				return;
-			}
-
-			Render(model, world_to_projection);
-		});
+		Render(queue, RenderBucket::Opaque);
 
 		//---------------------------------------------------------------------
 		// All models with TSNM.
 		//---------------------------------------------------------------------
 		{
 			constexpr bool tsnm = true;
-			const PixelShaderPtr ps = CreateForwardPS(m_resource_manager,
-													  brdf, transparency, vct, tsnm);
+			const auto& ps = GetForwardPS(brdf, transparency, vct, tsnm);
 			// PS: Bind the pixel shader.
 			ps->BindShader(m_device_context);
 		}
 
 		// Process the models.
-		world.ForEach< Model >([this, world_to_projection](const Model& model) {
-
-			const auto& material = model.GetMaterial();
-
-			if (State::Active != model.GetState()
-				|| material.IsEmissive()
-				|| nullptr == material.GetNormalSRV()
-				|| material.GetBaseColor()[3] < TRANSPARENCY_THRESHOLD) {
-				return;
-			}
-
-			Render(model, world_to_projection);
-		});
+		Render(queue, RenderBucket::OpaqueTSNM);
 	}
 
-	void XM_CALLCONV ForwardPass::RenderSolid(const World& world,
-											  FXMMATRIX world_to_projection) const {
+	void ForwardPass::RenderSolid(const RenderQueue& queue) const {
 		// Bind the fixed opaque state.
 		BindFixedOpaqueState();
 
@@ -210,23 +232,17 @@ namespace mage::rendering {
 		// All models.
 		//---------------------------------------------------------------------
 		{
-			const PixelShaderPtr ps = CreateForwardSolidPS(m_resource_manager);
 			// PS: Bind the pixel shader.
-			ps->BindShader(m_device_context);
+			m_solid_ps->BindShader(m_device_context);
 		}
 
 		// Process the models.
-		world.ForEach< Model >([this, world_to_projection](const Model& model) {
-			if (State::Active != model.GetState()) {
-				return;
-			}
-
-			Render(model, world_to_projection);
-		});
+		for (const auto model : queue.GetCulledModels()) {
+			Render(*model);
+		}
 	}
 
-	void XM_CALLCONV ForwardPass::RenderGBuffer(const World& world,
-												FXMMATRIX world_to_projection) const {
+	void ForwardPass::RenderGBuffer(const RenderQueue& queue) const {
 		// Bind the fixed opaque state.
 		BindFixedOpaqueState();
 
@@ -235,54 +251,29 @@ namespace mage::rendering {
 		//---------------------------------------------------------------------
 		{
 			constexpr bool tsnm = false;
-			const PixelShaderPtr ps = CreateGBufferPS(m_resource_manager, tsnm);
+			const auto& ps = GetGBufferPS(tsnm);
 			// PS: Bind the pixel shader.
 			ps->BindShader(m_device_context);
 		}
 
 		// Process the models.
-		world.ForEach< Model >([this, world_to_projection](const Model& model) {
-
-			const auto& material = model.GetMaterial();
-
-			if (State::Active != model.GetState()
-				|| material.IsEmissive()
-				|| nullptr != material.GetNormalSRV()
-				|| material.GetBaseColor()[3] < TRANSPARENCY_THRESHOLD) {
-				return;
-			}
-
-			Render(model, world_to_projection);
-		});
+		Render(queue, RenderBucket::Opaque);
 
 		//---------------------------------------------------------------------
 		// All models with TSNM.
 		//---------------------------------------------------------------------
 		{
 			constexpr bool tsnm = true;
-			const PixelShaderPtr ps = CreateGBufferPS(m_resource_manager, tsnm);
+			const auto& ps = GetGBufferPS(tsnm);
 			// PS: Bind the pixel shader.
 			ps->BindShader(m_device_context);
 		}
 
 		// Process the models.
-		world.ForEach< Model >([this, world_to_projection](const Model& model) {
-
-			const auto& material = model.GetMaterial();
-
-			if (State::Active != model.GetState()
-				|| material.IsEmissive()
-				|| nullptr == material.GetNormalSRV()
-				|| material.GetBaseColor()[3] < TRANSPARENCY_THRESHOLD) {
-				return;
-			}
-
-			Render(model, world_to_projection);
-		});
+		Render(queue, RenderBucket::OpaqueTSNM);
 	}
 
-	void XM_CALLCONV ForwardPass::RenderEmissive(const World& world,
-												 FXMMATRIX world_to_projection) const {
+	void ForwardPass::RenderEmissive(const RenderQueue& queue) const {
 		constexpr bool transparency = false;
 
 		// Bind the fixed opaque state.
@@ -292,119 +283,40 @@ namespace mage::rendering {
 		// All emissive models.
 		//---------------------------------------------------------------------
 		{
-			const PixelShaderPtr ps = CreateForwardEmissivePS(m_resource_manager,
-															  transparency);
+			const auto& ps = GetForwardEmissivePS(transparency);
 			// PS: Bind the pixel shader.
 			ps->BindShader(m_device_context);
 		}
 
 		// Process the models.
-		world.ForEach< Model >([this, world_to_projection](const Model& model) {
-
-			const auto& material = model.GetMaterial();
-
-			if (State::Active != model.GetState()
-				|| !material.IsEmissive()
-				|| material.GetBaseColor()[3] < TRANSPARENCY_THRESHOLD) {
-				return;
-			}
-
-			Render(model, world_to_projection);
-		});
+		Render(queue, RenderBucket::OpaqueEmissive);
 	}
 
-	void XM_CALLCONV ForwardPass::RenderTransparent(const World& world,
-													FXMMATRIX world_to_projection,
-													BRDF brdf,
-													bool vct) const {
+	void ForwardPass::RenderTransparent(const RenderQueue& queue,
+										BRDF brdf, bool vct) const {
 		// Bind the fixed transparent state.
 		BindFixedTransparentState();
 
 		constexpr bool transparency = true;
 
 		//---------------------------------------------------------------------
-		// All transparent emissive models.
-		//---------------------------------------------------------------------
-		{
-			const PixelShaderPtr ps = CreateForwardEmissivePS(m_resource_manager,
-															  transparency);
-			// PS: Bind the pixel shader.
-			ps->BindShader(m_device_context);
-		}
-
-		// Process the models.
-		world.ForEach< Model >([this, world_to_projection](const Model& model) {
-
-			const auto& material = model.GetMaterial();
-
-			if (State::Active != model.GetState()
-				|| !material.IsEmissive()
-				|| !material.IsTransparant()
-				|| material.GetBaseColor()[3] < TRANSPARENCY_SHADOW_THRESHOLD) {
-				return;
-			}
-
-			Render(model, world_to_projection);
-		});
-
-		//---------------------------------------------------------------------
-		// All transparent models with no TSNM.
+		// All transparent models (back-to-front).
 		//---------------------------------------------------------------------
-		{
-			constexpr bool tsnm = false;
-			const PixelShaderPtr ps = CreateForwardPS(m_resource_manager,
-													  brdf, transparency, vct, tsnm);
-			// PS: Bind the pixel shader.
-			ps->BindShader(m_device_context);
-		}
-
-		// Process the models.
-		world.ForEach< Model >([this, world_to_projection](const Model& model) {
-
-			const auto& material = model.GetMaterial();
-
-			if (State::Active != model.GetState()
-				|| material.IsEmissive()
-				|| nullptr != material.GetNormalSRV()
-				|| !material.IsTransparant()
-				|| material.GetBaseColor()[3] < TRANSPARENCY_SHADOW_THRESHOLD) {
-				return;
-			}
-
-			Render(model, world_to_projection);
-		});
-
-		//---------------------------------------------------------------------
-		// All transparent models with TSNM.
-		//---------------------------------------------------------------------
-		{
-			constexpr bool tsnm = true;
-			const PixelShaderPtr ps = CreateForwardPS(m_resource_manager,
-													  brdf, transparency, vct, tsnm);
-			// PS: Bind the pixel shader.
-			ps->BindShader(m_device_context);
-		}
+		static_assert(0u == static_cast< U8 >(RenderPermutation::Emissive));
+		static_assert(1u == static_cast< U8 >(RenderPermutation::Default));
+		static_assert(2u == static_cast< U8 >(RenderPermutation::TSNM));
+		const PixelShaderPtr pixel_shaders[] = {
+			GetForwardEmissivePS(transparency),
+			GetForwardPS(brdf, transparency, vct, false), // No TSNM
+			GetForwardPS(brdf, transparency, vct, true)   // TSNM
+		};
 
 		// Process the models.
-		world.ForEach< Model >([this, world_to_projection](const Model& model) {
-
-			const auto& material = model.GetMaterial();
-
-			if (State::Active != model.GetState()
-				|| material.IsEmissive()
-				|| nullptr == material.GetNormalSRV()
-				|| !material.IsTransparant()
-				|| material.GetBaseColor()[3] < TRANSPARENCY_SHADOW_THRESHOLD) {
-				return;
-			}
-
-			Render(model, world_to_projection);
-		});
+		Render(queue, RenderBucket::Transparent, pixel_shaders);
 	}
 
-	void XM_CALLCONV ForwardPass::RenderFalseColor(const World& world,
-												   FXMMATRIX world_to_projection,
-												   FalseColor false_color) const {
+	void ForwardPass::RenderFalseColor(const RenderQueue& queue,
+									   FalseColor false_color) const {
 		// Bind the fixed opaque state.
 		BindFixedOpaqueState();
 
@@ -416,24 +328,18 @@ namespace mage::rendering {
 		// All models.
 		//---------------------------------------------------------------------
 		{
-			const PixelShaderPtr ps = CreateFalseColorPS(m_resource_manager,
-														 false_color);
+			const auto& ps = GetFalseColorPS(false_color);
 			// PS: Bind the pixel shader.
 			ps->BindShader(m_device_context);
 		}
 
 		// Process the models.
-		world.ForEach< Model >([this, world_to_projection](const Model& model) {
-			if (State::Active != model.GetState()) {
-				return;
-			}
-
-			Render(model, world_to_projection);
-		});
+		for (const auto model : queue.GetCulledModels()) {
+			Render(*model);
+		}
 	}
 
-	void XM_CALLCONV ForwardPass::RenderWireframe(const World& world,
-												  FXMMATRIX world_to_projection) {
+	void ForwardPass::RenderWireframe(const RenderQueue& queue) {
 		// Bind the fixed opaque state.
 		BindFixedWireframeState();
 
@@ -445,36 +351,121 @@ namespace mage::rendering {
 		// All models.
 		//---------------------------------------------------------------------
 		{
-			const PixelShaderPtr ps = CreateFalseColorPS(m_resource_manager,
-														 FalseColor::ConstantColor);
+			const auto& ps = GetFalseColorPS(FalseColor::ConstantColor);
 			// PS: Bind the pixel shader.
 			ps->BindShader(m_device_context);
 		}
 
 		// Process the models.
-		world.ForEach< Model >([this, world_to_projection](const Model& model) {
-			if (State::Active != model.GetState()) {
-				return;
+		for (const auto model : queue.GetCulledModels()) {
+			Render(*model);
+		}
+	}
+
+	void ForwardPass::Render(const RenderQueue& queue,
+							 RenderBucket bucket,
+							 const PixelShaderPtr* pixel_shaders) const {
+
+		static_assert(SLOT_SRV_MATERIAL == SLOT_SRV_BASE_COLOR + 1);
+		static_assert(SLOT_SRV_NORMAL   == SLOT_SRV_BASE_COLOR + 2);
+
+		// The draw items are sorted on material and mesh: skip redundant
+		// SRV and mesh bindings between consecutive instance batches.
+		ID3D11ShaderResourceView* bound_srvs[] = { nullptr, nullptr, nullptr };
+		const Mesh* bound_mesh = nullptr;
+		auto bound_index_format = DXGI_FORMAT_UNKNOWN;
+		auto bound_permutation = RenderPermutation::Count;
+		bool bound_instanced = false;
+		bool bound_compact = false;
+		bool first = true;
+
+		for (const auto& batch : queue.GetInstanceBatches(bucket)) {
+			const auto& item     = queue.GetDrawItem(batch.m_first);
+			const auto& model    = queue.GetModel(item);
+			const auto& material = model.GetMaterial();
+			const auto  instanced = (1u < batch.m_count);
+			const auto  compact   = model.GetMesh()->HasCompactVertices();
+
+			// Bind the pixel shader of the instance batch.
+			if (pixel_shaders) {
+				const auto permutation = RenderQueue::GetPermutation(item.m_key);
+				if (bound_permutation != permutation) {
+					pixel_shaders[static_cast< std::size_t >(permutation)]
+						->BindShader(m_device_context);
+					bound_permutation = permutation;
+				}
 			}
 
-			Render(model, world_to_projection);
-		});
-	}
+			// Bind the vertex shader of the instance batch.
+			if (first || bound_instanced != instanced
+				      || bound_compact   != compact) {
+				const auto& vs = compact ? (instanced ? m_instanced_compact_vs : m_compact_vs)
+					                     : (instanced ? m_instanced_vs : m_vs);
+				vs->BindShader(m_device_context);
+				bound_instanced = instanced;
+				bound_compact   = compact;
+			}
+
+			// Bind the constant buffer of the model. The material data is
+			// shared by all instances of the instance batch.
+			if (instanced) {
+				InstanceBuffer buffer;
+				buffer.m_instance_start = batch.m_instance_start;
+				m_instance_buffer.UpdateData(m_device_context, buffer);
+				m_instance_buffer.Bind< Pipeline::VS >(m_device_context,
+													   SLOT_CBUFFER_INSTANCE);
+			}
+			else {
+				model.BindBuffer< Pipeline::VS >(m_device_context, SLOT_CBUFFER_MODEL);
+			}
+			model.BindBuffer< Pipeline::PS >(m_device_context, SLOT_CBUFFER_MODEL);
+
+			// Bind the SRVs of the model.
+			ID3D11ShaderResourceView* const srvs[] = {
+				material.GetBaseColorSRV(),
+				material.GetMaterialSRV(),
+				material.GetNormalSRV()
+			};
+			if (first || !std::equal(std::cbegin(srvs), std::cend(srvs),
+									 std::cbegin(bound_srvs))) {
+
+				Pipeline::PS::BindSRVs(m_device_context, SLOT_SRV_BASE_COLOR,
+									   static_cast< U32 >(std::size(srvs)), srvs);
+				std::copy(std::cbegin(srvs), std::cend(srvs),
+						  std::begin(bound_srvs));
+			}
 
-	void XM_CALLCONV ForwardPass::Render(const Model& model,
-										 FXMMATRIX world_to_projection) const noexcept {
+			// Bind the mesh (i.e. the index range) of the model.
+			if (first || bound_mesh != model.GetMesh()
+				      || bound_index_format != model.GetIndexFormat()) {
+				model.BindMesh(m_device_context);
+				bound_mesh         = model.GetMesh();
+				bound_index_format = model.GetIndexFormat();
+			}
 
-		const auto& transform            = model.GetOwner()->GetTransform();
-		const auto  object_to_world      = transform.GetObjectToWorldMatrix();
-		const auto  object_to_projection = object_to_world * world_to_projection;
+			// Draw the model (instances).
+			if (instanced) {
+				model.DrawInstanced(m_device_context, batch.m_count);
+			}
+			else {
+				model.Draw(m_device_context);
+			}
 
-		// Apply view frustum culling.
-		if (BoundingFrustum::Cull(object_to_projection, model.GetAABB())) {
-			return;
+			first = false;
 		}
 
-		const auto& material             = model.GetMaterial();
+		// Restore the vertex shader.
+		if (bound_instanced || bound_compact) {
+			m_vs->BindShader(m_device_context);
+		}
+	}
+
+	void ForwardPass::Render(const Model& model) const noexcept {
+		const auto& material = model.GetMaterial();
 
+		// Bind the vertex shader matching the vertices of the model.
+		const auto& vs = model.GetMesh()->HasCompactVertices() ? m_compact_vs : m_vs;
+		vs->BindShader(m_device_context);
 		// Bind the constant buffer of the model.
 		model.BindBuffer< Pipeline::VS >(m_device_context, SLOT_CBUFFER_MODEL);
 		model.BindBuffer< Pipeline::PS >(m_device_context, SLOT_CBUFFER_MODEL);
@@ -5,9 +5,13 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
+#include "renderer\buffer\constant_buffer.hpp"
+#include "renderer\buffer\structured_buffer.hpp"
 #include "renderer\configuration.hpp"
+#include "renderer\render_queue.hpp"
 #include "renderer\state_manager.hpp"
 #include "resource\rendering_resource_manager.hpp"
+#include "resource\shader\shader_permutation.hpp"
 #include "scene\rendering_world.hpp"
 
 #pragma endregion
@@ -97,110 +101,101 @@ namespace mage::rendering {
 		//---------------------------------------------------------------------
 
 		/**
-		 Renders the given world.
+		 Updates the instances of this forward pass with the instances of
+		 the given render queue.
 
-		 @param[in]		world
-						A reference to the world.
-		 @param[in]		world_to_projection
-						The world-to-projection transformation matrix.
+		 @param[in]		queue
+						A reference to the render queue.
+		 @throws		Exception
+						Failed to update the instances.
+		 */
+		void UpdateInstances(const RenderQueue& queue);
+
+		/**
+		 Renders the opaque models of the given render queue.
+
+		 @param[in]		queue
+						A reference to the render queue.
 		 @param[in]		brdf
 						The BRDF.
 		 @param[in]		vct
 						@c true if voxel cone tracing should be enabled. @c false
 						otherwise.
 		 @throws		Exception
-						Failed to render the world.
+						Failed to render the render queue.
 		 */
-		void XM_CALLCONV Render(const World& world,
-								FXMMATRIX world_to_projection,
-								BRDF brdf, bool vct) const;
+		void Render(const RenderQueue& queue, BRDF brdf, bool vct) const;
 
 		/**
-		 Renders the given world as solid.
+		 Renders all visible models of the given render queue as solid.
 
-		 @param[in]		world
-						A reference to the world.
-		 @param[in]		world_to_projection
-						The world-to-projection transformation matrix.
+		 @param[in]		queue
+						A reference to the render queue.
 		 @throws		Exception
-						Failed to render the world.
+						Failed to render the render queue.
 		 */
-		void XM_CALLCONV RenderSolid(const World& world,
-									 FXMMATRIX world_to_projection) const;
+		void RenderSolid(const RenderQueue& queue) const;
 
 		/**
-		 Renders the given world to a GBuffer.
+		 Renders the opaque non-emissive models of the given render queue to
+		 a GBuffer.
 
-		 @param[in]		world
-						A reference to the world.
-		 @param[in]		world_to_projection
-						The world-to-projection transformation matrix.
+		 @param[in]		queue
+						A reference to the render queue.
 		 @throws		Exception
-						Failed to render the world.
+						Failed to render the render queue.
 		 */
-		void XM_CALLCONV RenderGBuffer(const World& world,
-									   FXMMATRIX world_to_projection) const;
+		void RenderGBuffer(const RenderQueue& queue) const;
 
 		/**
-		 Renders the emissive models of the given world.
+		 Renders the opaque emissive models of the given render queue.
 
-		 @param[in]		world
-						A reference to the world.
-		 @param[in]		world_to_projection
-						The world-to-projection transformation matrix.
+		 @param[in]		queue
+						A reference to the render queue.
 		 @throws		Exception
-						Failed to render the world.
+						Failed to render the render queue.
 		 */
-		void XM_CALLCONV RenderEmissive(const World& world,
-										FXMMATRIX world_to_projection) const;
+		void RenderEmissive(const RenderQueue& queue) const;
 
 		/**
-		 Renders the transparent models of the given world.
+		 Renders the transparent models of the given render queue
+		 back-to-front.
 
-		 @param[in]		world
-						A reference to the world.
-		 @param[in]		world_to_projection
-						The world-to-projection transformation matrix.
+		 @param[in]		queue
+						A reference to the render queue.
 		 @param[in]		brdf
 						The BRDF.
 		 @param[in]		vct
 						@c true if voxel cone tracing should be enabled. @c false
 						otherwise.
 		 @throws		Exception
-						Failed to render the world.
+						Failed to render the render queue.
 		 */
-		void XM_CALLCONV RenderTransparent(const World& world,
-										   FXMMATRIX world_to_projection,
-										   BRDF brdf, bool vct) const;
+		void RenderTransparent(const RenderQueue& queue,
+							   BRDF brdf, bool vct) const;
 
 		/**
-		 Renders the given world as a false color.
+		 Renders all visible models of the given render queue as a false color.
 
-		 @param[in]		world
-						A reference to the world.
-		 @param[in]		world_to_projection
-						The world-to-projection transformation matrix.
+		 @param[in]		queue
+						A reference to the render queue.
 		 @param[in]		false_color
 						The false color.
 		 @throws		Exception
-						Failed to render the world.
+						Failed to render the render queue.
 		 */
-		void XM_CALLCONV RenderFalseColor(const World& world,
-										  FXMMATRIX world_to_projection,
-										  FalseColor false_color) const;
+		void RenderFalseColor(const RenderQueue& queue,
+							  FalseColor false_color) const;
 
 		/**
-		 Renders the given world as a wireframe.
+		 Renders all visible models of the given render queue as a wireframe.
 
-		 @param[in]		world
-						A reference to the world.
-		 @param[in]		world_to_projection
-						The world-to-projection transformation matrix.
+		 @param[in]		queue
+						A reference to the render queue.
 		 @throws		Exception
-						Failed to render the world.
+						Failed to render the render queue.
 		 */
-		void XM_CALLCONV RenderWireframe(const World& world,
-										 FXMMATRIX world_to_projection);
+		void RenderWireframe(const RenderQueue& queue);
 
 	private:
 
@@ -233,16 +228,95 @@ namespace mage::rendering {
 		 */
 		void BindColor(const RGBA& color);
 
+		/**
+		 Returns the forward emissive pixel shader.
+
+		 @param[in]		transparency
+						@c true if transparency should be enabled. @c false
+						otherwise.
+		 @return		A reference to the pointer to the forward emissive
+						pixel shader.
+		 @throws		Exception
+						Failed to create the pixel shader.
+		 */
+		const PixelShaderPtr& GetForwardEmissivePS(bool transparency) const;
+
+		/**
+		 Returns the forward pixel shader matching the given BRDF.
+
+		 @param[in]		brdf
+						The BRDF.
+		 @param[in]		transparency
+						@c true if transparency should be enabled. @c false
+						otherwise.
+		 @param[in]		vct
+						@c true if voxel cone tracing should be enabled.
+						@c false otherwise.
+		 @param[in]		tsnm
+						@c true if tangent space normal mapping should be
+						enabled. @c false otherwise.
+		 @return		A reference to the pointer to the forward pixel
+						shader matching the given BRDF.
+		 @throws		Exception
+						Failed to create the pixel shader.
+		 */
+		const PixelShaderPtr& GetForwardPS(BRDF brdf,
+										   bool transparency,
+										   bool vct,
+										   bool tsnm) const;
+
+		/**
+		 Returns the GBuffer pixel shader.
+
+		 @param[in]		tsnm
+						@c true if tangent space normal mapping should be
+						enabled. @c false otherwise.
+		 @return		A reference to the pointer to the GBuffer pixel
+						shader.
+		 @throws		Exception
+						Failed to create the pixel shader.
+		 */
+		const PixelShaderPtr& GetGBufferPS(bool tsnm) const;
+
+		/**
+		 Returns the false color pixel shader.
+
+		 @param[in]		false_color
+						The false color.
+		 @return		A reference to the pointer to the false color pixel
+						shader.
+		 @throws		Exception
+						Failed to create the pixel shader.
+		 */
+		const PixelShaderPtr& GetFalseColorPS(FalseColor false_color) const;
+
+		/**
+		 Renders the draw items of the given render bucket of the given
+		 render queue. Each instance batch containing more than one draw
+		 item is drawn with a single instanced draw call.
+
+		 @param[in]		queue
+						A reference to the render queue.
+		 @param[in]		bucket
+						The render bucket.
+		 @param[in]		pixel_shaders
+						A pointer to the pixel shaders indexed by pixel
+						shader permutation. If @c nullptr, the pixel shader
+						is assumed to be bound already.
+		 @throws		Exception
+						Failed to render the render queue.
+		 */
+		void Render(const RenderQueue& queue,
+					RenderBucket bucket,
+					const PixelShaderPtr* pixel_shaders = nullptr) const;
+
 		/**
 		 Renders the given model.
 
 		 @param[in]		model
 						A reference to the model.
-		 @param[in]		world_to_projection
-						The world-to-projection transformation matrix.
 		 */
-		void XM_CALLCONV Render(const Model& model,
-								FXMMATRIX world_to_projection) const noexcept;
+		void Render(const Model& model) const noexcept;
 
 		//---------------------------------------------------------------------
 		// Member Variables
@@ -268,6 +342,48 @@ namespace mage::rendering {
 		 */
 		VertexShaderPtr m_vs;
 
+		/**
+		 A pointer to the instanced vertex shader of this forward pass.
+		 */
+		VertexShaderPtr m_instanced_vs;
+
+		/**
+		 A pointer to the vertex shader for models with compact vertices of
+		 this forward pass.
+		 */
+		VertexShaderPtr m_compact_vs;
+
+		/**
+		 A pointer to the instanced vertex shader for models with compact
+		 vertices of this forward pass.
+		 */
+		VertexShaderPtr m_instanced_compact_vs;
+
+		/**
+		 A pointer to the solid pixel shader of this forward pass.
+		 */
+		PixelShaderPtr m_solid_ps;
+
+		/**
+		 The forward emissive pixel shaders of this forward pass.
+		 */
+		mutable ForwardEmissivePSCache m_forward_emissive_ps;
+
+		/**
+		 The forward pixel shaders of this forward pass.
+		 */
+		mutable ForwardPSCache m_forward_ps;
+
+		/**
+		 The GBuffer pixel shaders of this forward pass.
+		 */
+		mutable GBufferPSCache m_gbuffer_ps;
+
+		/**
+		 The false color pixel shaders of this forward pass.
+		 */
+		mutable FalseColorPSCache m_false_color_ps;
+
 		/**
 		 A pointer to the UV reference texture of this forward pass.
 		 */
@@ -277,5 +393,17 @@ namespace mage::rendering {
 		 The color buffer of this forward pass.
 		 */
 		ConstantBuffer< RGBA > m_color_buffer;
+
+		/**
+		 The instance buffer of this forward pass (i.e. the start of the
+		 instances of the current instanced draw call).
+		 */
+		mutable ConstantBuffer< InstanceBuffer > m_instance_buffer;
+
+		/**
+		 The structured buffer containing the instances of this forward
+		 pass.
+		 */
+		StructuredBuffer< ModelBuffer > m_instances;
 	};
 }
\ No newline at end of file
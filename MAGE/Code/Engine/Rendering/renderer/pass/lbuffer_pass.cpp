@@ -10,33 +10,330 @@
 
 #pragma endregion
 
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+#pragma endregion
+
 //-----------------------------------------------------------------------------
 // Engine Definitions
 //-----------------------------------------------------------------------------
 namespace mage::rendering {
 
+	namespace {
+
+		/**
+		 A struct of light entries (i.e. the processing results of a light).
+
+		 @tparam		BufferT
+						The light buffer type.
+		 @tparam		SMBufferT
+						The shadow mapped light buffer type.
+		 */
+		template< typename BufferT, typename SMBufferT >
+		struct alignas(16) LightEntry {
+
+			/**
+			 The world-to-light matrix of this light entry (if shadow
+			 mapped).
+			 */
+			XMMATRIX m_world_to_light;
+
+			/**
+			 The light-to-projection matrix of this light entry (if shadow
+			 mapped).
+			 */
+			XMMATRIX m_light_to_projection;
+
+			/**
+			 The light buffer of this light entry (if not shadow mapped).
+			 */
+			BufferT m_buffer;
+
+			/**
+			 The shadow mapped light buffer of this light entry (if shadow
+			 mapped).
+			 */
+			SMBufferT m_sm_buffer;
+
+			/**
+			 The bounding sphere of the light of this light entry expressed
+			 in world space (if not shadow mapped and clustered).
+			 */
+			BoundingSphere m_sphere;
+
+			/**
+			 The shadow atlas request of the light of this light entry (if
+			 shadow mapped and not an omni light).
+			 */
+			ShadowAtlasAllocator::Request m_request;
+
+			/**
+			 A flag indicating whether the light of this light entry is
+			 visible.
+			 */
+			bool m_visible;
+
+			/**
+			 A flag indicating whether the light of this light entry is
+			 shadow mapped.
+			 */
+			bool m_shadows;
+		};
+
+		/**
+		 Computes the fraction of the screen covered by the projection of the
+		 given AABB.
+
+		 @param[in]		object_to_projection
+						The object-to-projection transformation matrix.
+		 @param[in]		aabb
+						A reference to the AABB expressed in object space.
+		 @return		The fraction of the screen covered by the projection
+						of @a aabb (in [0,1]).
+		 */
+		[[nodiscard]]
+		F32 XM_CALLCONV GetScreenCoverage(FXMMATRIX object_to_projection,
+										  const AABB& aabb) noexcept {
+
+			const auto p_min = aabb.MinPoint();
+			const auto p_max = aabb.MaxPoint();
+
+			auto ndc_min = XMVectorReplicate( 1.0f);
+			auto ndc_max = XMVectorReplicate(-1.0f);
+			for (U32 i = 0u; i < 8u; ++i) {
+				const auto control = XMVectorSelectControl(i & 1u,
+														   (i >> 1u) & 1u,
+														   (i >> 2u) & 1u,
+														   0u);
+				const auto p       = XMVectorSetW(
+					                 XMVectorSelect(p_min, p_max, control), 1.0f);
+				const auto p_proj  = XMVector4Transform(p, object_to_projection);
+
+				// The AABB crosses the camera plane.
+				if (XMVectorGetW(p_proj) <= 0.0f) {
+					return 1.0f;
+				}
+
+				const auto p_ndc = XMVectorDivide(p_proj, XMVectorSplatW(p_proj));
+				ndc_min = XMVectorMin(ndc_min, p_ndc);
+				ndc_max = XMVectorMax(ndc_max, p_ndc);
+			}
+
+			const auto lower  = XMVectorReplicate(-1.0f);
+			const auto upper  = XMVectorReplicate( 1.0f);
+			const auto extent = XMVectorClamp(ndc_max, lower, upper)
+				              - XMVectorClamp(ndc_min, lower, upper);
+
+			return 0.25f * XMVectorGetX(extent) * XMVectorGetY(extent);
+		}
+
+		/**
+		 Converts the given shadow atlas tile to its scale and offset
+		 expressed in shadow atlas UV space.
+
+		 @param[in]		tile
+						A reference to the shadow atlas tile.
+		 @param[in]		resolution
+						The resolution of the shadow atlas.
+		 @return		The scale (xy) and offset (zw) of @a tile.
+		 */
+		[[nodiscard]]
+		F32x4 GetTileScaleAndOffset(const ShadowAtlasAllocator::Tile& tile,
+									U32 resolution) noexcept {
+
+			const auto inv_resolution = 1.0f / static_cast< F32 >(resolution);
+			const auto scale = static_cast< F32 >(tile.m_size) * inv_resolution;
+			return {
+				scale,
+				scale,
+				static_cast< F32 >(tile.m_position[0]) * inv_resolution,
+				static_cast< F32 >(tile.m_position[1]) * inv_resolution
+			};
+		}
+
+		/**
+		 Checks whether the given shadow atlas tiles are equal.
+
+		 @param[in]		lhs
+						A reference to the first shadow atlas tile.
+		 @param[in]		rhs
+						A reference to the second shadow atlas tile.
+		 @return		@c true if @a lhs is equal to @a rhs. @c false
+						otherwise.
+		 */
+		[[nodiscard]]
+		bool Equal(const ShadowAtlasAllocator::Tile& lhs,
+				   const ShadowAtlasAllocator::Tile& rhs) noexcept {
+
+			return lhs.m_size        == rhs.m_size
+				&& lhs.m_position[0] == rhs.m_position[0]
+				&& lhs.m_position[1] == rhs.m_position[1];
+		}
+
+		/**
+		 Checks whether the given matrices are equal.
+
+		 @param[in]		lhs
+						The first matrix.
+		 @param[in]		rhs
+						The second matrix.
+		 @return		@c true if @a lhs is equal to @a rhs. @c false
+						otherwise.
+		 */
+		[[nodiscard]]
+		bool XM_CALLCONV Equal(FXMMATRIX lhs, CXMMATRIX rhs) noexcept {
+			return XMVector4Equal(lhs.r[0], rhs.r[0])
+				&& XMVector4Equal(lhs.r[1], rhs.r[1])
+				&& XMVector4Equal(lhs.r[2], rhs.r[2])
+				&& XMVector4Equal(lhs.r[3], rhs.r[3]);
+		}
+
+		/**
+		 The number of faces of a shadow cube map.
+		 */
+		constexpr std::size_t s_nb_cube_faces = 6u;
+
+		/**
+		 Returns the light-to-face rotation matrix of the given cube face.
+
+		 @pre			@a face is smaller than the number of cube faces.
+		 @param[in]		face
+						The cube face index (i.e. +x, -x, +y, -y, +z, -z).
+		 @return		The light-to-face rotation matrix of @a face.
+		 */
+		[[nodiscard]]
+		const XMMATRIX& GetCubeFaceRotation(std::size_t face) noexcept {
+			static const XMMATRIX rotations[s_nb_cube_faces] = {
+				XMMatrixRotationY(-XM_PIDIV2), // Look: +x
+				XMMatrixRotationY(XM_PIDIV2),  // Look: -x
+				XMMatrixRotationX(XM_PIDIV2),  // Look: +y
+				XMMatrixRotationX(-XM_PIDIV2), // Look: -y
+				XMMatrixIdentity(),            // Look: +z
+				XMMatrixRotationY(XM_PI),      // Look: -z
+			};
+
+			return rotations[face];
+		}
+
+		/**
+		 Returns the cube faces overlapped by the given AABB (i.e. the AABB
+		 overlaps the pyramid of a cube face if it contains a point whose
+		 coordinate along the axis of the face is at least as large as the
+		 absolute values of its two other coordinates).
+
+		 @param[in]		aabb
+						A reference to the AABB expressed in light space.
+		 @return		The face mask of @a aabb (i.e. bit i is set if
+						@a aabb overlaps the i-th cube face).
+		 */
+		[[nodiscard]]
+		U8 GetCubeFaceMask(const AABB& aabb) noexcept {
+			const auto p_min = XMStore< F32x3 >(aabb.MinPoint());
+			const auto p_max = XMStore< F32x3 >(aabb.MaxPoint());
+
+			// The minimum absolute value of each coordinate.
+			F32x3 abs_min;
+			for (std::size_t i = 0u; i < 3u; ++i) {
+				abs_min[i] = (p_min[i] <= 0.0f && 0.0f <= p_max[i]) ? 0.0f
+					       : std::min(std::abs(p_min[i]), std::abs(p_max[i]));
+			}
+
+			U8 mask = 0u;
+			for (std::size_t i = 0u; i < 3u; ++i) {
+				const auto bound = std::max(abs_min[(i + 1u) % 3u],
+											abs_min[(i + 2u) % 3u]);
+				if (bound <= p_max[i]) {
+					mask |= static_cast< U8 >(1u << (2u * i));
+				}
+				if (bound <= -p_min[i]) {
+					mask |= static_cast< U8 >(1u << (2u * i + 1u));
+				}
+			}
+
+			return mask;
+		}
+
+		/**
+		 Culls the given light volumes against the view frustum in a single
+		 sweep.
+
+		 @tparam		BoundingVolumeArrayT
+						The bounding volume array type.
+		 @param[in]		world_to_projection
+						The world-to-projection transformation matrix.
+		 @param[in]		volumes
+						A reference to the light volumes expressed in world
+						space.
+		 @param[out]	visibility
+						A reference to the visibility mask (i.e. one bit per
+						light volume which is set if the light volume overlaps
+						the view frustum).
+		 */
+		template< typename BoundingVolumeArrayT >
+		void XM_CALLCONV CullLightVolumes(FXMMATRIX world_to_projection,
+										  const BoundingVolumeArrayT& volumes,
+										  std::vector< U64 >& visibility) {
+
+			const BoundingFrustum frustum(world_to_projection);
+			visibility.resize(GetNumberOfMaskWords(volumes.size()));
+			Cull(gsl::span< const BoundingFrustum >(&frustum, 1),
+				 volumes, gsl::make_span(visibility));
+		}
+	}
+
 	LBufferPass::LBufferPass(ID3D11Device& device,
 							 ID3D11DeviceContext& device_context,
 							 StateManager& state_manager,
-							 ResourceManager& resource_manager)
+							 ResourceManager& resource_manager,
+							 JobSystem& job_system)
 		: m_device_context(device_context),
+		m_job_system(job_system),
 		m_light_buffer(device),
+		m_light_index_list(device, 2u * LightClusterGrid::s_nb_clusters),
 		m_directional_lights(device, 3u),
 		m_omni_lights(device, 32u),
 		m_spot_lights(device, 32u),
 		m_sm_directional_lights(device, 1u),
 		m_sm_omni_lights(device, 1u),
 		m_sm_spot_lights(device, 1u),
-		m_directional_sms(MakeUnique< ShadowMapBuffer >(device, 1u)),
+		m_sm_directional_light_buffers(),
+		m_sm_spot_light_buffers(),
+		m_shadow_atlas(),
 		m_omni_sms(MakeUnique< ShadowCubeMapBuffer >(device, 1u)),
-		m_spot_sms(MakeUnique< ShadowMapBuffer >(device, 1u)),
-		m_directional_light_cameras(),
+		m_static_shadow_atlas(),
+		m_omni_static_sms(MakeUnique< ShadowCubeMapBuffer >(device, 1u)),
+		m_shadow_atlas_allocator(),
+		m_shadow_atlas_requests(),
+		m_shadow_atlas_cameras(),
 		m_omni_light_cameras(),
-		m_spot_light_cameras(),
+		m_sm_omni_light_spheres(),
+		m_omni_light_occluders(),
+		m_static_occluders(),
+		m_dynamic_occluders(),
+		m_shadow_atlas_cache(),
+		m_omni_sm_cache(),
+		m_omni_light_spheres(),
+		m_spot_light_spheres(),
+		m_light_volume_aabbs(),
+		m_light_volume_spheres(),
+		m_light_volume_visibility(),
+		m_light_cluster_grid(),
 		m_depth_pass(MakeUnique< DepthPass >(device,
 											 device_context,
 											 state_manager,
-											 resource_manager)) {}
+											 resource_manager)) {
+
+		const auto resolution = m_shadow_atlas_allocator.GetResolution();
+		m_shadow_atlas        = MakeUnique< ShadowAtlasBuffer >(device, resolution);
+		m_static_shadow_atlas = MakeUnique< ShadowAtlasBuffer >(device, resolution);
+	}
 
 	LBufferPass::LBufferPass(LBufferPass&& buffer) noexcept = default;
 
@@ -46,12 +343,17 @@ namespace mage::rendering {
 
 	void XM_CALLCONV LBufferPass
 		::Render(const World& world,
+				 const Camera& camera,
 				 FXMMATRIX world_to_projection) {
 
 		// Process the lights.
+		m_shadow_atlas_cameras.clear();
+		m_shadow_atlas_requests.clear();
 		ProcessDirectionalLights(world, world_to_projection);
 		ProcessOmniLights(world, world_to_projection);
 		ProcessSpotLights(world, world_to_projection);
+		// Assign the omni lights and spotlights to the light clusters.
+		ProcessLightClusters(camera);
 
 		// Unbind the shadow map SRVs.
 		UnbindShadowMaps();
@@ -68,38 +370,37 @@ namespace mage::rendering {
 	}
 
 	void LBufferPass::UnbindShadowMaps() const noexcept {
-		static_assert(SLOT_SRV_OMNI_SHADOW_MAPS == SLOT_SRV_DIRECTIONAL_SHADOW_MAPS + 1);
-		static_assert(SLOT_SRV_SPOT_SHADOW_MAPS == SLOT_SRV_DIRECTIONAL_SHADOW_MAPS + 2);
+		static_assert(SLOT_SRV_OMNI_SHADOW_MAPS == SLOT_SRV_SHADOW_ATLAS + 1);
 
-		ID3D11ShaderResourceView* const srvs[3] = {};
+		ID3D11ShaderResourceView* const srvs[2] = {};
 
 		// Unbind the shadow map SRVs.
-		Pipeline::PS::BindSRVs(m_device_context, SLOT_SRV_DIRECTIONAL_SHADOW_MAPS,
+		Pipeline::PS::BindSRVs(m_device_context, SLOT_SRV_SHADOW_ATLAS,
 							   static_cast< U32 >(std::size(srvs)), srvs);
-		Pipeline::CS::BindSRVs(m_device_context, SLOT_SRV_DIRECTIONAL_SHADOW_MAPS,
+		Pipeline::CS::BindSRVs(m_device_context, SLOT_SRV_SHADOW_ATLAS,
 							   static_cast< U32 >(std::size(srvs)), srvs);
 	}
 
 	void LBufferPass::BindLBuffer() const noexcept {
+		static_assert(SLOT_SRV_DIRECTIONAL_LIGHTS               == SLOT_SRV_LIGHT_INDEX_LIST + 1);
 		static_assert(SLOT_SRV_OMNI_LIGHTS                      == SLOT_SRV_DIRECTIONAL_LIGHTS + 1);
 		static_assert(SLOT_SRV_SPOT_LIGHTS                      == SLOT_SRV_DIRECTIONAL_LIGHTS + 2);
 		static_assert(SLOT_SRV_SHADOW_MAPPED_DIRECTIONAL_LIGHTS == SLOT_SRV_DIRECTIONAL_LIGHTS + 3);
 		static_assert(SLOT_SRV_SHADOW_MAPPED_OMNI_LIGHTS        == SLOT_SRV_DIRECTIONAL_LIGHTS + 4);
 		static_assert(SLOT_SRV_SHADOW_MAPPED_SPOT_LIGHTS        == SLOT_SRV_DIRECTIONAL_LIGHTS + 5);
-		static_assert(SLOT_SRV_DIRECTIONAL_SHADOW_MAPS          == SLOT_SRV_DIRECTIONAL_LIGHTS + 6);
+		static_assert(SLOT_SRV_SHADOW_ATLAS                     == SLOT_SRV_DIRECTIONAL_LIGHTS + 6);
 		static_assert(SLOT_SRV_OMNI_SHADOW_MAPS                 == SLOT_SRV_DIRECTIONAL_LIGHTS + 7);
-		static_assert(SLOT_SRV_SPOT_SHADOW_MAPS                 == SLOT_SRV_DIRECTIONAL_LIGHTS + 8);
 
 		ID3D11ShaderResourceView* const srvs[] = {
+			&m_light_index_list.Get(),
 			&m_directional_lights.Get(),
 			&m_omni_lights.Get(),
 			&m_spot_lights.Get(),
 			&m_sm_directional_lights.Get(),
 			&m_sm_omni_lights.Get(),
 			&m_sm_spot_lights.Get(),
-			&m_directional_sms->GetSRV(),
-			&m_omni_sms->GetSRV(),
-			&m_spot_sms->GetSRV()
+			&m_shadow_atlas->GetSRV(),
+			&m_omni_sms->GetSRV()
 		};
 
 		// Bind no RTV and DSV.
@@ -112,20 +413,16 @@ namespace mage::rendering {
 										 SLOT_CBUFFER_LIGHTING, &m_light_buffer.Get());
 
 		// Bind the SRVs.
-		Pipeline::PS::BindSRVs(m_device_context, SLOT_SRV_DIRECTIONAL_LIGHTS,
+		Pipeline::PS::BindSRVs(m_device_context, SLOT_SRV_LIGHT_INDEX_LIST,
 							   static_cast< U32 >(std::size(srvs)), srvs);
-		Pipeline::CS::BindSRVs(m_device_context, SLOT_SRV_DIRECTIONAL_LIGHTS,
+		Pipeline::CS::BindSRVs(m_device_context, SLOT_SRV_LIGHT_INDEX_LIST,
 							   static_cast< U32 >(std::size(srvs)), srvs);
 	}
 
 	void LBufferPass::ProcessLightsData(const World& world) {
 		// Accumulate all ambient light spectra.
 		XMVECTOR La = {};
-		world.ForEach< AmbientLight >([&La](const AmbientLight& light) {
-			if (State::Active != light.GetState()) {
-				return;
-			}
-
+		world.ForEachActive< AmbientLight >([&La](const AmbientLight& light) {
 			La += XMLoad(light.GetRadianceSpectrum());
 		});
 
@@ -137,6 +434,13 @@ namespace mage::rendering {
 		buffer.m_nb_sm_directional_lights = static_cast< U32 >(m_sm_directional_lights.size());
 		buffer.m_nb_sm_omni_lights        = static_cast< U32 >(m_sm_omni_lights.size());
 		buffer.m_nb_sm_spot_lights        = static_cast< U32 >(m_sm_spot_lights.size());
+		buffer.m_light_cluster_resolution = {
+			LightClusterGrid::s_nb_tiles_x,
+			LightClusterGrid::s_nb_tiles_y,
+			LightClusterGrid::s_nb_slices
+		};
+		buffer.m_light_cluster_depth_scale = m_light_cluster_grid.GetDepthScale();
+		buffer.m_light_cluster_depth_bias  = m_light_cluster_grid.GetDepthBias();
 
 		// Update the light buffer.
 		m_light_buffer.UpdateData(m_device_context, buffer);
@@ -146,141 +450,206 @@ namespace mage::rendering {
 		::ProcessDirectionalLights(const World& world,
 								   FXMMATRIX world_to_projection) {
 
-		AlignedVector< DirectionalLightBuffer > lights;
-		lights.reserve(m_directional_lights.size());
+		using Entry = LightEntry< DirectionalLightBuffer,
+								  ShadowMappedDirectionalLightBuffer >;
 
-		AlignedVector< DirectionalLightBuffer > sm_lights;
-		sm_lights.reserve(m_sm_directional_lights.size());
-		m_directional_light_cameras.clear();
+		const auto nb_lights = world.GetNumberOfActive< DirectionalLight >();
+		AlignedVector< Entry > entries(nb_lights);
 
-		// Process the directional lights.
-		world.ForEach< DirectionalLight >([this, &lights, &sm_lights, world_to_projection]
-		(const DirectionalLight& light) {
+		// Cull the world-space light volumes against the view frustum.
+		m_light_volume_aabbs.resize(nb_lights);
+		world.ForEachActive< DirectionalLight >(m_job_system, [this]
+		(const DirectionalLight& light, std::size_t index) {
+			const auto light_to_world = light.GetOwner()->GetTransform().GetObjectToWorldMatrix();
+			m_light_volume_aabbs.Set(index, AABB::Transform(light.GetAABB(), light_to_world));
+		});
+		CullLightVolumes(world_to_projection, m_light_volume_aabbs, m_light_volume_visibility);
+		const auto visibility = gsl::make_span(std::as_const(m_light_volume_visibility));
 
-			if (State::Active != light.GetState()) {
-				return;
-			}
+		// Process the directional lights in parallel.
+		world.ForEachActive< DirectionalLight >(m_job_system, [&world, &entries, visibility]
+		(const DirectionalLight& light, std::size_t index) {
 
-			const auto& transform           = light.GetOwner()->GetTransform();
-			const auto  light_to_world      = transform.GetObjectToWorldMatrix();
-			const auto  light_to_projection = light_to_world * world_to_projection;
+			auto& entry     = entries[index];
+			entry.m_visible = false;
 
-			// Cull the light against the view frustum.
-			if (BoundingFrustum::Cull(light_to_projection, light.GetAABB())) {
+			// Skip the light if culled against the view frustum.
+			if (!IsVisible(visibility, index)) {
 				return;
 			}
 
+			const auto& transform           = light.GetOwner()->GetTransform();
+			const auto  light_to_world      = transform.GetObjectToWorldMatrix();
 			const auto  neg_d               = -transform.GetWorldAxisZ();
 			const auto world_to_light       = transform.GetWorldToObjectMatrix();
 			const auto light_to_lprojection = light.GetLightToProjectionMatrix();
 			const auto world_to_lprojection = world_to_light * light_to_lprojection;
 
+			entry.m_visible = true;
+			entry.m_shadows = light.UseShadows()
+				&& world.AnyActiveModel(
+					   AABB::Transform(light.GetAABB(), light_to_world),
+					   [](const Model& model) noexcept {
+						   return model.OccludesLight();
+					   });
+
 			// Create a directional light buffer.
-			DirectionalLightBuffer buffer;
+			auto& buffer = entry.m_shadows ? entry.m_sm_buffer : entry.m_buffer;
 			buffer.m_neg_d_world = Direction3(XMStore< F32x3 >(neg_d));
 			buffer.m_E_ortho     = light.GetIrradianceSpectrum();
 			buffer.m_world_to_projection = XMMatrixTranspose(world_to_lprojection);
 
-			if (light.UseShadows()) {
-				// Create a spotlight camera.
+			if (entry.m_shadows) {
+				entry.m_world_to_light      = world_to_light;
+				entry.m_light_to_projection = light_to_lprojection;
+
+				// Directional lights cover the complete screen.
+				entry.m_request.m_key        = light.GetGuid();
+				entry.m_request.m_coverage   = 1.0f;
+				entry.m_request.m_importance = 1.0f;
+			}
+		});
+
+		AlignedVector< DirectionalLightBuffer > lights;
+		lights.reserve(m_directional_lights.size());
+
+		auto& sm_lights = m_sm_directional_light_buffers;
+		sm_lights.clear();
+
+		// Gather the visible directional lights in order.
+		for (const auto& entry : entries) {
+			if (!entry.m_visible) {
+				continue;
+			}
+
+			if (entry.m_shadows) {
+				// Create a directional light camera.
 				LightCameraInfo camera;
-				camera.world_to_light      = world_to_light;
-				camera.light_to_projection = light_to_lprojection;
+				camera.world_to_light      = entry.m_world_to_light;
+				camera.light_to_projection = entry.m_light_to_projection;
 
-				// Add directional light camera to the directional cameras.
-				m_directional_light_cameras.push_back(std::move(camera));
+				// Add directional light camera to the shadow atlas cameras.
+				m_shadow_atlas_cameras.push_back(std::move(camera));
+				m_shadow_atlas_requests.push_back(entry.m_request);
 
 				// Add directional light buffer to directional light buffers.
-				sm_lights.push_back(std::move(buffer));
+				sm_lights.push_back(entry.m_sm_buffer);
 			}
 			else {
 				// Add directional light buffer to directional light buffers.
-				lights.push_back(std::move(buffer));
+				lights.push_back(entry.m_buffer);
 			}
-		});
+		}
 
-		// Update the buffers for directional lights.
+		// Update the buffer for directional lights (the buffer for shadow
+		// mapped directional lights is updated after allocating the shadow
+		// atlas tiles).
 		m_directional_lights.UpdateData(m_device_context, lights);
-		m_sm_directional_lights.UpdateData(m_device_context, sm_lights);
 	}
 
 	void XM_CALLCONV LBufferPass
 		::ProcessOmniLights(const World& world,
 							FXMMATRIX world_to_projection) {
 
-		AlignedVector< OmniLightBuffer > lights;
-		lights.reserve(m_omni_lights.size());
-
-		AlignedVector< ShadowMappedOmniLightBuffer > sm_lights;
-		sm_lights.reserve(m_sm_omni_lights.size());
-		m_omni_light_cameras.clear();
+		using Entry = LightEntry< OmniLightBuffer, ShadowMappedOmniLightBuffer >;
 
-		// Process the omni lights.
-		world.ForEach< OmniLight >([this, &lights, &sm_lights, world_to_projection]
-		(const OmniLight& light) {
+		const auto nb_lights = world.GetNumberOfActive< OmniLight >();
+		AlignedVector< Entry > entries(nb_lights);
 
-			static const XMMATRIX rotations[6] = {
-				XMMatrixRotationY(-XM_PIDIV2), // Look: +x
-				XMMatrixRotationY(XM_PIDIV2),  // Look: -x
-				XMMatrixRotationX(XM_PIDIV2),  // Look: +y
-				XMMatrixRotationX(-XM_PIDIV2), // Look: -y
-				XMMatrixIdentity(),            // Look: +z
-				XMMatrixRotationY(XM_PI),      // Look: -z
-			};
+		// Cull the world-space light volumes against the view frustum.
+		m_light_volume_spheres.resize(nb_lights);
+		world.ForEachActive< OmniLight >(m_job_system, [this]
+		(const OmniLight& light, std::size_t index) {
+			const auto p = light.GetOwner()->GetTransform().GetWorldOrigin();
+			m_light_volume_spheres.Set(index, BoundingSphere(p, light.GetWorldRange()));
+		});
+		CullLightVolumes(world_to_projection, m_light_volume_spheres, m_light_volume_visibility);
+		const auto visibility = gsl::make_span(std::as_const(m_light_volume_visibility));
 
-			if (State::Active != light.GetState()) {
-				return;
-			}
+		// Process the omni lights in parallel.
+		world.ForEachActive< OmniLight >(m_job_system, [&world, &entries, visibility]
+		(const OmniLight& light, std::size_t index) {
 
-			const auto& transform           = light.GetOwner()->GetTransform();
-			const auto  light_to_world      = transform.GetObjectToWorldMatrix();
-			const auto  light_to_projection = light_to_world * world_to_projection;
+			auto& entry     = entries[index];
+			entry.m_visible = false;
 
-			// Cull the light against the view frustum.
-			if (BoundingFrustum::Cull(light_to_projection, light.GetBoundingSphere())) {
+			// Skip the light if culled against the view frustum.
+			if (!IsVisible(visibility, index)) {
 				return;
 			}
 
-			const auto p     = transform.GetWorldOrigin();
-			const auto range = light.GetWorldRange();
+			const auto& transform = light.GetOwner()->GetTransform();
+			const auto  p         = transform.GetWorldOrigin();
+			const auto  range     = light.GetWorldRange();
 
-			if (light.UseShadows()) {
-				// Create six omni light cameras.
+			entry.m_visible = true;
+			entry.m_sphere  = BoundingSphere(p, range);
+			entry.m_shadows = light.UseShadows()
+				&& world.AnyActiveModel(entry.m_sphere,
+					   [](const Model& model) noexcept {
+						   return model.OccludesLight();
+					   });
+
+			if (entry.m_shadows) {
 				const auto world_to_light       = transform.GetWorldToObjectMatrix();
 				const auto light_to_lprojection = light.GetLightToProjectionMatrix();
 
-				for (std::size_t i = 0u; i < std::size(rotations); ++i) {
-					LightCameraInfo camera;
-					camera.world_to_light      = world_to_light * rotations[i];
-					camera.light_to_projection = light_to_lprojection;
-
-					// Add omni light camera to the omni light cameras.
-					m_omni_light_cameras.push_back(std::move(camera));
-				}
+				entry.m_world_to_light      = world_to_light;
+				entry.m_light_to_projection = light_to_lprojection;
 
 				// Create an omni light buffer.
-				ShadowMappedOmniLightBuffer buffer;
+				auto& buffer = entry.m_sm_buffer;
 				buffer.m_p_world           = Point3(XMStore< F32x3 >(p));
 				buffer.m_inv_sqr_range     = 1.0f / (range * range);
 				buffer.m_I                 = light.GetIntensitySpectrum();
 				buffer.m_world_to_light    = XMMatrixTranspose(world_to_light);
 				buffer.m_projection_values = XMStore< F32x2 >(GetNDCZConstructionValues(
 					                                          light_to_lprojection));
-
-				// Add omni light buffer to omni light buffers.
-				sm_lights.push_back(std::move(buffer));
 			}
 			else {
 				// Create an omni light buffer.
-				OmniLightBuffer buffer;
+				auto& buffer = entry.m_buffer;
 				buffer.m_p_world       = Point3(XMStore< F32x3 >(p));
 				buffer.m_inv_sqr_range = 1.0f / (range * range);
 				buffer.m_I             = light.GetIntensitySpectrum();
+			}
+		});
+
+		AlignedVector< OmniLightBuffer > lights;
+		lights.reserve(m_omni_lights.size());
+		m_omni_light_spheres.clear();
+
+		AlignedVector< ShadowMappedOmniLightBuffer > sm_lights;
+		sm_lights.reserve(m_sm_omni_lights.size());
+		m_omni_light_cameras.clear();
+		m_sm_omni_light_spheres.clear();
+
+		// Gather the visible omni lights in order.
+		for (const auto& entry : entries) {
+			if (!entry.m_visible) {
+				continue;
+			}
+
+			if (entry.m_shadows) {
+				// Create an omni light camera (the six cube face cameras are
+				// derived while rendering).
+				LightCameraInfo camera;
+				camera.world_to_light      = entry.m_world_to_light;
+				camera.light_to_projection = entry.m_light_to_projection;
+
+				// Add omni light camera to the omni light cameras.
+				m_omni_light_cameras.push_back(std::move(camera));
+				m_sm_omni_light_spheres.push_back(entry.m_sphere);
 
 				// Add omni light buffer to omni light buffers.
-				lights.push_back(std::move(buffer));
+				sm_lights.push_back(entry.m_sm_buffer);
 			}
-		});
+			else {
+				// Add omni light buffer to omni light buffers.
+				lights.push_back(entry.m_buffer);
+				m_omni_light_spheres.push_back(entry.m_sphere);
+			}
+		}
 
 		// Update the buffers for omni lights.
 		m_omni_lights.UpdateData(m_device_context, lights);
@@ -291,18 +660,30 @@ namespace mage::rendering {
 		::ProcessSpotLights(const World& world,
 							FXMMATRIX world_to_projection) {
 
-		AlignedVector< SpotLightBuffer > lights;
-		lights.reserve(m_spot_lights.size());
+		using Entry = LightEntry< SpotLightBuffer, ShadowMappedSpotLightBuffer >;
+
+		const auto nb_lights = world.GetNumberOfActive< SpotLight >();
+		AlignedVector< Entry > entries(nb_lights);
+
+		// Cull the world-space light volumes against the view frustum.
+		m_light_volume_aabbs.resize(nb_lights);
+		world.ForEachActive< SpotLight >(m_job_system, [this]
+		(const SpotLight& light, std::size_t index) {
+			const auto light_to_world = light.GetOwner()->GetTransform().GetObjectToWorldMatrix();
+			m_light_volume_aabbs.Set(index, AABB::Transform(light.GetAABB(), light_to_world));
+		});
+		CullLightVolumes(world_to_projection, m_light_volume_aabbs, m_light_volume_visibility);
+		const auto visibility = gsl::make_span(std::as_const(m_light_volume_visibility));
 
-		AlignedVector< ShadowMappedSpotLightBuffer > sm_lights;
-		sm_lights.reserve(m_sm_spot_lights.size());
-		m_spot_light_cameras.clear();
+		// Process the spotlights in parallel.
+		world.ForEachActive< SpotLight >(m_job_system, [&world, &entries, visibility, world_to_projection]
+		(const SpotLight& light, std::size_t index) {
 
-		// Process the spotlights.
-		world.ForEach< SpotLight >([this, &lights, &sm_lights, world_to_projection]
-		(const SpotLight& light) {
+			auto& entry     = entries[index];
+			entry.m_visible = false;
 
-			if (State::Active != light.GetState()) {
+			// Skip the light if culled against the view frustum.
+			if (!IsVisible(visibility, index)) {
 				return;
 			}
 
@@ -310,30 +691,28 @@ namespace mage::rendering {
 			const auto  light_to_world      = transform.GetObjectToWorldMatrix();
 			const auto  light_to_projection = light_to_world * world_to_projection;
 
-			// Cull the light against the view frustum.
-			if (BoundingFrustum::Cull(light_to_projection, light.GetAABB())) {
-				return;
-			}
-
 			const auto p     =  transform.GetWorldOrigin();
 			const auto neg_d = -transform.GetWorldAxisZ();
 			const auto range =  light.GetWorldRange();
 
-			if (light.UseShadows()) {
+			entry.m_visible = true;
+			entry.m_shadows = light.UseShadows()
+				&& world.AnyActiveModel(
+					   AABB::Transform(light.GetAABB(), light_to_world),
+					   [](const Model& model) noexcept {
+						   return model.OccludesLight();
+					   });
+
+			if (entry.m_shadows) {
 				const auto world_to_light       = transform.GetWorldToObjectMatrix();
 				const auto light_to_lprojection = light.GetLightToProjectionMatrix();
 				const auto world_to_lprojection = world_to_light * light_to_lprojection;
 
-				// Create a spotlight camera.
-				LightCameraInfo camera;
-				camera.world_to_light          = world_to_light;
-				camera.light_to_projection     = light_to_lprojection;
-
-				// Add spotlight camera to the spotlight cameras.
-				m_spot_light_cameras.push_back(std::move(camera));
+				entry.m_world_to_light      = world_to_light;
+				entry.m_light_to_projection = light_to_lprojection;
 
 				// Create a spotlight buffer.
-				ShadowMappedSpotLightBuffer buffer;
+				auto& buffer = entry.m_sm_buffer;
 				buffer.m_p_world       = Point3(XMStore< F32x3 >(p));
 				buffer.m_neg_d_world   = Direction3(XMStore< F32x3 >(neg_d));
 				buffer.m_inv_sqr_range = 1.0f / (range * range);
@@ -342,12 +721,15 @@ namespace mage::rendering {
 				buffer.m_cos_inv_range = 1.0f / light.GetRangeAngularCutoff();
 				buffer.m_world_to_projection = XMMatrixTranspose(world_to_lprojection);
 
-				// Add spotlight buffer to spotlight buffers.
-				sm_lights.push_back(std::move(buffer));
+				// The importance is normalized after processing all lights.
+				entry.m_request.m_key        = light.GetGuid();
+				entry.m_request.m_coverage   = GetScreenCoverage(light_to_projection,
+																 light.GetAABB());
+				entry.m_request.m_importance = light.GetIntensity();
 			}
 			else {
-				// Create an omni light buffer.
-				SpotLightBuffer buffer;
+				// Create a spotlight buffer.
+				auto& buffer = entry.m_buffer;
 				buffer.m_p_world       = Point3(XMStore< F32x3 >(p));
 				buffer.m_neg_d_world   = Direction3(XMStore< F32x3 >(neg_d));
 				buffer.m_inv_sqr_range = 1.0f / (range * range);
@@ -355,30 +737,115 @@ namespace mage::rendering {
 				buffer.m_cos_umbra     = light.GetEndAngularCutoff();
 				buffer.m_cos_inv_range = 1.0f / light.GetRangeAngularCutoff();
 
-				// Add spotlight buffer to spotlight buffers.
-				lights.push_back(std::move(buffer));
+				// Enclose the world-space AABB of the light volume.
+				const auto aabb = AABB::Transform(light.GetAABB(), light_to_world);
+				entry.m_sphere  = BoundingSphere(aabb.Centroid(), XMVectorGetX(
+					                             XMVector3Length(aabb.Radius())));
 			}
 		});
 
-		// Update the buffers for spotlights.
+		AlignedVector< SpotLightBuffer > lights;
+		lights.reserve(m_spot_lights.size());
+		m_spot_light_spheres.clear();
+
+		auto& sm_lights = m_sm_spot_light_buffers;
+		sm_lights.clear();
+
+		// Determine the maximum intensity of the shadow mapped spotlights.
+		auto max_intensity = 0.0f;
+		for (const auto& entry : entries) {
+			if (entry.m_visible && entry.m_shadows) {
+				max_intensity = std::max(max_intensity, entry.m_request.m_importance);
+			}
+		}
+		const auto inv_max_intensity = (0.0f < max_intensity)
+			                         ? 1.0f / max_intensity : 1.0f;
+
+		// Gather the visible spotlights in order.
+		for (const auto& entry : entries) {
+			if (!entry.m_visible) {
+				continue;
+			}
+
+			if (entry.m_shadows) {
+				// Create a spotlight camera.
+				LightCameraInfo camera;
+				camera.world_to_light      = entry.m_world_to_light;
+				camera.light_to_projection = entry.m_light_to_projection;
+
+				// Add spotlight camera to the shadow atlas cameras.
+				m_shadow_atlas_cameras.push_back(std::move(camera));
+
+				// Weigh the spotlight relative to the brightest shadow mapped
+				// spotlight.
+				auto request = entry.m_request;
+				request.m_importance = std::clamp(request.m_importance * inv_max_intensity,
+												  0.25f, 1.0f);
+				m_shadow_atlas_requests.push_back(request);
+
+				// Add spotlight buffer to spotlight buffers.
+				sm_lights.push_back(entry.m_sm_buffer);
+			}
+			else {
+				// Add spotlight buffer to spotlight buffers.
+				lights.push_back(entry.m_buffer);
+				m_spot_light_spheres.push_back(entry.m_sphere);
+			}
+		}
+
+		// Update the buffer for spotlights (the buffer for shadow mapped
+		// spotlights is updated after allocating the shadow atlas tiles).
 		m_spot_lights.UpdateData(m_device_context, lights);
-		m_sm_spot_lights.UpdateData(m_device_context, sm_lights);
+	}
+
+	void LBufferPass::ProcessLightClusters(const Camera& camera) {
+		const auto& transform            = camera.GetOwner()->GetTransform();
+		const auto  world_to_camera      = transform.GetWorldToObjectMatrix();
+		const auto  camera_to_projection = camera.GetCameraToProjectionMatrix();
+		const auto  clipping_planes      = camera.GetClippingPlanes();
+
+		// Transform the bounding spheres to camera space.
+		const auto to_camera = [world_to_camera](BoundingSphere& sphere) noexcept {
+			const auto p = XMVector3TransformCoord(sphere.Centroid(), world_to_camera);
+			sphere = BoundingSphere(p, sphere.Radius());
+		};
+		for (auto& sphere : m_omni_light_spheres) {
+			to_camera(sphere);
+		}
+		for (auto& sphere : m_spot_light_spheres) {
+			to_camera(sphere);
+		}
+
+		m_light_cluster_grid.Build(camera_to_projection,
+								   clipping_planes[0], clipping_planes[1],
+								   m_omni_light_spheres, m_spot_light_spheres);
+
+		// Update the light index list.
+		m_light_index_list.UpdateData(m_device_context,
+									  m_light_cluster_grid.GetLightIndexList());
 	}
 
 	void LBufferPass::SetupShadowMaps() {
-		// Setup the shadow maps for the directional lights.
+		// Setup the shadow atlas for the directional lights and spotlights.
 		{
-			const auto nb_requested = m_sm_directional_lights.size();
-			const auto nb_available = m_directional_sms->GetNumberOfShadowMaps();
+			m_shadow_atlas_allocator.Allocate(m_shadow_atlas_requests);
 
-			if (nb_available < nb_requested) {
-				ComPtr< ID3D11Device > device;
-				m_device_context.get().GetDevice(device.ReleaseAndGetAddressOf());
-				m_directional_sms = MakeUnique< ShadowMapBuffer >(*device.Get(),
-																  nb_requested);
+			const auto tiles      = m_shadow_atlas_allocator.GetTiles();
+			const auto resolution = m_shadow_atlas_allocator.GetResolution();
+			std::size_t index = 0u;
+			for (auto& buffer : m_sm_directional_light_buffers) {
+				buffer.m_shadow_tile = GetTileScaleAndOffset(tiles[index++], resolution);
+			}
+			for (auto& buffer : m_sm_spot_light_buffers) {
+				buffer.m_shadow_tile = GetTileScaleAndOffset(tiles[index++], resolution);
 			}
 
-			m_directional_sms->ClearDSVs(m_device_context);
+			// Update the buffers for shadow mapped directional lights and
+			// spotlights.
+			m_sm_directional_lights.UpdateData(m_device_context,
+											   m_sm_directional_light_buffers);
+			m_sm_spot_lights.UpdateData(m_device_context,
+										m_sm_spot_light_buffers);
 		}
 
 		// Setup the shadow maps for the omni lights.
@@ -391,85 +858,223 @@ namespace mage::rendering {
 				m_device_context.get().GetDevice(device.ReleaseAndGetAddressOf());
 				m_omni_sms = MakeUnique< ShadowCubeMapBuffer >(*device.Get(),
 															   nb_requested);
+				m_omni_static_sms = MakeUnique< ShadowCubeMapBuffer >(*device.Get(),
+																	  nb_requested);
+				// Invalidate the cached shadow maps.
+				m_omni_sm_cache.clear();
 			}
-
-			m_omni_sms->ClearDSVs(m_device_context);
-		}
-
-		// Setup the shadow maps for the spotlights.
-		{
-			const auto nb_requested = m_sm_spot_lights.size();
-			const auto nb_available = m_spot_sms->GetNumberOfShadowMaps();
-
-			if (nb_available < nb_requested) {
-				ComPtr< ID3D11Device > device;
-				m_device_context.get().GetDevice(device.ReleaseAndGetAddressOf());
-				m_spot_sms = MakeUnique< ShadowMapBuffer >(*device.Get(),
-														   nb_requested);
-			}
-
-			m_spot_sms->ClearDSVs(m_device_context);
 		}
 	}
 
 	void XM_CALLCONV LBufferPass::RenderShadowMaps(const World& world) {
+		// Render the shadow atlas of the directional lights and spotlights.
+		RenderShadowAtlas(world);
+
 		// Bind the fixed state.
 		m_depth_pass->BindFixedState();
 
-		// Render the shadow maps of the directional lights.
+		// Render the shadow maps of the omni lights.
 		{
 			// Bind the viewport.
-			m_directional_sms->Bind(m_device_context);
+			m_omni_sms->Bind(m_device_context);
 			// Bind the rasterizer state.
-			m_directional_sms->BindRasterizerState(m_device_context);
+			m_omni_sms->BindRasterizerState(m_device_context);
 
-			std::size_t i = 0u;
-			for (const auto& camera : m_directional_light_cameras) {
-				// Bind the DSV.
-				m_directional_sms->BindDSV(m_device_context, i++);
+			RenderShadowCubeMaps(world);
+		}
+	}
 
-				// Perform the depth pass.
-				m_depth_pass->RenderOccluders(world,
-											  camera.world_to_light,
-											  camera.light_to_projection);
+	void LBufferPass::RenderShadowAtlas(const World& world) {
+		const auto frame = world.GetModelHierarchyFrame();
+		const auto tiles = m_shadow_atlas_allocator.GetTiles();
+		m_shadow_atlas_cache.resize(m_shadow_atlas_cameras.size());
+
+		const auto occludes_light = [](const Model& model) noexcept {
+			return model.OccludesLight();
+		};
+
+		// Binds the fixed state (which is changed by clearing and copying
+		// depth).
+		const auto bind_fixed_state = [this]() noexcept {
+			m_depth_pass->BindFixedState();
+			m_shadow_atlas->BindRasterizerState(m_device_context);
+		};
+
+		bind_fixed_state();
+
+		for (std::size_t i = 0u; i < m_shadow_atlas_cameras.size(); ++i) {
+			const auto& camera = m_shadow_atlas_cameras[i];
+			const auto& tile   = tiles[i];
+			auto& entry        = m_shadow_atlas_cache[i];
+
+			// The light could not be allocated a tile (and is not shadowed).
+			if (0u == tile.m_size) {
+				entry.valid = false;
+				continue;
 			}
-		}
 
-		// Render the shadow maps of the omni lights.
-		{
-			// Bind the viewport.
-			m_omni_sms->Bind(m_device_context);
-			// Bind the rasterizer state.
-			m_omni_sms->BindRasterizerState(m_device_context);
+			const auto same_camera = entry.valid
+				&& Equal(entry.tile, tile)
+				&& Equal(entry.world_to_light,      camera.world_to_light)
+				&& Equal(entry.light_to_projection, camera.light_to_projection);
+
+			// The tile is already up-to-date (e.g., for a previous camera in
+			// this frame).
+			if (same_camera && entry.frame == frame) {
+				continue;
+			}
+
+			const BoundingFrustum frustum(camera.world_to_light
+										  * camera.light_to_projection);
+			const auto dynamic = world.AnyActiveModel(frustum, occludes_light,
+													  ModelMobility::Dynamic);
+
+			if (same_camera && !world.HasStaticModelChanges(frustum, entry.frame)) {
+				// Reuse the static depth layer (unless the tile already
+				// contains nothing else).
+				if (entry.dynamic || dynamic) {
+					m_shadow_atlas->BindDSV(m_device_context);
+					m_shadow_atlas->BindTile(m_device_context,
+											 tile.m_position, tile.m_size);
+					m_depth_pass->CopyDepth(m_static_shadow_atlas->GetSRV());
+					bind_fixed_state();
+				}
+			}
+			else {
+				// Render the static depth layer.
+				m_static_shadow_atlas->BindDSV(m_device_context);
+				m_static_shadow_atlas->BindTile(m_device_context,
+												tile.m_position, tile.m_size);
+				m_depth_pass->ClearDepth();
+				bind_fixed_state();
+				m_depth_pass->RenderOccluders(world,
+											  camera.world_to_light,
+											  camera.light_to_projection,
+											  ModelMobility::Static);
 
-			std::size_t i = 0u;
-			for (const auto& camera : m_omni_light_cameras) {
-				// Bind the DSV.
-				m_omni_sms->BindDSV(m_device_context, i++);
+				m_shadow_atlas->BindDSV(m_device_context);
+				m_depth_pass->CopyDepth(m_static_shadow_atlas->GetSRV());
+				bind_fixed_state();
+			}
 
-				// Perform the depth pass.
+			entry.world_to_light      = camera.world_to_light;
+			entry.light_to_projection = camera.light_to_projection;
+			entry.tile                = tile;
+			entry.frame               = frame;
+			entry.valid               = true;
+			entry.dynamic             = dynamic;
+
+			if (dynamic) {
+				// Render the dynamic occluders on top of the static depth
+				// layer.
+				m_shadow_atlas->BindDSV(m_device_context);
+				m_shadow_atlas->BindTile(m_device_context,
+										 tile.m_position, tile.m_size);
 				m_depth_pass->RenderOccluders(world,
 											  camera.world_to_light,
-											  camera.light_to_projection);
+											  camera.light_to_projection,
+											  ModelMobility::Dynamic);
 			}
 		}
+	}
 
-		// Render the shadow maps of the spotlights.
-		{
-			// Bind the viewport.
-			m_spot_sms->Bind(m_device_context);
-			// Bind the rasterizer state.
-			m_spot_sms->BindRasterizerState(m_device_context);
+	void LBufferPass::RenderShadowCubeMaps(const World& world) {
+		const auto frame = world.GetModelHierarchyFrame();
+		m_omni_sm_cache.resize(s_nb_cube_faces * m_omni_light_cameras.size());
 
-			std::size_t i = 0u;
-			for (const auto& camera : m_spot_light_cameras) {
-				// Bind the DSV.
-				m_spot_sms->BindDSV(m_device_context, i++);
+		for (std::size_t i = 0u; i < m_omni_light_cameras.size(); ++i) {
+			const auto& camera = m_omni_light_cameras[i];
 
-				// Perform the depth pass.
-				m_depth_pass->RenderOccluders(world,
-											  camera.world_to_light,
-											  camera.light_to_projection);
+			// Cull the occluders once against the bounding sphere of the
+			// light, and classify them by the cube faces they overlap.
+			m_omni_light_occluders.clear();
+			world.ForEachActiveModelAABB(m_sm_omni_light_spheres[i],
+				[this, &camera](const Model& model,
+								const AABB& aabb,
+								ModelMobility mobility) {
+
+				if (!model.OccludesLight()) {
+					return;
+				}
+
+				const auto faces = GetCubeFaceMask(
+					AABB::Transform(aabb, camera.world_to_light));
+				if (0u != faces) {
+					m_omni_light_occluders.push_back({ &model, faces, mobility });
+				}
+			});
+
+			for (std::size_t face = 0u; face < s_nb_cube_faces; ++face) {
+				const auto index          = s_nb_cube_faces * i + face;
+				const auto world_to_light = camera.world_to_light
+					                      * GetCubeFaceRotation(face);
+				auto& entry               = m_omni_sm_cache[index];
+
+				const auto same_camera = entry.valid
+					&& Equal(entry.world_to_light,      world_to_light)
+					&& Equal(entry.light_to_projection, camera.light_to_projection);
+
+				// The shadow map is already up-to-date (e.g., for a previous
+				// camera in this frame).
+				if (same_camera && entry.frame == frame) {
+					continue;
+				}
+
+				// Gather the static and dynamic occluders of the cube face.
+				m_static_occluders.clear();
+				m_dynamic_occluders.clear();
+				for (const auto& occluder : m_omni_light_occluders) {
+					if (0u == (occluder.faces & (1u << face))) {
+						continue;
+					}
+
+					if (ModelMobility::Static == occluder.mobility) {
+						m_static_occluders.push_back(occluder.model);
+					}
+					else {
+						m_dynamic_occluders.push_back(occluder.model);
+					}
+				}
+
+				const auto dynamic = !m_dynamic_occluders.empty();
+
+				const BoundingFrustum frustum(world_to_light
+											  * camera.light_to_projection);
+
+				if (same_camera && !world.HasStaticModelChanges(frustum, entry.frame)) {
+					// Reuse the static depth layer (unless the shadow map
+					// already contains nothing else).
+					if (entry.dynamic || dynamic) {
+						m_omni_sms->CopyDSV(m_device_context, index,
+											*m_omni_static_sms);
+					}
+				}
+				else {
+					// Render the static depth layer.
+					m_omni_static_sms->ClearDSV(m_device_context, index);
+					m_omni_static_sms->BindDSV(m_device_context, index);
+					m_depth_pass->RenderOccluders(m_static_occluders,
+												  world_to_light,
+												  camera.light_to_projection);
+
+					m_omni_sms->CopyDSV(m_device_context, index,
+										*m_omni_static_sms);
+				}
+
+				entry.world_to_light      = world_to_light;
+				entry.light_to_projection = camera.light_to_projection;
+				entry.frame               = frame;
+				entry.valid               = true;
+				entry.dynamic             = dynamic;
+
+				if (dynamic) {
+					// Render the dynamic occluders on top of the static depth
+					// layer.
+					m_omni_sms->BindDSV(m_device_context, index);
+					m_depth_pass->RenderOccluders(m_dynamic_occluders,
+												  world_to_light,
+												  camera.light_to_projection);
+				}
 			}
 		}
 	}
@@ -5,9 +5,13 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
+#include "renderer\buffer\constant_buffer.hpp"
 #include "renderer\buffer\structured_buffer.hpp"
 #include "renderer\buffer\scene_buffer.hpp"
 #include "renderer\buffer\shadow_map_buffer.hpp"
+#include "renderer\light_cluster_grid.hpp"
+#include "geometry\culling.hpp"
+#include "renderer\shadow_atlas_allocator.hpp"
 #include "renderer\pass\depth_pass.hpp"
 
 #pragma endregion
@@ -36,11 +40,14 @@ namespace mage::rendering {
 						A reference to the state manager.
 		 @param[in,out]	resource_manager
 						A reference to the resource manager.
+		 @param[in,out]	job_system
+						A reference to the job system.
 		 */
 		explicit LBufferPass(ID3D11Device& device,
 							 ID3D11DeviceContext& device_context,
 							 StateManager& state_manager,
-							 ResourceManager& resource_manager);
+							 ResourceManager& resource_manager,
+							 JobSystem& job_system);
 		LBufferPass(const LBufferPass& buffer) = delete;
 		LBufferPass(LBufferPass&& buffer) noexcept;
 		~LBufferPass();
@@ -57,6 +64,7 @@ namespace mage::rendering {
 		//---------------------------------------------------------------------
 
 		void XM_CALLCONV Render(const World& world,
+								const Camera& camera,
 			                    FXMMATRIX world_to_projection);
 
 	private:
@@ -76,10 +84,13 @@ namespace mage::rendering {
 										   FXMMATRIX world_to_projection);
 		void XM_CALLCONV ProcessSpotLights(const World& world,
 										   FXMMATRIX world_to_projection);
+		void ProcessLightClusters(const Camera& camera);
 
 		void SetupShadowMaps();
 
 		void XM_CALLCONV RenderShadowMaps(const World& world);
+		void RenderShadowAtlas(const World& world);
+		void RenderShadowCubeMaps(const World& world);
 
 		//---------------------------------------------------------------------
 		// Member Variables
@@ -90,26 +101,134 @@ namespace mage::rendering {
 		 */
 		std::reference_wrapper< ID3D11DeviceContext > m_device_context;
 
+		/**
+		 A reference to the job system of this LBuffer pass.
+		 */
+		std::reference_wrapper< JobSystem > m_job_system;
+
 		ConstantBuffer< LightBuffer > m_light_buffer;
+		StructuredBuffer< U32 > m_light_index_list;
 		StructuredBuffer< DirectionalLightBuffer > m_directional_lights;
 		StructuredBuffer< OmniLightBuffer > m_omni_lights;
 		StructuredBuffer< SpotLightBuffer > m_spot_lights;
-		StructuredBuffer< DirectionalLightBuffer > m_sm_directional_lights;
+		StructuredBuffer< ShadowMappedDirectionalLightBuffer > m_sm_directional_lights;
 		StructuredBuffer< ShadowMappedOmniLightBuffer > m_sm_omni_lights;
 		StructuredBuffer< ShadowMappedSpotLightBuffer > m_sm_spot_lights;
 
-		UniquePtr< ShadowMapBuffer > m_directional_sms;
+		/**
+		 The shadow mapped directional light and spotlight buffers of this
+		 LBuffer pass (which are uploaded once their shadow atlas tiles are
+		 allocated).
+		 */
+		AlignedVector< ShadowMappedDirectionalLightBuffer > m_sm_directional_light_buffers;
+		AlignedVector< ShadowMappedSpotLightBuffer > m_sm_spot_light_buffers;
+
+		/**
+		 The shadow atlas (i.e. the shadow maps of the directional lights and
+		 spotlights) of this LBuffer pass.
+		 */
+		UniquePtr< ShadowAtlasBuffer > m_shadow_atlas;
 		UniquePtr< ShadowCubeMapBuffer > m_omni_sms;
-		UniquePtr< ShadowMapBuffer > m_spot_sms;
+
+		/**
+		 The static depth layers (i.e. the shadow maps containing only the
+		 static occluders) of this LBuffer pass.
+		 */
+		UniquePtr< ShadowAtlasBuffer > m_static_shadow_atlas;
+		UniquePtr< ShadowCubeMapBuffer > m_omni_static_sms;
+
+		/**
+		 The shadow atlas allocator of this LBuffer pass.
+		 */
+		ShadowAtlasAllocator m_shadow_atlas_allocator;
+
+		/**
+		 The shadow atlas requests (i.e. one request per shadow mapped
+		 directional light, followed by one request per shadow mapped
+		 spotlight) of this LBuffer pass.
+		 */
+		std::vector< ShadowAtlasAllocator::Request > m_shadow_atlas_requests;
 
 		struct alignas(16) LightCameraInfo {
 			XMMATRIX world_to_light;
 			XMMATRIX light_to_projection;
 		};
 
-		AlignedVector< LightCameraInfo > m_directional_light_cameras;
+		/**
+		 A struct of shadow map cache entries (i.e. the light camera, shadow
+		 atlas tile and model hierarchy frame for which a shadow map and its
+		 static depth layer were rendered).
+		 */
+		struct alignas(16) ShadowMapCacheEntry {
+			XMMATRIX world_to_light;
+			XMMATRIX light_to_projection;
+			ShadowAtlasAllocator::Tile tile;
+			U64 frame;
+			bool valid;
+			bool dynamic;
+		};
+
+		/**
+		 A struct of omni light occluders (i.e. a model overlapping the
+		 bounding sphere of a shadow mapped omni light, classified by the cube
+		 faces it overlaps).
+		 */
+		struct OmniLightOccluder {
+			const Model* model;
+			U8 faces;
+			ModelMobility mobility;
+		};
+
+		/**
+		 The light cameras of the shadow atlas (i.e. the directional light
+		 cameras, followed by the spotlight cameras) of this LBuffer pass.
+		 */
+		AlignedVector< LightCameraInfo > m_shadow_atlas_cameras;
+
+		/**
+		 The light cameras (i.e. one camera per shadow mapped omni light,
+		 looking along the +z axis of the light) and bounding spheres of the
+		 shadow mapped omni lights of this LBuffer pass.
+		 */
 		AlignedVector< LightCameraInfo > m_omni_light_cameras;
-		AlignedVector< LightCameraInfo > m_spot_light_cameras;
+		AlignedVector< BoundingSphere > m_sm_omni_light_spheres;
+
+		/**
+		 The occluders of the current shadow mapped omni light, and the static
+		 and dynamic occluders of its current cube face of this LBuffer pass.
+		 */
+		std::vector< OmniLightOccluder > m_omni_light_occluders;
+		std::vector< const Model* > m_static_occluders;
+		std::vector< const Model* > m_dynamic_occluders;
+
+		/**
+		 The shadow map caches (i.e. one entry per shadow map) of this LBuffer
+		 pass.
+		 */
+		AlignedVector< ShadowMapCacheEntry > m_shadow_atlas_cache;
+		AlignedVector< ShadowMapCacheEntry > m_omni_sm_cache;
+
+		/**
+		 The bounding spheres of the clustered omni lights and spotlights of
+		 this LBuffer pass.
+		 */
+		AlignedVector< BoundingSphere > m_omni_light_spheres;
+		AlignedVector< BoundingSphere > m_spot_light_spheres;
+
+		/**
+		 The world-space light volumes of the active lights of the type being
+		 processed, and their visibility mask (i.e. one bit per light which
+		 is set if the light volume overlaps the view frustum) of this LBuffer
+		 pass.
+		 */
+		AABBArray m_light_volume_aabbs;
+		BoundingSphereArray m_light_volume_spheres;
+		std::vector< U64 > m_light_volume_visibility;
+
+		/**
+		 The light cluster grid of this LBuffer pass.
+		 */
+		LightClusterGrid m_light_cluster_grid;
 
 		UniquePtr< DepthPass > m_depth_pass;
 	};
@@ -22,7 +22,8 @@ namespace mage::rendering {
 		: m_device_context(device_context),
 		m_state_manager(state_manager),
 		m_resource_manager(resource_manager),
-		m_dof_cs(CreateDepthOfFieldCS(resource_manager)) {}
+		m_dof_cs(CreateDepthOfFieldCS(resource_manager)),
+		m_ldr_cs() {}
 
 	PostProcessPass::PostProcessPass(PostProcessPass&& pass) noexcept = default;
 
@@ -47,8 +48,10 @@ namespace mage::rendering {
 									  ToneMapping tone_mapping) const noexcept {
 
 		// CS: Bind the compute shader.
-		const auto cs = CreateLowDynamicRangeCS(m_resource_manager,
-												tone_mapping);
+		const auto& cs = m_ldr_cs.Get(GetLowDynamicRangePermutation(tone_mapping),
+			[this, tone_mapping]() {
+				return CreateLowDynamicRangeCS(m_resource_manager, tone_mapping);
+			});
 		cs->BindShader(m_device_context);
 
 		// Dispatch the pass.
@@ -61,23 +61,15 @@ namespace mage::rendering {
 		m_sprite_batch.Begin();
 
 		// Processes the sprite images.
-		world.ForEach< SpriteImage >([&sprite_batch(m_sprite_batch)]
+		world.ForEachActive< SpriteImage >([&sprite_batch(m_sprite_batch)]
 		(const SpriteImage& sprite) {
-			if (State::Active != sprite.GetState()) {
-				return;
-			}
-
 			// Draw the sprite.
 			sprite.Draw(sprite_batch);
 		});
 
 		// Processes the sprite texts.
-		world.ForEach< SpriteText >([&sprite_batch(m_sprite_batch)]
+		world.ForEachActive< SpriteText >([&sprite_batch(m_sprite_batch)]
 		(const SpriteText& sprite) {
-			if (State::Active != sprite.GetState()) {
-				return;
-			}
-
 			// Draw the sprite.
 			sprite.Draw(sprite_batch);
 		});
@@ -25,8 +25,11 @@ namespace mage::rendering {
 		m_state_manager(state_manager),
 		m_resource_manager(resource_manager),
 		m_rs(),
-		m_vs(CreateVoxelizationVS(resource_manager)),
+		m_vs(CreateVoxelizationVS(resource_manager, false)),
+		m_compact_vs(CreateVoxelizationVS(resource_manager, true)),
 		m_gs(CreateVoxelizationGS(resource_manager)),
+		m_emissive_ps(CreateVoxelizationEmissivePS(resource_manager)),
+		m_ps(),
 		m_cs(CreateVoxelizationCS(resource_manager)),
 		m_voxel_grid(MakeUnique< VoxelGrid >(device, 1u)) {
 
@@ -119,18 +122,16 @@ namespace mage::rendering {
 		// All emissive models.
 		//---------------------------------------------------------------------
 		{
-			const PixelShaderPtr ps = CreateVoxelizationEmissivePS(m_resource_manager);
 			// PS: Bind the pixel shader.
-			ps->BindShader(m_device_context);
+			m_emissive_ps->BindShader(m_device_context);
 		}
 
 		// Process the models.
-		world.ForEach< Model >([this, world_to_projection](const Model& model) {
+		world.ForEachActive< Model >([this, world_to_projection](const Model& model) {
 
 			const auto& material = model.GetMaterial();
 
-			if (State::Active != model.GetState()
-				|| !material.IsEmissive()
+			if (!material.IsEmissive()
 				|| material.GetBaseColor()[3] < TRANSPARENCY_THRESHOLD) {
 				return;
 			}
@@ -143,19 +144,20 @@ namespace mage::rendering {
 		//---------------------------------------------------------------------
 		{
 			constexpr bool tsnm = false;
-			const PixelShaderPtr ps = CreateVoxelizationPS(m_resource_manager,
-														   tsnm);
+			const auto& ps = m_ps.Get(GetVoxelizationPermutation(tsnm),
+				[this]() {
+					return CreateVoxelizationPS(m_resource_manager, tsnm);
+				});
 			// PS: Bind the pixel shader.
 			ps->BindShader(m_device_context);
 		}
 
 		// Process the models.
-		world.ForEach< Model >([this, world_to_projection](const Model& model) {
+		world.ForEachActive< Model >([this, world_to_projection](const Model& model) {
 
 			const auto& material = model.GetMaterial();
 
-			if (State::Active != model.GetState()
-				|| material.IsEmissive()
+			if (material.IsEmissive()
 				|| nullptr != material.GetNormalSRV()
 				|| material.GetBaseColor()[3] < TRANSPARENCY_THRESHOLD) {
 				return;
@@ -169,19 +171,20 @@ namespace mage::rendering {
 		//---------------------------------------------------------------------
 		{
 			constexpr bool tsnm = true;
-			const PixelShaderPtr ps = CreateVoxelizationPS(m_resource_manager,
-														   tsnm);
+			const auto& ps = m_ps.Get(GetVoxelizationPermutation(tsnm),
+				[this]() {
+					return CreateVoxelizationPS(m_resource_manager, tsnm);
+				});
 			// PS: Bind the pixel shader.
 			ps->BindShader(m_device_context);
 		}
 
 		// Process the models.
-		world.ForEach< Model >([this, world_to_projection](const Model& model) {
+		world.ForEachActive< Model >([this, world_to_projection](const Model& model) {
 
 			const auto& material = model.GetMaterial();
 
-			if (State::Active != model.GetState()
-				|| material.IsEmissive()
+			if (material.IsEmissive()
 				|| nullptr == material.GetNormalSRV()
 				|| material.GetBaseColor()[3] < TRANSPARENCY_THRESHOLD) {
 				return;
@@ -205,6 +208,9 @@ namespace mage::rendering {
 
 		const auto& material             = model.GetMaterial();
 
+		// Bind the vertex shader matching the vertices of the model.
+		const auto& vs = model.GetMesh()->HasCompactVertices() ? m_compact_vs : m_vs;
+		vs->BindShader(m_device_context);
 		// Bind the constant buffer of the model.
 		model.BindBuffer< Pipeline::VS >(m_device_context, SLOT_CBUFFER_MODEL);
 		model.BindBuffer< Pipeline::PS >(m_device_context, SLOT_CBUFFER_MODEL);
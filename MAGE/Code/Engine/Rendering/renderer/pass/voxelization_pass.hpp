@@ -8,6 +8,7 @@
 #include "renderer\buffer\voxel_grid.hpp"
 #include "renderer\state_manager.hpp"
 #include "resource\rendering_resource_manager.hpp"
+#include "resource\shader\shader_permutation.hpp"
 #include "scene\rendering_world.hpp"
 
 #pragma endregion
@@ -194,11 +195,27 @@ namespace mage::rendering {
 		 */
 		VertexShaderPtr m_vs;
 
+		/**
+		 A pointer to the vertex shader for models with compact vertices of
+		 this voxelization pass.
+		 */
+		VertexShaderPtr m_compact_vs;
+
 		/**
 		 A pointer to the geometry shader of this voxelization pass.
 		 */
 		GeometryShaderPtr m_gs;
 
+		/**
+		 A pointer to the emissive pixel shader of this voxelization pass.
+		 */
+		PixelShaderPtr m_emissive_ps;
+
+		/**
+		 The pixel shaders of this voxelization pass.
+		 */
+		mutable VoxelizationPSCache m_ps;
+
 		/**
 		 A pointer to the compute shader of this voxelization pass.
 		 */
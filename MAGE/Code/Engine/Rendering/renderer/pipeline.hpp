@@ -195,6 +195,47 @@ namespace mage::rendering {
 			CS::BindConstantBuffer(device_context, slot, buffer);
 		}
 
+		/**
+		 Binds a range of a constant buffer to all shader stages.
+
+		 @pre			@a device_context must be a @c D3D11DeviceContext.
+		 @pre			@a slot < @c D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT.
+		 @pre			@a first_constant and @a nb_constants must be
+						multiples of 16.
+		 @param[in,out]	device_context
+						A reference to the device context.
+		 @param[in]		slot
+						The index into the device's zero-based array to set
+						the constant buffer to (ranges from 0 to
+						@c D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT - 1).
+		 @param[in]		buffer
+						A pointer to the constant buffer.
+		 @param[in]		first_constant
+						The offset of the range in the constant buffer (in
+						16-byte constants).
+		 @param[in]		nb_constants
+						The number of 16-byte constants of the range.
+		 */
+		static void BindConstantBuffer(ID3D11DeviceContext& device_context,
+			                           U32 slot,
+			                           ID3D11Buffer* buffer,
+			                           U32 first_constant,
+			                           U32 nb_constants) noexcept {
+
+			VS::BindConstantBuffer(device_context, slot, buffer,
+								   first_constant, nb_constants);
+			HS::BindConstantBuffer(device_context, slot, buffer,
+								   first_constant, nb_constants);
+			DS::BindConstantBuffer(device_context, slot, buffer,
+								   first_constant, nb_constants);
+			GS::BindConstantBuffer(device_context, slot, buffer,
+								   first_constant, nb_constants);
+			PS::BindConstantBuffer(device_context, slot, buffer,
+								   first_constant, nb_constants);
+			CS::BindConstantBuffer(device_context, slot, buffer,
+								   first_constant, nb_constants);
+		}
+
 		/**
 		 Binds an array of constant buffers to all shader stages.
 
@@ -521,6 +562,39 @@ namespace mage::rendering {
 				device_context.VSSetConstantBuffers(slot, nb_buffers, buffers);
 			}
 
+			/**
+			 Binds a range of a constant buffer to the vertex shader stage.
+
+			 @pre			@a device_context must be a @c D3D11DeviceContext.
+			 @pre			@a slot < @c D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT.
+			 @pre			@a first_constant and @a nb_constants must be
+							multiples of 16.
+			 @param[in,out]	device_context
+							A reference to the device context.
+			 @param[in]		slot
+							The index into the device's zero-based array to set
+							the constant buffer to (ranges from 0 to
+							@c D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT - 1).
+			 @param[in]		buffer
+							A pointer to the constant buffer.
+			 @param[in]		first_constant
+							The offset of the range in the constant buffer (in
+							16-byte constants).
+			 @param[in]		nb_constants
+							The number of 16-byte constants of the range.
+			 */
+			static void BindConstantBuffer(ID3D11DeviceContext& device_context,
+				                           U32 slot,
+				                           ID3D11Buffer* buffer,
+				                           U32 first_constant,
+				                           U32 nb_constants) noexcept {
+
+				ID3D11Buffer* const buffers[] = { buffer };
+				static_cast< D3D11DeviceContext& >(device_context)
+					.VSSetConstantBuffers1(slot, 1u, buffers,
+					                       &first_constant, &nb_constants);
+			}
+
 			/**
 			 Binds a shader resource view to the vertex shader stage.
 
@@ -727,6 +801,39 @@ namespace mage::rendering {
 				device_context.HSSetConstantBuffers(slot, nb_buffers, buffers);
 			}
 
+			/**
+			 Binds a range of a constant buffer to the hull shader stage.
+
+			 @pre			@a device_context must be a @c D3D11DeviceContext.
+			 @pre			@a slot < @c D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT.
+			 @pre			@a first_constant and @a nb_constants must be
+							multiples of 16.
+			 @param[in,out]	device_context
+							A reference to the device context.
+			 @param[in]		slot
+							The index into the device's zero-based array to set
+							the constant buffer to (ranges from 0 to
+							@c D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT - 1).
+			 @param[in]		buffer
+							A pointer to the constant buffer.
+			 @param[in]		first_constant
+							The offset of the range in the constant buffer (in
+							16-byte constants).
+			 @param[in]		nb_constants
+							The number of 16-byte constants of the range.
+			 */
+			static void BindConstantBuffer(ID3D11DeviceContext& device_context,
+				                           U32 slot,
+				                           ID3D11Buffer* buffer,
+				                           U32 first_constant,
+				                           U32 nb_constants) noexcept {
+
+				ID3D11Buffer* const buffers[] = { buffer };
+				static_cast< D3D11DeviceContext& >(device_context)
+					.HSSetConstantBuffers1(slot, 1u, buffers,
+					                       &first_constant, &nb_constants);
+			}
+
 			/**
 			 Binds a shader resource view to the hull shader stage.
 
@@ -945,6 +1052,39 @@ namespace mage::rendering {
 				device_context.DSSetConstantBuffers(slot, nb_buffers, buffers);
 			}
 
+			/**
+			 Binds a range of a constant buffer to the domain shader stage.
+
+			 @pre			@a device_context must be a @c D3D11DeviceContext.
+			 @pre			@a slot < @c D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT.
+			 @pre			@a first_constant and @a nb_constants must be
+							multiples of 16.
+			 @param[in,out]	device_context
+							A reference to the device context.
+			 @param[in]		slot
+							The index into the device's zero-based array to set
+							the constant buffer to (ranges from 0 to
+							@c D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT - 1).
+			 @param[in]		buffer
+							A pointer to the constant buffer.
+			 @param[in]		first_constant
+							The offset of the range in the constant buffer (in
+							16-byte constants).
+			 @param[in]		nb_constants
+							The number of 16-byte constants of the range.
+			 */
+			static void BindConstantBuffer(ID3D11DeviceContext& device_context,
+				                           U32 slot,
+				                           ID3D11Buffer* buffer,
+				                           U32 first_constant,
+				                           U32 nb_constants) noexcept {
+
+				ID3D11Buffer* const buffers[] = { buffer };
+				static_cast< D3D11DeviceContext& >(device_context)
+					.DSSetConstantBuffers1(slot, 1u, buffers,
+					                       &first_constant, &nb_constants);
+			}
+
 			/**
 			 Binds a shader resource view to the domain shader stage.
 
@@ -1151,6 +1291,39 @@ namespace mage::rendering {
 				device_context.GSSetConstantBuffers(slot, nb_buffers, buffers);
 			}
 
+			/**
+			 Binds a range of a constant buffer to the geometry shader stage.
+
+			 @pre			@a device_context must be a @c D3D11DeviceContext.
+			 @pre			@a slot < @c D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT.
+			 @pre			@a first_constant and @a nb_constants must be
+							multiples of 16.
+			 @param[in,out]	device_context
+							A reference to the device context.
+			 @param[in]		slot
+							The index into the device's zero-based array to set
+							the constant buffer to (ranges from 0 to
+							@c D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT - 1).
+			 @param[in]		buffer
+							A pointer to the constant buffer.
+			 @param[in]		first_constant
+							The offset of the range in the constant buffer (in
+							16-byte constants).
+			 @param[in]		nb_constants
+							The number of 16-byte constants of the range.
+			 */
+			static void BindConstantBuffer(ID3D11DeviceContext& device_context,
+				                           U32 slot,
+				                           ID3D11Buffer* buffer,
+				                           U32 first_constant,
+				                           U32 nb_constants) noexcept {
+
+				ID3D11Buffer* const buffers[] = { buffer };
+				static_cast< D3D11DeviceContext& >(device_context)
+					.GSSetConstantBuffers1(slot, 1u, buffers,
+					                       &first_constant, &nb_constants);
+			}
+
 			/**
 			 Binds a shader resource view to the geometry shader stage.
 
@@ -1427,6 +1600,39 @@ namespace mage::rendering {
 				device_context.PSSetConstantBuffers(slot, nb_buffers, buffers);
 			}
 
+			/**
+			 Binds a range of a constant buffer to the pixel shader stage.
+
+			 @pre			@a device_context must be a @c D3D11DeviceContext.
+			 @pre			@a slot < @c D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT.
+			 @pre			@a first_constant and @a nb_constants must be
+							multiples of 16.
+			 @param[in,out]	device_context
+							A reference to the device context.
+			 @param[in]		slot
+							The index into the device's zero-based array to set
+							the constant buffer to (ranges from 0 to
+							@c D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT - 1).
+			 @param[in]		buffer
+							A pointer to the constant buffer.
+			 @param[in]		first_constant
+							The offset of the range in the constant buffer (in
+							16-byte constants).
+			 @param[in]		nb_constants
+							The number of 16-byte constants of the range.
+			 */
+			static void BindConstantBuffer(ID3D11DeviceContext& device_context,
+				                           U32 slot,
+				                           ID3D11Buffer* buffer,
+				                           U32 first_constant,
+				                           U32 nb_constants) noexcept {
+
+				ID3D11Buffer* const buffers[] = { buffer };
+				static_cast< D3D11DeviceContext& >(device_context)
+					.PSSetConstantBuffers1(slot, 1u, buffers,
+					                       &first_constant, &nb_constants);
+			}
+
 			/**
 			 Binds a shader resource view to the pixel shader stage.
 
@@ -1816,6 +2022,39 @@ namespace mage::rendering {
 				device_context.CSSetConstantBuffers(slot, nb_buffers, buffers);
 			}
 
+			/**
+			 Binds a range of a constant buffer to the compute shader stage.
+
+			 @pre			@a device_context must be a @c D3D11DeviceContext.
+			 @pre			@a slot < @c D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT.
+			 @pre			@a first_constant and @a nb_constants must be
+							multiples of 16.
+			 @param[in,out]	device_context
+							A reference to the device context.
+			 @param[in]		slot
+							The index into the device's zero-based array to set
+							the constant buffer to (ranges from 0 to
+							@c D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT - 1).
+			 @param[in]		buffer
+							A pointer to the constant buffer.
+			 @param[in]		first_constant
+							The offset of the range in the constant buffer (in
+							16-byte constants).
+			 @param[in]		nb_constants
+							The number of 16-byte constants of the range.
+			 */
+			static void BindConstantBuffer(ID3D11DeviceContext& device_context,
+				                           U32 slot,
+				                           ID3D11Buffer* buffer,
+				                           U32 first_constant,
+				                           U32 nb_constants) noexcept {
+
+				ID3D11Buffer* const buffers[] = { buffer };
+				static_cast< D3D11DeviceContext& >(device_context)
+					.CSSetConstantBuffers1(slot, 1u, buffers,
+					                       &first_constant, &nb_constants);
+			}
+
 			/**
 			 Binds a shader resource view to the compute shader stage.
 
@@ -0,0 +1,413 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "renderer\render_queue.hpp"
+
+// Include HLSL bindings.
+#include "hlsl.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <cstring>
+#include <functional>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	namespace {
+
+		/**
+		 Folds the given pointer to a 16-bit identifier.
+
+		 @param[in]		ptr
+						The pointer.
+		 @return		The 16-bit identifier of the given pointer.
+		 */
+		[[nodiscard]]
+		U32 FoldPointer(const void* ptr) noexcept {
+			auto bits = static_cast< U64 >(reinterpret_cast< std::uintptr_t >(ptr));
+			// Discard the alignment bits.
+			bits >>= 4u;
+			bits ^= bits >> 16u;
+			bits ^= bits >> 32u;
+			return static_cast< U32 >(bits & 0xFFFFu);
+		}
+
+		/**
+		 Returns the 16-bit identifier of the SRVs of the given material.
+
+		 @param[in]		material
+						A reference to the material.
+		 @return		The 16-bit identifier of the SRVs of the given
+						material.
+		 */
+		[[nodiscard]]
+		U32 GetMaterialId(const Material& material) noexcept {
+			return FoldPointer(material.GetBaseColorSRV())
+				^ (FoldPointer(material.GetMaterialSRV()) * 31u)
+				^ (FoldPointer(material.GetNormalSRV())   * 961u);
+		}
+
+		/**
+		 Returns the 24-bit quantized (non-negative) depth of the given depth.
+		 The bit representation of non-negative floating point values is
+		 monotonically increasing.
+
+		 @param[in]		depth
+						The depth.
+		 @return		The 24-bit quantized depth of the given depth.
+		 */
+		[[nodiscard]]
+		U32 QuantizeDepth(F32 depth) noexcept {
+			if (!(0.0f < depth)) {
+				return 0u;
+			}
+
+			U32 bits;
+			std::memcpy(&bits, &depth, sizeof(bits));
+			// The sign bit is zero.
+			return bits >> 7u;
+		}
+
+		/**
+		 Sorts the given draw items on their sort keys (i.e. stable least
+		 significant digit radix sort).
+
+		 @param[in,out]	items
+						A reference to the vector containing the draw items.
+		 @param[in,out]	buffer
+						A reference to the vector used as intermediate
+						buffer.
+		 */
+		void RadixSort(std::vector< DrawItem >& items,
+					   std::vector< DrawItem >& buffer) {
+
+			const auto count = items.size();
+			buffer.resize(count);
+
+			for (U32 shift = 0u; shift < 64u; shift += 8u) {
+				std::array< std::size_t, 256u > offsets = {};
+				for (const auto& item : items) {
+					++offsets[(item.m_key >> shift) & 0xFFu];
+				}
+
+				// Skip the digit if all draw items share it.
+				if (count == offsets[(items[0].m_key >> shift) & 0xFFu]) {
+					continue;
+				}
+
+				std::size_t offset = 0u;
+				for (auto& digit_offset : offsets) {
+					const auto digit_count = digit_offset;
+					digit_offset = offset;
+					offset += digit_count;
+				}
+
+				for (const auto& item : items) {
+					buffer[offsets[(item.m_key >> shift) & 0xFFu]++] = item;
+				}
+
+				items.swap(buffer);
+			}
+		}
+	}
+
+	U64 RenderQueue::MakeOpaqueKey(RenderBucket bucket,
+								   U32 material,
+								   U32 mesh,
+								   F32 depth,
+								   OpaqueOrder order) noexcept {
+
+		const auto permutation = static_cast< U64 >(bucket)
+			                   - static_cast< U64 >(RenderBucket::OpaqueEmissive);
+
+		if (OpaqueOrder::FrontToBack == order) {
+			// | bucket: 4 | depth: 24 | material: 16 | mesh: 16 | permutation: 4 |
+			return (static_cast< U64 >(bucket)               << 60u)
+				 | (static_cast< U64 >(QuantizeDepth(depth)) << 36u)
+				 | (static_cast< U64 >(material & 0xFFFFu)   << 20u)
+				 | (static_cast< U64 >(mesh     & 0xFFFFu)   <<  4u)
+				 | permutation;
+		}
+
+		// | bucket: 4 | material: 16 | mesh: 16 | depth: 24 | permutation: 4 |
+		return (static_cast< U64 >(bucket)               << 60u)
+			 | (static_cast< U64 >(material & 0xFFFFu)   << 44u)
+			 | (static_cast< U64 >(mesh     & 0xFFFFu)   << 28u)
+			 | (static_cast< U64 >(QuantizeDepth(depth)) <<  4u)
+			 | permutation;
+	}
+
+	U64 RenderQueue::MakeTransparentKey(RenderPermutation permutation,
+										U32 material,
+										U32 mesh,
+										F32 depth) noexcept {
+
+		// Invert the depth to sort back-to-front.
+		const auto inverted_depth = 0xFFFFFFu - QuantizeDepth(depth);
+
+		// | bucket: 4 | inverted depth: 24 | material: 16 | mesh: 16 | permutation: 4 |
+		return (static_cast< U64 >(RenderBucket::Transparent) << 60u)
+			 | (static_cast< U64 >(inverted_depth)            << 36u)
+			 | (static_cast< U64 >(material & 0xFFFFu)        << 20u)
+			 | (static_cast< U64 >(mesh     & 0xFFFFu)        <<  4u)
+			 | static_cast< U64 >(permutation);
+	}
+
+	bool RenderQueue::CanInstance(const Model& lhs, const Model& rhs) noexcept {
+		using std::cbegin;
+		using std::cend;
+
+		if (lhs.GetMesh()               != rhs.GetMesh()
+			|| lhs.GetStartIndex()      != rhs.GetStartIndex()
+			|| lhs.GetNumberOfIndices() != rhs.GetNumberOfIndices()
+			|| lhs.GetIndexFormat()     != rhs.GetIndexFormat()
+			|| lhs.GetBaseVertex()      != rhs.GetBaseVertex()) {
+			return false;
+		}
+
+		const auto& lhs_material = lhs.GetMaterial();
+		const auto& rhs_material = rhs.GetMaterial();
+
+		// The material data is shared by all instances.
+		return lhs_material.GetBaseColorSRV() == rhs_material.GetBaseColorSRV()
+			&& lhs_material.GetMaterialSRV()  == rhs_material.GetMaterialSRV()
+			&& lhs_material.GetNormalSRV()    == rhs_material.GetNormalSRV()
+			&& lhs_material.GetRoughness()    == rhs_material.GetRoughness()
+			&& lhs_material.GetMetalness()    == rhs_material.GetMetalness()
+			&& lhs_material.GetRadiance()     == rhs_material.GetRadiance()
+			&& lhs_material.IsEmissive()      == rhs_material.IsEmissive()
+			&& lhs_material.IsTransparant()   == rhs_material.IsTransparant()
+			&& std::equal(cbegin(lhs_material.GetBaseColor()),
+						  cend(lhs_material.GetBaseColor()),
+						  cbegin(rhs_material.GetBaseColor()));
+	}
+
+	RenderQueue::RenderQueue()
+		: m_candidates(),
+		m_models(),
+		m_culled_models(),
+		m_items(),
+		m_buffer(),
+		m_offsets{},
+		m_batches(),
+		m_batch_offsets{},
+		m_instances() {}
+
+	RenderQueue::RenderQueue(const RenderQueue& queue) = default;
+
+	RenderQueue::RenderQueue(RenderQueue&& queue) noexcept = default;
+
+	RenderQueue::~RenderQueue() = default;
+
+	RenderQueue& RenderQueue::operator=(const RenderQueue& queue) = default;
+
+	RenderQueue& RenderQueue::operator=(RenderQueue&& queue) noexcept = default;
+
+	void XM_CALLCONV RenderQueue::Build(const World& world,
+										JobSystem& job_system,
+										FXMMATRIX world_to_camera,
+										CXMMATRIX camera_to_projection,
+										OpaqueOrder order) {
+		Clear();
+
+		const auto world_to_projection = world_to_camera * camera_to_projection;
+
+		// Apply view frustum culling by querying the model hierarchy.
+		const BoundingFrustum frustum(world_to_projection);
+		world.ForEachActiveModel(frustum, [this](const Model& model) {
+			m_candidates.push_back({ &model, {}, 0u });
+		});
+
+		// Restore the storage order of the models (i.e. the order of the
+		// active models).
+		std::sort(m_candidates.begin(), m_candidates.end(),
+				  [](const Candidate& lhs, const Candidate& rhs) noexcept {
+					  return std::less<>()(lhs.m_model, rhs.m_model);
+				  });
+
+		// Generate the keys of the visible models in parallel. Each job only
+		// writes its own candidates.
+		job_system.ParallelFor(m_candidates.size(), [this, world_to_camera, order]
+		(std::size_t index) {
+
+			auto& candidate     = m_candidates[index];
+			const auto& model   = *candidate.m_model;
+
+			const auto& transform       = model.GetOwner()->GetTransform();
+			const auto  object_to_world = transform.GetObjectToWorldMatrix();
+
+			const auto& material     = model.GetMaterial();
+			const auto  alpha        = material.GetBaseColor()[3];
+			const auto  opaque       = (TRANSPARENCY_THRESHOLD <= alpha);
+			const auto  transparent  = material.IsTransparant()
+				                    && (TRANSPARENCY_SHADOW_THRESHOLD <= alpha);
+
+			if (!opaque && !transparent) {
+				return;
+			}
+
+			const auto  object_to_camera = object_to_world * world_to_camera;
+			const auto  p_camera         = XMVector3TransformCoord(
+				model.GetAABB().Centroid(), object_to_camera);
+			const auto  depth            = XMVectorGetZ(p_camera);
+
+			const auto  material_id  = GetMaterialId(material);
+			const auto  mesh_id      = FoldPointer(model.GetMesh());
+			const auto  emissive     = material.IsEmissive();
+			const auto  tsnm         = (nullptr != material.GetNormalSRV());
+
+			if (opaque) {
+				const auto bucket = emissive ? RenderBucket::OpaqueEmissive
+					              : (tsnm ? RenderBucket::OpaqueTSNM
+					                      : RenderBucket::Opaque);
+				candidate.m_keys[candidate.m_nb_keys++]
+					= MakeOpaqueKey(bucket, material_id, mesh_id, depth, order);
+			}
+
+			if (transparent) {
+				const auto permutation = emissive ? RenderPermutation::Emissive
+					                   : (tsnm ? RenderPermutation::TSNM
+					                           : RenderPermutation::Default);
+				candidate.m_keys[candidate.m_nb_keys++]
+					= MakeTransparentKey(permutation, material_id, mesh_id, depth);
+			}
+		});
+
+		// Merge the candidates in the order of the active models.
+		m_culled_models.reserve(m_candidates.size());
+		for (const auto& candidate : m_candidates) {
+			m_culled_models.push_back(candidate.m_model);
+
+			if (0u == candidate.m_nb_keys) {
+				continue;
+			}
+
+			const auto index = AddModel(*candidate.m_model);
+			for (U32 i = 0u; i < candidate.m_nb_keys; ++i) {
+				AddDrawItem(index, candidate.m_keys[i]);
+			}
+		}
+
+		Sort();
+		Batch();
+	}
+
+	void RenderQueue::Clear() noexcept {
+		m_candidates.clear();
+		m_models.clear();
+		m_culled_models.clear();
+		m_items.clear();
+		m_offsets.fill(0u);
+		m_batches.clear();
+		m_batch_offsets.fill(0u);
+		m_instances.clear();
+	}
+
+	U32 RenderQueue::AddModel(const Model& model) {
+		const auto index = static_cast< U32 >(m_models.size());
+		m_models.push_back(&model);
+		return index;
+	}
+
+	void RenderQueue::AddDrawItem(U32 model, U64 key) {
+		m_items.push_back({ key, model });
+	}
+
+	void RenderQueue::Sort() {
+		using std::cbegin;
+		using std::cend;
+
+		if (!m_items.empty()) {
+			RadixSort(m_items, m_buffer);
+		}
+
+		// The render bucket occupies the most significant bits of the sort
+		// key: each render bucket is a contiguous range of draw items.
+		for (std::size_t i = 0u; i < m_offsets.size(); ++i) {
+			const auto key = static_cast< U64 >(i) << 60u;
+			const auto it  = std::lower_bound(cbegin(m_items), cend(m_items), key,
+				[](const DrawItem& item, U64 value) noexcept {
+					return item.m_key < value;
+				});
+
+			m_offsets[i] = static_cast< std::size_t >(it - cbegin(m_items));
+		}
+	}
+
+	void RenderQueue::Batch() {
+		using std::size;
+
+		m_batches.clear();
+		m_instances.clear();
+
+		for (std::size_t i = 0u; i + 1u < m_offsets.size(); ++i) {
+			m_batch_offsets[i] = size(m_batches);
+
+			// The draw items are sorted on material and mesh: the models of
+			// an instance batch are consecutive.
+			auto       first = m_offsets[i];
+			const auto last  = m_offsets[i + 1u];
+			while (first < last) {
+				const auto& model = GetModel(m_items[first]);
+
+				auto end = first + 1u;
+				while (end < last && CanInstance(model, GetModel(m_items[end]))) {
+					++end;
+				}
+
+				InstanceBatch batch = {
+					static_cast< U32 >(first),
+					static_cast< U32 >(end - first),
+					static_cast< U32 >(size(m_instances))
+				};
+
+				// Pack the model buffer data of the instances.
+				if (1u < batch.m_count) {
+					for (auto j = first; j < end; ++j) {
+						m_instances.push_back(GetModel(m_items[j]).GetBufferData());
+					}
+				}
+
+				m_batches.push_back(batch);
+				first = end;
+			}
+		}
+
+		m_batch_offsets.back() = size(m_batches);
+	}
+
+	gsl::span< const DrawItem > RenderQueue::GetDrawItems(RenderBucket bucket)
+		const noexcept {
+
+		const auto index = static_cast< std::size_t >(bucket);
+		const auto first = m_offsets[index];
+		const auto last  = m_offsets[index + 1u];
+
+		return { m_items.data() + first,
+				 static_cast< std::ptrdiff_t >(last - first) };
+	}
+
+	gsl::span< const InstanceBatch > RenderQueue::GetInstanceBatches(RenderBucket bucket)
+		const noexcept {
+
+		const auto index = static_cast< std::size_t >(bucket);
+		const auto first = m_batch_offsets[index];
+		const auto last  = m_batch_offsets[index + 1u];
+
+		return { m_batches.data() + first,
+				 static_cast< std::ptrdiff_t >(last - first) };
+	}
+}
\ No newline at end of file
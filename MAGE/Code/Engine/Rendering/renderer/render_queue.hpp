@@ -0,0 +1,535 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "renderer\configuration.hpp"
+#include "scene\rendering_world.hpp"
+#include "collection\vector.hpp"
+#include "parallel\job_system.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <array>
+#include <gsl\span>
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	//-------------------------------------------------------------------------
+	// RenderBucket
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 An enumeration of the different render buckets. Each opaque render
+	 bucket corresponds to a pixel shader permutation (emissive, no TSNM or
+	 TSNM). The transparent models share a single render bucket in order to
+	 be drawn back-to-front.
+	 */
+	enum class RenderBucket : U8 {
+		OpaqueEmissive = 0,
+		Opaque,
+		OpaqueTSNM,
+		Transparent,
+		Count
+	};
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// RenderPermutation
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 An enumeration of the different pixel shader permutations of draw items.
+	 */
+	enum class RenderPermutation : U8 {
+		Emissive = 0,
+		Default,
+		TSNM,
+		Count
+	};
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// DrawItem
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A struct of draw items.
+	 */
+	struct DrawItem {
+
+		/**
+		 The sort key of this draw item.
+		 */
+		U64 m_key;
+
+		/**
+		 The index of the model of this draw item in the render queue.
+		 */
+		U32 m_model;
+	};
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// InstanceBatch
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A struct of instance batches.
+
+	 An instance batch is a range of consecutive draw items of the same
+	 render bucket whose models share the same mesh, submesh and material.
+	 An instance batch is drawn with a single (instanced) draw call.
+	 */
+	struct InstanceBatch {
+
+		/**
+		 The index of the first draw item of this instance batch in the
+		 render queue.
+		 */
+		U32 m_first;
+
+		/**
+		 The number of draw items of this instance batch.
+		 */
+		U32 m_count;
+
+		/**
+		 The index of the first instance of this instance batch in the
+		 instances of the render queue. Only valid if this instance batch
+		 contains more than one draw item.
+		 */
+		U32 m_instance_start;
+	};
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// RenderQueue
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A class of render queues.
+
+	 A render queue is built once per camera. It culls each model once and
+	 emits one draw item per render bucket the model belongs to. The draw
+	 items are sorted on a 64-bit key such that each render bucket is a
+	 contiguous range of draw items. Within the opaque render buckets, the
+	 draw items are sorted on (material, mesh, depth) for the fewest state
+	 changes or on (depth, material, mesh) for the most early-Z rejections.
+	 Within the transparent render bucket, the draw items are sorted
+	 back-to-front on (inverted depth, material, mesh).
+
+	 Apart from @c Build, render queues do not access the GPU.
+	 */
+	class RenderQueue {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Class Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the sort key for the given opaque draw item data.
+
+		 @pre			@a bucket must be an opaque render bucket.
+		 @param[in]		bucket
+						The render bucket.
+		 @param[in]		material
+						The material identifier (only the 16 least
+						significant bits are used).
+		 @param[in]		mesh
+						The mesh identifier (only the 16 least significant
+						bits are used).
+		 @param[in]		depth
+						The (non-negative) view space depth.
+		 @param[in]		order
+						The draw order of the opaque draw items.
+		 @return		The sort key for the given opaque draw item data.
+		 */
+		[[nodiscard]]
+		static U64 MakeOpaqueKey(RenderBucket bucket,
+								 U32 material,
+								 U32 mesh,
+								 F32 depth,
+								 OpaqueOrder order) noexcept;
+
+		/**
+		 Returns the sort key for the given transparent draw item data.
+
+		 @param[in]		permutation
+						The pixel shader permutation.
+		 @param[in]		material
+						The material identifier (only the 16 least
+						significant bits are used).
+		 @param[in]		mesh
+						The mesh identifier (only the 16 least significant
+						bits are used).
+		 @param[in]		depth
+						The (non-negative) view space depth.
+		 @return		The sort key for the given transparent draw item
+						data.
+		 */
+		[[nodiscard]]
+		static U64 MakeTransparentKey(RenderPermutation permutation,
+									  U32 material,
+									  U32 mesh,
+									  F32 depth) noexcept;
+
+		/**
+		 Returns the render bucket of the given sort key.
+
+		 @param[in]		key
+						The sort key.
+		 @return		The render bucket of the given sort key.
+		 */
+		[[nodiscard]]
+		static RenderBucket GetBucket(U64 key) noexcept {
+			return static_cast< RenderBucket >(key >> 60u);
+		}
+
+		/**
+		 Returns the pixel shader permutation of the given sort key.
+
+		 @param[in]		key
+						The sort key.
+		 @return		The pixel shader permutation of the given sort key.
+		 */
+		[[nodiscard]]
+		static RenderPermutation GetPermutation(U64 key) noexcept {
+			return static_cast< RenderPermutation >(key & 0xFu);
+		}
+
+		/**
+		 Checks whether the given models can be drawn with a single instanced
+		 draw call (i.e. the models share the same mesh, submesh and
+		 material).
+
+		 @param[in]		lhs
+						A reference to the first model.
+		 @param[in]		rhs
+						A reference to the second model.
+		 @return		@c true if the given models can be drawn with a
+						single instanced draw call. @c false otherwise.
+		 */
+		[[nodiscard]]
+		static bool CanInstance(const Model& lhs, const Model& rhs) noexcept;
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a render queue.
+		 */
+		RenderQueue();
+
+		/**
+		 Constructs a render queue from the given render queue.
+
+		 @param[in]		queue
+						A reference to the render queue to copy.
+		 */
+		RenderQueue(const RenderQueue& queue);
+
+		/**
+		 Constructs a render queue by moving the given render queue.
+
+		 @param[in]		queue
+						A reference to the render queue to move.
+		 */
+		RenderQueue(RenderQueue&& queue) noexcept;
+
+		/**
+		 Destructs this render queue.
+		 */
+		~RenderQueue();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given render queue to this render queue.
+
+		 @param[in]		queue
+						A reference to the render queue to copy.
+		 @return		A reference to the copy of the given render queue
+						(i.e. this render queue).
+		 */
+		RenderQueue& operator=(const RenderQueue& queue);
+
+		/**
+		 Moves the given render queue to this render queue.
+
+		 @param[in]		queue
+						A reference to the render queue to move.
+		 @return		A reference to the moved render queue (i.e. this
+						render queue).
+		 */
+		RenderQueue& operator=(RenderQueue&& queue) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Builds this render queue from the active models of the given world.
+		 The models are culled by querying the model hierarchy of the world
+		 and the visible models are added in the order of the active models.
+		 The draw items are sorted and grouped into instance batches.
+
+		 @pre			The model hierarchy of the given world is up-to-date.
+
+		 @param[in]		world
+						A reference to the world.
+		 @param[in,out]	job_system
+						A reference to the job system.
+		 @param[in]		world_to_camera
+						The world-to-camera transformation matrix.
+		 @param[in]		camera_to_projection
+						The camera-to-projection transformation matrix.
+		 @param[in]		order
+						The draw order of the opaque models.
+		 */
+		void XM_CALLCONV Build(const World& world,
+							   JobSystem& job_system,
+							   FXMMATRIX world_to_camera,
+							   CXMMATRIX camera_to_projection,
+							   OpaqueOrder order = OpaqueOrder::Material);
+
+		/**
+		 Clears this render queue.
+		 */
+		void Clear() noexcept;
+
+		/**
+		 Adds the given model to this render queue.
+
+		 @param[in]		model
+						A reference to the model.
+		 @return		The index of the model in this render queue.
+		 */
+		U32 AddModel(const Model& model);
+
+		/**
+		 Adds a draw item to this render queue.
+
+		 @pre			@a model must be the index of a model in this render
+						queue.
+		 @param[in]		model
+						The index of the model in this render queue.
+		 @param[in]		key
+						The sort key.
+		 */
+		void AddDrawItem(U32 model, U64 key);
+
+		/**
+		 Sorts the draw items of this render queue.
+		 */
+		void Sort();
+
+		/**
+		 Groups the consecutive draw items of each render bucket of this
+		 render queue into instance batches.
+
+		 @pre			This render queue must be sorted.
+		 */
+		void Batch();
+
+		/**
+		 Returns the visible models of this render queue which have at least
+		 one draw item.
+
+		 @return		The visible models of this render queue which have at
+						least one draw item.
+		 */
+		[[nodiscard]]
+		gsl::span< const Model* const > GetModels() const noexcept {
+			return gsl::make_span(m_models);
+		}
+
+		/**
+		 Returns all visible models of this render queue (i.e. all active
+		 models passing view frustum culling, including the models which are
+		 neither opaque nor transparent) in the order of the active models.
+
+		 @return		All visible models of this render queue.
+		 */
+		[[nodiscard]]
+		gsl::span< const Model* const > GetCulledModels() const noexcept {
+			return gsl::make_span(m_culled_models);
+		}
+
+		/**
+		 Returns the model of the given draw item.
+
+		 @param[in]		item
+						A reference to the draw item.
+		 @return		A reference to the model of the given draw item.
+		 */
+		[[nodiscard]]
+		const Model& GetModel(const DrawItem& item) const noexcept {
+			return *m_models[item.m_model];
+		}
+
+		/**
+		 Returns the draw items of the given render bucket.
+
+		 @pre			This render queue must be sorted.
+		 @param[in]		bucket
+						The render bucket.
+		 @return		The draw items of the given render bucket sorted on
+						their sort keys.
+		 */
+		[[nodiscard]]
+		gsl::span< const DrawItem > GetDrawItems(RenderBucket bucket)
+			const noexcept;
+
+		/**
+		 Returns the draw item at the given index.
+
+		 @pre			@a index must be smaller than the number of draw
+						items of this render queue.
+		 @param[in]		index
+						The index of the draw item in this render queue.
+		 @return		A reference to the draw item at the given index.
+		 */
+		[[nodiscard]]
+		const DrawItem& GetDrawItem(U32 index) const noexcept {
+			return m_items[index];
+		}
+
+		/**
+		 Returns the instance batches of the given render bucket.
+
+		 @pre			This render queue must be batched.
+		 @param[in]		bucket
+						The render bucket.
+		 @return		The instance batches of the given render bucket.
+		 */
+		[[nodiscard]]
+		gsl::span< const InstanceBatch > GetInstanceBatches(RenderBucket bucket)
+			const noexcept;
+
+		/**
+		 Returns the instances of this render queue (i.e. the model buffer
+		 data of all draw items of all instance batches containing more than
+		 one draw item).
+
+		 @return		A reference to the vector containing the instances of
+						this render queue.
+		 */
+		[[nodiscard]]
+		const AlignedVector< ModelBuffer >& GetInstances() const noexcept {
+			return m_instances;
+		}
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		/**
+		 A struct of candidates (i.e. the culling results of a model).
+		 */
+		struct Candidate {
+
+			/**
+			 A pointer to the model of this candidate.
+			 */
+			const Model* m_model;
+
+			/**
+			 The sort keys of the draw items of this candidate.
+			 */
+			U64 m_keys[2];
+
+			/**
+			 The number of draw items of this candidate.
+			 */
+			U32 m_nb_keys;
+		};
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 A vector containing the candidates of this render queue during
+		 building.
+		 */
+		std::vector< Candidate > m_candidates;
+
+		/**
+		 A vector containing the (visible) models of this render queue which
+		 have at least one draw item.
+		 */
+		std::vector< const Model* > m_models;
+
+		/**
+		 A vector containing all visible models of this render queue.
+		 */
+		std::vector< const Model* > m_culled_models;
+
+		/**
+		 A vector containing the draw items of this render queue.
+		 */
+		std::vector< DrawItem > m_items;
+
+		/**
+		 A vector containing the draw items of this render queue during
+		 sorting.
+		 */
+		std::vector< DrawItem > m_buffer;
+
+		/**
+		 An array containing the offsets of the render buckets in the draw
+		 items of this render queue.
+		 */
+		std::array< std::size_t, static_cast< std::size_t >(RenderBucket::Count) + 1u >
+			m_offsets;
+
+		/**
+		 A vector containing the instance batches of this render queue.
+		 */
+		std::vector< InstanceBatch > m_batches;
+
+		/**
+		 An array containing the offsets of the render buckets in the
+		 instance batches of this render queue.
+		 */
+		std::array< std::size_t, static_cast< std::size_t >(RenderBucket::Count) + 1u >
+			m_batch_offsets;
+
+		/**
+		 A vector containing the instances of this render queue.
+		 */
+		AlignedVector< ModelBuffer > m_instances;
+	};
+
+	#pragma endregion
+}
\ No newline at end of file
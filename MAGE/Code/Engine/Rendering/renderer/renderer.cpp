@@ -5,6 +5,7 @@
 
 #include "renderer\renderer.hpp"
 #include "renderer\output_manager.hpp"
+#include "renderer\render_queue.hpp"
 #include "renderer\pass\aa_pass.hpp"
 #include "renderer\pass\back_buffer_pass.hpp"
 #include "renderer\pass\bounding_volume_pass.hpp"
@@ -17,6 +18,8 @@
 #include "renderer\pass\sprite_pass.hpp"
 #include "renderer\pass\voxelization_pass.hpp"
 #include "renderer\pass\voxel_grid_pass.hpp"
+#include "renderer\buffer\constant_buffer.hpp"
+#include "renderer\buffer\constant_buffer_allocator.hpp"
 #include "renderer\buffer\scene_buffer.hpp"
 #include "ImGui\imgui_impl_dx11.h"
 
@@ -59,12 +62,15 @@ namespace mage::rendering {
 						A reference to the swap chain.
 		 @param[in,out]	resource_manager
 						A pointer to the resource manager.
+		 @param[in,out]	job_system
+						A reference to the job system.
 		 */
 		explicit Impl(ID3D11Device& device,
 					  ID3D11DeviceContext& device_context,
 					  DisplayConfiguration& display_configuration,
 					  SwapChain& swap_chain,
-					  ResourceManager& resource_manager);
+					  ResourceManager& resource_manager,
+					  JobSystem& job_system);
 
 		/**
 		 Constructs a renderer from the given renderer.
@@ -160,10 +166,7 @@ namespace mage::rendering {
 									 const Camera& camera,
 									 FXMMATRIX world_to_projection);
 
-		void XM_CALLCONV RenderFalseColor(const World& world,
-										  const Camera& camera,
-										  FXMMATRIX world_to_projection,
-										  FalseColor false_color);
+		void RenderFalseColor(const Camera& camera, FalseColor false_color);
 
 		void XM_CALLCONV RenderVoxelGrid(const World& world,
 										 const Camera& camera,
@@ -197,6 +200,11 @@ namespace mage::rendering {
 		 */
 		std::reference_wrapper< ResourceManager > m_resource_manager;
 
+		/**
+		 A reference to the job system of this renderer.
+		 */
+		std::reference_wrapper< JobSystem > m_job_system;
+
 		/**
 		 A pointer to the output manager of this rendering manager.
 		 */
@@ -216,6 +224,21 @@ namespace mage::rendering {
 		 */
 		ConstantBuffer< WorldBuffer > m_world_buffer;
 
+		/**
+		 The constant buffer allocator of this renderer for the per-frame
+		 camera and model buffers.
+		 */
+		ConstantBufferAllocator m_constant_buffer_allocator;
+
+		//---------------------------------------------------------------------
+		// Member Variables: Render Queues
+		//---------------------------------------------------------------------
+
+		/**
+		 The render queue of the camera being rendered by this renderer.
+		 */
+		RenderQueue m_render_queue;
+
 		//---------------------------------------------------------------------
 		// Member Variables: Render Passes
 		//---------------------------------------------------------------------
@@ -285,16 +308,20 @@ namespace mage::rendering {
 						 ID3D11DeviceContext& device_context,
 						 DisplayConfiguration& display_configuration,
 						 SwapChain& swap_chain,
-						 ResourceManager& resource_manager)
+						 ResourceManager& resource_manager,
+						 JobSystem& job_system)
 		: m_display_configuration(display_configuration),
 		m_device(device),
 		m_device_context(device_context),
 		m_resource_manager(resource_manager),
+		m_job_system(job_system),
 		m_output_manager(MakeUnique< OutputManager >(device,
 													 display_configuration,
 													 swap_chain)),
 		m_state_manager(MakeUnique< StateManager >(device)),
 		m_world_buffer(device),
+		m_constant_buffer_allocator(device),
+		m_render_queue(),
 		m_aa_pass(),
 		m_back_buffer_pass(),
 		m_bounding_volume_pass(),
@@ -348,7 +375,8 @@ namespace mage::rendering {
 		m_lbuffer_pass = MakeUnique< LBufferPass >(m_device,
 												   m_device_context,
 												   *m_state_manager.get(),
-												   m_resource_manager);
+												   m_resource_manager,
+												   m_job_system);
 
 		m_postprocess_pass = MakeUnique< PostProcessPass >(m_device_context,
 														   *m_state_manager.get(),
@@ -380,6 +408,8 @@ namespace mage::rendering {
 	void Renderer::Impl::Render(const World& world, const GameTime& time) {
 		// Update the buffers.
 		UpdateBuffers(world, time);
+		// Update the model hierarchy (before any culling).
+		world.UpdateModelHierarchy();
 
 		// Bind the world buffer.
 		m_world_buffer.Bind< Pipeline >(m_device_context, SLOT_CBUFFER_WORLD);
@@ -387,11 +417,7 @@ namespace mage::rendering {
 		m_output_manager->BindBegin(m_device_context);
 
 		// Render the world for each camera.
-		world.ForEach< Camera >([this, &world](const Camera& camera) {
-			if (State::Active != camera.GetState()) {
-				return;
-			}
-
+		world.ForEachActive< Camera >([this, &world](const Camera& camera) {
 			// Render the world.
 			Render(world, camera);
 		});
@@ -425,20 +451,30 @@ namespace mage::rendering {
 		// Update the world buffer.
 		UpdateWorldBuffer(time);
 
+		// Map the constant buffer allocator once for all cameras and models.
+		m_constant_buffer_allocator.Begin(m_device_context);
+
 		// Update the buffer of each camera.
-		world.ForEach< Camera >([this](const Camera& camera) {
-			if (State::Active == camera.GetState()) {
-				camera.UpdateBuffer(m_device_context,
-									m_display_configuration.get().GetAA());
-			}
+		world.ForEachActive< Camera >([this](const Camera& camera) {
+			camera.UpdateBuffer(m_device_context,
+								m_constant_buffer_allocator,
+								m_display_configuration.get().GetAA());
+		});
+
+		// Pack the buffer data of each model in parallel. The transforms are
+		// validated by the scene (i.e. their getters only read), and each
+		// model only caches its own buffer data.
+		world.ForEachActive< Model >(m_job_system,
+									 [](const Model& model, std::size_t) {
+			[[maybe_unused]] const auto& data = model.GetBufferData();
 		});
 
 		// Update the buffer of each model.
-		world.ForEach< Model >([this](const Model& model) {
-			if (State::Active == model.GetState()) {
-				model.UpdateBuffer(m_device_context);
-			}
+		world.ForEachActive< Model >([this](const Model& model) {
+			model.UpdateBuffer(m_device_context, m_constant_buffer_allocator);
 		});
+
+		m_constant_buffer_allocator.End(m_device_context);
 	}
 
 	void Renderer::Impl::UpdateWorldBuffer(const GameTime& time) {
@@ -503,6 +539,12 @@ namespace mage::rendering {
 		const auto  world_to_projection  = world_to_camera * camera_to_projection;
 
 		const auto  render_mode          = camera.GetSettings().GetRenderMode();
+		const auto  opaque_order         = camera.GetSettings().GetOpaqueOrder();
+
+		// Cull and sort the models of the world once for this camera.
+		m_render_queue.Build(world, m_job_system, world_to_camera,
+							 camera_to_projection, opaque_order);
+		m_forward_pass->UpdateInstances(m_render_queue);
 
 		m_output_manager->BindBeginViewport(m_device_context);
 
@@ -532,88 +574,71 @@ namespace mage::rendering {
 		}
 
 		case RenderMode::FalseColor_BaseColor: {
-			RenderFalseColor(world, camera, world_to_projection,
-							 FalseColor::BaseColor);
+			RenderFalseColor(camera, FalseColor::BaseColor);
 			break;
 		}
 		case RenderMode::FalseColor_BaseColorCoefficient: {
-			RenderFalseColor(world, camera, world_to_projection,
-							 FalseColor::BaseColorCoefficient);
+			RenderFalseColor(camera, FalseColor::BaseColorCoefficient);
 			break;
 		}
 		case RenderMode::FalseColor_BaseColorTexture: {
-			RenderFalseColor(world, camera, world_to_projection,
-							 FalseColor::BaseColorTexture);
+			RenderFalseColor(camera, FalseColor::BaseColorTexture);
 			break;
 		}
 		case RenderMode::FalseColor_Material: {
-			RenderFalseColor(world, camera, world_to_projection,
-							 FalseColor::Material);
+			RenderFalseColor(camera, FalseColor::Material);
 			break;
 		}
 		case RenderMode::FalseColor_MaterialCoefficient: {
-			RenderFalseColor(world, camera, world_to_projection,
-							 FalseColor::MaterialCoefficient);
+			RenderFalseColor(camera, FalseColor::MaterialCoefficient);
 			break;
 		}
 		case RenderMode::FalseColor_MaterialTexture: {
-			RenderFalseColor(world, camera, world_to_projection,
-							 FalseColor::MaterialTexture);
+			RenderFalseColor(camera, FalseColor::MaterialTexture);
 			break;
 		}
 		case RenderMode::FalseColor_Roughness: {
-			RenderFalseColor(world, camera, world_to_projection,
-							 FalseColor::Roughness);
+			RenderFalseColor(camera, FalseColor::Roughness);
 			break;
 		}
 		case RenderMode::FalseColor_RoughnessCoefficient: {
-			RenderFalseColor(world, camera, world_to_projection,
-							 FalseColor::RoughnessCoefficient);
+			RenderFalseColor(camera, FalseColor::RoughnessCoefficient);
 			break;
 		}
 		case RenderMode::FalseColor_RoughnessTexture: {
-			RenderFalseColor(world, camera, world_to_projection,
-							 FalseColor::RoughnessTexture);
+			RenderFalseColor(camera, FalseColor::RoughnessTexture);
 			break;
 		}
 		case RenderMode::FalseColor_Metalness: {
-			RenderFalseColor(world, camera, world_to_projection,
-							 FalseColor::Metalness);
+			RenderFalseColor(camera, FalseColor::Metalness);
 			break;
 		}
 		case RenderMode::FalseColor_MetalnessCoefficient: {
-			RenderFalseColor(world, camera, world_to_projection,
-							 FalseColor::MetalnessCoefficient);
+			RenderFalseColor(camera, FalseColor::MetalnessCoefficient);
 			break;
 		}
 		case RenderMode::FalseColor_MetalnessTexture: {
-			RenderFalseColor(world, camera, world_to_projection,
-							 FalseColor::MetalnessTexture);
+			RenderFalseColor(camera, FalseColor::MetalnessTexture);
 			break;
 		}
 		case RenderMode::FalseColor_ShadingNormal: {
-			RenderFalseColor(world, camera, world_to_projection,
-							 FalseColor::ShadingNormal);
+			RenderFalseColor(camera, FalseColor::ShadingNormal);
 			break;
 		}
 		case RenderMode::FalseColor_TSNMShadingNormal: {
-			RenderFalseColor(world, camera, world_to_projection,
-							 FalseColor::TSNMShadingNormal);
+			RenderFalseColor(camera, FalseColor::TSNMShadingNormal);
 			break;
 		}
 		case RenderMode::FalseColor_Depth: {
-			RenderFalseColor(world, camera, world_to_projection,
-							 FalseColor::Depth);
+			RenderFalseColor(camera, FalseColor::Depth);
 			break;
 		}
 		case RenderMode::FalseColor_Distance: {
-			RenderFalseColor(world, camera, world_to_projection,
-							 FalseColor::Distance);
+			RenderFalseColor(camera, FalseColor::Distance);
 			break;
 		}
 		case RenderMode::FalseColor_UV: {
-			RenderFalseColor(world, camera, world_to_projection,
-							 FalseColor::UV);
+			RenderFalseColor(camera, FalseColor::UV);
 			break;
 		}
 
@@ -633,7 +658,7 @@ namespace mage::rendering {
 		//---------------------------------------------------------------------
 		const auto& settings = camera.GetSettings();
 		if (settings.ContainsRenderLayer(RenderLayer::Wireframe)) {
-			m_forward_pass->RenderWireframe(world, world_to_projection);
+			m_forward_pass->RenderWireframe(m_render_queue);
 		}
 		if (settings.ContainsRenderLayer(RenderLayer::AABB)) {
 			m_bounding_volume_pass->Render(world, world_to_projection);
@@ -666,7 +691,7 @@ namespace mage::rendering {
 				= VoxelizationSettings::GetWorldToVoxelMatrix();
 
 			// TODO: world_to_projection + world_to_voxel for culling
-			m_lbuffer_pass->Render(world, world_to_projection);
+			m_lbuffer_pass->Render(world, camera, world_to_projection);
 
 			const auto voxel_grid_resolution
 				= VoxelizationSettings::GetVoxelGridResolution();
@@ -675,7 +700,7 @@ namespace mage::rendering {
 										voxel_grid_resolution);
 		}
 		else {
-			m_lbuffer_pass->Render(world, world_to_projection);
+			m_lbuffer_pass->Render(world, camera, world_to_projection);
 		}
 
 		const Viewport viewport(camera.GetViewport(),
@@ -696,7 +721,7 @@ namespace mage::rendering {
 		//---------------------------------------------------------------------
 		// Forward: opaque fragments
 		//---------------------------------------------------------------------
-		m_forward_pass->Render(world, world_to_projection,
+		m_forward_pass->Render(m_render_queue,
 							   camera.GetSettings().GetBRDF(), vct);
 
 		//---------------------------------------------------------------------
@@ -707,7 +732,7 @@ namespace mage::rendering {
 		//---------------------------------------------------------------------
 		// Forward: transparent fragments
 		//---------------------------------------------------------------------
-		m_forward_pass->RenderTransparent(world, world_to_projection,
+		m_forward_pass->RenderTransparent(m_render_queue,
 										  camera.GetSettings().GetBRDF(), vct);
 	}
 
@@ -725,7 +750,7 @@ namespace mage::rendering {
 				= VoxelizationSettings::GetWorldToVoxelMatrix();
 
 			// TODO: world_to_projection + world_to_voxel for culling
-			m_lbuffer_pass->Render(world, world_to_projection);
+			m_lbuffer_pass->Render(world, camera, world_to_projection);
 
 			const auto voxel_grid_resolution
 				= VoxelizationSettings::GetVoxelGridResolution();
@@ -734,7 +759,7 @@ namespace mage::rendering {
 										voxel_grid_resolution);
 		}
 		else {
-			m_lbuffer_pass->Render(world, world_to_projection);
+			m_lbuffer_pass->Render(world, camera, world_to_projection);
 		}
 
 		const Viewport viewport(camera.GetViewport(),
@@ -745,7 +770,7 @@ namespace mage::rendering {
 		//---------------------------------------------------------------------
 		// GBuffer: opaque fragments
 		//---------------------------------------------------------------------
-		m_forward_pass->RenderGBuffer(world, world_to_projection);
+		m_forward_pass->RenderGBuffer(m_render_queue);
 
 		m_output_manager->BindEndGBuffer(m_device_context);
 		m_output_manager->BindBeginDeferred(m_device_context);
@@ -767,7 +792,7 @@ namespace mage::rendering {
 		//---------------------------------------------------------------------
 		// Forward: emissive fragments.
 		//---------------------------------------------------------------------
-		m_forward_pass->RenderEmissive(world, world_to_projection);
+		m_forward_pass->RenderEmissive(m_render_queue);
 
 		//---------------------------------------------------------------------
 		// Perform a sky pass.
@@ -777,7 +802,7 @@ namespace mage::rendering {
 		//---------------------------------------------------------------------
 		// Forward: transparent fragments
 		//---------------------------------------------------------------------
-		m_forward_pass->RenderTransparent(world, world_to_projection,
+		m_forward_pass->RenderTransparent(m_render_queue,
 										  camera.GetSettings().GetBRDF(), vct);
 	}
 
@@ -788,7 +813,7 @@ namespace mage::rendering {
 		//---------------------------------------------------------------------
 		// LBuffer
 		//---------------------------------------------------------------------
-		m_lbuffer_pass->Render(world, world_to_projection);
+		m_lbuffer_pass->Render(world, camera, world_to_projection);
 
 		const Viewport viewport(camera.GetViewport(),
 								m_display_configuration.get().GetAA());
@@ -798,13 +823,11 @@ namespace mage::rendering {
 		//---------------------------------------------------------------------
 		// Forward
 		//---------------------------------------------------------------------
-		m_forward_pass->RenderSolid(world, world_to_projection);
+		m_forward_pass->RenderSolid(m_render_queue);
 	}
 
-	void XM_CALLCONV Renderer::Impl::RenderFalseColor(const World& world,
-													  const Camera& camera,
-													  FXMMATRIX world_to_projection,
-													  FalseColor false_color) {
+	void Renderer::Impl::RenderFalseColor(const Camera& camera,
+										  FalseColor false_color) {
 
 		const Viewport viewport(camera.GetViewport(),
 								m_display_configuration.get().GetAA());
@@ -814,7 +837,7 @@ namespace mage::rendering {
 		//---------------------------------------------------------------------
 		// Forward
 		//---------------------------------------------------------------------
-		m_forward_pass->RenderFalseColor(world, world_to_projection, false_color);
+		m_forward_pass->RenderFalseColor(m_render_queue, false_color);
 	}
 
 	void XM_CALLCONV Renderer::Impl::RenderVoxelGrid(const World& world,
@@ -824,7 +847,7 @@ namespace mage::rendering {
 		//---------------------------------------------------------------------
 		// LBuffer
 		//---------------------------------------------------------------------
-		m_lbuffer_pass->Render(world, world_to_projection);
+		m_lbuffer_pass->Render(world, camera, world_to_projection);
 
 		//---------------------------------------------------------------------
 		// Voxelization
@@ -930,12 +953,14 @@ namespace mage::rendering {
 					   ID3D11DeviceContext& device_context,
 					   DisplayConfiguration& display_configuration,
 					   SwapChain& swap_chain,
-					   ResourceManager& resource_manager)
+					   ResourceManager& resource_manager,
+					   JobSystem& job_system)
 		: m_impl(MakeUnique< Impl >(device,
 									device_context,
 									display_configuration,
 									swap_chain,
-									resource_manager)) {}
+									resource_manager,
+									job_system)) {}
 
 	Renderer::Renderer(Renderer&& renderer) noexcept = default;
 
@@ -9,6 +9,7 @@
 #include "resource\rendering_resource_manager.hpp"
 #include "scene\rendering_world.hpp"
 #include "system\game_timer.hpp"
+#include "parallel\job_system.hpp"
 
 #pragma endregion
 
@@ -41,12 +42,15 @@ namespace mage::rendering {
 						A reference to the swap chain.
 		 @param[in,out]	resource_manager
 						A pointer to the resource manager.
+		 @param[in,out]	job_system
+						A reference to the job system.
 		 */
 		explicit Renderer(ID3D11Device& device,
 						  ID3D11DeviceContext& device_context,
 						  DisplayConfiguration& display_configuration,
 						  SwapChain& swap_chain,
-						  ResourceManager& resource_manager);
+						  ResourceManager& resource_manager,
+						  JobSystem& job_system);
 
 		/**
 		 Constructs a renderer from the given renderer.
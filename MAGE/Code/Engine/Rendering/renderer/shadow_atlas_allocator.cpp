@@ -0,0 +1,360 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "renderer\shadow_atlas_allocator.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	namespace {
+
+		/**
+		 Rounds the given size to the nearest power of two (in log space).
+
+		 @pre			@a size is at least one.
+		 @param[in]		size
+						The size.
+		 @return		The power of two nearest to @a size.
+		 */
+		[[nodiscard]]
+		U32 RoundToPowerOfTwo(F32 size) noexcept {
+			const auto exponent = std::lround(std::log2(size));
+			return U32(1u) << static_cast< U32 >(std::max(exponent, 0l));
+		}
+	}
+
+	ShadowAtlasAllocator::ShadowAtlasAllocator(U32 resolution,
+											   U32 min_tile_size,
+											   U32 max_tile_size)
+		: m_resolution(resolution),
+		m_min_tile_size(min_tile_size),
+		m_max_tile_size(max_tile_size),
+		m_free_rectangles(),
+		m_allocations(),
+		m_sizes(),
+		m_tiles(),
+		m_scale(0u),
+		m_nb_relocations(0u) {
+
+		ResetFreeRectangles();
+	}
+
+	ShadowAtlasAllocator::ShadowAtlasAllocator(
+		const ShadowAtlasAllocator& allocator) = default;
+
+	ShadowAtlasAllocator::ShadowAtlasAllocator(
+		ShadowAtlasAllocator&& allocator) noexcept = default;
+
+	ShadowAtlasAllocator::~ShadowAtlasAllocator() = default;
+
+	ShadowAtlasAllocator& ShadowAtlasAllocator
+		::operator=(const ShadowAtlasAllocator& allocator) = default;
+
+	ShadowAtlasAllocator& ShadowAtlasAllocator
+		::operator=(ShadowAtlasAllocator&& allocator) noexcept = default;
+
+	void ShadowAtlasAllocator::Allocate(gsl::span< const Request > requests) {
+		const auto nb_requests = static_cast< std::size_t >(requests.size());
+
+		SetupTileSizes(requests, true);
+
+		auto previous_allocations = std::move(m_allocations);
+		m_allocations.clear();
+		m_allocations.reserve(nb_requests);
+		m_tiles.assign(nb_requests, Tile{});
+
+		// Retain the tiles whose size did not change.
+		std::vector< std::size_t > pending;
+		for (std::size_t i = 0u; i < nb_requests; ++i) {
+			const auto key = requests[i].m_key;
+			const auto it  = previous_allocations.find(key);
+			if (previous_allocations.cend() != it
+				&& it->second.m_size == m_sizes[i]) {
+
+				m_tiles[i] = it->second;
+				m_allocations.emplace(key, it->second);
+			}
+			else {
+				pending.push_back(i);
+			}
+		}
+
+		// Deallocate the tiles of the lights which are no longer requested
+		// or which are resized.
+		for (const auto& [key, tile] : previous_allocations) {
+			if (m_allocations.cend() == m_allocations.find(key)) {
+				Free(tile);
+			}
+		}
+
+		// Allocate the pending tiles from large to small.
+		std::stable_sort(pending.begin(), pending.end(),
+			[this](std::size_t lhs, std::size_t rhs) noexcept {
+				return m_sizes[rhs] < m_sizes[lhs];
+			});
+
+		auto fits = true;
+		for (const auto i : pending) {
+			if (!Insert(m_sizes[i], m_tiles[i])) {
+				fits = false;
+				break;
+			}
+
+			m_allocations.emplace(requests[i].m_key, m_tiles[i]);
+		}
+
+		if (!fits) {
+			Repack(requests);
+		}
+		else if (0u < m_scale && 4.0f * GetOccupancy() <= 1.0f) {
+			// All tiles fit at twice their current (reduced) size.
+			--m_scale;
+			SetupTileSizes(requests, false);
+			Repack(requests);
+		}
+
+		// Count the tiles which were (re)allocated.
+		m_nb_relocations = 0u;
+		for (std::size_t i = 0u; i < nb_requests; ++i) {
+			const auto it = previous_allocations.find(requests[i].m_key);
+			if (previous_allocations.cend() == it
+				|| it->second.m_size        != m_tiles[i].m_size
+				|| it->second.m_position[0] != m_tiles[i].m_position[0]
+				|| it->second.m_position[1] != m_tiles[i].m_position[1]) {
+
+				++m_nb_relocations;
+			}
+		}
+	}
+
+	void ShadowAtlasAllocator::Clear() noexcept {
+		m_allocations.clear();
+		m_sizes.clear();
+		m_tiles.clear();
+		m_scale          = 0u;
+		m_nb_relocations = 0u;
+
+		ResetFreeRectangles();
+	}
+
+	[[nodiscard]]
+	F32 ShadowAtlasAllocator::GetDesiredTileSize(const Request& request) const noexcept {
+		const auto coverage   = std::clamp(request.m_coverage,   0.0f, 1.0f);
+		const auto importance = std::clamp(request.m_importance, 0.0f, 1.0f);
+		const auto size       = static_cast< F32 >(m_max_tile_size)
+			                  * std::sqrt(coverage) * importance;
+
+		return std::clamp(size, static_cast< F32 >(m_min_tile_size),
+						  static_cast< F32 >(m_max_tile_size));
+	}
+
+	[[nodiscard]]
+	F32 ShadowAtlasAllocator::GetOccupancy() const noexcept {
+		U64 area = 0u;
+		for (const auto& tile : m_tiles) {
+			area += static_cast< U64 >(tile.m_size) * tile.m_size;
+		}
+
+		return static_cast< F32 >(area)
+			 / static_cast< F32 >(static_cast< U64 >(m_resolution) * m_resolution);
+	}
+
+	void ShadowAtlasAllocator::SetupTileSizes(gsl::span< const Request > requests,
+											  bool hysteresis) {
+
+		// sqrt(2) corresponds to the rounding boundaries in log space.
+		const auto band       = 1.41421356f * s_hysteresis;
+		const auto scale      = static_cast< F32 >(U32(1u) << m_scale);
+		const auto min_size   = static_cast< F32 >(m_min_tile_size);
+
+		m_sizes.resize(static_cast< std::size_t >(requests.size()));
+		for (std::size_t i = 0u; i < m_sizes.size(); ++i) {
+			const auto& request = requests[i];
+			const auto  desired = std::max(GetDesiredTileSize(request) / scale,
+										   min_size);
+
+			if (hysteresis) {
+				const auto it = m_allocations.find(request.m_key);
+				if (m_allocations.cend() != it) {
+					const auto current = static_cast< F32 >(it->second.m_size);
+					if (current <= desired * band && desired <= current * band) {
+						m_sizes[i] = it->second.m_size;
+						continue;
+					}
+				}
+			}
+
+			m_sizes[i] = std::clamp(RoundToPowerOfTwo(desired),
+									m_min_tile_size, m_max_tile_size);
+		}
+	}
+
+	void ShadowAtlasAllocator::Repack(gsl::span< const Request > requests) {
+		const auto nb_requests = static_cast< std::size_t >(requests.size());
+
+		std::vector< std::size_t > order(nb_requests);
+		for (;;) {
+			ResetFreeRectangles();
+
+			// Insert the tiles from large to small.
+			std::iota(order.begin(), order.end(), std::size_t(0u));
+			std::stable_sort(order.begin(), order.end(),
+				[this](std::size_t lhs, std::size_t rhs) noexcept {
+					return m_sizes[rhs] < m_sizes[lhs];
+				});
+
+			auto fits = true;
+			for (const auto i : order) {
+				if (!Insert(m_sizes[i], m_tiles[i])) {
+					m_tiles[i] = Tile{};
+					fits = false;
+				}
+			}
+
+			const auto max_size = m_sizes.empty() ? 0u
+				: *std::max_element(m_sizes.cbegin(), m_sizes.cend());
+			if (fits || max_size <= m_min_tile_size) {
+				break;
+			}
+
+			// Halve all tile sizes.
+			++m_scale;
+			SetupTileSizes(requests, false);
+		}
+
+		m_allocations.clear();
+		for (std::size_t i = 0u; i < nb_requests; ++i) {
+			if (0u != m_tiles[i].m_size) {
+				m_allocations.emplace(requests[i].m_key, m_tiles[i]);
+			}
+		}
+	}
+
+	[[nodiscard]]
+	bool ShadowAtlasAllocator::Insert(U32 size, Tile& tile) {
+		// Select the free rectangle with the best area fit.
+		auto best      = m_free_rectangles.end();
+		auto best_area = U64(0u);
+		for (auto it = m_free_rectangles.begin(); it != m_free_rectangles.end(); ++it) {
+			if (it->m_size[0] < size || it->m_size[1] < size) {
+				continue;
+			}
+
+			const auto area = static_cast< U64 >(it->m_size[0]) * it->m_size[1];
+			if (m_free_rectangles.end() == best || area < best_area) {
+				best      = it;
+				best_area = area;
+			}
+		}
+
+		if (m_free_rectangles.end() == best) {
+			return false;
+		}
+
+		const auto rectangle = *best;
+		m_free_rectangles.erase(best);
+
+		tile.m_position = rectangle.m_position;
+		tile.m_size     = size;
+
+		// Split the remainder along the shorter leftover axis.
+		const auto leftover_x = rectangle.m_size[0] - size;
+		const auto leftover_y = rectangle.m_size[1] - size;
+
+		Rectangle right;
+		right.m_position = { rectangle.m_position[0] + size, rectangle.m_position[1] };
+		Rectangle bottom;
+		bottom.m_position = { rectangle.m_position[0], rectangle.m_position[1] + size };
+		if (leftover_x <= leftover_y) {
+			right.m_size  = { leftover_x, size };
+			bottom.m_size = { rectangle.m_size[0], leftover_y };
+		}
+		else {
+			right.m_size  = { leftover_x, rectangle.m_size[1] };
+			bottom.m_size = { size, leftover_y };
+		}
+
+		if (0u != right.m_size[0] && 0u != right.m_size[1]) {
+			m_free_rectangles.push_back(right);
+		}
+		if (0u != bottom.m_size[0] && 0u != bottom.m_size[1]) {
+			m_free_rectangles.push_back(bottom);
+		}
+
+		return true;
+	}
+
+	void ShadowAtlasAllocator::Free(const Tile& tile) {
+		Rectangle rectangle;
+		rectangle.m_position = tile.m_position;
+		rectangle.m_size     = { tile.m_size, tile.m_size };
+
+		// Merge the rectangle with the free rectangles sharing a full edge.
+		for (auto merged = true; merged; ) {
+			merged = false;
+
+			for (auto it = m_free_rectangles.begin(); it != m_free_rectangles.end(); ++it) {
+				const auto& other = *it;
+
+				const auto same_column = other.m_position[0] == rectangle.m_position[0]
+					                  && other.m_size[0]     == rectangle.m_size[0];
+				const auto same_row    = other.m_position[1] == rectangle.m_position[1]
+					                  && other.m_size[1]     == rectangle.m_size[1];
+
+				if (same_column
+					&& other.m_position[1] + other.m_size[1] == rectangle.m_position[1]) {
+					// other above rectangle
+					rectangle.m_position[1]  = other.m_position[1];
+					rectangle.m_size[1]     += other.m_size[1];
+				}
+				else if (same_column
+					&& rectangle.m_position[1] + rectangle.m_size[1] == other.m_position[1]) {
+					// other below rectangle
+					rectangle.m_size[1]     += other.m_size[1];
+				}
+				else if (same_row
+					&& other.m_position[0] + other.m_size[0] == rectangle.m_position[0]) {
+					// other left of rectangle
+					rectangle.m_position[0]  = other.m_position[0];
+					rectangle.m_size[0]     += other.m_size[0];
+				}
+				else if (same_row
+					&& rectangle.m_position[0] + rectangle.m_size[0] == other.m_position[0]) {
+					// other right of rectangle
+					rectangle.m_size[0]     += other.m_size[0];
+				}
+				else {
+					continue;
+				}
+
+				m_free_rectangles.erase(it);
+				merged = true;
+				break;
+			}
+		}
+
+		m_free_rectangles.push_back(rectangle);
+	}
+
+	void ShadowAtlasAllocator::ResetFreeRectangles() {
+		m_free_rectangles.clear();
+		m_free_rectangles.push_back({ { 0u, 0u }, { m_resolution, m_resolution } });
+	}
+}
\ No newline at end of file
@@ -0,0 +1,390 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "type\types.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <gsl\span>
+#include <unordered_map>
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	/**
+	 A class of shadow atlas allocators.
+
+	 A shadow atlas allocator packs square shadow map tiles into a single
+	 square shadow atlas with a guillotine allocator (i.e. a list of free
+	 rectangles which are split on allocation and merged on deallocation).
+	 The size of each tile is a power of two, derived from the projected
+	 screen coverage and importance of its light.
+
+	 Tiles are remapped with minimal churn: the tile of a light is retained
+	 as long as its size stays within a hysteresis band around the desired
+	 size; only new and resized tiles are (re)allocated. The atlas is only
+	 repacked from scratch if the free space is too fragmented, and all tile
+	 sizes are reduced uniformly if the tiles do not fit at all.
+
+	 Shadow atlas allocators do not access the GPU.
+	 */
+	class ShadowAtlasAllocator {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		/**
+		 A struct of shadow atlas requests.
+		 */
+		struct Request {
+
+		public:
+
+			/**
+			 The key identifying the light of this request across frames
+			 (e.g. the guid of the light, which is stable unlike its
+			 address).
+			 */
+			U64 m_key;
+
+			/**
+			 The fraction of the screen covered by the projected light volume
+			 of this request (in [0,1]).
+			 */
+			F32 m_coverage;
+
+			/**
+			 The importance of the light of this request (in [0,1]).
+			 */
+			F32 m_importance;
+		};
+
+		/**
+		 A struct of shadow atlas tiles.
+		 */
+		struct Tile {
+
+		public:
+
+			/**
+			 The position of the top-left texel of this tile in the shadow
+			 atlas.
+			 */
+			U32x2 m_position;
+
+			/**
+			 The size (in texels) of this tile. A zero size indicates that no
+			 tile could be allocated.
+			 */
+			U32 m_size;
+		};
+
+		//---------------------------------------------------------------------
+		// Class Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The factor by which the desired tile size of a light may exceed the
+		 rounding boundaries of its current tile size before the tile is
+		 resized.
+		 */
+		static constexpr F32 s_hysteresis = 1.25f;
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a shadow atlas allocator.
+
+		 @pre			@a resolution, @a min_tile_size and @a max_tile_size
+						are powers of two.
+		 @pre			@a min_tile_size is not larger than @a max_tile_size.
+		 @pre			@a max_tile_size is not larger than @a resolution.
+		 @param[in]		resolution
+						The resolution of the shadow atlas.
+		 @param[in]		min_tile_size
+						The minimum tile size.
+		 @param[in]		max_tile_size
+						The maximum tile size.
+		 */
+		explicit ShadowAtlasAllocator(U32 resolution    = 4096u,
+									  U32 min_tile_size = 128u,
+									  U32 max_tile_size = 2048u);
+
+		/**
+		 Constructs a shadow atlas allocator from the given shadow atlas
+		 allocator.
+
+		 @param[in]		allocator
+						A reference to the shadow atlas allocator to copy.
+		 */
+		ShadowAtlasAllocator(const ShadowAtlasAllocator& allocator);
+
+		/**
+		 Constructs a shadow atlas allocator by moving the given shadow atlas
+		 allocator.
+
+		 @param[in]		allocator
+						A reference to the shadow atlas allocator to move.
+		 */
+		ShadowAtlasAllocator(ShadowAtlasAllocator&& allocator) noexcept;
+
+		/**
+		 Destructs this shadow atlas allocator.
+		 */
+		~ShadowAtlasAllocator();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given shadow atlas allocator to this shadow atlas
+		 allocator.
+
+		 @param[in]		allocator
+						A reference to the shadow atlas allocator to copy.
+		 @return		A reference to the copy of the given shadow atlas
+						allocator (i.e. this shadow atlas allocator).
+		 */
+		ShadowAtlasAllocator& operator=(const ShadowAtlasAllocator& allocator);
+
+		/**
+		 Moves the given shadow atlas allocator to this shadow atlas
+		 allocator.
+
+		 @param[in]		allocator
+						A reference to the shadow atlas allocator to move.
+		 @return		A reference to the moved shadow atlas allocator (i.e.
+						this shadow atlas allocator).
+		 */
+		ShadowAtlasAllocator& operator=(ShadowAtlasAllocator&& allocator) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Allocates the tiles for the given requests. The tiles of the lights
+		 which are no longer requested, are deallocated.
+
+		 @pre			The keys of the requests are unique.
+		 @param[in]		requests
+						The requests.
+		 */
+		void Allocate(gsl::span< const Request > requests);
+
+		/**
+		 Clears this shadow atlas allocator (i.e. deallocates all tiles).
+		 */
+		void Clear() noexcept;
+
+		/**
+		 Returns the desired (unrounded) tile size of the given request.
+
+		 @param[in]		request
+						A reference to the request.
+		 @return		The desired tile size of @a request clamped to the
+						tile size range of this shadow atlas allocator.
+		 */
+		[[nodiscard]]
+		F32 GetDesiredTileSize(const Request& request) const noexcept;
+
+		/**
+		 Returns the resolution of the shadow atlas of this shadow atlas
+		 allocator.
+
+		 @return		The resolution of the shadow atlas of this shadow
+						atlas allocator.
+		 */
+		[[nodiscard]]
+		U32 GetResolution() const noexcept {
+			return m_resolution;
+		}
+
+		/**
+		 Returns the tiles of the requests of the last allocation of this
+		 shadow atlas allocator (in order).
+
+		 @return		The tiles of the last allocation of this shadow atlas
+						allocator.
+		 */
+		[[nodiscard]]
+		gsl::span< const Tile > GetTiles() const noexcept {
+			return m_tiles;
+		}
+
+		/**
+		 Returns the number of tiles which were (re)allocated during the last
+		 allocation of this shadow atlas allocator.
+
+		 @return		The number of tiles which were (re)allocated during
+						the last allocation of this shadow atlas allocator.
+		 */
+		[[nodiscard]]
+		std::size_t GetNumberOfRelocations() const noexcept {
+			return m_nb_relocations;
+		}
+
+		/**
+		 Returns the fraction of the shadow atlas of this shadow atlas
+		 allocator which is covered by tiles.
+
+		 @return		The occupancy of the shadow atlas of this shadow atlas
+						allocator.
+		 */
+		[[nodiscard]]
+		F32 GetOccupancy() const noexcept;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		/**
+		 A struct of (free) rectangles of the shadow atlas.
+		 */
+		struct Rectangle {
+
+		public:
+
+			/**
+			 The position of the top-left texel of this rectangle.
+			 */
+			U32x2 m_position;
+
+			/**
+			 The size (in texels) of this rectangle.
+			 */
+			U32x2 m_size;
+		};
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Determines the tile sizes of the given requests.
+
+		 @param[in]		requests
+						The requests.
+		 @param[in]		hysteresis
+						@c true if the current tile sizes should be retained
+						within the hysteresis band. @c false otherwise.
+		 */
+		void SetupTileSizes(gsl::span< const Request > requests,
+							bool hysteresis);
+
+		/**
+		 Repacks all tiles of this shadow atlas allocator from scratch,
+		 uniformly reducing the tile sizes until all tiles fit.
+
+		 @param[in]		requests
+						The requests.
+		 */
+		void Repack(gsl::span< const Request > requests);
+
+		/**
+		 Inserts a tile of the given size into the free rectangles of this
+		 shadow atlas allocator.
+
+		 @param[in]		size
+						The tile size.
+		 @param[out]	tile
+						A reference to the tile.
+		 @return		@c true if the tile could be inserted. @c false
+						otherwise.
+		 */
+		[[nodiscard]]
+		bool Insert(U32 size, Tile& tile);
+
+		/**
+		 Returns the given tile to the free rectangles of this shadow atlas
+		 allocator.
+
+		 @param[in]		tile
+						A reference to the tile.
+		 */
+		void Free(const Tile& tile);
+
+		/**
+		 Resets the free rectangles of this shadow atlas allocator to the
+		 complete shadow atlas.
+		 */
+		void ResetFreeRectangles();
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The resolution of the shadow atlas of this shadow atlas allocator.
+		 */
+		U32 m_resolution;
+
+		/**
+		 The minimum tile size of this shadow atlas allocator.
+		 */
+		U32 m_min_tile_size;
+
+		/**
+		 The maximum tile size of this shadow atlas allocator.
+		 */
+		U32 m_max_tile_size;
+
+		/**
+		 A vector containing the free rectangles of this shadow atlas
+		 allocator.
+		 */
+		std::vector< Rectangle > m_free_rectangles;
+
+		/**
+		 A map containing the allocated tile of each key of this shadow atlas
+		 allocator.
+		 */
+		std::unordered_map< U64, Tile > m_allocations;
+
+		/**
+		 A vector containing the tile sizes of the requests of the last
+		 allocation of this shadow atlas allocator.
+		 */
+		std::vector< U32 > m_sizes;
+
+		/**
+		 A vector containing the tiles of the requests of the last allocation
+		 of this shadow atlas allocator.
+		 */
+		std::vector< Tile > m_tiles;
+
+		/**
+		 The number of times the tile sizes of this shadow atlas allocator are
+		 halved in order to fit all tiles.
+		 */
+		U32 m_scale;
+
+		/**
+		 The number of tiles which were (re)allocated during the last
+		 allocation of this shadow atlas allocator.
+		 */
+		std::size_t m_nb_relocations;
+	};
+}
\ No newline at end of file
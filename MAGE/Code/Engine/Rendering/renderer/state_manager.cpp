@@ -184,6 +184,15 @@ namespace mage::rendering {
 						  "Less, read depth stencil state creation failed: {:08X}.",
 						  result);
 		}
+
+		{
+			const HRESULT result = CreateDepthReadWriteDepthStencilState(
+				m_device, ReleaseAndGetAddressOf(DepthStencilStateID::AlwaysDepthReadWrite),
+				D3D11_COMPARISON_ALWAYS);
+			ThrowIfFailed(result,
+						  "Always, read-write depth stencil state creation failed: {:08X}.",
+						  result);
+		}
 	}
 
 	void StateManager::SetupRasterizerStates() {
@@ -53,8 +53,9 @@ namespace mage::rendering {
 	 @c GreaterDepthRead,
 	 @c LessEqualDepthReadWrite,
 	 @c LessEqualDepthRead,
-	 @c LessDepthReadWrite and
-	 @c LessDepthRead.
+	 @c LessDepthReadWrite,
+	 @c LessDepthRead and
+	 @c AlwaysDepthReadWrite.
 	 */
 	enum class DepthStencilStateID : U8 {
 		DepthNone = 0,
@@ -66,6 +67,7 @@ namespace mage::rendering {
 		LessEqualDepthRead,
 		LessDepthReadWrite,
 		LessDepthRead,
+		AlwaysDepthReadWrite,
 		Count
 	};
 
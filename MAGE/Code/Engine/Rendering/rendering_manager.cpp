@@ -40,9 +40,12 @@ namespace mage::rendering {
 						The main window handle.
 		 @param[in]		display_configuration
 						A reference to the display configuration.
+		 @param[in,out]	job_system
+						A reference to the job system.
 		 */
 		explicit Impl(NotNull< HWND > window,
-					  const DisplayConfiguration& display_configuration);
+					  const DisplayConfiguration& display_configuration,
+					  JobSystem& job_system);
 
 		/**
 		 Constructs a rendering manager from the given rendering manager.
@@ -218,6 +221,11 @@ namespace mage::rendering {
 		 */
 		UniquePtr< DisplayConfiguration > m_display_configuration;
 
+		/**
+		 A reference to the job system of this rendering manager.
+		 */
+		std::reference_wrapper< JobSystem > m_job_system;
+
 		//---------------------------------------------------------------------
 		// Member Variables: Rendering
 		//---------------------------------------------------------------------
@@ -259,10 +267,12 @@ namespace mage::rendering {
 	};
 
 	Manager::Impl::Impl(NotNull< HWND > window,
-						const DisplayConfiguration& configuration)
+						const DisplayConfiguration& configuration,
+						JobSystem& job_system)
 		: m_window(window),
 		m_display_configuration(
 			MakeUnique< DisplayConfiguration >(configuration)),
+		m_job_system(job_system),
 		m_feature_level(),
 		m_device(),
 		m_device_context(),
@@ -291,11 +301,11 @@ namespace mage::rendering {
 			                                   *m_display_configuration);
 
 		// Setup the resource manager.
-		m_resource_manager = MakeUnique< ResourceManager >(*m_device.Get());
+		m_resource_manager = MakeUnique< ResourceManager >(*m_device.Get(),
+														   m_job_system);
 
 		// Setup the world.
-		m_world = MakeUnique< World >(*m_device.Get(),
-									  *m_display_configuration,
+		m_world = MakeUnique< World >(*m_display_configuration,
 									  *m_resource_manager);
 
 		// Setup the renderer.
@@ -303,7 +313,8 @@ namespace mage::rendering {
 											*m_device_context.Get(),
 											*m_display_configuration,
 											*m_swap_chain,
-											*m_resource_manager);
+											*m_resource_manager,
+											m_job_system);
 
 		// Setup ImGui.
 		ImGui::CreateContext();
@@ -392,8 +403,9 @@ namespace mage::rendering {
 	#pragma region
 
 	Manager::Manager(NotNull< HWND > window,
-					 const DisplayConfiguration& configuration)
-		: m_impl(MakeUnique< Impl >(window, configuration)) {}
+					 const DisplayConfiguration& configuration,
+					 JobSystem& job_system)
+		: m_impl(MakeUnique< Impl >(window, configuration, job_system)) {}
 
 	Manager::Manager(Manager&& manager) noexcept = default;
 
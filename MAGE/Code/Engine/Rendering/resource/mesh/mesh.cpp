@@ -21,6 +21,10 @@ namespace mage::rendering {
 		m_nb_indices(0u),
 		m_vertex_size(vertex_size),
 		m_index_format(index_format),
+		m_index_offset(0u),
+		m_position_offset(0.0f),
+		m_position_scale(1.0f),
+		m_compact_vertices(false),
 		m_primitive_topology(primitive_topology) {}
 
 	Mesh::Mesh(Mesh&& mesh) noexcept = default;
@@ -120,6 +120,72 @@ namespace mage::rendering {
 			return m_index_format;
 		}
 
+		/**
+		 Returns the byte offset of the indices with the index format of this
+		 mesh in the index buffer of this mesh.
+
+		 @return		The byte offset of the indices with the index format
+						of this mesh in the index buffer of this mesh.
+		 */
+		[[nodiscard]]
+		U32 GetIndexOffset() const noexcept {
+			return m_index_offset;
+		}
+
+		/**
+		 Checks whether this mesh has compact vertices (i.e. vertices with
+		 quantized positions, octahedron encoded normals and half-precision
+		 texture coordinates).
+
+		 @return		@c true if this mesh has compact vertices. @c false
+						otherwise.
+		 */
+		[[nodiscard]]
+		bool HasCompactVertices() const noexcept {
+			return m_compact_vertices;
+		}
+
+		/**
+		 Returns the offset of the quantized positions of this mesh (i.e. the
+		 minimum point of the bounds of this mesh).
+
+		 @return		A reference to the offset of the quantized positions
+						of this mesh.
+		 */
+		[[nodiscard]]
+		const F32x3& GetPositionOffset() const noexcept {
+			return m_position_offset;
+		}
+
+		/**
+		 Returns the scale of the quantized positions of this mesh (i.e. the
+		 extent of the bounds of this mesh).
+
+		 @return		A reference to the scale of the quantized positions
+						of this mesh.
+		 */
+		[[nodiscard]]
+		const F32x3& GetPositionScale() const noexcept {
+			return m_position_scale;
+		}
+
+		/**
+		 Marks the vertices of this mesh as compact vertices.
+
+		 @param[in]		position_offset
+						A reference to the offset of the quantized positions
+						of this mesh.
+		 @param[in]		position_scale
+						A reference to the scale of the quantized positions
+						of this mesh.
+		 */
+		void SetCompactVertices(const F32x3& position_offset,
+								const F32x3& position_scale) noexcept {
+			m_compact_vertices = true;
+			m_position_offset  = position_offset;
+			m_position_scale   = position_scale;
+		}
+
 		/**
 		 Returns the primitive topology of this mesh.
 
@@ -157,13 +223,39 @@ namespace mage::rendering {
 		void BindMesh(ID3D11DeviceContext& device_context,
 			          D3D11_PRIMITIVE_TOPOLOGY topology) const noexcept {
 
+			BindMesh(device_context, topology, m_index_format);
+		}
+
+		/**
+		 Binds this mesh with given primitive topology and index format.
+
+		 The vertex buffer, the range of the index buffer with the given index
+		 format and the given primitive topology of this mesh will be bound to
+		 the input-assembler stage. The range of 16-bit indices of a mesh with
+		 a wider index format starts at the beginning of its index buffer.
+
+		 @param[in,out]	device_context
+						A reference to the device context.
+		 @param[in]		topology
+						The primitive topology.
+		 @param[in]		index_format
+						The index format.
+		 */
+		void BindMesh(ID3D11DeviceContext& device_context,
+			          D3D11_PRIMITIVE_TOPOLOGY topology,
+			          DXGI_FORMAT index_format) const noexcept {
+
+			const auto index_offset = (m_index_format == index_format)
+				                    ? m_index_offset : 0u;
+
 			Pipeline::IA::BindVertexBuffer(device_context,
 				                           0u,
 				                           *m_vertex_buffer.Get(),
 				                           static_cast< U32 >(m_vertex_size));
 			Pipeline::IA::BindIndexBuffer(device_context,
 				                          *m_index_buffer.Get(),
-				                          m_index_format);
+				                          index_format,
+				                          index_offset);
 			Pipeline::IA::BindPrimitiveTopology(device_context, topology);
 		}
 
@@ -188,14 +280,47 @@ namespace mage::rendering {
 						The start index.
 		 @param[in]		nb_indices
 						The number of indices.
+		 @param[in]		base_vertex
+						The base vertex (i.e. the value added to each index
+						before reading a vertex from the vertex buffer).
 		 */
 		void Draw(ID3D11DeviceContext& device_context,
 				  std::size_t start_index,
-				  std::size_t nb_indices) const noexcept {
+				  std::size_t nb_indices,
+				  U32 base_vertex = 0u) const noexcept {
 
 			Pipeline::DrawIndexed(device_context,
 				                  static_cast< U32 >(nb_indices),
-				                  static_cast< U32 >(start_index));
+				                  static_cast< U32 >(start_index),
+				                  base_vertex);
+		}
+
+		/**
+		 Draws instances of a submesh of this mesh.
+
+		 @param[in,out]	device_context
+						A reference to the device context.
+		 @param[in]		start_index
+						The start index.
+		 @param[in]		nb_indices
+						The number of indices.
+		 @param[in]		nb_instances
+						The number of instances.
+		 @param[in]		base_vertex
+						The base vertex (i.e. the value added to each index
+						before reading a vertex from the vertex buffer).
+		 */
+		void DrawInstanced(ID3D11DeviceContext& device_context,
+						   std::size_t start_index,
+						   std::size_t nb_indices,
+						   std::size_t nb_instances,
+						   U32 base_vertex = 0u) const noexcept {
+
+			Pipeline::DrawIndexedInstanced(device_context,
+				                           static_cast< U32 >(nb_indices),
+				                           static_cast< U32 >(nb_instances),
+				                           static_cast< U32 >(start_index),
+				                           base_vertex);
 		}
 
 	protected:
@@ -258,6 +383,18 @@ namespace mage::rendering {
 			m_nb_indices = nb_indices;
 		}
 
+		/**
+		 Sets the byte offset of the indices with the index format of this
+		 mesh in the index buffer of this mesh to the given offset.
+
+		 @param[in]		index_offset
+						The byte offset of the indices with the index format
+						of this mesh in the index buffer of this mesh.
+		 */
+		void SetIndexOffset(U32 index_offset) noexcept {
+			m_index_offset = index_offset;
+		}
+
 		//---------------------------------------------------------------------
 		// Member Variables
 		//---------------------------------------------------------------------
@@ -298,6 +435,27 @@ namespace mage::rendering {
 		 */
 		DXGI_FORMAT m_index_format;
 
+		/**
+		 The byte offset of the indices with the index format of this mesh in
+		 the index buffer of this mesh.
+		 */
+		U32 m_index_offset;
+
+		/**
+		 The offset of the quantized positions of this mesh.
+		 */
+		F32x3 m_position_offset;
+
+		/**
+		 The scale of the quantized positions of this mesh.
+		 */
+		F32x3 m_position_scale;
+
+		/**
+		 A flag indicating whether this mesh has compact vertices.
+		 */
+		bool m_compact_vertices;
+
 		/**
 		 The primitive topology of this mesh.
 		 */
@@ -41,12 +41,30 @@ namespace mage::rendering {
 						A flag indicating whether the face vertices should be
 						defined in clockwise order or not (i.e.
 						counterclockwise order).
+		 @param[in]		weld_vertices
+						A flag indicating whether vertices with identical
+						attributes should be welded or not.
+		 @param[in]		optimize_mesh
+						A flag indicating whether the triangles and vertices
+						should be reordered for the post-transform vertex
+						cache, overdraw and vertex fetch or not.
+		 @param[in]		compact_vertices
+						A flag indicating whether the vertices should be
+						stored as compact vertices (i.e. with quantized
+						positions, octahedron encoded normals and
+						half-precision texture coordinates) or not.
 		 */
 		constexpr explicit MeshDescriptor(
 			bool invert_handedness = false,
-			bool clockwise_order   = true) noexcept
+			bool clockwise_order   = true,
+			bool weld_vertices     = false,
+			bool optimize_mesh     = false,
+			bool compact_vertices  = false) noexcept
 			: m_invert_handedness(invert_handedness),
-			m_clockwise_order(clockwise_order) {}
+			m_clockwise_order(clockwise_order),
+			m_weld_vertices(weld_vertices),
+			m_optimize_mesh(optimize_mesh),
+			m_compact_vertices(compact_vertices) {}
 
 		/**
 		 Constructs a mesh descriptor from the given mesh descriptor.
@@ -122,6 +140,43 @@ namespace mage::rendering {
 			return m_clockwise_order;
 		}
 
+		/**
+		 Checks whether vertices with identical attributes should be welded
+		 or not according to this mesh descriptor.
+
+		 @return		@c true if vertices with identical attributes should
+						be welded. @c false otherwise.
+		 */
+		[[nodiscard]]
+		constexpr bool WeldVertices() const noexcept {
+			return m_weld_vertices;
+		}
+
+		/**
+		 Checks whether the triangles and vertices should be reordered for the
+		 post-transform vertex cache, overdraw and vertex fetch or not
+		 according to this mesh descriptor.
+
+		 @return		@c true if the triangles and vertices should be
+						reordered. @c false otherwise.
+		 */
+		[[nodiscard]]
+		constexpr bool OptimizeMesh() const noexcept {
+			return m_optimize_mesh;
+		}
+
+		/**
+		 Checks whether the vertices should be stored as compact vertices or
+		 not according to this mesh descriptor.
+
+		 @return		@c true if the vertices should be stored as compact
+						vertices. @c false otherwise.
+		 */
+		[[nodiscard]]
+		constexpr bool CompactVertices() const noexcept {
+			return m_compact_vertices;
+		}
+
 	private:
 
 		//---------------------------------------------------------------------
@@ -140,5 +195,24 @@ namespace mage::rendering {
 		 descriptor.
 		 */
 		bool m_clockwise_order;
+
+		/**
+		 A flag indicating whether vertices with identical attributes should
+		 be welded or not for this mesh descriptor.
+		 */
+		bool m_weld_vertices;
+
+		/**
+		 A flag indicating whether the triangles and vertices should be
+		 reordered for the post-transform vertex cache, overdraw and vertex
+		 fetch or not for this mesh descriptor.
+		 */
+		bool m_optimize_mesh;
+
+		/**
+		 A flag indicating whether the vertices should be stored as compact
+		 vertices or not for this mesh descriptor.
+		 */
+		bool m_compact_vertices;
 	};
 }
\ No newline at end of file
@@ -0,0 +1,202 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "geometry\geometry.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <gsl\span>
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	/**
+	 The (FIFO) post-transform vertex cache size used for optimizing and
+	 analyzing triangle orders.
+	 */
+	constexpr std::size_t g_vertex_cache_size = 16u;
+
+	//-------------------------------------------------------------------------
+	// VertexCacheStatistics
+	//-------------------------------------------------------------------------
+
+	/**
+	 A struct of post-transform vertex cache statistics.
+	 */
+	struct VertexCacheStatistics {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the average cache miss ratio (ACMR) of these vertex cache
+		 statistics.
+
+		 @return		The number of transformed vertices per triangle (i.e.
+						between 0.5 and 3).
+		 */
+		[[nodiscard]]
+		F32 GetACMR() const noexcept {
+			return (0u != m_nb_triangles)
+				? static_cast< F32 >(m_nb_cache_misses) / m_nb_triangles
+				: 0.0f;
+		}
+
+		/**
+		 Returns the average transform to vertex ratio (ATVR) of these vertex
+		 cache statistics.
+
+		 @return		The number of transformed vertices per referenced
+						vertex (i.e. 1 for an optimal triangle order).
+		 */
+		[[nodiscard]]
+		F32 GetATVR() const noexcept {
+			return (0u != m_nb_vertices)
+				? static_cast< F32 >(m_nb_cache_misses) / m_nb_vertices
+				: 0.0f;
+		}
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The number of triangles of these vertex cache statistics.
+		 */
+		std::size_t m_nb_triangles = 0u;
+
+		/**
+		 The number of (referenced) vertices of these vertex cache
+		 statistics.
+		 */
+		std::size_t m_nb_vertices = 0u;
+
+		/**
+		 The number of vertex cache misses (i.e. transformed vertices) of
+		 these vertex cache statistics.
+		 */
+		std::size_t m_nb_cache_misses = 0u;
+	};
+
+	//-------------------------------------------------------------------------
+	// Mesh Optimization
+	//-------------------------------------------------------------------------
+
+	/**
+	 Simulates a FIFO post-transform vertex cache for the given triangle list.
+
+	 @tparam		IndexT
+					The index type.
+	 @param[in]		indices
+					The indices of the triangle list.
+	 @param[in]		nb_vertices
+					The number of vertices referenced by the given indices.
+	 @param[in]		cache_size
+					The vertex cache size.
+	 @return		The vertex cache statistics of the given triangle list.
+	 */
+	template< typename IndexT >
+	[[nodiscard]]
+	const VertexCacheStatistics
+		AnalyzeVertexCache(gsl::span< const IndexT > indices,
+						   std::size_t nb_vertices,
+						   std::size_t cache_size = g_vertex_cache_size);
+
+	/**
+	 Reorders the triangles of the given triangle list for the post-transform
+	 vertex cache (i.e. Tipsify by Sander, Nehab and Barczak).
+
+	 The vertex order of each triangle (and thus the winding order) is
+	 preserved.
+
+	 @tparam		IndexT
+					The index type.
+	 @param[in,out]	indices
+					The indices of the triangle list.
+	 @param[in]		nb_vertices
+					The number of vertices referenced by the given indices.
+	 @param[out]	clusters
+					A reference to a vector for storing the index of the
+					first triangle of each cluster (i.e. each range of
+					triangles starting after a vertex cache flush).
+	 @param[in]		cache_size
+					The vertex cache size.
+	 */
+	template< typename IndexT >
+	void OptimizeVertexCache(gsl::span< IndexT > indices,
+							 std::size_t nb_vertices,
+							 std::vector< std::size_t >& clusters,
+							 std::size_t cache_size = g_vertex_cache_size);
+
+	/**
+	 Reorders the clusters of the given triangle list to reduce overdraw.
+
+	 Clusters facing away from the centroid of the triangle list (i.e. which
+	 are more likely to occlude the other clusters) are drawn first. The
+	 triangle order within each cluster is preserved.
+
+	 @tparam		IndexT
+					The index type.
+	 @param[in,out]	indices
+					The indices of the triangle list.
+	 @param[in]		positions
+					The positions of the vertices referenced by the given
+					indices.
+	 @param[in]		clusters
+					The index of the first triangle of each cluster.
+	 @param[in]		clockwise_order
+					@c true if front faces are defined in clockwise order.
+					@c false otherwise.
+	 */
+	template< typename IndexT >
+	void OptimizeOverdraw(gsl::span< IndexT > indices,
+						  gsl::span< const Point3 > positions,
+						  gsl::span< const std::size_t > clusters,
+						  bool clockwise_order = true);
+
+	/**
+	 Reorders the given vertices in order of first use by the given triangle
+	 list (and remaps the given indices accordingly).
+
+	 Unreferenced vertices are retained (in order) after the referenced
+	 vertices.
+
+	 @tparam		VertexT
+					The vertex type.
+	 @tparam		IndexT
+					The index type.
+	 @param[in,out]	vertices
+					A reference to the vector containing the vertices.
+	 @param[in,out]	indices
+					The indices of the triangle list.
+	 */
+	template< typename VertexT, typename IndexT >
+	void OptimizeVertexFetch(std::vector< VertexT >& vertices,
+							 gsl::span< IndexT > indices);
+}
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "resource\mesh\mesh_optimizer.tpp"
+
+#pragma endregion
\ No newline at end of file
@@ -0,0 +1,283 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <limits>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	template< typename IndexT >
+	[[nodiscard]]
+	const VertexCacheStatistics
+		AnalyzeVertexCache(gsl::span< const IndexT > indices,
+						   std::size_t nb_vertices,
+						   std::size_t cache_size) {
+
+		VertexCacheStatistics statistics;
+		statistics.m_nb_triangles = static_cast< std::size_t >(indices.size()) / 3u;
+
+		// A vertex is cached if it was transformed less than cache_size
+		// transformations ago. A zero time stamp denotes a vertex which was
+		// never transformed.
+		std::vector< std::size_t > time_stamps(nb_vertices, 0u);
+		std::size_t time = cache_size + 1u;
+
+		for (const auto index : indices) {
+			auto& time_stamp = time_stamps[index];
+			if (0u == time_stamp) {
+				++statistics.m_nb_vertices;
+			}
+			if (time - time_stamp > cache_size) {
+				time_stamp = time++;
+				++statistics.m_nb_cache_misses;
+			}
+		}
+
+		return statistics;
+	}
+
+	template< typename IndexT >
+	void OptimizeVertexCache(gsl::span< IndexT > indices,
+							 std::size_t nb_vertices,
+							 std::vector< std::size_t >& clusters,
+							 std::size_t cache_size) {
+
+		constexpr auto s_invalid = std::numeric_limits< std::size_t >::max();
+
+		clusters.clear();
+
+		const auto nb_triangles = static_cast< std::size_t >(indices.size()) / 3u;
+		if (0u == nb_triangles) {
+			return;
+		}
+
+		// The number of non-emitted triangles of each vertex.
+		std::vector< U32 > live(nb_vertices, 0u);
+		for (std::size_t i = 0u; i < 3u * nb_triangles; ++i) {
+			++live[indices[i]];
+		}
+
+		// The vertex-triangle adjacency.
+		std::vector< std::size_t > offsets(nb_vertices + 1u, 0u);
+		for (std::size_t v = 0u; v < nb_vertices; ++v) {
+			offsets[v + 1u] = offsets[v] + live[v];
+		}
+		std::vector< U32 > adjacency(3u * nb_triangles);
+		{
+			std::vector< std::size_t > cursors(offsets.cbegin(), offsets.cend() - 1);
+			for (std::size_t t = 0u; t < nb_triangles; ++t) {
+				for (std::size_t j = 0u; j < 3u; ++j) {
+					adjacency[cursors[indices[3u * t + j]]++] = static_cast< U32 >(t);
+				}
+			}
+		}
+
+		std::vector< std::size_t > time_stamps(nb_vertices, 0u);
+		std::vector< bool > emitted(nb_triangles, false);
+		std::vector< IndexT > dead_ends;
+		std::vector< IndexT > candidates;
+		std::vector< IndexT > output;
+		dead_ends.reserve(3u * nb_triangles);
+		output.reserve(3u * nb_triangles);
+
+		std::size_t time   = cache_size + 1u;
+		std::size_t cursor = 0u;
+
+		// Returns the next vertex with non-emitted triangles if the current
+		// fanning vertex is a dead end.
+		const auto skip_dead_end = [&]() noexcept {
+			while (!dead_ends.empty()) {
+				const auto v = static_cast< std::size_t >(dead_ends.back());
+				dead_ends.pop_back();
+				if (0u != live[v]) {
+					return v;
+				}
+			}
+
+			for (; cursor < nb_vertices; ++cursor) {
+				if (0u != live[cursor]) {
+					return cursor;
+				}
+			}
+
+			return s_invalid;
+		};
+
+		clusters.push_back(0u);
+		auto fanning = static_cast< std::size_t >(indices[0]);
+		while (s_invalid != fanning) {
+			candidates.clear();
+
+			// Emit all non-emitted triangles of the fanning vertex.
+			for (auto a = offsets[fanning]; a < offsets[fanning + 1u]; ++a) {
+				const auto t = adjacency[a];
+				if (emitted[t]) {
+					continue;
+				}
+
+				for (std::size_t j = 0u; j < 3u; ++j) {
+					const auto v = indices[3u * t + j];
+					output.push_back(v);
+					dead_ends.push_back(v);
+					candidates.push_back(v);
+					--live[v];
+
+					if (time - time_stamps[v] > cache_size) {
+						time_stamps[v] = time++;
+					}
+				}
+
+				emitted[t] = true;
+			}
+
+			// Select the candidate which will still be cached after emitting
+			// all its remaining triangles and which entered the cache first.
+			auto next = s_invalid;
+			std::size_t max_priority = 0u;
+			for (const auto candidate : candidates) {
+				const auto v = static_cast< std::size_t >(candidate);
+				if (0u == live[v]) {
+					continue;
+				}
+
+				const auto age = time - time_stamps[v];
+				const auto priority = (age + 2u * live[v] <= cache_size) ? age : 0u;
+				if (s_invalid == next || priority > max_priority) {
+					next         = v;
+					max_priority = priority;
+				}
+			}
+
+			if (s_invalid == next) {
+				next = skip_dead_end();
+
+				// A dead end starts a new cluster.
+				if (s_invalid != next && clusters.back() != output.size() / 3u) {
+					clusters.push_back(output.size() / 3u);
+				}
+			}
+
+			fanning = next;
+		}
+
+		std::copy(output.cbegin(), output.cend(), indices.begin());
+	}
+
+	template< typename IndexT >
+	void OptimizeOverdraw(gsl::span< IndexT > indices,
+						  gsl::span< const Point3 > positions,
+						  gsl::span< const std::size_t > clusters,
+						  bool clockwise_order) {
+
+		const auto nb_triangles = static_cast< std::size_t >(indices.size()) / 3u;
+		const auto nb_clusters  = static_cast< std::size_t >(clusters.size());
+		if (nb_clusters <= 1u) {
+			return;
+		}
+
+		const auto get_cluster_end = [&](std::size_t c) noexcept {
+			return (c + 1u < nb_clusters) ? clusters[c + 1u] : nb_triangles;
+		};
+
+		// Compute the area-weighted centroid and normal of each cluster.
+		std::vector< F32x3 > centroids(nb_clusters);
+		std::vector< F32x3 > normals(nb_clusters);
+		auto mesh_centroid = XMVectorZero();
+		auto mesh_area     = 0.0f;
+
+		for (std::size_t c = 0u; c < nb_clusters; ++c) {
+			auto centroid = XMVectorZero();
+			auto normal   = XMVectorZero();
+			auto area     = 0.0f;
+
+			for (auto t = clusters[c]; t < get_cluster_end(c); ++t) {
+				const auto p0 = XMLoad(positions[indices[3u * t     ]]);
+				const auto p1 = XMLoad(positions[indices[3u * t + 1u]]);
+				const auto p2 = XMLoad(positions[indices[3u * t + 2u]]);
+
+				// Twice the area of the triangle.
+				const auto n = XMVector3Cross(p1 - p0, p2 - p0);
+				const auto a = XMVectorGetX(XMVector3Length(n));
+
+				centroid += (p0 + p1 + p2) * (a / 3.0f);
+				normal   += n;
+				area     += a;
+			}
+
+			mesh_centroid += centroid;
+			mesh_area     += area;
+
+			centroids[c] = XMStore< F32x3 >(
+				(0.0f < area) ? centroid / area : centroid);
+			normals[c]   = XMStore< F32x3 >(XMVector3Normalize(
+				clockwise_order ? normal : -normal));
+		}
+
+		if (0.0f < mesh_area) {
+			mesh_centroid /= mesh_area;
+		}
+
+		// Sort the clusters on decreasing alignment of their normal with
+		// the direction from the centroid of the triangle list.
+		std::vector< F32 > keys(nb_clusters);
+		std::vector< std::size_t > order(nb_clusters);
+		for (std::size_t c = 0u; c < nb_clusters; ++c) {
+			const auto d = XMLoad(centroids[c]) - mesh_centroid;
+			keys[c]  = XMVectorGetX(XMVector3Dot(d, XMLoad(normals[c])));
+			order[c] = c;
+		}
+
+		std::stable_sort(order.begin(), order.end(),
+			[&keys](std::size_t lhs, std::size_t rhs) noexcept {
+				return keys[lhs] > keys[rhs];
+			});
+
+		std::vector< IndexT > output;
+		output.reserve(3u * nb_triangles);
+		for (const auto c : order) {
+			output.insert(output.cend(),
+						  indices.begin() + 3u * clusters[c],
+						  indices.begin() + 3u * get_cluster_end(c));
+		}
+
+		std::copy(output.cbegin(), output.cend(), indices.begin());
+	}
+
+	template< typename VertexT, typename IndexT >
+	void OptimizeVertexFetch(std::vector< VertexT >& vertices,
+							 gsl::span< IndexT > indices) {
+
+		constexpr auto s_invalid = std::numeric_limits< std::size_t >::max();
+
+		std::vector< std::size_t > mapping(vertices.size(), s_invalid);
+		std::vector< VertexT > output;
+		output.reserve(vertices.size());
+
+		for (auto& index : indices) {
+			auto& new_index = mapping[index];
+			if (s_invalid == new_index) {
+				new_index = output.size();
+				output.push_back(vertices[index]);
+			}
+
+			index = static_cast< IndexT >(new_index);
+		}
+
+		for (std::size_t i = 0u; i < vertices.size(); ++i) {
+			if (s_invalid == mapping[i]) {
+				output.push_back(vertices[i]);
+			}
+		}
+
+		vertices.swap(output);
+	}
+}
\ No newline at end of file
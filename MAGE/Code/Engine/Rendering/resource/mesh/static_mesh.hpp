@@ -62,6 +62,38 @@ namespace mage::rendering {
 			                D3D11_PRIMITIVE_TOPOLOGY primitive_topology
 			                = D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
 
+		/**
+		 Constructs a static mesh with a range of 16-bit indices and a range
+		 of indices.
+
+		 The range of 16-bit indices precedes the range of indices in the
+		 index buffer of the static mesh. The index format of the static mesh
+		 corresponds to the range of indices.
+
+		 @pre			The size of @c IndexT is larger than the size of
+						@c U16.
+		 @param[in,out]	device
+						A reference to the device.
+		 @param[in]		vertices
+						A vector containing the vertices.
+		 @param[in]		compact_indices
+						A vector containing the 16-bit indices.
+		 @param[in]		indices
+						A vector containing the indices.
+		 @param[in]		primitive_topology
+						The primitive topology.
+		 @throws		Exception
+						Failed to setup the vertex buffer of the static mesh.
+		 @throws		Exception
+						Failed to setup the index buffer of the static mesh.
+		 */
+		explicit StaticMesh(ID3D11Device& device,
+			                std::vector< VertexT > vertices,
+			                std::vector< U16 >     compact_indices,
+			                std::vector< IndexT >  indices,
+			                D3D11_PRIMITIVE_TOPOLOGY primitive_topology
+			                = D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+
 		/**
 		 Constructs a static mesh from the given static mesh.
 
@@ -142,6 +174,11 @@ namespace mage::rendering {
 		 */
 		std::vector< VertexT > m_vertices;
 
+		/**
+		 The vector containing the 16-bit indices of this static mesh.
+		 */
+		std::vector< U16 > m_compact_indices;
+
 		/**
 		 The vector containing the indices of this static mesh.
 		 */
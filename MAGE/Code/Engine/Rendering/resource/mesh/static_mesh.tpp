@@ -10,6 +10,15 @@
 
 #pragma endregion
 
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <cstring>
+
+#pragma endregion
+
 //-----------------------------------------------------------------------------
 // Engine Definitions
 //-----------------------------------------------------------------------------
@@ -25,12 +34,33 @@ namespace mage::rendering {
 			   mage::rendering::GetIndexFormat< IndexT >(),
 			   primitive_topology),
 	    m_vertices(std::move(vertices)),
+		m_compact_indices(),
 		m_indices(std::move(indices)) {
 
 		SetupVertexBuffer(device);
 		SetupIndexBuffer(device);
 	}
 
+	template< typename VertexT, typename IndexT >
+	StaticMesh< VertexT, IndexT >
+		::StaticMesh(ID3D11Device& device,
+		             std::vector< VertexT > vertices,
+		             std::vector< U16 >     compact_indices,
+		             std::vector< IndexT >  indices,
+		             D3D11_PRIMITIVE_TOPOLOGY primitive_topology)
+		: Mesh(sizeof(VertexT),
+			   mage::rendering::GetIndexFormat< IndexT >(),
+			   primitive_topology),
+	    m_vertices(std::move(vertices)),
+		m_compact_indices(std::move(compact_indices)),
+		m_indices(std::move(indices)) {
+
+		static_assert(sizeof(U16) < sizeof(IndexT));
+
+		SetupVertexBuffer(device);
+		SetupIndexBuffer(device);
+	}
+
 	template< typename VertexT, typename IndexT >
 	StaticMesh< VertexT, IndexT >
 		::StaticMesh(StaticMesh&& mesh) noexcept = default;
@@ -59,10 +89,32 @@ namespace mage::rendering {
 	void StaticMesh< VertexT, IndexT >
 		::SetupIndexBuffer(ID3D11Device& device) {
 
-		const HRESULT result = CreateStaticIndexBuffer(
-			device, NotNull< ID3D11Buffer** >(m_index_buffer.ReleaseAndGetAddressOf()),
-			gsl::make_span(static_cast< const std::vector< IndexT >& >(m_indices)));
-		ThrowIfFailed(result, "Index buffer creation failed: {:08X}.", result);
+		if (m_compact_indices.empty()) {
+			const HRESULT result = CreateStaticIndexBuffer(
+				device, NotNull< ID3D11Buffer** >(m_index_buffer.ReleaseAndGetAddressOf()),
+				gsl::make_span(static_cast< const std::vector< IndexT >& >(m_indices)));
+			ThrowIfFailed(result, "Index buffer creation failed: {:08X}.", result);
+		}
+		else {
+			// The range of indices starts at a multiple of the index size.
+			const auto nb_compact_indices
+				= (m_compact_indices.size() + sizeof(IndexT) / sizeof(U16) - 1u)
+				/ (sizeof(IndexT) / sizeof(U16)) * (sizeof(IndexT) / sizeof(U16));
+
+			std::vector< U16 > data(nb_compact_indices
+									+ m_indices.size() * (sizeof(IndexT) / sizeof(U16)));
+			std::memcpy(data.data(), m_compact_indices.data(),
+						m_compact_indices.size() * sizeof(U16));
+			std::memcpy(data.data() + nb_compact_indices, m_indices.data(),
+						m_indices.size() * sizeof(IndexT));
+
+			const HRESULT result = CreateStaticIndexBuffer(
+				device, NotNull< ID3D11Buffer** >(m_index_buffer.ReleaseAndGetAddressOf()),
+				gsl::make_span(static_cast< const std::vector< U16 >& >(data)));
+			ThrowIfFailed(result, "Index buffer creation failed: {:08X}.", result);
+
+			SetIndexOffset(static_cast< U32 >(nb_compact_indices * sizeof(U16)));
+		}
 
 		SetNumberOfIndices(m_indices.size());
 	}
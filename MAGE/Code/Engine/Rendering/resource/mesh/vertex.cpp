@@ -62,4 +62,10 @@ namespace mage::rendering {
 		{ g_vertex_semantic_name_color,    0u, DXGI_FORMAT_R32G32B32A32_FLOAT, 0u, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_VERTEX_DATA, 0u },
 		{ g_vertex_semantic_name_texture,  0u, DXGI_FORMAT_R32G32_FLOAT,       0u, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_VERTEX_DATA, 0u }
 	};
+
+	const D3D11_INPUT_ELEMENT_DESC CompactVertexPositionNormalTexture::s_input_element_descs[] = {
+		{ g_vertex_semantic_name_position, 0u, DXGI_FORMAT_R16G16B16A16_UNORM, 0u, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_VERTEX_DATA, 0u },
+		{ g_vertex_semantic_name_normal,   0u, DXGI_FORMAT_R16G16_UNORM,       0u, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_VERTEX_DATA, 0u },
+		{ g_vertex_semantic_name_texture,  0u, DXGI_FORMAT_R16G16_FLOAT,       0u, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_VERTEX_DATA, 0u }
+	};
 }
\ No newline at end of file
@@ -662,4 +662,93 @@ namespace mage::rendering {
 
 	static_assert(48u == sizeof(VertexPositionNormalColorTexture),
 				  "Vertex struct/layout mismatch");
+
+	/**
+	 A struct of compact vertices containing position, normal and texture
+	 coordinates.
+
+	 The position is quantized to 16 bits per axis relative to the bounds of
+	 the mesh, the normal is octahedron encoded in 2x16 bits and the texture
+	 coordinates are stored as half-precision floating point values.
+	 */
+	struct CompactVertexPositionNormalTexture {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Class Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Checks whether vertices have a position.
+
+		 @return		@c true if vertices have a position. @c false otherwise.
+		 */
+		[[nodiscard]]
+		static constexpr bool HasPosition() noexcept {
+			return true;
+		}
+
+		/**
+		 Checks whether vertices have a normal.
+
+		 @return		@c true if vertices have a normal. @c false otherwise.
+		 */
+		[[nodiscard]]
+		static constexpr bool HasNormal() noexcept {
+			return true;
+		}
+
+		/**
+		 Checks whether vertices have a texture.
+
+		 @return		@c true if vertices have a texture. @c false otherwise.
+		 */
+		[[nodiscard]]
+		static constexpr bool HasTexture() noexcept {
+			return true;
+		}
+
+		/**
+		 Checks whether vertices have a color.
+
+		 @return		@c true if vertices have a color. @c false otherwise.
+		 */
+		[[nodiscard]]
+		static constexpr bool HasColor() noexcept {
+			return false;
+		}
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The quantized position of this vertex (the fourth component is
+		 padding).
+		 */
+		U16x4 m_p;
+
+		/**
+		 The octahedron encoded normal of this vertex.
+		 */
+		U16x2 m_n;
+
+		/**
+		 The half-precision texture coordinates of this vertex.
+		 */
+		U16x2 m_tex;
+
+		//---------------------------------------------------------------------
+		// Class Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The input element descriptors of a vertex.
+		 */
+		static const D3D11_INPUT_ELEMENT_DESC s_input_element_descs[3u];
+	};
+
+	static_assert(16u == sizeof(CompactVertexPositionNormalTexture),
+				  "Vertex struct/layout mismatch");
 }
\ No newline at end of file
@@ -0,0 +1,177 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "resource\mesh\vertex_compression.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <DirectXPackedVector.h>
+#include <algorithm>
+#include <cmath>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	namespace {
+
+		/**
+		 The largest 16-bit UNORM value.
+		 */
+		constexpr F32 s_unorm16_max = 65535.0f;
+
+		/**
+		 Encodes the given value in the [0,1] range as a 16-bit UNORM value.
+
+		 @param[in]		x
+						The value.
+		 @return		The 16-bit UNORM value.
+		 */
+		[[nodiscard]]
+		inline U16 EncodeUNorm16(F32 x) noexcept {
+			return static_cast< U16 >(
+				std::lround(std::clamp(x, 0.0f, 1.0f) * s_unorm16_max));
+		}
+
+		/**
+		 Decodes the given 16-bit UNORM value to the [0,1] range.
+
+		 @param[in]		x
+						The 16-bit UNORM value.
+		 @return		The value.
+		 */
+		[[nodiscard]]
+		inline F32 DecodeUNorm16(U16 x) noexcept {
+			return static_cast< F32 >(x) * (1.0f / s_unorm16_max);
+		}
+
+		/**
+		 Encodes the given normal using an octahedron encoding (see
+		 EncodeUnitVector_Octahedron in unit_vector.hlsli).
+
+		 @param[in]		n
+						A reference to the normal.
+		 @return		The octahedron encoded normal.
+		 */
+		[[nodiscard]]
+		const U16x2 EncodeNormal(const Normal3& n) noexcept {
+			const auto l1 = std::abs(n[0]) + std::abs(n[1]) + std::abs(n[2]);
+			if (0.0f == l1) {
+				return { EncodeUNorm16(0.5f), EncodeUNorm16(0.5f) };
+			}
+
+			auto x = n[0] / l1;
+			auto y = n[1] / l1;
+			if (n[2] < 0.0f) {
+				const auto wrapped_x = (1.0f - std::abs(y)) * (0.0f <= x ? 1.0f : -1.0f);
+				const auto wrapped_y = (1.0f - std::abs(x)) * (0.0f <= y ? 1.0f : -1.0f);
+				x = wrapped_x;
+				y = wrapped_y;
+			}
+
+			return { EncodeUNorm16(0.5f * x + 0.5f),
+					 EncodeUNorm16(0.5f * y + 0.5f) };
+		}
+
+		/**
+		 Decodes the given octahedron encoded normal (see
+		 DecodeUnitVector_Octahedron in unit_vector.hlsli).
+
+		 @param[in]		e
+						A reference to the octahedron encoded normal.
+		 @return		The normal.
+		 */
+		[[nodiscard]]
+		const Normal3 DecodeNormal(const U16x2& e) noexcept {
+			const auto x = 2.0f * DecodeUNorm16(e[0]) - 1.0f;
+			const auto y = 2.0f * DecodeUNorm16(e[1]) - 1.0f;
+			const auto z = 1.0f - std::abs(x) - std::abs(y);
+			const auto s = std::max(-z, 0.0f);
+			const auto u_x = x + (0.0f <= x ? -s : s);
+			const auto u_y = y + (0.0f <= y ? -s : s);
+			const auto inv_l2 = 1.0f / std::sqrt(u_x * u_x + u_y * u_y + z * z);
+
+			return { u_x * inv_l2, u_y * inv_l2, z * inv_l2 };
+		}
+	}
+
+	[[nodiscard]]
+	std::vector< CompactVertexPositionNormalTexture >
+		EncodeVertices(gsl::span< const VertexPositionNormalTexture > vertices,
+					   const AABB& aabb) {
+
+		using DirectX::PackedVector::XMConvertFloatToHalf;
+
+		const auto p_min = XMStore< F32x3 >(aabb.MinPoint());
+		const auto p_ext = XMStore< F32x3 >(aabb.Diagonal());
+		F32x3 inv_p_ext;
+		for (std::size_t i = 0u; i < std::size(p_ext); ++i) {
+			// Degenerate axes are quantized to the minimum of the AABB.
+			inv_p_ext[i] = (0.0f < p_ext[i]) ? 1.0f / p_ext[i] : 0.0f;
+		}
+
+		std::vector< CompactVertexPositionNormalTexture > compact_vertices;
+		compact_vertices.reserve(vertices.size());
+
+		for (const auto& vertex : vertices) {
+			CompactVertexPositionNormalTexture compact_vertex;
+			compact_vertex.m_p = {
+				EncodeUNorm16((vertex.m_p[0] - p_min[0]) * inv_p_ext[0]),
+				EncodeUNorm16((vertex.m_p[1] - p_min[1]) * inv_p_ext[1]),
+				EncodeUNorm16((vertex.m_p[2] - p_min[2]) * inv_p_ext[2]),
+				U16(0u)
+			};
+			compact_vertex.m_n   = EncodeNormal(vertex.m_n);
+			compact_vertex.m_tex = {
+				XMConvertFloatToHalf(vertex.m_tex[0]),
+				XMConvertFloatToHalf(vertex.m_tex[1])
+			};
+
+			compact_vertices.push_back(compact_vertex);
+		}
+
+		return compact_vertices;
+	}
+
+	[[nodiscard]]
+	std::vector< VertexPositionNormalTexture >
+		DecodeVertices(gsl::span< const CompactVertexPositionNormalTexture > vertices,
+					   const AABB& aabb) {
+
+		using DirectX::PackedVector::XMConvertHalfToFloat;
+
+		const auto p_min = XMStore< F32x3 >(aabb.MinPoint());
+		const auto p_ext = XMStore< F32x3 >(aabb.Diagonal());
+
+		std::vector< VertexPositionNormalTexture > decoded_vertices;
+		decoded_vertices.reserve(vertices.size());
+
+		for (const auto& vertex : vertices) {
+			VertexPositionNormalTexture decoded_vertex;
+			decoded_vertex.m_p = {
+				p_min[0] + DecodeUNorm16(vertex.m_p[0]) * p_ext[0],
+				p_min[1] + DecodeUNorm16(vertex.m_p[1]) * p_ext[1],
+				p_min[2] + DecodeUNorm16(vertex.m_p[2]) * p_ext[2]
+			};
+			decoded_vertex.m_n   = DecodeNormal(vertex.m_n);
+			decoded_vertex.m_tex = {
+				XMConvertHalfToFloat(vertex.m_tex[0]),
+				XMConvertHalfToFloat(vertex.m_tex[1])
+			};
+
+			decoded_vertices.push_back(decoded_vertex);
+		}
+
+		return decoded_vertices;
+	}
+}
\ No newline at end of file
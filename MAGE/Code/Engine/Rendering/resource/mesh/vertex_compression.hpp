@@ -0,0 +1,63 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "resource\mesh\vertex.hpp"
+#include "geometry\bounding_volume.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <gsl\span>
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	/**
+	 Encodes the given vertices as compact vertices.
+
+	 The positions are quantized to 16 bits per axis relative to the given
+	 AABB, the normals are octahedron encoded in 2x16 bits and the texture
+	 coordinates are converted to half-precision floating point values. The
+	 maximum position error is half the quantization step (i.e. the extent of
+	 the given AABB along each axis divided by 131070).
+
+	 @pre			The given AABB encloses all given vertices.
+	 @param[in]		vertices
+					A span containing the vertices.
+	 @param[in]		aabb
+					A reference to the AABB.
+	 @return		A vector containing the compact vertices.
+	 */
+	[[nodiscard]]
+	std::vector< CompactVertexPositionNormalTexture >
+		EncodeVertices(gsl::span< const VertexPositionNormalTexture > vertices,
+					   const AABB& aabb);
+
+	/**
+	 Decodes the given compact vertices.
+
+	 @param[in]		vertices
+					A span containing the compact vertices.
+	 @param[in]		aabb
+					A reference to the AABB the positions of the compact
+					vertices are quantized relative to.
+	 @return		A vector containing the vertices.
+	 */
+	[[nodiscard]]
+	std::vector< VertexPositionNormalTexture >
+		DecodeVertices(gsl::span< const CompactVertexPositionNormalTexture > vertices,
+					   const AABB& aabb);
+}
\ No newline at end of file
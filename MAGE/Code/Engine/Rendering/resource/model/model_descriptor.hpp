@@ -6,6 +6,7 @@
 #pragma region
 
 #include "resource\mesh\static_mesh.hpp"
+#include "resource\mesh\vertex_compression.hpp"
 #include "loaders\model_loader.hpp"
 
 #pragma endregion
@@ -37,6 +38,13 @@ namespace mage::rendering {
 		/**
 		 Constructs a model descriptor.
 
+		 The model is imported from its cached MDLB file if that file is
+		 fresh. Otherwise, the model is imported from its source file and
+		 the MDLB file is (re)built. The indices of the model parts are
+		 rebased and stored as 16-bit indices wherever possible. The vertices
+		 are stored as compact vertices if requested by the given mesh
+		 descriptor.
+
 		 @tparam		VertexT
 						The vertex type.
 		 @tparam		IndexT
@@ -1,10 +1,65 @@
 #pragma once
 
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <type_traits>
+#include <utility>
+
+#pragma endregion
+
 //-----------------------------------------------------------------------------
 // Engine Definitions
 //-----------------------------------------------------------------------------
 namespace mage::rendering {
 
+	namespace details {
+
+		/**
+		 Creates a static mesh.
+
+		 @tparam		VertexT
+						The vertex type.
+		 @tparam		IndexT
+						The index type.
+		 @param[in,out]	device
+						A reference to the device.
+		 @param[in]		vertices
+						A vector containing the vertices.
+		 @param[in]		compact_indices
+						A vector containing the 16-bit indices.
+		 @param[in]		indices
+						A vector containing the indices.
+		 @return		A pointer to the static mesh.
+		 @throws		Exception
+						Failed to create the static mesh.
+		 */
+		template< typename VertexT, typename IndexT >
+		[[nodiscard]]
+		SharedPtr< StaticMesh< VertexT, IndexT > >
+			CreateStaticMesh(ID3D11Device& device,
+							 std::vector< VertexT > vertices,
+							 std::vector< U16 > compact_indices,
+							 std::vector< IndexT > indices) {
+
+			if constexpr (sizeof(U16) < sizeof(IndexT)) {
+				return MakeShared< StaticMesh< VertexT, IndexT > >(
+					               device,
+					               std::move(vertices),
+					               std::move(compact_indices),
+					               std::move(indices));
+			}
+			else {
+				return MakeShared< StaticMesh< VertexT, IndexT > >(
+					               device,
+					               std::move(vertices),
+					               std::move(indices));
+			}
+		}
+	}
+
 	template< typename VertexT, typename IndexT >
 	ModelDescriptor::ModelDescriptor(ID3D11Device& device,
 									 ResourceManager& resource_manager,
@@ -17,7 +72,22 @@ namespace mage::rendering {
 		m_model_parts() {
 
 		ModelOutput< VertexT, IndexT > buffer;
-		loader::ImportModelFromFile(GetPath(), resource_manager, buffer, desc);
+
+		// Use the cached MDLB file if fresh, and rebuild it otherwise.
+		const auto mdlb_path = loader::GetMDLBPath(GetPath());
+		const auto is_cached = loader::ImportMDLBModelFromFile(
+			mdlb_path, GetPath(), resource_manager, buffer, desc);
+		if (!is_cached) {
+			loader::ImportModelFromFile(GetPath(), resource_manager, buffer, desc);
+
+			try {
+				loader::ExportMDLBModelToFile(mdlb_path, GetPath(), buffer, desc);
+			}
+			catch (const std::exception& exception) {
+				Warning("{}: could not cache the model: {}",
+						GetPath(), exception.what());
+			}
+		}
 
 		if (export_as_MDL) {
 			auto mdl_path = GetPath();
@@ -26,10 +96,39 @@ namespace mage::rendering {
 			loader::ExportModelToFile(mdl_path, buffer);
 		}
 
-		m_mesh = MakeShared< StaticMesh< VertexT, IndexT > >(
-			               device,
-			               std::move(buffer.m_vertex_buffer),
-			               std::move(buffer.m_index_buffer));
+		// Use 16-bit indices for all model parts spanning few enough vertices.
+		std::vector< U16 >    compact_indices;
+		std::vector< IndexT > indices;
+		buffer.CompactModelParts(compact_indices, indices);
+
+		if (desc.CompactVertices()) {
+			if constexpr (std::is_same_v< VertexT, VertexPositionNormalTexture >) {
+				AABB aabb;
+				for (const auto& vertex : buffer.m_vertex_buffer) {
+					aabb = AABB::Union(aabb, vertex);
+				}
+
+				auto mesh = details::CreateStaticMesh(
+					device,
+					EncodeVertices(gsl::make_span(std::as_const(buffer.m_vertex_buffer)), aabb),
+					std::move(compact_indices),
+					std::move(indices));
+				mesh->SetCompactVertices(XMStore< F32x3 >(aabb.MinPoint()),
+										 XMStore< F32x3 >(aabb.Diagonal()));
+				m_mesh = std::move(mesh);
+			}
+			else {
+				Warning("{}: compact vertices require position, normal and texture coordinates.",
+						GetPath());
+			}
+		}
+
+		if (!m_mesh) {
+			m_mesh = details::CreateStaticMesh(device,
+											   std::move(buffer.m_vertex_buffer),
+											   std::move(compact_indices),
+											   std::move(indices));
+		}
 		m_materials   = std::move(buffer.m_material_buffer);
 		m_model_parts = std::move(buffer.m_model_parts);
 	}
@@ -8,10 +8,27 @@
 #include "transform\transform.hpp"
 #include "geometry\bounding_volume.hpp"
 #include "resource\model\material.hpp"
+#include "resource\mesh\mesh.hpp"
+#include "resource\mesh\mesh_optimizer.hpp"
+#include "collection\hash_map.hpp"
 #include "collection\vector.hpp"
 
 #pragma endregion
 
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <limits>
+#include <string_view>
+#include <utility>
+
+#pragma endregion
+
 //-----------------------------------------------------------------------------
 // Engine Declarations and Definitions
 //-----------------------------------------------------------------------------
@@ -120,6 +137,20 @@ namespace mage::rendering {
 		 */
 		U32 m_nb_indices = 0u;
 
+		/**
+		 The base vertex of this model part in the mesh of the corresponding
+		 model (i.e. the value added to each index of this model part before
+		 reading a vertex from the vertex buffer).
+		 */
+		U32 m_base_vertex = 0u;
+
+		/**
+		 The index format of this model part in the mesh of the corresponding
+		 model. @c DXGI_FORMAT_UNKNOWN corresponds to the index format of that
+		 mesh.
+		 */
+		DXGI_FORMAT m_index_format = DXGI_FORMAT_UNKNOWN;
+
 		//---------------------------------------------------------------------
 		// Member Variables: Scene Graph
 		//---------------------------------------------------------------------
@@ -179,6 +210,49 @@ namespace mage::rendering {
 		 */
 		void NormalizeModelParts() noexcept;
 
+		/**
+		 Welds the vertices with bitwise identical attributes of each model
+		 part of this model output.
+
+		 Vertices are only welded within a model part: each model part
+		 references its own contiguous range of vertices afterwards (i.e.
+		 model parts do not share vertices). The vertices of each model part
+		 are stored in order of first use.
+		 */
+		void WeldModelParts();
+
+		/**
+		 Optimizes the model parts of this model output.
+
+		 The triangles of each model part are reordered for the
+		 post-transform vertex cache and overdraw, after which the vertices
+		 are reordered in order of first use.
+
+		 @param[in]		clockwise_order
+						@c true if front faces are defined in clockwise
+						order. @c false otherwise.
+		 */
+		void OptimizeModelParts(bool clockwise_order = true);
+
+		/**
+		 Compacts the indices of the model parts of this model output.
+
+		 The indices of each model part are rebased on the smallest vertex
+		 index of that model part. The indices of model parts spanning less
+		 than 65535 vertices are moved to the given 16-bit indices (if
+		 @c IndexT is wider), and the indices of all other model parts are
+		 moved to the given indices. The start index, base vertex and index
+		 format of each model part are updated accordingly.
+
+		 @param[out]	compact_indices
+						A reference to a vector for storing the 16-bit
+						indices.
+		 @param[out]	indices
+						A reference to a vector for storing the indices.
+		 */
+		void CompactModelParts(std::vector< U16 >& compact_indices,
+							   std::vector< IndexT >& indices);
+
 		//---------------------------------------------------------------------
 		// Member Variables
 		//---------------------------------------------------------------------
@@ -203,6 +277,13 @@ namespace mage::rendering {
 		 */
 		AlignedVector< ModelPart > m_model_parts;
 
+		/**
+		 A vector containing the paths of the files (e.g., MSH and MTL files)
+		 the model of this model output is imported from, besides the model
+		 file itself.
+		 */
+		std::vector< std::filesystem::path > m_dependencies;
+
 	private:
 
 		//---------------------------------------------------------------------
@@ -218,6 +299,53 @@ namespace mage::rendering {
 		 Normalizes the vertices in object space of this model output.
 		 */
 		void NormalizeInObjectSpace() noexcept;
+
+		/**
+		 A struct of vertex hash functions hashing the bitwise
+		 representation of vertices.
+		 */
+		struct VertexHash {
+
+		public:
+
+			/**
+			 Hashes the given vertex.
+
+			 @param[in]		vertex
+							A reference to the vertex.
+			 @return		The hash of the given vertex.
+			 */
+			[[nodiscard]]
+			std::size_t operator()(const VertexT& vertex) const noexcept {
+				const std::string_view bytes(
+					reinterpret_cast< const char* >(&vertex), sizeof(VertexT));
+				return std::hash< std::string_view >()(bytes);
+			}
+		};
+
+		/**
+		 A struct of vertex equality functions comparing the bitwise
+		 representation of vertices.
+		 */
+		struct VertexEqual {
+
+		public:
+
+			/**
+			 Compares the two given vertices against each other.
+
+			 @param[in]		lhs
+							A reference to the first vertex.
+			 @param[in]		rhs
+							A reference to the second vertex.
+			 @return		@c true if @a lhs and @a rhs are bitwise identical.
+							@c false otherwise.
+			 */
+			[[nodiscard]]
+			bool operator()(const VertexT& lhs, const VertexT& rhs) const noexcept {
+				return 0 == std::memcmp(&lhs, &rhs, sizeof(VertexT));
+			}
+		};
 	};
 }
 
@@ -49,6 +49,144 @@ namespace mage::rendering {
 		NormalizeInObjectSpace();
 	}
 
+	template< typename VertexT, typename IndexT >
+	void ModelOutput< VertexT, IndexT >::WeldModelParts() {
+		std::vector< VertexT > vertices;
+		vertices.reserve(m_vertex_buffer.size());
+		HashMap< VertexT, IndexT, VertexHash, VertexEqual > mapping;
+
+		for (const auto& model_part : m_model_parts) {
+			const std::size_t start = model_part.m_start_index;
+			const std::size_t end   = start + model_part.m_nb_indices;
+
+			// Model parts are not allowed to share vertices.
+			mapping.clear();
+
+			for (auto i = start; i < end; ++i) {
+				const auto& vertex = m_vertex_buffer[m_index_buffer[i]];
+				const auto [index, inserted] = mapping.try_emplace(
+					vertex, mapping.hash(vertex),
+					static_cast< IndexT >(vertices.size()));
+				if (inserted) {
+					vertices.push_back(vertex);
+				}
+
+				m_index_buffer[i] = *index;
+			}
+		}
+
+		m_vertex_buffer = std::move(vertices);
+	}
+
+	template< typename VertexT, typename IndexT >
+	void ModelOutput< VertexT, IndexT >
+		::OptimizeModelParts(bool clockwise_order) {
+
+		constexpr auto s_invalid = std::numeric_limits< U32 >::max();
+
+		// Mapping from the vertex buffer to the vertices of a model part.
+		std::vector< U32 > local_indices(m_vertex_buffer.size(), s_invalid);
+		// Mapping from the vertices of a model part to the vertex buffer.
+		std::vector< IndexT > global_indices;
+		std::vector< U32 > indices;
+		std::vector< Point3 > positions;
+		std::vector< std::size_t > clusters;
+
+		for (const auto& model_part : m_model_parts) {
+			const std::size_t start = model_part.m_start_index;
+			const std::size_t count = model_part.m_nb_indices;
+			if (0u != count % 3u) {
+				continue;
+			}
+
+			const auto part_indices = gsl::make_span(m_index_buffer)
+				                      .subspan(start, count);
+
+			// Compact the vertices of the model part.
+			global_indices.clear();
+			indices.clear();
+			positions.clear();
+			for (const auto index : part_indices) {
+				auto& local_index = local_indices[index];
+				if (s_invalid == local_index) {
+					local_index = static_cast< U32 >(global_indices.size());
+					global_indices.push_back(index);
+					if constexpr (VertexT::HasPosition()) {
+						positions.push_back(m_vertex_buffer[index].m_p);
+					}
+				}
+
+				indices.push_back(local_index);
+			}
+
+			OptimizeVertexCache(gsl::make_span(indices),
+								global_indices.size(), clusters);
+			if constexpr (VertexT::HasPosition()) {
+				OptimizeOverdraw(gsl::make_span(indices),
+								 gsl::make_span(positions),
+								 gsl::make_span(clusters),
+								 clockwise_order);
+			}
+
+			for (std::size_t i = 0u; i < count; ++i) {
+				part_indices[i] = global_indices[indices[i]];
+			}
+			for (const auto index : global_indices) {
+				local_indices[index] = s_invalid;
+			}
+		}
+
+		OptimizeVertexFetch(m_vertex_buffer, gsl::make_span(m_index_buffer));
+	}
+
+	template< typename VertexT, typename IndexT >
+	void ModelOutput< VertexT, IndexT >
+		::CompactModelParts(std::vector< U16 >& compact_indices,
+							std::vector< IndexT >& indices) {
+
+		constexpr bool s_compact = sizeof(U16) < sizeof(IndexT);
+
+		compact_indices.clear();
+		indices.clear();
+
+		for (auto& model_part : m_model_parts) {
+			const auto part_indices = gsl::make_span(std::as_const(m_index_buffer))
+				                      .subspan(model_part.m_start_index,
+											   model_part.m_nb_indices);
+			if (part_indices.empty()) {
+				model_part.m_start_index  = 0u;
+				model_part.m_base_vertex  = 0u;
+				model_part.m_index_format = GetIndexFormat< IndexT >();
+				continue;
+			}
+
+			const auto [min_index, max_index]
+				= std::minmax_element(part_indices.cbegin(), part_indices.cend());
+			const auto base_vertex = static_cast< U32 >(*min_index);
+			const auto range       = static_cast< U32 >(*max_index) - base_vertex;
+
+			model_part.m_base_vertex = base_vertex;
+
+			// The largest 16-bit index is reserved as strip cut value.
+			if (s_compact && range < std::numeric_limits< U16 >::max()) {
+				model_part.m_start_index  = static_cast< U32 >(compact_indices.size());
+				model_part.m_index_format = DXGI_FORMAT_R16_UINT;
+				for (const auto index : part_indices) {
+					compact_indices.push_back(
+						static_cast< U16 >(static_cast< U32 >(index) - base_vertex));
+				}
+			}
+			else {
+				model_part.m_start_index  = static_cast< U32 >(indices.size());
+				model_part.m_index_format = GetIndexFormat< IndexT >();
+				for (const auto index : part_indices) {
+					indices.push_back(
+						static_cast< IndexT >(static_cast< U32 >(index) - base_vertex));
+				}
+			}
+		}
+	}
+
 	template< typename VertexT, typename IndexT >
 	void ModelOutput< VertexT, IndexT >::NormalizeInWorldSpace() noexcept {
 		AABB aabb;
@@ -12,8 +12,10 @@
 //-----------------------------------------------------------------------------
 namespace mage::rendering {
 
-	ResourceManager::ResourceManager(ID3D11Device& device)
+	ResourceManager::ResourceManager(ID3D11Device& device,
+									 JobSystem& job_system)
 		: m_device(device),
+		m_job_system(job_system),
 		m_model_descriptor_pool(),
 		m_vs_pool(),
 		m_hs_pool(),
@@ -9,6 +9,7 @@
 #include "resource\model\model_descriptor.hpp"
 #include "resource\shader\shader.hpp"
 #include "resource\font\sprite_font.hpp"
+#include "parallel\job_system.hpp"
 
 #pragma endregion
 
@@ -124,8 +125,11 @@ namespace mage::rendering {
 
 		 @param[in,out]	device
 						A reference to the device.
+		 @param[in,out]	job_system
+						A reference to the job system used for loading
+						resources.
 		 */
-		explicit ResourceManager(ID3D11Device& device);
+		explicit ResourceManager(ID3D11Device& device, JobSystem& job_system);
 
 		/**
 		 Constructs a resource manager from the given resource manager.
@@ -176,6 +180,17 @@ namespace mage::rendering {
 		// Member Methods
 		//---------------------------------------------------------------------
 
+		/**
+		 Returns the job system of this resource manager.
+
+		 @return		A reference to the job system of this resource
+						manager.
+		 */
+		[[nodiscard]]
+		JobSystem& GetJobSystem() const noexcept {
+			return m_job_system;
+		}
+
 		/**
 		 Checks whether this resource manager contains a resource of the given
 		 type corresponding to the given globally unique identifier.
@@ -447,6 +462,11 @@ namespace mage::rendering {
 		 */
 		ID3D11Device& m_device;
 
+		/**
+		 A reference to the job system of this resource manager.
+		 */
+		JobSystem& m_job_system;
+
 		/**
 		 The model descriptor resource pool of this resource manager.
 		 */
@@ -24,6 +24,9 @@
 
 // Transform
 #include "transform\transform_VS.hpp"
+#include "transform\transform_instanced_VS.hpp"
+#include "transform\transform_compact_VS.hpp"
+#include "transform\transform_instanced_compact_VS.hpp"
 
 #pragma endregion
 
@@ -112,11 +115,38 @@ namespace mage::rendering {
 	//-------------------------------------------------------------------------
 	#pragma region
 
-	VertexShaderPtr CreateTransformVS(ResourceManager& resource_manager) {
-		using Vertex = VertexPositionNormalTexture;
-		return CreateVS(resource_manager,
-						MAGE_SHADER_ARGS(g_transform_VS),
-						gsl::make_span(Vertex::s_input_element_descs));
+	VertexShaderPtr CreateTransformVS(ResourceManager& resource_manager,
+									  bool compact_vertices) {
+
+		if (compact_vertices) {
+			using Vertex = CompactVertexPositionNormalTexture;
+			return CreateVS(resource_manager,
+							MAGE_SHADER_ARGS(g_transform_compact_VS),
+							gsl::make_span(Vertex::s_input_element_descs));
+		}
+		else {
+			using Vertex = VertexPositionNormalTexture;
+			return CreateVS(resource_manager,
+							MAGE_SHADER_ARGS(g_transform_VS),
+							gsl::make_span(Vertex::s_input_element_descs));
+		}
+	}
+
+	VertexShaderPtr CreateTransformInstancedVS(ResourceManager& resource_manager,
+											   bool compact_vertices) {
+
+		if (compact_vertices) {
+			using Vertex = CompactVertexPositionNormalTexture;
+			return CreateVS(resource_manager,
+							MAGE_SHADER_ARGS(g_transform_instanced_compact_VS),
+							gsl::make_span(Vertex::s_input_element_descs));
+		}
+		else {
+			using Vertex = VertexPositionNormalTexture;
+			return CreateVS(resource_manager,
+							MAGE_SHADER_ARGS(g_transform_instanced_VS),
+							gsl::make_span(Vertex::s_input_element_descs));
+		}
 	}
 
 	#pragma endregion
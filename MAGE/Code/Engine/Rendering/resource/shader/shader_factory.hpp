@@ -280,22 +280,30 @@ namespace mage::rendering {
 
 	 @param[in,out]	resource_manager
 					A reference to the resource manager.
+	 @param[in]		compact_vertices
+					@c true if the vertex shader should consume compact
+					vertices. @c false otherwise.
 	 @return		A pointer to the depth vertex shader.
 	 @throws		Exception
 					Failed to create the vertex shader.
 	 */
-	VertexShaderPtr CreateDepthVS(ResourceManager& resource_manager);
+	VertexShaderPtr CreateDepthVS(ResourceManager& resource_manager,
+								  bool compact_vertices);
 
 	/**
 	 Creates a depth transparent vertex shader.
 
 	 @param[in,out]	resource_manager
 					A reference to the resource manager.
+	 @param[in]		compact_vertices
+					@c true if the vertex shader should consume compact
+					vertices. @c false otherwise.
 	 @return		A pointer to the depth transparent vertex shader.
 	 @throws		Exception
 					Failed to create the vertex shader.
 	 */
-	VertexShaderPtr CreateDepthTransparentVS(ResourceManager& resource_manager);
+	VertexShaderPtr CreateDepthTransparentVS(ResourceManager& resource_manager,
+											 bool compact_vertices);
 
 	/**
 	 Creates a depth transparent pixel shader.
@@ -308,6 +316,18 @@ namespace mage::rendering {
 	 */
 	PixelShaderPtr CreateDepthTransparentPS(ResourceManager& resource_manager);
 
+	/**
+	 Creates a depth copy pixel shader (i.e. a pixel shader which outputs
+	 the depth of the texel of the image SRV at its position).
+
+	 @param[in,out]	resource_manager
+					A reference to the resource manager.
+	 @return		A pointer to the depth copy pixel shader.
+	 @throws		Exception
+					Failed to create the pixel shader.
+	 */
+	PixelShaderPtr CreateDepthCopyPS(ResourceManager& resource_manager);
+
 	#pragma endregion
 
 	//-------------------------------------------------------------------------
@@ -564,11 +584,30 @@ namespace mage::rendering {
 
 	 @param[in,out]	resource_manager
 					A reference to the resource manager.
+	 @param[in]		compact_vertices
+					@c true if the vertex shader should consume compact
+					vertices. @c false otherwise.
 	 @return		A pointer to the transform vertex shader.
 	 @throws		Exception
 					Failed to create the vertex shader.
 	 */
-	VertexShaderPtr CreateTransformVS(ResourceManager& resource_manager);
+	VertexShaderPtr CreateTransformVS(ResourceManager& resource_manager,
+									  bool compact_vertices);
+
+	/**
+	 Creates an instanced transform vertex shader.
+
+	 @param[in,out]	resource_manager
+					A reference to the resource manager.
+	 @param[in]		compact_vertices
+					@c true if the vertex shader should consume compact
+					vertices. @c false otherwise.
+	 @return		A pointer to the instanced transform vertex shader.
+	 @throws		Exception
+					Failed to create the vertex shader.
+	 */
+	VertexShaderPtr CreateTransformInstancedVS(ResourceManager& resource_manager,
+											   bool compact_vertices);
 
 	#pragma endregion
 
@@ -582,11 +621,15 @@ namespace mage::rendering {
 
 	 @param[in,out]	resource_manager
 					A reference to the resource manager.
+	 @param[in]		compact_vertices
+					@c true if the vertex shader should consume compact
+					vertices. @c false otherwise.
 	 @return		A pointer to the voxelization geometry shader.
 	 @throws		Exception
 					Failed to create the vertex shader.
 	 */
-	VertexShaderPtr CreateVoxelizationVS(ResourceManager& resource_manager);
+	VertexShaderPtr CreateVoxelizationVS(ResourceManager& resource_manager,
+										 bool compact_vertices);
 
 	/**
 	 Creates a voxelization geometry shader.
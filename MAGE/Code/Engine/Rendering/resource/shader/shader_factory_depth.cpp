@@ -8,9 +8,13 @@
 
 // Depth: Opaque
 #include "depth\depth_VS.hpp"
+#include "depth\depth_compact_VS.hpp"
 // Depth: Transparent
 #include "depth\depth_transparent_VS.hpp"
+#include "depth\depth_transparent_compact_VS.hpp"
 #include "depth\depth_transparent_PS.hpp"
+// Depth: Copy
+#include "depth\depth_copy_PS.hpp"
 
 #pragma endregion
 
@@ -35,18 +39,38 @@ namespace mage::rendering {
 	//-------------------------------------------------------------------------
 	#pragma region
 
-	VertexShaderPtr CreateDepthVS(ResourceManager& resource_manager) {
-		using Vertex = VertexPositionNormalTexture;
-		return CreateVS(resource_manager,
-						MAGE_SHADER_ARGS(g_depth_VS),
-						gsl::make_span(Vertex::s_input_element_descs));
+	VertexShaderPtr CreateDepthVS(ResourceManager& resource_manager,
+								  bool compact_vertices) {
+
+		if (compact_vertices) {
+			using Vertex = CompactVertexPositionNormalTexture;
+			return CreateVS(resource_manager,
+							MAGE_SHADER_ARGS(g_depth_compact_VS),
+							gsl::make_span(Vertex::s_input_element_descs));
+		}
+		else {
+			using Vertex = VertexPositionNormalTexture;
+			return CreateVS(resource_manager,
+							MAGE_SHADER_ARGS(g_depth_VS),
+							gsl::make_span(Vertex::s_input_element_descs));
+		}
 	}
 
-	VertexShaderPtr CreateDepthTransparentVS(ResourceManager& resource_manager) {
-		using Vertex = VertexPositionNormalTexture;
-		return CreateVS(resource_manager,
-						MAGE_SHADER_ARGS(g_depth_transparent_VS),
-						gsl::make_span(Vertex::s_input_element_descs));
+	VertexShaderPtr CreateDepthTransparentVS(ResourceManager& resource_manager,
+											 bool compact_vertices) {
+
+		if (compact_vertices) {
+			using Vertex = CompactVertexPositionNormalTexture;
+			return CreateVS(resource_manager,
+							MAGE_SHADER_ARGS(g_depth_transparent_compact_VS),
+							gsl::make_span(Vertex::s_input_element_descs));
+		}
+		else {
+			using Vertex = VertexPositionNormalTexture;
+			return CreateVS(resource_manager,
+							MAGE_SHADER_ARGS(g_depth_transparent_VS),
+							gsl::make_span(Vertex::s_input_element_descs));
+		}
 	}
 
 	PixelShaderPtr CreateDepthTransparentPS(ResourceManager& resource_manager) {
@@ -54,5 +78,10 @@ namespace mage::rendering {
 						MAGE_SHADER_ARGS(g_depth_transparent_PS));
 	}
 
+	PixelShaderPtr CreateDepthCopyPS(ResourceManager& resource_manager) {
+		return CreatePS(resource_manager,
+						MAGE_SHADER_ARGS(g_depth_copy_PS));
+	}
+
 	#pragma endregion
 }
\ No newline at end of file
@@ -9,6 +9,7 @@
 // Voxelization
 #include "voxelization\voxelization_CS.hpp"
 #include "voxelization\voxelization_VS.hpp"
+#include "voxelization\voxelization_compact_VS.hpp"
 #include "voxelization\voxelization_GS.hpp"
 // Voxelization: Opaque
 #include "voxelization\voxelization_emissive_PS.hpp"
@@ -43,11 +44,21 @@ namespace mage::rendering {
 	//-------------------------------------------------------------------------
 	#pragma region
 
-	VertexShaderPtr CreateVoxelizationVS(ResourceManager& resource_manager) {
-		using Vertex = VertexPositionNormalTexture;
-		return CreateVS(resource_manager,
-						MAGE_SHADER_ARGS(g_voxelization_VS),
-						gsl::make_span(Vertex::s_input_element_descs));
+	VertexShaderPtr CreateVoxelizationVS(ResourceManager& resource_manager,
+										 bool compact_vertices) {
+
+		if (compact_vertices) {
+			using Vertex = CompactVertexPositionNormalTexture;
+			return CreateVS(resource_manager,
+							MAGE_SHADER_ARGS(g_voxelization_compact_VS),
+							gsl::make_span(Vertex::s_input_element_descs));
+		}
+		else {
+			using Vertex = VertexPositionNormalTexture;
+			return CreateVS(resource_manager,
+							MAGE_SHADER_ARGS(g_voxelization_VS),
+							gsl::make_span(Vertex::s_input_element_descs));
+		}
 	}
 
 	GeometryShaderPtr CreateVoxelizationGS(ResourceManager& resource_manager) {
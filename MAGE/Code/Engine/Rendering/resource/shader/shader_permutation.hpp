@@ -0,0 +1,319 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "renderer\configuration.hpp"
+#include "resource\shader\shader.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <array>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	//-------------------------------------------------------------------------
+	// ShaderPermutationCache
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A class of shader permutation caches.
+
+	 A shader permutation cache maps compile-time permutation identifiers to
+	 resolved shaders. Each shader is resolved through the resource manager
+	 once; subsequent fetches reduce to an array index. Shader permutation
+	 caches are owned by a single pass and are not thread-safe.
+
+	 @tparam		ShaderT
+					The shader type.
+	 @tparam		N
+					The number of permutations.
+	 */
+	template< typename ShaderT, std::size_t N >
+	class ShaderPermutationCache {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Class Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The number of permutations of shader permutation caches.
+		 */
+		static constexpr std::size_t s_nb_permutations = N;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the shader of the given permutation.
+
+		 @pre			@a permutation is smaller than @c N.
+		 @tparam		FactoryT
+						The factory type.
+		 @param[in]		permutation
+						The permutation.
+		 @param[in]		factory
+						A reference to the factory creating the shader of the
+						given permutation on a cache miss.
+		 @return		A reference to the pointer to the shader of the given
+						permutation.
+		 @throws		Exception
+						Failed to create the shader.
+		 */
+		template< typename FactoryT >
+		const SharedPtr< const ShaderT >& Get(std::size_t permutation,
+											  FactoryT&& factory) {
+			auto& shader = m_shaders[permutation];
+			if (!shader) {
+				shader = factory();
+			}
+
+			return shader;
+		}
+
+		/**
+		 Clears this shader permutation cache.
+		 */
+		void Clear() noexcept {
+			for (auto& shader : m_shaders) {
+				shader.reset();
+			}
+		}
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 An array containing the shader of each permutation of this shader
+		 permutation cache.
+		 */
+		std::array< SharedPtr< const ShaderT >, N > m_shaders = {};
+	};
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// Shader Permutations: Deferred
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 Returns the deferred shader permutation.
+
+	 @param[in]		brdf
+					The BRDF.
+	 @param[in]		vct
+					@c true if voxel cone tracing should be enabled. @c false
+					otherwise.
+	 @return		The deferred shader permutation.
+	 */
+	[[nodiscard]]
+	constexpr std::size_t GetDeferredPermutation(BRDF brdf,
+												 bool vct) noexcept {
+		return (static_cast< std::size_t >(brdf) << 1u)
+			 | static_cast< std::size_t >(vct);
+	}
+
+	/**
+	 A shader permutation cache of deferred compute shaders.
+	 */
+	using DeferredCSCache
+		= ShaderPermutationCache< ComputeShader,
+		                          GetDeferredPermutation(BRDF::Frostbite, true) + 1u >;
+
+	/**
+	 A shader permutation cache of deferred MSAA pixel shaders.
+	 */
+	using DeferredMSAAPSCache
+		= ShaderPermutationCache< PixelShader,
+		                          GetDeferredPermutation(BRDF::Frostbite, true) + 1u >;
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// Shader Permutations: False Color
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 Returns the false color shader permutation.
+
+	 @param[in]		false_color
+					The false color.
+	 @return		The false color shader permutation.
+	 */
+	[[nodiscard]]
+	constexpr std::size_t GetFalseColorPermutation(FalseColor false_color) noexcept {
+		return static_cast< std::size_t >(false_color);
+	}
+
+	/**
+	 A shader permutation cache of false color pixel shaders.
+	 */
+	using FalseColorPSCache
+		= ShaderPermutationCache< PixelShader,
+		                          GetFalseColorPermutation(FalseColor::UV) + 1u >;
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// Shader Permutations: Forward
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 Returns the forward emissive shader permutation.
+
+	 @param[in]		transparency
+					@c true if transparency should be enabled. @c false
+					otherwise.
+	 @return		The forward emissive shader permutation.
+	 */
+	[[nodiscard]]
+	constexpr std::size_t GetForwardEmissivePermutation(bool transparency) noexcept {
+		return static_cast< std::size_t >(transparency);
+	}
+
+	/**
+	 Returns the forward shader permutation.
+
+	 @param[in]		brdf
+					The BRDF.
+	 @param[in]		transparency
+					@c true if transparency should be enabled. @c false
+					otherwise.
+	 @param[in]		vct
+					@c true if voxel cone tracing should be enabled. @c false
+					otherwise.
+	 @param[in]		tsnm
+					@c true if tangent space normal mapping should be enabled.
+					@c false otherwise.
+	 @return		The forward shader permutation.
+	 */
+	[[nodiscard]]
+	constexpr std::size_t GetForwardPermutation(BRDF brdf,
+												bool transparency,
+												bool vct,
+												bool tsnm) noexcept {
+		return (static_cast< std::size_t >(brdf)         << 3u)
+			 | (static_cast< std::size_t >(transparency) << 2u)
+			 | (static_cast< std::size_t >(vct)          << 1u)
+			 |  static_cast< std::size_t >(tsnm);
+	}
+
+	/**
+	 A shader permutation cache of forward emissive pixel shaders.
+	 */
+	using ForwardEmissivePSCache
+		= ShaderPermutationCache< PixelShader,
+		                          GetForwardEmissivePermutation(true) + 1u >;
+
+	/**
+	 A shader permutation cache of forward pixel shaders.
+	 */
+	using ForwardPSCache
+		= ShaderPermutationCache< PixelShader,
+		                          GetForwardPermutation(BRDF::Frostbite,
+		                                                true, true, true) + 1u >;
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// Shader Permutations: GBuffer
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 Returns the GBuffer shader permutation.
+
+	 @param[in]		tsnm
+					@c true if tangent space normal mapping should be enabled.
+					@c false otherwise.
+	 @return		The GBuffer shader permutation.
+	 */
+	[[nodiscard]]
+	constexpr std::size_t GetGBufferPermutation(bool tsnm) noexcept {
+		return static_cast< std::size_t >(tsnm);
+	}
+
+	/**
+	 A shader permutation cache of GBuffer pixel shaders.
+	 */
+	using GBufferPSCache
+		= ShaderPermutationCache< PixelShader,
+		                          GetGBufferPermutation(true) + 1u >;
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// Shader Permutations: Post-processing
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 Returns the low-dynamic-range shader permutation.
+
+	 @param[in]		tone_mapping
+					The tone mapping function.
+	 @return		The low-dynamic-range shader permutation.
+	 */
+	[[nodiscard]]
+	constexpr std::size_t GetLowDynamicRangePermutation(ToneMapping tone_mapping) noexcept {
+		return static_cast< std::size_t >(tone_mapping);
+	}
+
+	/**
+	 A shader permutation cache of low-dynamic-range compute shaders.
+	 */
+	using LowDynamicRangeCSCache
+		= ShaderPermutationCache< ComputeShader,
+		                          GetLowDynamicRangePermutation(ToneMapping::Uncharted) + 1u >;
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// Shader Permutations: Voxelization
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 Returns the voxelization shader permutation.
+
+	 @param[in]		tsnm
+					@c true if tangent space normal mapping should be enabled.
+					@c false otherwise.
+	 @return		The voxelization shader permutation.
+	 */
+	[[nodiscard]]
+	constexpr std::size_t GetVoxelizationPermutation(bool tsnm) noexcept {
+		return static_cast< std::size_t >(tsnm);
+	}
+
+	/**
+	 A shader permutation cache of voxelization pixel shaders.
+	 */
+	using VoxelizationPSCache
+		= ShaderPermutationCache< PixelShader,
+		                          GetVoxelizationPermutation(true) + 1u >;
+
+	#pragma endregion
+}
\ No newline at end of file
@@ -40,9 +40,9 @@ namespace mage::rendering {
 	//-------------------------------------------------------------------------
 	#pragma region
 
-	Camera::Camera(ID3D11Device& device)
+	Camera::Camera()
 		: Component(),
-		m_buffer(device),
+		m_buffer(),
 		m_clipping_planes(0.01f, 100.0f),
 		m_lens(),
 		m_viewport(),
@@ -55,6 +55,7 @@ namespace mage::rendering {
 	Camera& Camera::operator=(Camera&& camera) noexcept = default;
 
 	void Camera::UpdateBuffer(ID3D11DeviceContext& device_context,
+							  ConstantBufferAllocator& allocator,
 							  AntiAliasing aa) const {
 		Assert(HasOwner());
 
@@ -116,7 +117,7 @@ namespace mage::rendering {
 		}
 
 		// Update the camera buffer.
-		m_buffer.UpdateData(device_context, buffer);
+		m_buffer = allocator.Allocate(device_context, buffer);
 	}
 
 	#pragma endregion
@@ -8,7 +8,7 @@
 #include "scene\component.hpp"
 #include "scene\camera\viewport.hpp"
 #include "renderer\configuration.hpp"
-#include "renderer\buffer\constant_buffer.hpp"
+#include "renderer\buffer\constant_buffer_allocator.hpp"
 #include "renderer\buffer\scene_buffer.hpp"
 #include "resource\texture\texture.hpp"
 #include "transform\transform.hpp"
@@ -738,6 +738,7 @@ namespace mage::rendering {
 			m_brdf(BRDF::Frostbite),
 			m_tone_mapping(ToneMapping::ACESFilmic),
 			m_render_layer_mask(static_cast< U32 >(RenderLayer::None)),
+			m_opaque_order(OpaqueOrder::Material),
 			m_fog(),
 			m_sky() {}
 
@@ -870,6 +871,19 @@ namespace mage::rendering {
 			m_render_layer_mask = static_cast< U32 >(RenderLayer::None);
 		}
 
+		//---------------------------------------------------------------------
+		// Member Methods: Opaque Order
+		//---------------------------------------------------------------------
+
+		[[nodiscard]]
+		OpaqueOrder GetOpaqueOrder() const noexcept {
+			return m_opaque_order;
+		}
+
+		void SetOpaqueOrder(OpaqueOrder opaque_order) noexcept {
+			m_opaque_order = opaque_order;
+		}
+
 		//---------------------------------------------------------------------
 		// Member Methods: Fog
 		//---------------------------------------------------------------------
@@ -954,6 +968,15 @@ namespace mage::rendering {
 		 */
 		U32 m_render_layer_mask;
 
+		//---------------------------------------------------------------------
+		// Member Variables: Opaque Order
+		//---------------------------------------------------------------------
+
+		/**
+		 The draw order of the opaque models of this camera settings.
+		 */
+		OpaqueOrder m_opaque_order;
+
 		//---------------------------------------------------------------------
 		// Member Variables: Fog
 		//---------------------------------------------------------------------
@@ -1142,12 +1165,18 @@ namespace mage::rendering {
 		/**
 		 Updates the buffer of this camera.
 
+		 @pre			The current frame of @a allocator must be begun.
 		 @param[in,out]	device_context
 						A reference to the device context.
+		 @param[in,out]	allocator
+						A reference to the constant buffer allocator.
 		 @param[in]		aa
 						The anti-aliasing mode.
+		 @throws		Exception
+						Failed to allocate the buffer of this camera.
 		 */
 		void UpdateBuffer(ID3D11DeviceContext& device_context,
+						  ConstantBufferAllocator& allocator,
 						  AntiAliasing aa) const;
 
 		/**
@@ -1177,11 +1206,8 @@ namespace mage::rendering {
 
 		/**
 		 Constructs a camera.
-
-		 @param[in,out]	device
-						A reference to the device.
 		 */
-		explicit Camera(ID3D11Device& device);
+		Camera();
 
 		/**
 		 Constructs a camera from the given camera.
@@ -1206,9 +1232,10 @@ namespace mage::rendering {
 		//---------------------------------------------------------------------
 
 		/**
-		 The buffer of this camera.
+		 The buffer of this camera (i.e. a range of the constant buffer
+		 allocator of the current frame).
 		 */
-		mutable ConstantBuffer< CameraBuffer > m_buffer;
+		mutable ConstantBufferView m_buffer;
 
 		//---------------------------------------------------------------------
 		// Member Variables: Projection
@@ -12,8 +12,8 @@
 //-----------------------------------------------------------------------------
 namespace mage::rendering {
 
-	OrthographicCamera::OrthographicCamera(ID3D11Device& device)
-		: Camera(device),
+	OrthographicCamera::OrthographicCamera()
+		: Camera(),
 		m_size(1.0f, 1.0f) {}
 
 	OrthographicCamera::OrthographicCamera(
@@ -30,11 +30,8 @@ namespace mage::rendering {
 
 		/**
 		 Constructs an orthographic camera.
-
-		 @param[in,out]	device
-						A reference to the device.
 		 */
-		explicit OrthographicCamera(ID3D11Device& device);
+		OrthographicCamera();
 
 		/**
 		 Constructs an orthographic camera from the given orthographic
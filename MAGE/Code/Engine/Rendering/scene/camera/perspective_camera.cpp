@@ -12,8 +12,8 @@
 //-----------------------------------------------------------------------------
 namespace mage::rendering {
 
-	PerspectiveCamera::PerspectiveCamera(ID3D11Device& device)
-		: Camera(device),
+	PerspectiveCamera::PerspectiveCamera()
+		: Camera(),
 		m_aspect_ratio(AspectRatioFromWidthAndHeight(1.0f, 1.0f)),
 		m_fov_y(XM_PIDIV2) {}
 
@@ -105,11 +105,8 @@ namespace mage::rendering {
 
 		/**
 		 Constructs a perspective camera.
-
-		 @param[in,out]	device
-						A reference to the device.
 		 */
-		explicit PerspectiveCamera(ID3D11Device& device);
+		PerspectiveCamera();
 
 		/**
 		 Constructs a perspective camera from the given perspective camera.
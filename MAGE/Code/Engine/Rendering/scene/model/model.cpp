@@ -13,14 +13,18 @@
 //-----------------------------------------------------------------------------
 namespace mage::rendering {
 
-	Model::Model(ID3D11Device& device)
+	Model::Model()
 		: Component(),
-		m_buffer(device),
+		m_buffer(),
+		m_buffer_data(),
+		m_buffer_version(0u),
 		m_aabb(),
 		m_sphere(),
 		m_mesh(),
 		m_start_index(0u),
 		m_nb_indices(0u),
+		m_index_format(DXGI_FORMAT_UNKNOWN),
+		m_base_vertex(0u),
 		m_texture_transform(),
 		m_material(),
 		m_light_occlusion(true) {}
@@ -35,36 +39,68 @@ namespace mage::rendering {
 						std::size_t start_index,
 						std::size_t nb_indices,
 						const AABB& aabb,
-						const BoundingSphere& bs) noexcept {
+						const BoundingSphere& bs,
+						DXGI_FORMAT index_format,
+						U32 base_vertex) noexcept {
 
-		m_aabb        = aabb;
-		m_sphere      = bs;
-		m_mesh        = mesh;
-		m_start_index = start_index;
-		m_nb_indices  = nb_indices;
+		m_aabb         = aabb;
+		m_sphere       = bs;
+		m_mesh         = mesh;
+		m_start_index  = start_index;
+		m_nb_indices   = nb_indices;
+		m_index_format = (DXGI_FORMAT_UNKNOWN != index_format)
+			           ? index_format : m_mesh->GetIndexFormat();
+		m_base_vertex  = base_vertex;
+
+		// Invalidate the model buffer (i.e. the position decoding).
+		m_buffer_version = 0u;
+
+		s_mesh_version.fetch_add(1u, std::memory_order_relaxed);
 	}
 
-	void Model::UpdateBuffer(ID3D11DeviceContext& device_context) const {
+	const ModelBuffer& Model::GetBufferData() const noexcept {
 		Assert(HasOwner());
 
-		const auto& transform         = GetOwner()->GetTransform();
-		const auto  object_to_world   = transform.GetObjectToWorldMatrix();
-		const auto  world_to_object   = transform.GetWorldToObjectMatrix();
-		const auto  texture_transform = m_texture_transform.GetTransformMatrix();
+		const auto& transform = GetOwner()->GetTransform();
+		const auto  version   = transform.GetObjectToWorldVersion();
+		if (m_buffer_version != version) {
+			auto       object_to_world = transform.GetObjectToWorldMatrix();
+			const auto world_to_object = transform.GetWorldToObjectMatrix();
+
+			// Map the quantized positions of compact vertices to the bounds
+			// of the mesh (normals are not affected).
+			if (m_mesh && m_mesh->HasCompactVertices()) {
+				const auto scale  = XMLoad(m_mesh->GetPositionScale());
+				const auto offset = XMLoad(m_mesh->GetPositionOffset());
+				object_to_world = XMMatrixScalingFromVector(scale)
+					            * XMMatrixTranslationFromVector(offset)
+					            * object_to_world;
+			}
+
+			// Transforms
+			m_buffer_data.m_object_to_world = XMMatrixTranspose(object_to_world);
+			m_buffer_data.m_normal_to_world = world_to_object;
+
+			m_buffer_version = version;
+		}
+
+		const auto texture_transform = m_texture_transform.GetTransformMatrix();
 
-		ModelBuffer buffer;
 		// Transforms
-		buffer.m_object_to_world      = XMMatrixTranspose(object_to_world);
-		buffer.m_normal_to_world      = world_to_object;
-		buffer.m_texture_transform    = XMMatrixTranspose(texture_transform);
+		m_buffer_data.m_texture_transform = XMMatrixTranspose(texture_transform);
 		// Material
-		buffer.m_base_color           = m_material.IsEmissive()
-			                          ? m_material.GetRadianceSpectrum()
-			                          : m_material.GetBaseColor();
-		buffer.m_roughness            = m_material.GetRoughness();
-		buffer.m_metalness            = m_material.GetMetalness();
+		m_buffer_data.m_base_color        = m_material.IsEmissive()
+			                              ? m_material.GetRadianceSpectrum()
+			                              : m_material.GetBaseColor();
+		m_buffer_data.m_roughness         = m_material.GetRoughness();
+		m_buffer_data.m_metalness         = m_material.GetMetalness();
+
+		return m_buffer_data;
+	}
 
+	void Model::UpdateBuffer(ID3D11DeviceContext& device_context,
+							 ConstantBufferAllocator& allocator) const {
 		// Update the model buffer.
-		m_buffer.UpdateData(device_context, buffer);
+		m_buffer = allocator.Allocate(device_context, GetBufferData());
 	}
 }
\ No newline at end of file
@@ -10,7 +10,7 @@
 #include "resource\model\material.hpp"
 #include "geometry\bounding_volume.hpp"
 #include "transform\transform.hpp"
-#include "renderer\buffer\constant_buffer.hpp"
+#include "renderer\buffer\constant_buffer_allocator.hpp"
 #include "renderer\buffer\scene_buffer.hpp"
 
 #pragma endregion
@@ -30,17 +30,29 @@ namespace mage::rendering {
 
 	public:
 
+		//---------------------------------------------------------------------
+		// Class Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the mesh version of the models. The mesh version changes
+		 whenever the mesh (and thus the AABB) of a model changes.
+
+		 @return		The mesh version of the models.
+		 */
+		[[nodiscard]]
+		static U64 GetMeshVersion() noexcept {
+			return s_mesh_version.load(std::memory_order_relaxed);
+		}
+
 		//---------------------------------------------------------------------
 		// Constructors and Destructors
 		//---------------------------------------------------------------------
 
 		/**
 		 Constructs a model.
-
-		 @param[in,out]	device
-						A reference to the device.
 		 */
-		explicit Model(ID3D11Device& device);
+		Model();
 
 		/**
 		 Constructs a model from the given model.
@@ -103,12 +115,29 @@ namespace mage::rendering {
 						A reference to the AABB.
 		 @param[in]		bs
 						A reference to the bounding sphere.
+		 @param[in]		index_format
+						The index format in the mesh. @c DXGI_FORMAT_UNKNOWN
+						corresponds to the index format of the mesh.
+		 @param[in]		base_vertex
+						The base vertex in the mesh.
 		 */
 		void SetMesh(SharedPtr< const Mesh > mesh,
 					 std::size_t start_index,
 					 std::size_t nb_indices,
 					 const AABB& aabb,
-					 const BoundingSphere& bs) noexcept;
+					 const BoundingSphere& bs,
+					 DXGI_FORMAT index_format = DXGI_FORMAT_UNKNOWN,
+					 U32 base_vertex = 0u) noexcept;
+
+		/**
+		 Returns the mesh of this model.
+
+		 @return		A pointer to the mesh of this model.
+		 */
+		[[nodiscard]]
+		const Mesh* GetMesh() const noexcept {
+			return m_mesh.get();
+		}
 
 		/**
 		 Returns the AABB of this model.
@@ -151,6 +180,28 @@ namespace mage::rendering {
 			return m_nb_indices;
 		}
 
+		/**
+		 Returns the index format of this model in the mesh of this model.
+
+		 @return		The index format of this model in the mesh of this
+						model.
+		 */
+		[[nodiscard]]
+		DXGI_FORMAT GetIndexFormat() const noexcept {
+			return m_index_format;
+		}
+
+		/**
+		 Returns the base vertex of this model in the mesh of this model.
+
+		 @return		The base vertex of this model in the mesh of this
+						model.
+		 */
+		[[nodiscard]]
+		U32 GetBaseVertex() const noexcept {
+			return m_base_vertex;
+		}
+
 		/**
 		 Binds the mesh of this model.
 
@@ -158,7 +209,7 @@ namespace mage::rendering {
 						A reference to the device context.
 		 */
 		void BindMesh(ID3D11DeviceContext& device_context) const noexcept {
-			m_mesh->BindMesh(device_context);
+			BindMesh(device_context, m_mesh->GetPrimitiveTopology());
 		}
 
 		/**
@@ -172,7 +223,7 @@ namespace mage::rendering {
 		void BindMesh(ID3D11DeviceContext& device_context,
 			          D3D11_PRIMITIVE_TOPOLOGY topology) const noexcept {
 
-			m_mesh->BindMesh(device_context, topology);
+			m_mesh->BindMesh(device_context, topology, m_index_format);
 		}
 
 		/**
@@ -182,7 +233,23 @@ namespace mage::rendering {
 						A reference to the device context.
 		 */
 		void Draw(ID3D11DeviceContext& device_context) const noexcept {
-			m_mesh->Draw(device_context, m_start_index, m_nb_indices);
+			m_mesh->Draw(device_context, m_start_index, m_nb_indices,
+						 m_base_vertex);
+		}
+
+		/**
+		 Draws instances of this model.
+
+		 @param[in,out]	device_context
+						A reference to the device context.
+		 @param[in]		nb_instances
+						The number of instances.
+		 */
+		void DrawInstanced(ID3D11DeviceContext& device_context,
+						   std::size_t nb_instances) const noexcept {
+
+			m_mesh->DrawInstanced(device_context, m_start_index, m_nb_indices,
+								  nb_instances, m_base_vertex);
 		}
 
 		//---------------------------------------------------------------------
@@ -280,13 +347,30 @@ namespace mage::rendering {
 		// Member Methods: Buffer
 		//---------------------------------------------------------------------
 
+		/**
+		 Returns the buffer data of this model. The transformation matrices
+		 are only recomputed if the object-to-world matrix of the owner of
+		 this model changed.
+
+		 @pre			This model must have an owner.
+		 @return		A reference to the buffer data of this model.
+		 */
+		[[nodiscard]]
+		const ModelBuffer& GetBufferData() const noexcept;
+
 		/**
 		 Updates the buffer of this model.
 
+		 @pre			The current frame of @a allocator must be begun.
 		 @param[in,out]	device_context
 						A reference to the device context.
+		 @param[in,out]	allocator
+						A reference to the constant buffer allocator.
+		 @throws		Exception
+						Failed to allocate the buffer of this model.
 		 */
-		void UpdateBuffer(ID3D11DeviceContext& device_context) const;
+		void UpdateBuffer(ID3D11DeviceContext& device_context,
+						  ConstantBufferAllocator& allocator) const;
 
 		/**
 		 Binds the buffer of this model to the given pipeline stage.
@@ -309,14 +393,35 @@ namespace mage::rendering {
 
 	private:
 
+		//---------------------------------------------------------------------
+		// Class Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The mesh version of the models.
+		 */
+		static inline AtomicU64 s_mesh_version{ 1u };
+
 		//---------------------------------------------------------------------
 		// Member Variables: Buffer
 		//---------------------------------------------------------------------
 
 		/**
-		 The buffer of this model.
+		 The buffer of this model (i.e. a range of the constant buffer
+		 allocator of the current frame).
+		 */
+		mutable ConstantBufferView m_buffer;
+
+		/**
+		 The (cached) buffer data of this model.
 		 */
-		mutable ConstantBuffer< ModelBuffer > m_buffer;
+		mutable ModelBuffer m_buffer_data;
+
+		/**
+		 The version of the object-to-world matrix of the owner of this model
+		 used for the cached buffer data of this model.
+		 */
+		mutable U64 m_buffer_version;
 
 		//---------------------------------------------------------------------
 		// Member Variables: Geometry
@@ -347,6 +452,16 @@ namespace mage::rendering {
 		 */
 		std::size_t m_nb_indices;
 
+		/**
+		 The index format of this model in the mesh of this model.
+		 */
+		DXGI_FORMAT m_index_format;
+
+		/**
+		 The base vertex of this model in the mesh of this model.
+		 */
+		U32 m_base_vertex;
+
 		//---------------------------------------------------------------------
 		// Member Variables: Appearance
 		//---------------------------------------------------------------------
@@ -7,16 +7,24 @@
 
 #pragma endregion
 
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <numeric>
+
+#pragma endregion
+
 //-----------------------------------------------------------------------------
 // Engine Definitions
 //-----------------------------------------------------------------------------
 namespace mage::rendering {
 
-	World::World(ID3D11Device& device,
-				 DisplayConfiguration& display_configuration,
+	World::World(DisplayConfiguration& display_configuration,
 				 ResourceManager& resource_manager)
-		: m_device(device),
-		m_display_configuration(display_configuration),
+		: m_display_configuration(display_configuration),
 		m_resource_manager(resource_manager),
 		m_perspective_cameras(),
 		m_orthographic_cameras(),
@@ -26,7 +34,28 @@ namespace mage::rendering {
 		m_spot_lights(),
 		m_models(),
 		m_sprite_images(),
-		m_sprite_texts() {}
+		m_sprite_texts(),
+		m_active_perspective_cameras(),
+		m_active_orthographic_cameras(),
+		m_active_ambient_lights(),
+		m_active_directional_lights(),
+		m_active_omni_lights(),
+		m_active_spot_lights(),
+		m_active_models(),
+		m_active_sprite_images(),
+		m_active_sprite_texts(),
+		m_model_hierarchy(),
+		m_model_hierarchy_models(),
+		m_model_hierarchy_versions(),
+		m_model_hierarchy_aabbs(),
+		m_model_hierarchy_frames(),
+		m_model_hierarchy_indices(),
+		m_moved_models(),
+		m_dynamic_models(),
+		m_static_model_changes(),
+		m_model_hierarchy_frame(0u),
+		m_model_hierarchy_state_version(0u),
+		m_model_hierarchy_mesh_version(0u) {}
 
 	World::World(World&& world) noexcept = default;
 
@@ -34,6 +63,18 @@ namespace mage::rendering {
 
 	World& World::operator=(World&& world) noexcept = default;
 
+	void World::Destroy(Node& node) {
+		DestroyComponents< PerspectiveCamera  >(node);
+		DestroyComponents< OrthographicCamera >(node);
+		DestroyComponents< AmbientLight       >(node);
+		DestroyComponents< DirectionalLight   >(node);
+		DestroyComponents< OmniLight          >(node);
+		DestroyComponents< SpotLight          >(node);
+		DestroyComponents< Model              >(node);
+		DestroyComponents< SpriteImage        >(node);
+		DestroyComponents< SpriteText         >(node);
+	}
+
 	void World::Clear() noexcept {
 		m_perspective_cameras.clear();
 		m_orthographic_cameras.clear();
@@ -44,5 +85,201 @@ namespace mage::rendering {
 		m_models.clear();
 		m_sprite_images.clear();
 		m_sprite_texts.clear();
+
+		m_active_perspective_cameras.Clear();
+		m_active_orthographic_cameras.Clear();
+		m_active_ambient_lights.Clear();
+		m_active_directional_lights.Clear();
+		m_active_omni_lights.Clear();
+		m_active_spot_lights.Clear();
+		m_active_models.Clear();
+		m_active_sprite_images.Clear();
+		m_active_sprite_texts.Clear();
+
+		m_model_hierarchy.Clear();
+		m_model_hierarchy_models.clear();
+		m_model_hierarchy_versions.clear();
+		m_model_hierarchy_aabbs.clear();
+		m_model_hierarchy_frames.clear();
+		m_model_hierarchy_indices.clear();
+		m_moved_models.clear();
+		m_dynamic_models.clear();
+		m_static_model_changes.clear();
+		m_model_hierarchy_state_version = 0u;
+		m_model_hierarchy_mesh_version  = 0u;
+		// The model hierarchy frame keeps advancing to invalidate the static
+		// depth layers of the cleared models.
+		++m_model_hierarchy_frame;
+	}
+
+	void World::NotifyModelMoved(const Model& model) {
+		m_moved_models.push_back(&model);
+	}
+
+	void World::UpdateModelHierarchy() const {
+		++m_model_hierarchy_frame;
+		m_static_model_changes.clear();
+
+		// Visit all models if the active models or their meshes changed, and
+		// only the dynamic and moved models otherwise.
+		auto visit_all = false;
+
+		const auto state_version = Component::GetStateVersion< Model >();
+		if (m_model_hierarchy_state_version != state_version) {
+			m_model_hierarchy_state_version = state_version;
+
+			std::vector< const Model* > models;
+			models.reserve(GetNumberOfActive< Model >());
+			ForEachActive< Model >([&models](const Model& model) {
+				models.push_back(&model);
+			});
+
+			// Rebuild only if the active models changed.
+			if (models != m_model_hierarchy_models) {
+				RebuildModelHierarchy(std::move(models));
+				return;
+			}
+
+			visit_all = true;
+		}
+
+		const auto mesh_version = Model::GetMeshVersion();
+		if (m_model_hierarchy_mesh_version != mesh_version) {
+			m_model_hierarchy_mesh_version = mesh_version;
+			visit_all = true;
+		}
+
+		if (visit_all) {
+			m_dynamic_models.resize(m_model_hierarchy_models.size());
+			std::iota(m_dynamic_models.begin(), m_dynamic_models.end(),
+					  std::size_t(0u));
+		}
+		else {
+			for (const auto model : m_moved_models) {
+				if (const auto it = m_model_hierarchy_indices.find(model);
+					m_model_hierarchy_indices.cend() != it) {
+
+					m_dynamic_models.push_back(it->second);
+				}
+			}
+
+			std::sort(m_dynamic_models.begin(), m_dynamic_models.end());
+			m_dynamic_models.erase(std::unique(m_dynamic_models.begin(),
+											   m_dynamic_models.end()),
+								   m_dynamic_models.end());
+		}
+		m_moved_models.clear();
+
+		// Update the models which moved or changed their AABB.
+		for (const auto index : m_dynamic_models) {
+			UpdateModelHierarchyEntry(index);
+		}
+
+		// Retain the models which did not become static yet.
+		m_dynamic_models.erase(std::remove_if(
+			m_dynamic_models.begin(), m_dynamic_models.end(),
+			[this](std::size_t index) noexcept {
+				return ModelMobility::Static == GetModelMobility(index);
+			}), m_dynamic_models.end());
+
+		m_model_hierarchy.Refit();
+		if (m_model_hierarchy.NeedsRebuild()) {
+			m_model_hierarchy.Rebuild();
+		}
+	}
+
+	void World::UpdateModelHierarchyEntry(std::size_t index) const {
+		const auto& model     = *m_model_hierarchy_models[index];
+		const auto& transform = model.GetOwner()->GetTransform();
+		const auto  version   = transform.GetObjectToWorldVersion();
+		const auto  age       = m_model_hierarchy_frame
+			                  - m_model_hierarchy_frames[index];
+		if (m_model_hierarchy_versions[index] == version
+			&& m_model_hierarchy_aabbs[index] == model.GetAABB()) {
+
+			// The model becomes static.
+			if (s_nb_static_model_frames == age) {
+				m_static_model_changes.push_back(
+					m_model_hierarchy.GetAABB(index));
+			}
+			return;
+		}
+
+		// The static model becomes dynamic.
+		if (s_nb_static_model_frames <= age) {
+			m_static_model_changes.push_back(m_model_hierarchy.GetAABB(index));
+		}
+
+		m_model_hierarchy_frames[index]   = m_model_hierarchy_frame;
+		m_model_hierarchy_versions[index] = version;
+		m_model_hierarchy_aabbs[index]    = model.GetAABB();
+		m_model_hierarchy.Update(index, AABB::Transform(model.GetAABB(),
+			transform.GetObjectToWorldMatrix()));
+	}
+
+	void World::RebuildModelHierarchy(
+		std::vector< const Model* >&& models) const {
+
+		// The models of the current model hierarchy mapped to their index.
+		const auto previous_indices = std::move(m_model_hierarchy_indices);
+		m_model_hierarchy_indices.clear();
+		m_moved_models.clear();
+		m_dynamic_models.clear();
+		m_model_hierarchy_mesh_version = Model::GetMeshVersion();
+
+		const auto previous_frames = std::move(m_model_hierarchy_frames);
+		std::vector< U8 > retained(previous_frames.size(), 0u);
+
+		m_model_hierarchy_models = std::move(models);
+		const auto nb_models = m_model_hierarchy_models.size();
+		m_model_hierarchy_versions.resize(nb_models);
+		m_model_hierarchy_aabbs.resize(nb_models);
+		m_model_hierarchy_frames.assign(nb_models, m_model_hierarchy_frame);
+
+		AlignedVector< AABB > aabbs;
+		aabbs.reserve(nb_models);
+		for (std::size_t i = 0u; i < nb_models; ++i) {
+			const auto& model     = *m_model_hierarchy_models[i];
+			const auto& transform = model.GetOwner()->GetTransform();
+
+			m_model_hierarchy_indices.emplace(&model, i);
+			m_model_hierarchy_versions[i] = transform.GetObjectToWorldVersion();
+			m_model_hierarchy_aabbs[i]    = model.GetAABB();
+			aabbs.push_back(AABB::Transform(model.GetAABB(),
+				transform.GetObjectToWorldMatrix()));
+
+			// Preserve the mobility of the unchanged models.
+			if (const auto it = previous_indices.find(&model);
+				previous_indices.cend() != it
+				&& m_model_hierarchy.GetAABB(it->second) == aabbs.back()) {
+
+				m_model_hierarchy_frames[i] = previous_frames[it->second];
+				retained[it->second] = 1u;
+
+				// The model becomes static.
+				if (s_nb_static_model_frames == m_model_hierarchy_frame
+					- m_model_hierarchy_frames[i]) {
+					m_static_model_changes.push_back(aabbs.back());
+				}
+			}
+		}
+
+		// The static models which are removed or changed.
+		for (std::size_t i = 0u; i < previous_frames.size(); ++i) {
+			if (0u == retained[i] && s_nb_static_model_frames
+				<= m_model_hierarchy_frame - previous_frames[i]) {
+
+				m_static_model_changes.push_back(m_model_hierarchy.GetAABB(i));
+			}
+		}
+
+		// The models which did not become static yet.
+		for (std::size_t i = 0u; i < nb_models; ++i) {
+			if (ModelMobility::Dynamic == GetModelMobility(i)) {
+				m_dynamic_models.push_back(i);
+			}
+		}
+
+		m_model_hierarchy.Build(aabbs);
 	}
 }
\ No newline at end of file
@@ -5,8 +5,10 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
+#include "collection\slot_map.hpp"
 #include "display\display_configuration.hpp"
 #include "resource\rendering_resource_manager.hpp"
+#include "scene\active_index_list.hpp"
 #include "scene\node.hpp"
 #include "scene\camera\orthographic_camera.hpp"
 #include "scene\camera\perspective_camera.hpp"
@@ -17,6 +19,16 @@
 #include "scene\model\model.hpp"
 #include "scene\sprite\sprite_image.hpp"
 #include "scene\sprite\sprite_text.hpp"
+#include "geometry\bvh.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <unordered_map>
 
 #pragma endregion
 
@@ -25,6 +37,22 @@
 //-----------------------------------------------------------------------------
 namespace mage::rendering {
 
+	/**
+	 An enumeration of the different model mobilities used for filtering the
+	 models of the model hierarchy of a world.
+
+	 This contains:
+	 @c Static (i.e. models which did not change for a number of model
+	 hierarchy updates),
+	 @c Dynamic and
+	 @c Any.
+	 */
+	enum class ModelMobility : U8 {
+		Static,
+		Dynamic,
+		Any
+	};
+
 	/**
 	 A class of world.
 	 */
@@ -32,6 +60,16 @@ namespace mage::rendering {
 
 	public:
 
+		//---------------------------------------------------------------------
+		// Class Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The number of model hierarchy updates a model must remain unchanged
+		 (i.e. its transform and AABB) before it is considered static.
+		 */
+		static constexpr U64 s_nb_static_model_frames = 30u;
+
 		//---------------------------------------------------------------------
 		// Constructors and Destructors
 		//---------------------------------------------------------------------
@@ -39,15 +77,12 @@ namespace mage::rendering {
 		/**
 		 Constructs a world.
 
-		 @param[in,out]	device
-						A reference to the device.
 		 @param[in,out]	display_configuration
 						A reference to the display configuration.
 		 @param[in,out]	resource_manager
 						A reference to the resource manager.
 		 */
-		explicit World(ID3D11Device& device,
-					   DisplayConfiguration& display_configuration,
+		explicit World(DisplayConfiguration& display_configuration,
 					   ResourceManager& resource_manager);
 
 		/**
@@ -101,6 +136,14 @@ namespace mage::rendering {
 		template< typename ComponentT >
 		ProxyPtr< ComponentT > Create();
 
+		/**
+		 Destroys the components of this world owned by the given node.
+
+		 @param[in,out]	node
+						A reference to the node.
+		 */
+		void Destroy(Node& node);
+
 		template< typename ComponentT >
 		[[nodiscard]]
 		std::size_t GetNumberOf() const noexcept;
@@ -111,21 +154,241 @@ namespace mage::rendering {
 		template< typename ComponentT, typename ActionT >
 		void ForEach(ActionT&& action) const;
 
+		template< typename ComponentT >
+		[[nodiscard]]
+		std::size_t GetNumberOfActive() const;
+
+		template< typename ComponentT, typename ActionT >
+		void ForEachActive(ActionT&& action);
+
+		template< typename ComponentT, typename ActionT >
+		void ForEachActive(ActionT&& action) const;
+
+		/**
+		 Performs the given action on each active component of the given
+		 type in parallel.
+
+		 @tparam		ComponentT
+						The (concrete) component type.
+		 @tparam		ActionT
+						The action type.
+		 @param[in,out]	job_system
+						A reference to the job system.
+		 @param[in]		action
+						A reference to the action (i.e.
+						@c action(component, index) with @a index the
+						position of the component among the active
+						components of the given type).
+		 */
+		template< typename ComponentT, typename ActionT >
+		void ForEachActive(JobSystem& job_system, ActionT&& action) const;
+
 		/**
 		 Clears this world.
 		 */
 		void Clear() noexcept;
 
+		//---------------------------------------------------------------------
+		// Member Methods: Model Hierarchy
+		//---------------------------------------------------------------------
+
+		/**
+		 Updates the model hierarchy (i.e. the BVH of the world-space AABBs of
+		 the active models) of this world.
+
+		 The model hierarchy is rebuilt if the active models changed, and
+		 refitted for the models whose transform or AABB changed otherwise.
+		 Only the models which moved since the last update (see
+		 {@link mage::rendering::World::NotifyModelMoved(const Model&)}) and
+		 the models which did not become static yet are visited, unless the
+		 active models or the meshes of the models changed. Each update of the
+		 model hierarchy advances the model hierarchy frame of this world.
+		 */
+		void UpdateModelHierarchy() const;
+
+		/**
+		 Notifies the model hierarchy of this world that the object-to-world
+		 matrix of the transform of the given model changed.
+
+		 @param[in]		model
+						A reference to the model.
+		 */
+		void NotifyModelMoved(const Model& model);
+
+		/**
+		 Returns the model hierarchy frame (i.e. the number of model hierarchy
+		 updates) of this world.
+
+		 @return		The model hierarchy frame of this world.
+		 */
+		[[nodiscard]]
+		U64 GetModelHierarchyFrame() const noexcept {
+			return m_model_hierarchy_frame;
+		}
+
+		/**
+		 Performs the given action on each active model of this world whose
+		 world-space AABB overlaps the given bounding volume.
+
+		 @pre			The model hierarchy of this world is up-to-date.
+		 @tparam		BoundingVolumeT
+						The bounding volume type (e.g., bounding frustum,
+						bounding sphere or AABB).
+		 @tparam		ActionT
+						The action type.
+		 @param[in]		volume
+						A reference to the world-space bounding volume.
+		 @param[in]		action
+						A reference to the action (i.e. @c action(model)).
+		 @param[in]		mobility
+						The mobility of the models to consider.
+		 */
+		template< typename BoundingVolumeT, typename ActionT >
+		void ForEachActiveModel(const BoundingVolumeT& volume,
+								ActionT&& action,
+								ModelMobility mobility = ModelMobility::Any) const;
+
+		/**
+		 Performs the given action on each active model of this world whose
+		 world-space AABB overlaps the given bounding volume. The action
+		 additionally receives the world-space AABB and mobility of the model
+		 (e.g., for classifying the models of a single traversal).
+
+		 @pre			The model hierarchy of this world is up-to-date.
+		 @tparam		BoundingVolumeT
+						The bounding volume type (e.g., bounding frustum,
+						bounding sphere or AABB).
+		 @tparam		ActionT
+						The action type.
+		 @param[in]		volume
+						A reference to the world-space bounding volume.
+		 @param[in]		action
+						A reference to the action (i.e.
+						@c action(model, aabb, mobility)).
+		 */
+		template< typename BoundingVolumeT, typename ActionT >
+		void ForEachActiveModelAABB(const BoundingVolumeT& volume,
+									ActionT&& action) const;
+
+		/**
+		 Checks whether any active model of this world which satisfies the
+		 given predicate, has a world-space AABB overlapping the given
+		 bounding volume.
+
+		 @pre			The model hierarchy of this world is up-to-date.
+		 @tparam		BoundingVolumeT
+						The bounding volume type (e.g., bounding frustum,
+						bounding sphere or AABB).
+		 @tparam		PredicateT
+						The predicate type.
+		 @param[in]		volume
+						A reference to the world-space bounding volume.
+		 @param[in]		predicate
+						A reference to the predicate (i.e.
+						@c predicate(model)).
+		 @param[in]		mobility
+						The mobility of the models to consider.
+		 @return		@c true if an active model of this world which
+						satisfies @a predicate, has a world-space AABB
+						overlapping @a volume. @c false otherwise.
+		 */
+		template< typename BoundingVolumeT, typename PredicateT >
+		[[nodiscard]]
+		bool AnyActiveModel(const BoundingVolumeT& volume,
+							PredicateT&& predicate,
+							ModelMobility mobility = ModelMobility::Any) const;
+
+		/**
+		 Checks whether the static models of this world overlapping the given
+		 bounding volume changed since the given model hierarchy frame (i.e.
+		 whether a static depth layer rendered at that frame is outdated).
+
+		 A static model changes if it is added, removed, moved or becomes
+		 dynamic. A dynamic model changes if it becomes static.
+
+		 @pre			The model hierarchy of this world is up-to-date.
+		 @tparam		BoundingVolumeT
+						The bounding volume type (e.g., bounding frustum,
+						bounding sphere or AABB).
+		 @param[in]		volume
+						A reference to the world-space bounding volume.
+		 @param[in]		frame
+						The model hierarchy frame.
+		 @return		@c true if the static models of this world overlapping
+						@a volume changed since @a frame. @c false otherwise.
+		 */
+		template< typename BoundingVolumeT >
+		[[nodiscard]]
+		bool HasStaticModelChanges(const BoundingVolumeT& volume,
+								   U64 frame) const;
+
 	private:
 
 		//---------------------------------------------------------------------
-		// Member Variables
+		// Member Methods
 		//---------------------------------------------------------------------
 
+		template< typename ComponentT >
+		[[nodiscard]]
+		SlotMap< ComponentT >& GetComponents() noexcept;
+
+		template< typename ComponentT >
+		[[nodiscard]]
+		const SlotMap< ComponentT >& GetComponents() const noexcept;
+
+		template< typename ComponentT >
+		[[nodiscard]]
+		ActiveIndexList& GetActiveComponents() const noexcept;
+
+		template< typename ComponentT >
+		ProxyPtr< ComponentT > AddComponent();
+
+		template< typename ComponentT >
+		void DestroyComponents(Node& node);
+
+		/**
+		 Rebuilds the model hierarchy of this world for the given models.
+
+		 The mobility of the models which were already part of the model
+		 hierarchy and did not change, is preserved.
+
+		 @param[in]		models
+						A reference to a vector containing the active models
+						(in order) to move.
+		 */
+		void RebuildModelHierarchy(std::vector< const Model* >&& models) const;
+
+		/**
+		 Updates the given model of the model hierarchy of this world if its
+		 transform or AABB changed, and records its mobility changes.
+
+		 @pre			@a index is smaller than the number of models of the
+						model hierarchy of this world.
+		 @param[in]		index
+						The index of the model in the model hierarchy.
+		 */
+		void UpdateModelHierarchyEntry(std::size_t index) const;
+
 		/**
-		 A reference to the device of this world.
+		 Returns the mobility of the given model of the model hierarchy of
+		 this world.
+
+		 @pre			@a primitive is smaller than the number of models of
+						the model hierarchy of this world.
+		 @param[in]		primitive
+						The index of the model in the model hierarchy.
+		 @return		The mobility of the given model.
 		 */
-		std::reference_wrapper< ID3D11Device > m_device;
+		[[nodiscard]]
+		ModelMobility GetModelMobility(std::size_t primitive) const noexcept {
+			return (s_nb_static_model_frames <= m_model_hierarchy_frame
+					- m_model_hierarchy_frames[primitive])
+				   ? ModelMobility::Static : ModelMobility::Dynamic;
+		}
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
 
 		/**
 		 A reference to the display configuration manager of this world.
@@ -142,49 +405,173 @@ namespace mage::rendering {
 		//---------------------------------------------------------------------
 
 		/**
-		 A vector containing the perspective cameras of this world.
+		 A slot map containing the perspective cameras of this world.
+		 */
+		SlotMap< PerspectiveCamera > m_perspective_cameras;
+
+		/**
+		 A slot map containing the orthographic cameras of this world.
+		 */
+		SlotMap< OrthographicCamera > m_orthographic_cameras;
+
+		/**
+		 A slot map containing the ambient lights of this world.
+		 */
+		SlotMap< AmbientLight > m_ambient_lights;
+
+		/**
+		 A slot map containing the directional lights of this world.
+		 */
+		SlotMap< DirectionalLight > m_directional_lights;
+
+		/**
+		 A slot map containing the omni lights of this world.
+		 */
+		SlotMap< OmniLight > m_omni_lights;
+
+		/**
+		 A slot map containing the spot lights of this world.
+		 */
+		SlotMap< SpotLight > m_spot_lights;
+
+		/**
+		 A slot map containing the models of this world.
+		 */
+		SlotMap< Model > m_models;
+
+		/**
+		 A slot map containing the sprite images of this world.
+		 */
+		SlotMap< SpriteImage > m_sprite_images;
+
+		/**
+		 A slot map containing the sprite texts of this world.
+		 */
+		SlotMap< SpriteText > m_sprite_texts;
+
+		//---------------------------------------------------------------------
+		// Member Variables: Active Components
+		//---------------------------------------------------------------------
+
+		/**
+		 The active index list of the perspective cameras of this world.
+		 */
+		mutable ActiveIndexList m_active_perspective_cameras;
+
+		/**
+		 The active index list of the orthographic cameras of this world.
+		 */
+		mutable ActiveIndexList m_active_orthographic_cameras;
+
+		/**
+		 The active index list of the ambient lights of this world.
+		 */
+		mutable ActiveIndexList m_active_ambient_lights;
+
+		/**
+		 The active index list of the directional lights of this world.
+		 */
+		mutable ActiveIndexList m_active_directional_lights;
+
+		/**
+		 The active index list of the omni lights of this world.
+		 */
+		mutable ActiveIndexList m_active_omni_lights;
+
+		/**
+		 The active index list of the spot lights of this world.
+		 */
+		mutable ActiveIndexList m_active_spot_lights;
+
+		/**
+		 The active index list of the models of this world.
+		 */
+		mutable ActiveIndexList m_active_models;
+
+		/**
+		 The active index list of the sprite images of this world.
+		 */
+		mutable ActiveIndexList m_active_sprite_images;
+
+		/**
+		 The active index list of the sprite texts of this world.
+		 */
+		mutable ActiveIndexList m_active_sprite_texts;
+
+		//---------------------------------------------------------------------
+		// Member Variables: Model Hierarchy
+		//---------------------------------------------------------------------
+
+		/**
+		 The BVH of the world-space AABBs of the active models of this world.
+		 */
+		mutable BVH m_model_hierarchy;
+
+		/**
+		 A vector containing the active models (in order) of the model
+		 hierarchy of this world.
+		 */
+		mutable std::vector< const Model* > m_model_hierarchy_models;
+
+		/**
+		 A vector containing the object-to-world versions of the transforms
+		 of the models of the model hierarchy of this world.
+		 */
+		mutable std::vector< U64 > m_model_hierarchy_versions;
+
+		/**
+		 A vector containing the (object-space) AABBs of the models of the
+		 model hierarchy of this world.
 		 */
-		AlignedVector< PerspectiveCamera > m_perspective_cameras;
+		mutable AlignedVector< AABB > m_model_hierarchy_aabbs;
 
 		/**
-		 A vector containing the orthographic cameras of this world.
+		 A vector containing the model hierarchy frames at which the models of
+		 the model hierarchy of this world changed for the last time.
 		 */
-		AlignedVector< OrthographicCamera > m_orthographic_cameras;
+		mutable std::vector< U64 > m_model_hierarchy_frames;
 
 		/**
-		 A vector containing the ambient lights of this world.
+		 A map containing the indices of the models of the model hierarchy of
+		 this world.
 		 */
-		AlignedVector< AmbientLight > m_ambient_lights;
+		mutable std::unordered_map< const Model*, std::size_t >
+			m_model_hierarchy_indices;
 
 		/**
-		 A vector containing the directional lights of this world.
+		 A vector containing the models which moved since the last update of
+		 the model hierarchy of this world.
 		 */
-		AlignedVector< DirectionalLight > m_directional_lights;
+		mutable std::vector< const Model* > m_moved_models;
 
 		/**
-		 A vector containing the omni lights of this world.
+		 A vector containing the indices of the models of the model hierarchy
+		 of this world which did not become static yet.
 		 */
-		AlignedVector< OmniLight > m_omni_lights;
+		mutable std::vector< std::size_t > m_dynamic_models;
 
 		/**
-		 A vector containing the spot lights of this world.
+		 A vector containing the world-space AABBs of the static models which
+		 changed at the last update of the model hierarchy of this world.
 		 */
-		AlignedVector< SpotLight > m_spot_lights;
+		mutable AlignedVector< AABB > m_static_model_changes;
 
 		/**
-		 A vector containing the models of this world.
+		 The model hierarchy frame of this world.
 		 */
-		AlignedVector< Model > m_models;
+		mutable U64 m_model_hierarchy_frame;
 
 		/**
-		 A vector containing the sprite images of this world.
+		 The state version of the models at the last update of the model
+		 hierarchy of this world.
 		 */
-		AlignedVector< SpriteImage > m_sprite_images;
+		mutable U64 m_model_hierarchy_state_version;
 
 		/**
-		 A vector containing the sprite texts of this world.
+		 The mesh version of the models at the last update of the model
+		 hierarchy of this world.
 		 */
-		AlignedVector< SpriteText > m_sprite_texts;
+		mutable U64 m_model_hierarchy_mesh_version;
 	};
 }
 
@@ -22,9 +22,19 @@ namespace mage::rendering {
 	//-------------------------------------------------------------------------
 	#pragma region
 
+	template< typename ComponentT >
+	inline ProxyPtr< ComponentT > World::AddComponent() {
+		const auto ptr = AddElement(GetComponents< ComponentT >());
+
+		// Changes of the component only affect the components of its type.
+		ComponentClient::BindStateVersion(*ptr);
+
+		return ptr;
+	}
+
 	template<>
 	inline ProxyPtr< PerspectiveCamera > World::Create() {
-		const auto ptr = AddElement(m_perspective_cameras, m_device);
+		const auto ptr = AddComponent< PerspectiveCamera >();
 
 		const auto resolution
 			= m_display_configuration.get().GetDisplayResolution();
@@ -37,7 +47,7 @@ namespace mage::rendering {
 
 	template<>
 	inline ProxyPtr< OrthographicCamera > World::Create() {
-		const auto ptr = AddElement(m_orthographic_cameras, m_device);
+		const auto ptr = AddComponent< OrthographicCamera >();
 
 		const auto resolution
 			= m_display_configuration.get().GetDisplayResolution();
@@ -48,32 +58,32 @@ namespace mage::rendering {
 
 	template<>
 	inline ProxyPtr< AmbientLight > World::Create() {
-		return AddElement(m_ambient_lights);
+		return AddComponent< AmbientLight >();
 	}
 
 	template<>
 	inline ProxyPtr< DirectionalLight > World::Create() {
-		return AddElement(m_directional_lights);
+		return AddComponent< DirectionalLight >();
 	}
 
 	template<>
 	inline ProxyPtr< OmniLight > World::Create() {
-		return AddElement(m_omni_lights);
+		return AddComponent< OmniLight >();
 	}
 
 	template<>
 	inline ProxyPtr< SpotLight > World::Create() {
-		return AddElement(m_spot_lights);
+		return AddComponent< SpotLight >();
 	}
 
 	template<>
 	inline ProxyPtr< Model > World::Create() {
-		return AddElement(m_models, m_device);
+		return AddComponent< Model >();
 	}
 
 	template<>
 	inline ProxyPtr< SpriteImage > World::Create() {
-		const auto ptr = AddElement(m_sprite_images);
+		const auto ptr = AddComponent< SpriteImage >();
 
 		ptr->SetBaseColorTexture(CreateWhiteTexture(m_resource_manager));
 
@@ -82,7 +92,7 @@ namespace mage::rendering {
 
 	template<>
 	inline ProxyPtr< SpriteText > World::Create() {
-		const auto ptr = AddElement(m_sprite_texts);
+		const auto ptr = AddComponent< SpriteText >();
 
 		ptr->SetFont(CreateConsolasFont(m_resource_manager));
 
@@ -92,111 +102,89 @@ namespace mage::rendering {
 	#pragma endregion
 
 	//-------------------------------------------------------------------------
-	// Scene: Count
+	// World: Destruction
 	//-------------------------------------------------------------------------
 	#pragma region
 
-	template< typename ElementT >
-	[[nodiscard]]
-	inline std::size_t World::GetNumberOf() const noexcept {
-		std::size_t count = 0u;
-		ForEach< ElementT >([&count](
-			[[maybe_unused]] const ElementT& element) noexcept {
-				++count;
-			}
-		);
+	template< typename ComponentT >
+	void World::DestroyComponents(Node& node) {
+		auto& components = GetComponents< ComponentT >();
 
-		return count;
+		// Each removal only moves the last component of the slot map. The
+		// remaining components of the node are resolved through their
+		// handles.
+		node.ForEach< ComponentT >([&components](const ComponentT& component) {
+			RemoveElement(components, component);
+		});
 	}
 
 	#pragma endregion
 
 	//-------------------------------------------------------------------------
-	// Scene: Iteration
+	// World: Count
 	//-------------------------------------------------------------------------
 	#pragma region
 
-	template< typename ComponentT, typename ActionT >
-	void World::ForEach(ActionT&& action) {
-
-		if constexpr (std::is_same_v< PerspectiveCamera, ComponentT >) {
-			for (auto& component : m_perspective_cameras) {
-				if (State::Terminated != component.GetState()) {
-					action(component);
-				}
-			}
+	template< typename ComponentT >
+	[[nodiscard]]
+	inline std::size_t World::GetNumberOf() const noexcept {
+		if constexpr (std::is_same_v< Camera, ComponentT >) {
+			return GetNumberOf< PerspectiveCamera >()
+				 + GetNumberOf< OrthographicCamera >();
 		}
-
-		if constexpr (std::is_same_v< OrthographicCamera, ComponentT >) {
-			for (auto& component : m_orthographic_cameras) {
-				if (State::Terminated != component.GetState()) {
-					action(component);
-				}
-			}
+		else if constexpr (std::is_same_v< Component, ComponentT >) {
+			return GetNumberOf< Camera >()
+				 + GetNumberOf< AmbientLight >()
+				 + GetNumberOf< DirectionalLight >()
+				 + GetNumberOf< OmniLight >()
+				 + GetNumberOf< SpotLight >()
+				 + GetNumberOf< Model >()
+				 + GetNumberOf< SpriteImage >()
+				 + GetNumberOf< SpriteText >();
 		}
-
-		if constexpr (std::is_same_v< Camera, ComponentT >) {
-			ForEach< PerspectiveCamera >(action);
-			ForEach< OrthographicCamera >(action);
+		else {
+			return GetComponents< ComponentT >().size();
 		}
+	}
 
-		if constexpr (std::is_same_v< AmbientLight, ComponentT >) {
-			for (auto& component : m_ambient_lights) {
-				if (State::Terminated != component.GetState()) {
-					action(component);
-				}
-			}
+	template< typename ComponentT >
+	[[nodiscard]]
+	inline std::size_t World::GetNumberOfActive() const {
+		if constexpr (std::is_same_v< Camera, ComponentT >) {
+			return GetNumberOfActive< PerspectiveCamera >()
+				 + GetNumberOfActive< OrthographicCamera >();
 		}
-
-		if constexpr (std::is_same_v< DirectionalLight, ComponentT >) {
-			for (auto& component : m_directional_lights) {
-				if (State::Terminated != component.GetState()) {
-					action(component);
-				}
-			}
+		else if constexpr (std::is_same_v< Component, ComponentT >) {
+			return GetNumberOfActive< Camera >()
+				 + GetNumberOfActive< AmbientLight >()
+				 + GetNumberOfActive< DirectionalLight >()
+				 + GetNumberOfActive< OmniLight >()
+				 + GetNumberOfActive< SpotLight >()
+				 + GetNumberOfActive< Model >()
+				 + GetNumberOfActive< SpriteImage >()
+				 + GetNumberOfActive< SpriteText >();
 		}
-
-		if constexpr (std::is_same_v< OmniLight, ComponentT >) {
-			for (auto& component : m_omni_lights) {
-				if (State::Terminated != component.GetState()) {
-					action(component);
-				}
-			}
+		else {
+			return GetActiveComponents< ComponentT >()
+				.Count(GetComponents< ComponentT >());
 		}
+	}
 
-		if constexpr (std::is_same_v< SpotLight, ComponentT >) {
-			for (auto& component : m_spot_lights) {
-				if (State::Terminated != component.GetState()) {
-					action(component);
-				}
-			}
-		}
+	#pragma endregion
 
-		if constexpr (std::is_same_v< Model, ComponentT >) {
-			for (auto& component : m_models) {
-				if (State::Terminated != component.GetState()) {
-					action(component);
-				}
-			}
-		}
+	//-------------------------------------------------------------------------
+	// World: Iteration
+	//-------------------------------------------------------------------------
+	#pragma region
 
-		if constexpr (std::is_same_v< SpriteImage, ComponentT >) {
-			for (auto& component : m_sprite_images) {
-				if (State::Terminated != component.GetState()) {
-					action(component);
-				}
-			}
-		}
+	template< typename ComponentT, typename ActionT >
+	void World::ForEach(ActionT&& action) {
 
-		if constexpr (std::is_same_v< SpriteText, ComponentT >) {
-			for (auto& component : m_sprite_texts) {
-				if (State::Terminated != component.GetState()) {
-					action(component);
-				}
-			}
+		if constexpr (std::is_same_v< Camera, ComponentT >) {
+			ForEach< PerspectiveCamera >(action);
+			ForEach< OrthographicCamera >(action);
 		}
-
-		if constexpr (std::is_same_v< Component, ComponentT >) {
+		else if constexpr (std::is_same_v< Component, ComponentT >) {
 			ForEach< Camera >(action);
 			ForEach< AmbientLight >(action);
 			ForEach< DirectionalLight >(action);
@@ -206,97 +194,272 @@ namespace mage::rendering {
 			ForEach< SpriteImage >(action);
 			ForEach< SpriteText >(action);
 		}
+		else {
+			for (auto& component : GetComponents< ComponentT >()) {
+				action(component);
+			}
+		}
 	}
 
 	template< typename ComponentT, typename ActionT >
 	void World::ForEach(ActionT&& action) const {
 
-		if constexpr (std::is_same_v< PerspectiveCamera, ComponentT >) {
-			for (const auto& component : m_perspective_cameras) {
-				if (State::Terminated != component.GetState()) {
-					action(component);
-				}
-			}
+		if constexpr (std::is_same_v< Camera, ComponentT >) {
+			ForEach< PerspectiveCamera >(action);
+			ForEach< OrthographicCamera >(action);
 		}
-
-		if constexpr (std::is_same_v< OrthographicCamera, ComponentT >) {
-			for (const auto& component : m_orthographic_cameras) {
-				if (State::Terminated != component.GetState()) {
-					action(component);
-				}
+		else if constexpr (std::is_same_v< Component, ComponentT >) {
+			ForEach< Camera >(action);
+			ForEach< AmbientLight >(action);
+			ForEach< DirectionalLight >(action);
+			ForEach< OmniLight >(action);
+			ForEach< SpotLight >(action);
+			ForEach< Model >(action);
+			ForEach< SpriteImage >(action);
+			ForEach< SpriteText >(action);
+		}
+		else {
+			for (const auto& component : GetComponents< ComponentT >()) {
+				action(component);
 			}
 		}
+	}
+
+	template< typename ComponentT, typename ActionT >
+	void World::ForEachActive(ActionT&& action) {
 
 		if constexpr (std::is_same_v< Camera, ComponentT >) {
-			ForEach< PerspectiveCamera >(action);
-			ForEach< OrthographicCamera >(action);
+			ForEachActive< PerspectiveCamera >(action);
+			ForEachActive< OrthographicCamera >(action);
+		}
+		else if constexpr (std::is_same_v< Component, ComponentT >) {
+			ForEachActive< Camera >(action);
+			ForEachActive< AmbientLight >(action);
+			ForEachActive< DirectionalLight >(action);
+			ForEachActive< OmniLight >(action);
+			ForEachActive< SpotLight >(action);
+			ForEachActive< Model >(action);
+			ForEachActive< SpriteImage >(action);
+			ForEachActive< SpriteText >(action);
 		}
+		else {
+			GetActiveComponents< ComponentT >()
+				.ForEach(GetComponents< ComponentT >(), action);
+		}
+	}
 
-		if constexpr (std::is_same_v< AmbientLight, ComponentT >) {
-			for (const auto& component : m_ambient_lights) {
-				if (State::Terminated != component.GetState()) {
-					action(component);
-				}
-			}
+	template< typename ComponentT, typename ActionT >
+	void World::ForEachActive(ActionT&& action) const {
+
+		if constexpr (std::is_same_v< Camera, ComponentT >) {
+			ForEachActive< PerspectiveCamera >(action);
+			ForEachActive< OrthographicCamera >(action);
+		}
+		else if constexpr (std::is_same_v< Component, ComponentT >) {
+			ForEachActive< Camera >(action);
+			ForEachActive< AmbientLight >(action);
+			ForEachActive< DirectionalLight >(action);
+			ForEachActive< OmniLight >(action);
+			ForEachActive< SpotLight >(action);
+			ForEachActive< Model >(action);
+			ForEachActive< SpriteImage >(action);
+			ForEachActive< SpriteText >(action);
 		}
+		else {
+			GetActiveComponents< ComponentT >()
+				.ForEach(GetComponents< ComponentT >(), action);
+		}
+	}
+
+	template< typename ComponentT, typename ActionT >
+	inline void World::ForEachActive(JobSystem& job_system,
+									 ActionT&& action) const {
+
+		static_assert(!std::is_same_v< Camera, ComponentT >
+					  && !std::is_same_v< Component, ComponentT >);
+
+		GetActiveComponents< ComponentT >()
+			.ForEach(GetComponents< ComponentT >(), job_system, action);
+	}
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// World: Model Hierarchy
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	template< typename BoundingVolumeT, typename ActionT >
+	inline void World::ForEachActiveModel(const BoundingVolumeT& volume,
+										  ActionT&& action,
+										  ModelMobility mobility) const {
 
-		if constexpr (std::is_same_v< DirectionalLight, ComponentT >) {
-			for (const auto& component : m_directional_lights) {
-				if (State::Terminated != component.GetState()) {
-					action(component);
+		m_model_hierarchy.ForEachOverlapping(volume,
+			[this, &action, mobility](std::size_t primitive) {
+				if (ModelMobility::Any != mobility
+					&& GetModelMobility(primitive) != mobility) {
+					return;
 				}
-			}
-		}
 
-		if constexpr (std::is_same_v< OmniLight, ComponentT >) {
-			for (const auto& component : m_omni_lights) {
-				if (State::Terminated != component.GetState()) {
-					action(component);
+				action(*m_model_hierarchy_models[primitive]);
+			});
+	}
+
+	template< typename BoundingVolumeT, typename ActionT >
+	inline void World::ForEachActiveModelAABB(const BoundingVolumeT& volume,
+											  ActionT&& action) const {
+
+		m_model_hierarchy.ForEachOverlapping(volume,
+			[this, &action](std::size_t primitive) {
+				action(*m_model_hierarchy_models[primitive],
+					   m_model_hierarchy.GetAABB(primitive),
+					   GetModelMobility(primitive));
+			});
+	}
+
+	template< typename BoundingVolumeT, typename PredicateT >
+	[[nodiscard]]
+	inline bool World::AnyActiveModel(const BoundingVolumeT& volume,
+									  PredicateT&& predicate,
+									  ModelMobility mobility) const {
+
+		return m_model_hierarchy.AnyOverlapping(volume,
+			[this, &predicate, mobility](std::size_t primitive) {
+				if (ModelMobility::Any != mobility
+					&& GetModelMobility(primitive) != mobility) {
+					return false;
 				}
-			}
+
+				return predicate(*m_model_hierarchy_models[primitive]);
+			});
+	}
+
+	template< typename BoundingVolumeT >
+	[[nodiscard]]
+	inline bool World::HasStaticModelChanges(const BoundingVolumeT& volume,
+											 U64 frame) const {
+
+		if (m_model_hierarchy_frame <= frame) {
+			return false;
 		}
 
-		if constexpr (std::is_same_v< SpotLight, ComponentT >) {
-			for (const auto& component : m_spot_lights) {
-				if (State::Terminated != component.GetState()) {
-					action(component);
-				}
-			}
+		// Only the changes of the last update are retained.
+		if (frame + 1u != m_model_hierarchy_frame) {
+			return true;
 		}
 
-		if constexpr (std::is_same_v< Model, ComponentT >) {
-			for (const auto& component : m_models) {
-				if (State::Terminated != component.GetState()) {
-					action(component);
-				}
+		for (const auto& aabb : m_static_model_changes) {
+			if (volume.Overlaps(aabb)) {
+				return true;
 			}
 		}
 
-		if constexpr (std::is_same_v< SpriteImage, ComponentT >) {
-			for (const auto& component : m_sprite_images) {
-				if (State::Terminated != component.GetState()) {
-					action(component);
-				}
-			}
+		return false;
+	}
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// World: Storage
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	template< typename ComponentT >
+	[[nodiscard]]
+	inline SlotMap< ComponentT >& World::GetComponents() noexcept {
+		if constexpr (std::is_same_v< PerspectiveCamera, ComponentT >) {
+			return m_perspective_cameras;
+		}
+		else if constexpr (std::is_same_v< OrthographicCamera, ComponentT >) {
+			return m_orthographic_cameras;
+		}
+		else if constexpr (std::is_same_v< AmbientLight, ComponentT >) {
+			return m_ambient_lights;
+		}
+		else if constexpr (std::is_same_v< DirectionalLight, ComponentT >) {
+			return m_directional_lights;
+		}
+		else if constexpr (std::is_same_v< OmniLight, ComponentT >) {
+			return m_omni_lights;
+		}
+		else if constexpr (std::is_same_v< SpotLight, ComponentT >) {
+			return m_spot_lights;
+		}
+		else if constexpr (std::is_same_v< Model, ComponentT >) {
+			return m_models;
+		}
+		else if constexpr (std::is_same_v< SpriteImage, ComponentT >) {
+			return m_sprite_images;
+		}
+		else {
+			static_assert(std::is_same_v< SpriteText, ComponentT >);
+			return m_sprite_texts;
 		}
+	}
 
-		if constexpr (std::is_same_v< SpriteText, ComponentT >) {
-			for (const auto& component : m_sprite_texts) {
-				if (State::Terminated != component.GetState()) {
-					action(component);
-				}
-			}
+	template< typename ComponentT >
+	[[nodiscard]]
+	inline const SlotMap< ComponentT >& World::GetComponents() const noexcept {
+		if constexpr (std::is_same_v< PerspectiveCamera, ComponentT >) {
+			return m_perspective_cameras;
+		}
+		else if constexpr (std::is_same_v< OrthographicCamera, ComponentT >) {
+			return m_orthographic_cameras;
+		}
+		else if constexpr (std::is_same_v< AmbientLight, ComponentT >) {
+			return m_ambient_lights;
+		}
+		else if constexpr (std::is_same_v< DirectionalLight, ComponentT >) {
+			return m_directional_lights;
+		}
+		else if constexpr (std::is_same_v< OmniLight, ComponentT >) {
+			return m_omni_lights;
+		}
+		else if constexpr (std::is_same_v< SpotLight, ComponentT >) {
+			return m_spot_lights;
+		}
+		else if constexpr (std::is_same_v< Model, ComponentT >) {
+			return m_models;
 		}
+		else if constexpr (std::is_same_v< SpriteImage, ComponentT >) {
+			return m_sprite_images;
+		}
+		else {
+			static_assert(std::is_same_v< SpriteText, ComponentT >);
+			return m_sprite_texts;
+		}
+	}
 
-		if constexpr (std::is_same_v< Component, ComponentT >) {
-			ForEach< Camera >(action);
-			ForEach< AmbientLight >(action);
-			ForEach< DirectionalLight >(action);
-			ForEach< OmniLight >(action);
-			ForEach< SpotLight >(action);
-			ForEach< Model >(action);
-			ForEach< SpriteImage >(action);
-			ForEach< SpriteText >(action);
+	template< typename ComponentT >
+	[[nodiscard]]
+	inline ActiveIndexList& World::GetActiveComponents() const noexcept {
+		if constexpr (std::is_same_v< PerspectiveCamera, ComponentT >) {
+			return m_active_perspective_cameras;
+		}
+		else if constexpr (std::is_same_v< OrthographicCamera, ComponentT >) {
+			return m_active_orthographic_cameras;
+		}
+		else if constexpr (std::is_same_v< AmbientLight, ComponentT >) {
+			return m_active_ambient_lights;
+		}
+		else if constexpr (std::is_same_v< DirectionalLight, ComponentT >) {
+			return m_active_directional_lights;
+		}
+		else if constexpr (std::is_same_v< OmniLight, ComponentT >) {
+			return m_active_omni_lights;
+		}
+		else if constexpr (std::is_same_v< SpotLight, ComponentT >) {
+			return m_active_spot_lights;
+		}
+		else if constexpr (std::is_same_v< Model, ComponentT >) {
+			return m_active_models;
+		}
+		else if constexpr (std::is_same_v< SpriteImage, ComponentT >) {
+			return m_active_sprite_images;
+		}
+		else {
+			static_assert(std::is_same_v< SpriteText, ComponentT >);
+			return m_active_sprite_texts;
 		}
 	}
 
@@ -6,7 +6,7 @@
 //-----------------------------------------------------------------------------
 // Vertex Shader
 //-----------------------------------------------------------------------------
-float4 VS(VSInputPositionNormalTexture input) : SV_Position {
+float4 VS(VSInputModel input) : SV_Position {
     return Transform(input.p,
 	                 g_object_to_world,
 					 g_world_to_camera2,
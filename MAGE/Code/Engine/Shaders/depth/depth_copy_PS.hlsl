@@ -0,0 +1,17 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#include "global.hlsli"
+
+//-----------------------------------------------------------------------------
+// SRVs
+//-----------------------------------------------------------------------------
+TEXTURE_2D(g_depth_texture, float, SLOT_SRV_IMAGE);
+
+//-----------------------------------------------------------------------------
+// Pixel Shader
+//-----------------------------------------------------------------------------
+float PS(float4 input : SV_Position) : SV_Depth {
+	const uint2 p_texture = input.xy;
+	return g_depth_texture[p_texture];
+}
\ No newline at end of file
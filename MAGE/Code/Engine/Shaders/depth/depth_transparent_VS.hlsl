@@ -6,7 +6,7 @@
 //-----------------------------------------------------------------------------
 // Vertex Shader
 //-----------------------------------------------------------------------------
-PSInputTexture VS(VSInputPositionNormalTexture input) {
+PSInputTexture VS(VSInputModel input) {
 	PSInputTexture output;
 	output.p   = Transform(input.p,
 						   g_object_to_world,
@@ -63,6 +63,7 @@
 #define SLOT_CBUFFER_MODEL                         3
 #define SLOT_CBUFFER_SECONDARY_CAMERA              4
 #define SLOT_CBUFFER_COLOR                         5
+#define SLOT_CBUFFER_INSTANCE                      6
 
 //-----------------------------------------------------------------------------
 // Engine Includes: Light and Shadow Map SRVs
@@ -77,9 +78,8 @@
 #define SLOT_SRV_SHADOW_MAPPED_OMNI_LIGHTS         5
 #define SLOT_SRV_SHADOW_MAPPED_SPOT_LIGHTS         6
 // Shadow (Cube) Maps
-#define SLOT_SRV_DIRECTIONAL_SHADOW_MAPS           7
+#define SLOT_SRV_SHADOW_ATLAS                      7
 #define SLOT_SRV_OMNI_SHADOW_MAPS                  8
-#define SLOT_SRV_SPOT_SHADOW_MAPS                  9
 
 //-----------------------------------------------------------------------------
 // Engine Includes: Voxelization
@@ -104,6 +104,12 @@
 #define SLOT_SRV_SPRITE                           15
 #define SLOT_SRV_TEXTURE                          15
 
+//-----------------------------------------------------------------------------
+// Engine Includes: Instancing SRVs
+//-----------------------------------------------------------------------------
+
+#define SLOT_SRV_INSTANCES                        16
+
 //-----------------------------------------------------------------------------
 // Engine Includes: General UAVs
 //-----------------------------------------------------------------------------
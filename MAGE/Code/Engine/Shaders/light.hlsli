@@ -11,7 +11,7 @@
 //-----------------------------------------------------------------------------
 
 /**
- A struct of shadow maps.
+ A struct of shadow maps (i.e. tiles of a shadow atlas).
  */
 struct ShadowMap {
 
@@ -25,16 +25,16 @@ struct ShadowMap {
 	SamplerComparisonState m_pcf_sampler;
 
 	/**
-	 The array of shadow map textures containing the shadow map texture of this
-	 shadow map.
+	 The shadow atlas texture containing the tile of this shadow map.
 	 */
-	Texture2DArray< float > m_maps;
+	Texture2D< float > m_atlas;
 
 	/**
-	 The index into the array of shadow map textures corresponding to the
-	 shadow map texture of this shadow map.
+	 The scale (xy) and offset (zw) of the tile of this shadow map expressed
+	 in shadow atlas UV space. A zero scale indicates that no tile is
+	 allocated.
 	 */
-	uint m_index;
+	float4 m_tile;
 
 	//-------------------------------------------------------------------------
 	// Member Methods
@@ -49,9 +49,27 @@ struct ShadowMap {
 					given hit position expressed in light NDC space.
 	 */
 	float ShadowFactor(float3 p_ndc) {
-		const float3 location = { NDCtoUV(p_ndc.xy), m_index };
-
-		return  m_maps.SampleCmpLevelZero(m_pcf_sampler, location, p_ndc.z);
+		// Lights without tile are not shadowed.
+		if (0.0f == m_tile.x) {
+			return 1.0f;
+		}
+
+		const float2 uv = NDCtoUV(p_ndc.xy);
+		// Positions outside the shadow map are shadowed.
+		if (any(0.0f > uv || 1.0f < uv)) {
+			return 0.0f;
+		}
+
+		float2 resolution;
+		m_atlas.GetDimensions(resolution.x, resolution.y);
+		const float2 half_texel = 0.5f / resolution;
+
+		// Keep the PCF footprint inside the tile.
+		const float2 location = clamp(uv * m_tile.xy + m_tile.zw,
+									  m_tile.zw + half_texel,
+									  m_tile.zw + m_tile.xy - half_texel);
+
+		return m_atlas.SampleCmpLevelZero(m_pcf_sampler, location, p_ndc.z);
 	}
 };
 
@@ -404,7 +422,18 @@ struct SpotLight : PointLight {
 /**
  A struct of shadow mapped directional lights.
  */
-typedef DirectionalLight ShadowMappedDirectionalLight;
+struct ShadowMappedDirectionalLight : DirectionalLight {
+
+	//-------------------------------------------------------------------------
+	// Member Variables
+	//-------------------------------------------------------------------------
+
+	/**
+	 The scale (xy) and offset (zw) of the shadow atlas tile of this shadow
+	 mapped directional light.
+	 */
+	float4 m_shadow_tile;
+};
 
 /**
  A struct of shadow mapped omni lights.
@@ -476,6 +505,12 @@ struct ShadowMappedSpotLight : SpotLight {
 	 */
 	float4x4 m_world_to_projection;
 
+	/**
+	 The scale (xy) and offset (zw) of the shadow atlas tile of this shadow
+	 mapped spotlight.
+	 */
+	float4 m_shadow_tile;
+
 	//-------------------------------------------------------------------------
 	// Member Methods
 	//-------------------------------------------------------------------------
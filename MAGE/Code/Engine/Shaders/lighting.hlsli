@@ -96,6 +96,30 @@ CBUFFER(LightBuffer, SLOT_CBUFFER_LIGHTING) {
 	 The radiance of the ambient light in the scene.
 	 */
 	float3 g_La                     : packoffset(c2);
+
+	//-------------------------------------------------------------------------
+	// Member Variables: Light Clusters
+	//-------------------------------------------------------------------------
+
+	/**
+	 The resolution of the light cluster grid.
+	 .x = the number of screen tiles along the x axis
+	 .y = the number of screen tiles along the y axis
+	 .z = the number of depth slices
+	 */
+	uint3 g_light_cluster_resolution  : packoffset(c3.x);
+
+	/**
+	 The scale to apply to the logarithm of a camera-space depth to obtain its
+	 depth slice.
+	 */
+	float g_light_cluster_depth_scale : packoffset(c3.w);
+
+	/**
+	 The bias to add to the scaled logarithm of a camera-space depth to obtain
+	 its depth slice.
+	 */
+	float g_light_cluster_depth_bias  : packoffset(c4.x);
 }
 
 #endif // BRDF_FUNCTION
@@ -105,6 +129,11 @@ CBUFFER(LightBuffer, SLOT_CBUFFER_LIGHTING) {
 //-----------------------------------------------------------------------------
 #ifdef BRDF_FUNCTION
 
+#if !defined(DISABLE_LIGHTS_OMNI) || !defined(DISABLE_LIGHTS_SPOT)
+STRUCTURED_BUFFER(g_light_index_list, uint,
+				  SLOT_SRV_LIGHT_INDEX_LIST);
+#endif // !DISABLE_LIGHTS_OMNI || !DISABLE_LIGHTS_SPOT
+
 #ifndef DISABLE_LIGHTS_DIRECTIONAL
 STRUCTURED_BUFFER(g_directional_lights, DirectionalLight,
 				  SLOT_SRV_DIRECTIONAL_LIGHTS);
@@ -125,8 +154,6 @@ STRUCTURED_BUFFER(g_spot_lights, SpotLight,
 #ifndef DISABLE_LIGHTS_SHADOW_MAPPED_DIRECTIONAL
 STRUCTURED_BUFFER(g_sm_directional_lights, ShadowMappedDirectionalLight,
 				  SLOT_SRV_SHADOW_MAPPED_DIRECTIONAL_LIGHTS);
-TEXTURE_2D_ARRAY(g_directional_sms, float,
-				 SLOT_SRV_DIRECTIONAL_SHADOW_MAPS);
 #endif // DISABLE_LIGHTS_SHADOW_MAPPED_DIRECTIONAL
 
 #ifndef DISABLE_LIGHTS_SHADOW_MAPPED_OMNI
@@ -139,10 +166,13 @@ TEXTURE_CUBE_ARRAY(g_omni_sms, float,
 #ifndef DISABLE_LIGHTS_SHADOW_MAPPED_SPOT
 STRUCTURED_BUFFER(g_sm_spot_lights, ShadowMappedSpotLight,
 				  SLOT_SRV_SHADOW_MAPPED_SPOT_LIGHTS);
-TEXTURE_2D_ARRAY(g_spot_sms, float,
-				 SLOT_SRV_SPOT_SHADOW_MAPS);
 #endif // DISABLE_LIGHTS_SHADOW_MAPPED_SPOT
 
+#if !defined(DISABLE_LIGHTS_SHADOW_MAPPED_DIRECTIONAL) \
+ || !defined(DISABLE_LIGHTS_SHADOW_MAPPED_SPOT)
+TEXTURE_2D(g_shadow_atlas, float, SLOT_SRV_SHADOW_ATLAS);
+#endif
+
 #endif // DISABLE_LIGHTS_SHADOW_MAPPED
 
 #ifndef DISABLE_VCT
@@ -170,6 +200,61 @@ float FogFactor_Exponential(float distance, float density) {
 
 #ifdef BRDF_FUNCTION
 
+#if !defined(DISABLE_LIGHTS_OMNI) || !defined(DISABLE_LIGHTS_SPOT)
+
+/**
+ Obtains the light cluster containing the given position.
+
+ @param[in]		p_world
+				The position expressed in world space.
+ @param[out]	offset
+				The offset of the light indices of the light cluster in the
+				light index list.
+ @param[out]	nb_omni_lights
+				The number of omni lights of the light cluster (or the number
+				of omni lights in the scene if @a p_world is not contained in
+				the light cluster grid).
+ @param[out]	nb_spot_lights
+				The number of spotlights of the light cluster (or the number
+				of spotlights in the scene if @a p_world is not contained in
+				the light cluster grid).
+ @return		@c true if @a p_world is contained in the light cluster grid
+				(i.e. the view frustum of the camera). @c false otherwise.
+ */
+bool GetLightCluster(float3 p_world, out uint offset,
+					 out uint nb_omni_lights, out uint nb_spot_lights) {
+
+	offset         = 0u;
+	nb_omni_lights = g_nb_omni_lights;
+	nb_spot_lights = g_nb_spot_lights;
+
+	// World -> Camera -> Projection -> NDC
+	const float4 p_camera  = mul(float4(p_world, 1.0f), g_world_to_camera);
+	const float4 p_proj    = mul(p_camera, g_camera_to_projection);
+	const float2 p_ndc_xy  = p_proj.xy / p_proj.w;
+	const float3 p_cluster = {
+		(0.5f * p_ndc_xy + 0.5f) * g_light_cluster_resolution.xy,
+		log(p_camera.z) * g_light_cluster_depth_scale + g_light_cluster_depth_bias
+	};
+
+	// Also rejects NaNs (e.g., behind the camera).
+	if (!all(0.0f <= p_cluster && p_cluster < (float3)g_light_cluster_resolution)) {
+		return false;
+	}
+
+	const uint3 index   = (uint3)p_cluster;
+	const uint  cluster = (index.z * g_light_cluster_resolution.y + index.y)
+		                * g_light_cluster_resolution.x + index.x;
+	const uint  counts  = g_light_index_list[2u * cluster + 1u];
+
+	offset         = g_light_index_list[2u * cluster];
+	nb_omni_lights = counts & 0xFFFFu;
+	nb_spot_lights = counts >> 16u;
+	return true;
+}
+
+#endif // !DISABLE_LIGHTS_OMNI || !DISABLE_LIGHTS_SPOT
+
 float3 GetRadiance(float3 p_world, float3 n_world, float3 v_world,
 				   Material material) {
 
@@ -201,10 +286,19 @@ float3 GetRadiance(float3 p_world, float3 n_world, float3 v_world,
 	}
 	#endif // DISABLE_LIGHTS_DIRECTIONAL
 
+	#if !defined(DISABLE_LIGHTS_OMNI) || !defined(DISABLE_LIGHTS_SPOT)
+	// Obtain the omni lights and spotlights of the light cluster (or all
+	// omni lights and spotlights outside the light cluster grid).
+	uint offset, nb_omni_lights, nb_spot_lights;
+	const bool clustered = GetLightCluster(p_world, offset,
+										   nb_omni_lights, nb_spot_lights);
+	#endif // !DISABLE_LIGHTS_OMNI || !DISABLE_LIGHTS_SPOT
+
 	#ifndef DISABLE_LIGHTS_OMNI
 	// Direct illumination: omni lights
-	for (uint i1 = 0u; i1 < g_nb_omni_lights; ++i1) {
-		const OmniLight light = g_omni_lights[i1];
+	for (uint i1 = 0u; i1 < nb_omni_lights; ++i1) {
+		const uint      index = clustered ? g_light_index_list[offset + i1] : i1;
+		const OmniLight light = g_omni_lights[index];
 
 		// Compute the light (hit-to-light) direction and
 		// orthogonal irradiance contribution of the light.
@@ -221,8 +315,10 @@ float3 GetRadiance(float3 p_world, float3 n_world, float3 v_world,
 
 	#ifndef DISABLE_LIGHTS_SPOT
 	// Direct illumination: spotlights
-	for (uint i2 = 0u; i2 < g_nb_spot_lights; ++i2) {
-		const SpotLight light = g_spot_lights[i2];
+	for (uint i2 = 0u; i2 < nb_spot_lights; ++i2) {
+		const uint      index = clustered
+			                  ? g_light_index_list[offset + nb_omni_lights + i2] : i2;
+		const SpotLight light = g_spot_lights[index];
 
 		// Compute the light (hit-to-light) direction and
 		// orthogonal irradiance contribution of the light.
@@ -243,7 +339,7 @@ float3 GetRadiance(float3 p_world, float3 n_world, float3 v_world,
 	// Direct illumination: directional lights with shadow mapping
 	for (uint i3 = 0u; i3 < g_nb_sm_directional_lights; ++i3) {
 		const ShadowMappedDirectionalLight light = g_sm_directional_lights[i3];
-		const ShadowMap map = { g_pcf_sampler, g_directional_sms, i3 };
+		const ShadowMap map = { g_pcf_sampler, g_shadow_atlas, light.m_shadow_tile };
 
 		// Compute the light (hit-to-light) direction and
 		// orthogonal irradiance contribution of the light.
@@ -281,7 +377,7 @@ float3 GetRadiance(float3 p_world, float3 n_world, float3 v_world,
 	// Direct illumination: spotlights with shadow mapping
 	for (uint i5 = 0u; i5 < g_nb_sm_spot_lights; ++i5) {
 		const ShadowMappedSpotLight light = g_sm_spot_lights[i5];
-		const ShadowMap map = { g_pcf_sampler, g_spot_sms, i5 };
+		const ShadowMap map = { g_pcf_sampler, g_shadow_atlas, light.m_shadow_tile };
 
 		// Compute the light (hit-to-light) direction and
 		// orthogonal irradiance contribution of the light.
@@ -57,6 +57,17 @@ struct VSInputPositionNormalTexture {
 	float2 tex   : TEXCOORD0;
 };
 
+/**
+ A vertex shader input struct of compact vertices having a position (quantized
+ to the [0,1] range of the bounds of the mesh), an octahedron encoded normal
+ and a pair of texture coordinates.
+ */
+struct VSInputCompactPositionNormalTexture {
+	float3 p     : POSITION0;
+	float2 n     : NORMAL0;
+	float2 tex   : TEXCOORD0;
+};
+
 /**
  A vertex shader input struct of vertices having a position, a color and a
  pair of texture coordinates.
@@ -1,15 +1,63 @@
 #ifndef MAGE_HEADER_TRANSFORM
 #define MAGE_HEADER_TRANSFORM
 
+//-----------------------------------------------------------------------------
+// Engine Configuration
+//-----------------------------------------------------------------------------
+// Defines			                        | Default
+//-----------------------------------------------------------------------------
+// ENABLE_COMPACT_VERTICES                  | not defined
+
 //-----------------------------------------------------------------------------
 // Engine Includes
 //-----------------------------------------------------------------------------
 #include "structures.hlsli"
+#include "unit_vector.hlsli"
+
+//-----------------------------------------------------------------------------
+// Engine Defines
+//-----------------------------------------------------------------------------
+
+#ifdef ENABLE_COMPACT_VERTICES
+	#define VSInputModel VSInputCompactPositionNormalTexture
+#else  // ENABLE_COMPACT_VERTICES
+	#define VSInputModel VSInputPositionNormalTexture
+#endif // ENABLE_COMPACT_VERTICES
 
 //-----------------------------------------------------------------------------
 // Engine Declarations and Definitions
 //-----------------------------------------------------------------------------
 
+/**
+ Decodes the given vertex input structure.
+
+ @param[in]		input
+				The vertex input structure.
+ @return		The decoded vertex input structure.
+ */
+VSInputPositionNormalTexture Decode(VSInputPositionNormalTexture input) {
+	return input;
+}
+
+/**
+ Decodes the given compact vertex input structure.
+
+ The quantized position is not decoded: the object-to-world transformation
+ matrix of a mesh with compact vertices maps the [0,1] range to the bounds of
+ the mesh.
+
+ @param[in]		input
+				The compact vertex input structure.
+ @return		The decoded vertex input structure.
+ */
+VSInputPositionNormalTexture Decode(VSInputCompactPositionNormalTexture input) {
+	VSInputPositionNormalTexture output;
+	output.p   = input.p;
+	output.n   = DecodeUnitVector_Octahedron(input.n);
+	output.tex = input.tex;
+	return output;
+}
+
 /**
  Transforms the given position from object to projection space.
 
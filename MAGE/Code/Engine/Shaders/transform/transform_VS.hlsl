@@ -7,8 +7,8 @@
 //-----------------------------------------------------------------------------
 // Vertex Shader
 //-----------------------------------------------------------------------------
-PSInputPositionNormalTexture VS(VSInputPositionNormalTexture input) {
-	return Transform(input,
+PSInputPositionNormalTexture VS(VSInputModel input) {
+	return Transform(Decode(input),
 					 g_object_to_world,
 					 g_world_to_camera,
 					 g_camera_to_projection,
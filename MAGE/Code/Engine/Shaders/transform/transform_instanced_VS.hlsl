@@ -0,0 +1,92 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#include "forward\forward_input.hlsli"
+#include "transform\transform.hlsli"
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+
+/**
+ A struct of model instances (i.e. the model constant buffer data of a single
+ instance).
+ */
+struct ModelInstance {
+
+	//-------------------------------------------------------------------------
+	// Member Variables: Transformations
+	//-------------------------------------------------------------------------
+
+	/**
+	 The object-to-world transformation matrix of this model instance.
+	 */
+	float4x4 m_object_to_world;
+
+	/**
+	 The object-to-world inverse transpose transformation matrix
+	 = the normal-to-world transformation matrix of this model instance.
+	 */
+	float4x4 m_normal_to_world;
+
+	/**
+	 The texture transformation matrix of this model instance.
+	 */
+	float4x4 m_texture_transform;
+
+	//-------------------------------------------------------------------------
+	// Member Variables: Material
+	//-------------------------------------------------------------------------
+
+	/**
+	 The (linear) base color of the material of this model instance.
+	 */
+	float4   m_base_color;
+
+	/**
+	 The (linear) roughness of the material of this model instance.
+	 */
+	float    m_roughness;
+
+	/**
+	 The (linear) metalness of the material of this model instance.
+	 */
+	float    m_metalness;
+
+	/**
+	 The padding of this model instance.
+	 */
+	uint2    m_padding;
+};
+
+//-----------------------------------------------------------------------------
+// Constant Buffers
+//-----------------------------------------------------------------------------
+CBUFFER(Instance, SLOT_CBUFFER_INSTANCE) {
+
+	/**
+	 The index of the first model instance of the draw call.
+	 */
+	uint g_instance_start : packoffset(c0.x);
+}
+
+//-----------------------------------------------------------------------------
+// SRVs
+//-----------------------------------------------------------------------------
+STRUCTURED_BUFFER(g_instances, ModelInstance, SLOT_SRV_INSTANCES);
+
+//-----------------------------------------------------------------------------
+// Vertex Shader
+//-----------------------------------------------------------------------------
+PSInputPositionNormalTexture VS(VSInputModel input,
+								uint instance : SV_InstanceID) {
+
+	const ModelInstance model = g_instances[g_instance_start + instance];
+
+	return Transform(Decode(input),
+					 model.m_object_to_world,
+					 g_world_to_camera,
+					 g_camera_to_projection,
+					 (float3x3)model.m_normal_to_world,
+					 model.m_texture_transform);
+}
\ No newline at end of file
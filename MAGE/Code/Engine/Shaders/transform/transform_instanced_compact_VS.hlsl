@@ -0,0 +1,5 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#define ENABLE_COMPACT_VERTICES
+#include "transform\transform_instanced_VS.hlsl"
\ No newline at end of file
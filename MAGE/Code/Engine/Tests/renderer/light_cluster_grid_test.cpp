@@ -0,0 +1,244 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "test.hpp"
+#include "tests.hpp"
+#include "renderer\light_cluster_grid.hpp"
+#include "string\format.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::test {
+
+	using namespace rendering;
+
+	namespace {
+
+		/**
+		 The position of the near z-plane expressed in camera space of the
+		 cameras of the light fixtures.
+		 */
+		constexpr F32 s_near_z = 0.1f;
+
+		/**
+		 The position of the far z-plane expressed in camera space of the
+		 cameras of the light fixtures.
+		 */
+		constexpr F32 s_far_z = 100.0f;
+
+		/**
+		 Creates the given number of random camera-space bounding spheres
+		 around the view frustum (i.e. inside, partially inside, crossing the
+		 camera plane and outside). The bounding spheres are deterministic.
+
+		 @param[in]		nb_lights
+						The number of lights.
+		 @param[in]		seed
+						The seed.
+		 @return		A vector containing the bounding spheres.
+		 */
+		[[nodiscard]]
+		AlignedVector< BoundingSphere > CreateLights(std::size_t nb_lights,
+													  U32 seed) {
+			std::mt19937 generator(seed);
+			std::uniform_real_distribution< F32 > xy(-60.0f, 60.0f);
+			std::uniform_real_distribution< F32 > z(-5.0f, 110.0f);
+			std::uniform_real_distribution< F32 > radius(0.5f, 10.0f);
+
+			AlignedVector< BoundingSphere > lights;
+			lights.reserve(nb_lights);
+			for (std::size_t i = 0u; i < nb_lights; ++i) {
+				const auto x = xy(generator);
+				const auto y = xy(generator);
+				lights.emplace_back(Point3(x, y, z(generator)), radius(generator));
+			}
+
+			return lights;
+		}
+
+		/**
+		 Returns the cluster of the given light cluster grid containing the
+		 given camera-space position, as the shaders look it up.
+
+		 @param[in]		grid
+						A reference to the light cluster grid.
+		 @param[in]		camera_to_projection
+						The camera-to-projection transformation matrix.
+		 @param[in]		p
+						The position expressed in camera space.
+		 @return		The index of the cluster containing @a p.
+		 */
+		[[nodiscard]]
+		std::size_t XM_CALLCONV GetCluster(const LightClusterGrid& grid,
+										   FXMMATRIX camera_to_projection,
+										   FXMVECTOR p) noexcept {
+
+			const auto ndc = XMVector3TransformCoord(p, camera_to_projection);
+			const auto to_tile = [](F32 x, U32 nb_tiles) noexcept {
+				const auto tile = std::floor((0.5f * x + 0.5f)
+											 * static_cast< F32 >(nb_tiles));
+				return static_cast< U32 >(std::clamp(tile, 0.0f,
+					static_cast< F32 >(nb_tiles - 1u)));
+			};
+
+			const auto slice = std::floor(std::log(XMVectorGetZ(p))
+										  * grid.GetDepthScale()
+										  + grid.GetDepthBias());
+
+			return LightClusterGrid::GetClusterIndex(
+				to_tile(XMVectorGetX(ndc), LightClusterGrid::s_nb_tiles_x),
+				to_tile(XMVectorGetY(ndc), LightClusterGrid::s_nb_tiles_y),
+				static_cast< U32 >(std::clamp(slice, 0.0f,
+					static_cast< F32 >(LightClusterGrid::s_nb_slices - 1u))));
+		}
+
+		/**
+		 Checks whether each given light is present in the cluster of each
+		 point of the view frustum its bounding sphere covers (sampled at
+		 random).
+
+		 @param[in]		grid
+						A reference to the light cluster grid.
+		 @param[in]		camera_to_projection
+						The camera-to-projection transformation matrix.
+		 @param[in]		lights
+						The bounding spheres of the lights expressed in camera
+						space.
+		 @param[in]		spot
+						@c true if the lights are the spotlights of @a grid.
+						@c false if the lights are the omni lights of
+						@a grid.
+		 @param[in,out]	nb_mismatches
+						A reference to the number of mismatches.
+		 @return		The number of sampled points inside the view frustum.
+		 */
+		std::size_t XM_CALLCONV CheckCoverage(const LightClusterGrid& grid,
+											  FXMMATRIX camera_to_projection,
+											  gsl::span< const BoundingSphere > lights,
+											  bool spot,
+											  std::size_t& nb_mismatches) {
+
+			std::mt19937 generator(0x4D414745u);
+			std::uniform_real_distribution< F32 > unit(-1.0f, 1.0f);
+
+			std::size_t nb_points = 0u;
+			for (std::size_t i = 0u; i < static_cast< std::size_t >(lights.size()); ++i) {
+				const auto& light = lights[i];
+
+				for (std::size_t j = 0u; j < 64u; ++j) {
+					// A point strictly inside the bounding sphere.
+					const auto d = XMVectorSet(unit(generator), unit(generator),
+											   unit(generator), 0.0f);
+					if (1.0f < XMVectorGetX(XMVector3LengthSq(d))) {
+						continue;
+					}
+					const auto r = XMVectorReplicate(0.99f * light.Radius());
+					const auto p = XMVectorSetW(
+						XMVectorMultiplyAdd(r, d, light.Centroid()), 1.0f);
+
+					// Skip the points outside the view frustum.
+					const auto z   = XMVectorGetZ(p);
+					const auto ndc = XMVector3TransformCoord(p, camera_to_projection);
+					if (z <= s_near_z || s_far_z <= z
+						|| 1.0f < std::abs(XMVectorGetX(ndc))
+						|| 1.0f < std::abs(XMVectorGetY(ndc))) {
+						continue;
+					}
+					++nb_points;
+
+					const auto cluster = GetCluster(grid, camera_to_projection, p);
+					const auto indices = spot ? grid.GetSpotLights(cluster)
+						                      : grid.GetOmniLights(cluster);
+					if (std::find(indices.cbegin(), indices.cend(), static_cast< U32 >(i))
+						!= indices.cend()) {
+						continue;
+					}
+
+					// Only print the first few mismatches.
+					if (nb_mismatches < 8u) {
+						Print("  Light {} missing from cluster {}\n", i, cluster);
+					}
+					++nb_mismatches;
+				}
+			}
+
+			return nb_points;
+		}
+
+		void XM_CALLCONV TestCoverage(FXMMATRIX camera_to_projection) {
+			const auto omni_lights = CreateLights(1000u, 0x4D414745u);
+			const auto spot_lights = CreateLights(500u,  0x4C494748u);
+
+			LightClusterGrid grid;
+			grid.Build(camera_to_projection, s_near_z, s_far_z,
+					   gsl::make_span(omni_lights), gsl::make_span(spot_lights));
+
+			std::size_t nb_mismatches = 0u;
+			const auto nb_points
+				= CheckCoverage(grid, camera_to_projection,
+								gsl::make_span(omni_lights), false, nb_mismatches)
+				+ CheckCoverage(grid, camera_to_projection,
+								gsl::make_span(spot_lights), true,  nb_mismatches);
+
+			Print("  {} points covered by {} lights\n",
+				  nb_points, omni_lights.size() + spot_lights.size());
+
+			Expect(0u < nb_points);
+			Expect(0u == nb_mismatches);
+
+			// The light indices of each cluster are valid and the light index
+			// list contains exactly the light indices of the clusters.
+			std::size_t nb_indices = 0u;
+			std::size_t nb_invalid_indices = 0u;
+			for (std::size_t i = 0u; i < LightClusterGrid::s_nb_clusters; ++i) {
+				for (const auto index : grid.GetOmniLights(i)) {
+					nb_invalid_indices += (omni_lights.size() <= index) ? 1u : 0u;
+				}
+				for (const auto index : grid.GetSpotLights(i)) {
+					nb_invalid_indices += (spot_lights.size() <= index) ? 1u : 0u;
+				}
+				nb_indices += static_cast< std::size_t >(grid.GetOmniLights(i).size()
+														 + grid.GetSpotLights(i).size());
+			}
+			Expect(0u == nb_invalid_indices);
+			Expect(2u * LightClusterGrid::s_nb_clusters + nb_indices
+				   == grid.GetLightIndexList().size());
+		}
+
+		void TestEmpty() {
+			LightClusterGrid grid;
+			grid.Build(XMMatrixPerspectiveFovLH(XM_PIDIV4, 1.0f, s_near_z, s_far_z),
+					   s_near_z, s_far_z, {}, {});
+
+			std::size_t nb_indices = 0u;
+			for (std::size_t i = 0u; i < LightClusterGrid::s_nb_clusters; ++i) {
+				nb_indices += static_cast< std::size_t >(grid.GetOmniLights(i).size()
+														 + grid.GetSpotLights(i).size());
+			}
+			Expect(0u == nb_indices);
+		}
+	}
+
+	void TestLightClusterGrid() {
+		TestCoverage(XMMatrixPerspectiveFovLH(XM_PI / 3.0f, 16.0f / 9.0f,
+											  s_near_z, s_far_z));
+		TestCoverage(XMMatrixOrthographicLH(80.0f, 45.0f, s_near_z, s_far_z));
+		TestEmpty();
+	}
+}
\ No newline at end of file
@@ -0,0 +1,288 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "test.hpp"
+#include "tests.hpp"
+#include "renderer\render_queue.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::test {
+
+	using namespace rendering;
+
+	namespace {
+
+		/**
+		 A class of model fixtures: each model is owned by its own node, which
+		 is translated along the x-axis by the index of the model. All models
+		 initially share the same (absent) mesh, submesh and material.
+		 */
+		class ModelFixture {
+
+		public:
+
+			explicit ModelFixture(std::size_t nb_models)
+				: m_nodes(nb_models),
+				m_models(nb_models) {
+
+				for (std::size_t i = 0u; i < nb_models; ++i) {
+					auto& node = m_nodes[i];
+					node.Set(ProxyPtr< Node >(m_nodes, i));
+					node.Add(ProxyPtr< Model >(m_models, i));
+					node.GetTransform().SetTranslation(static_cast< F32 >(i), 0.0f, 0.0f);
+
+					SetSubmesh(i, 0u);
+				}
+			}
+
+			ModelFixture(const ModelFixture& fixture) = delete;
+
+			ModelFixture& operator=(const ModelFixture& fixture) = delete;
+
+			[[nodiscard]]
+			Model& operator[](std::size_t index) noexcept {
+				return m_models[index];
+			}
+
+			[[nodiscard]]
+			std::size_t GetIndex(const Model& model) const noexcept {
+				return static_cast< std::size_t >(&model - m_models.data());
+			}
+
+			void SetSubmesh(std::size_t index, std::size_t start_index) noexcept {
+				m_models[index].SetMesh(nullptr, start_index, 36u,
+										AABB(), BoundingSphere(),
+										DXGI_FORMAT_R16_UINT);
+			}
+
+		private:
+
+			std::vector< Node > m_nodes;
+
+			std::vector< Model > m_models;
+		};
+
+		/**
+		 Builds the given render queue with one opaque draw item per model
+		 (the i-th model at depth i).
+
+		 @param[in,out]	queue
+						A reference to the render queue.
+		 @param[in,out]	models
+						A reference to the model fixture.
+		 @param[in]		nb_models
+						The number of models.
+		 @param[in]		bucket
+						The (opaque) render bucket.
+		 */
+		void BuildOpaque(RenderQueue& queue,
+						 ModelFixture& models,
+						 std::size_t nb_models,
+						 RenderBucket bucket = RenderBucket::Opaque) {
+
+			for (std::size_t i = 0u; i < nb_models; ++i) {
+				const auto index = queue.AddModel(models[i]);
+				const auto key   = RenderQueue::MakeOpaqueKey(
+					bucket, 1u, 1u, static_cast< F32 >(i + 1u), OpaqueOrder::Material);
+				queue.AddDrawItem(index, key);
+			}
+
+			queue.Sort();
+			queue.Batch();
+		}
+
+		/**
+		 Checks whether the instances of the given instance batch contain the
+		 transforms of the models of the draw items of that batch, in the
+		 order of the draw items.
+
+		 @param[in]		queue
+						A reference to the (batched) render queue.
+		 @param[in]		models
+						A reference to the model fixture.
+		 @param[in]		batch
+						A reference to the instance batch.
+		 @return		@c true if the instances of the given instance batch
+						are in the order of its draw items. @c false
+						otherwise.
+		 */
+		[[nodiscard]]
+		bool HasInstancesInOrder(const RenderQueue& queue,
+								 const ModelFixture& models,
+								 const InstanceBatch& batch) {
+
+			const auto& instances = queue.GetInstances();
+			for (U32 i = 0u; i < batch.m_count; ++i) {
+				const auto& item     = queue.GetDrawItem(batch.m_first + i);
+				const auto& model    = queue.GetModel(item);
+				const auto& instance = instances[batch.m_instance_start + i];
+
+				// The object-to-world matrix is transposed: the translation
+				// is stored in the fourth column.
+				const auto x = XMVectorGetW(instance.m_object_to_world.r[0]);
+				if (static_cast< F32 >(models.GetIndex(model)) != x) {
+					return false;
+				}
+			}
+
+			return true;
+		}
+
+		void TestEmptyQueue() {
+			RenderQueue queue;
+			queue.Sort();
+			queue.Batch();
+
+			for (U8 i = 0u; i < static_cast< U8 >(RenderBucket::Count); ++i) {
+				const auto bucket = static_cast< RenderBucket >(i);
+				Expect(queue.GetDrawItems(bucket).empty());
+				Expect(queue.GetInstanceBatches(bucket).empty());
+			}
+			Expect(queue.GetInstances().empty());
+		}
+
+		void TestSingleBatch() {
+			ModelFixture models(4u);
+			RenderQueue  queue;
+			BuildOpaque(queue, models, 4u);
+
+			const auto batches = queue.GetInstanceBatches(RenderBucket::Opaque);
+			Expect(1 == batches.size());
+			Expect(0u == batches[0].m_first);
+			Expect(4u == batches[0].m_count);
+			Expect(0u == batches[0].m_instance_start);
+			Expect(4u == queue.GetInstances().size());
+			Expect(HasInstancesInOrder(queue, models, batches[0]));
+		}
+
+		void TestSingleDrawItemBatch() {
+			ModelFixture models(1u);
+			RenderQueue  queue;
+			BuildOpaque(queue, models, 1u);
+
+			// Single draw items are not instanced.
+			const auto batches = queue.GetInstanceBatches(RenderBucket::Opaque);
+			Expect(1 == batches.size());
+			Expect(1u == batches[0].m_count);
+			Expect(queue.GetInstances().empty());
+		}
+
+		void TestSubmeshSplit() {
+			ModelFixture models(4u);
+			models.SetSubmesh(2u, 36u);
+
+			RenderQueue queue;
+			BuildOpaque(queue, models, 4u);
+
+			// The third model breaks the batch of the first two models and
+			// the fourth model is not consecutive to them.
+			const auto batches = queue.GetInstanceBatches(RenderBucket::Opaque);
+			Expect(3 == batches.size());
+			Expect(2u == batches[0].m_count);
+			Expect(1u == batches[1].m_count);
+			Expect(1u == batches[2].m_count);
+			Expect(2u == queue.GetInstances().size());
+			Expect(HasInstancesInOrder(queue, models, batches[0]));
+		}
+
+		void TestMaterialSplit() {
+			ModelFixture models(4u);
+			models[2].GetMaterial().SetRoughness(0.25f);
+			models[3].GetMaterial().SetRoughness(0.25f);
+
+			RenderQueue queue;
+			BuildOpaque(queue, models, 4u);
+
+			const auto batches = queue.GetInstanceBatches(RenderBucket::Opaque);
+			Expect(2 == batches.size());
+			Expect(2u == batches[0].m_count);
+			Expect(2u == batches[1].m_count);
+			Expect(2u == batches[1].m_instance_start);
+			Expect(4u == queue.GetInstances().size());
+			Expect(HasInstancesInOrder(queue, models, batches[0]));
+			Expect(HasInstancesInOrder(queue, models, batches[1]));
+		}
+
+		void TestBucketSplit() {
+			ModelFixture models(4u);
+			RenderQueue  queue;
+
+			// Identical models in different render buckets are never batched
+			// together.
+			for (std::size_t i = 0u; i < 4u; ++i) {
+				const auto index  = queue.AddModel(models[i]);
+				const auto bucket = (i < 2u) ? RenderBucket::Opaque
+					                         : RenderBucket::OpaqueTSNM;
+				queue.AddDrawItem(index, RenderQueue::MakeOpaqueKey(
+					bucket, 1u, 1u, static_cast< F32 >(i + 1u), OpaqueOrder::Material));
+			}
+			queue.Sort();
+			queue.Batch();
+
+			const auto opaque = queue.GetInstanceBatches(RenderBucket::Opaque);
+			const auto tsnm   = queue.GetInstanceBatches(RenderBucket::OpaqueTSNM);
+			Expect(1 == opaque.size());
+			Expect(1 == tsnm.size());
+			Expect(2u == opaque[0].m_count);
+			Expect(2u == tsnm[0].m_count);
+			Expect(queue.GetInstanceBatches(RenderBucket::Transparent).empty());
+			Expect(HasInstancesInOrder(queue, models, opaque[0]));
+			Expect(HasInstancesInOrder(queue, models, tsnm[0]));
+		}
+
+		void TestTransparentOrder() {
+			ModelFixture models(3u);
+			for (std::size_t i = 0u; i < 3u; ++i) {
+				models[i].GetMaterial().SetTransparent();
+			}
+			models[1].SetSubmesh(1u, 36u);
+
+			RenderQueue queue;
+			for (std::size_t i = 0u; i < 3u; ++i) {
+				const auto index = queue.AddModel(models[i]);
+				queue.AddDrawItem(index, RenderQueue::MakeTransparentKey(
+					RenderPermutation::Default, 1u, 1u, static_cast< F32 >(i + 1u)));
+			}
+			queue.Sort();
+			queue.Batch();
+
+			// The draw items are sorted back-to-front and the batches never
+			// reorder them: the farthest and nearest models cannot be batched
+			// around the model in between.
+			const auto items = queue.GetDrawItems(RenderBucket::Transparent);
+			Expect(3 == items.size());
+			Expect(2u == models.GetIndex(queue.GetModel(items[0])));
+			Expect(1u == models.GetIndex(queue.GetModel(items[1])));
+			Expect(0u == models.GetIndex(queue.GetModel(items[2])));
+
+			const auto batches = queue.GetInstanceBatches(RenderBucket::Transparent);
+			Expect(3 == batches.size());
+			Expect(queue.GetInstances().empty());
+		}
+	}
+
+	void TestRenderQueue() {
+		TestEmptyQueue();
+		TestSingleBatch();
+		TestSingleDrawItemBatch();
+		TestSubmeshSplit();
+		TestMaterialSplit();
+		TestBucketSplit();
+		TestTransparentOrder();
+	}
+}
\ No newline at end of file
@@ -0,0 +1,324 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "test.hpp"
+#include "tests.hpp"
+#include "renderer\shadow_atlas_allocator.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::test {
+
+	using namespace rendering;
+
+	namespace {
+
+		using Request = ShadowAtlasAllocator::Request;
+		using Tile    = ShadowAtlasAllocator::Tile;
+
+		/**
+		 Creates a request with the given key whose desired tile size is the
+		 given size, for a shadow atlas allocator with the given maximum tile
+		 size.
+
+		 @param[in]		key
+						The key of the light.
+		 @param[in]		size
+						The desired tile size.
+		 @param[in]		max_tile_size
+						The maximum tile size of the shadow atlas allocator.
+		 @return		The request.
+		 */
+		[[nodiscard]]
+		const Request CreateRequest(U64 key, F32 size,
+									F32 max_tile_size = 512.0f) noexcept {
+			const auto ratio = size / max_tile_size;
+			return { key, ratio * ratio, 1.0f };
+		}
+
+		/**
+		 Checks whether the tiles of the given shadow atlas allocator lie
+		 inside the shadow atlas and do not overlap.
+
+		 @param[in]		allocator
+						A reference to the shadow atlas allocator.
+		 @return		@c true if the tiles of the given shadow atlas
+						allocator are valid. @c false otherwise.
+		 */
+		[[nodiscard]]
+		bool AreTilesValid(const ShadowAtlasAllocator& allocator) noexcept {
+			const auto tiles      = allocator.GetTiles();
+			const auto resolution = allocator.GetResolution();
+
+			for (auto i = tiles.begin(); i != tiles.end(); ++i) {
+				if (0u == i->m_size) {
+					continue;
+				}
+				if (resolution < i->m_position[0] + i->m_size
+					|| resolution < i->m_position[1] + i->m_size) {
+					return false;
+				}
+
+				for (auto j = i + 1; j != tiles.end(); ++j) {
+					if (0u == j->m_size) {
+						continue;
+					}
+					if (i->m_position[0] < j->m_position[0] + j->m_size
+						&& j->m_position[0] < i->m_position[0] + i->m_size
+						&& i->m_position[1] < j->m_position[1] + j->m_size
+						&& j->m_position[1] < i->m_position[1] + i->m_size) {
+						return false;
+					}
+				}
+			}
+
+			return true;
+		}
+
+		/**
+		 Checks whether the given tiles are equal.
+
+		 @param[in]		lhs
+						A reference to the first tile.
+		 @param[in]		rhs
+						A reference to the second tile.
+		 @return		@c true if the given tiles are equal. @c false
+						otherwise.
+		 */
+		[[nodiscard]]
+		bool operator==(const Tile& lhs, const Tile& rhs) noexcept {
+			return lhs.m_size        == rhs.m_size
+				&& lhs.m_position[0] == rhs.m_position[0]
+				&& lhs.m_position[1] == rhs.m_position[1];
+		}
+
+		void TestHysteresis() {
+			ShadowAtlasAllocator allocator(1024u, 128u, 512u);
+
+			std::vector< Request > requests = {
+				CreateRequest(1u, 256.0f), CreateRequest(2u, 128.0f)
+			};
+			allocator.Allocate(requests);
+			const Tile tile = allocator.GetTiles()[0];
+			Expect(256u == tile.m_size);
+			Expect(2u == allocator.GetNumberOfRelocations());
+
+			// 384 rounds to 512, but lies within the hysteresis band of 256.
+			requests[0] = CreateRequest(1u, 384.0f);
+			allocator.Allocate(requests);
+			Expect(tile == allocator.GetTiles()[0]);
+			Expect(0u == allocator.GetNumberOfRelocations());
+
+			// 150 rounds to 128, but lies within the hysteresis band of 256.
+			requests[0] = CreateRequest(1u, 150.0f);
+			allocator.Allocate(requests);
+			Expect(tile == allocator.GetTiles()[0]);
+			Expect(0u == allocator.GetNumberOfRelocations());
+
+			// 480 lies outside the hysteresis band of 256.
+			requests[0] = CreateRequest(1u, 480.0f);
+			allocator.Allocate(requests);
+			Expect(512u == allocator.GetTiles()[0].m_size);
+			Expect(128u == allocator.GetTiles()[1].m_size);
+			Expect(1u == allocator.GetNumberOfRelocations());
+			Expect(AreTilesValid(allocator));
+		}
+
+		void TestRepack() {
+			ShadowAtlasAllocator allocator(1024u, 128u, 512u);
+
+			// Eight 512 tiles cover twice the atlas: the sizes are halved once.
+			std::vector< Request > requests;
+			for (U64 key = 0u; key < 8u; ++key) {
+				requests.push_back(CreateRequest(key, 512.0f));
+			}
+			allocator.Allocate(requests);
+
+			std::size_t nb_mismatches = 0u;
+			for (const auto& tile : allocator.GetTiles()) {
+				nb_mismatches += (256u != tile.m_size) ? 1u : 0u;
+			}
+			Expect(0u == nb_mismatches);
+			Expect(AreTilesValid(allocator));
+			Expect(ApproximatelyEqual(allocator.GetOccupancy(), 0.5, 1e-6));
+
+			// A hundred 512 tiles do not even fit at the minimum tile size:
+			// the atlas is filled with 64 tiles of the minimum size.
+			for (U64 key = 8u; key < 100u; ++key) {
+				requests.push_back(CreateRequest(key, 512.0f));
+			}
+			allocator.Allocate(requests);
+
+			std::size_t nb_tiles = 0u;
+			nb_mismatches = 0u;
+			for (const auto& tile : allocator.GetTiles()) {
+				nb_tiles      += (0u != tile.m_size) ? 1u : 0u;
+				nb_mismatches += (0u != tile.m_size && 128u != tile.m_size) ? 1u : 0u;
+			}
+			Expect(64u == nb_tiles);
+			Expect(0u == nb_mismatches);
+			Expect(AreTilesValid(allocator));
+			Expect(ApproximatelyEqual(allocator.GetOccupancy(), 1.0, 1e-6));
+		}
+
+		void TestScaleRecovery() {
+			ShadowAtlasAllocator allocator(1024u, 128u, 512u);
+
+			std::vector< Request > requests;
+			for (U64 key = 0u; key < 8u; ++key) {
+				requests.push_back(CreateRequest(key, 512.0f));
+			}
+			allocator.Allocate(requests);
+			Expect(256u == allocator.GetTiles()[0].m_size);
+
+			// Five 256 tiles cover more than a quarter of the atlas: the
+			// halved sizes are retained.
+			requests.resize(5u);
+			allocator.Allocate(requests);
+			Expect(256u == allocator.GetTiles()[0].m_size);
+			Expect(4.0f * allocator.GetOccupancy() > 1.0f);
+
+			// Two 256 tiles cover at most a quarter of the atlas: all tiles
+			// fit at twice their size.
+			requests.resize(2u);
+			allocator.Allocate(requests);
+			Expect(512u == allocator.GetTiles()[0].m_size);
+			Expect(512u == allocator.GetTiles()[1].m_size);
+			Expect(AreTilesValid(allocator));
+		}
+
+		void TestFreeMerging() {
+			ShadowAtlasAllocator allocator(1024u, 128u, 512u);
+
+			// Three 512 tiles and four 256 tiles fill the atlas.
+			std::vector< Request > requests;
+			for (U64 key = 0u; key < 3u; ++key) {
+				requests.push_back(CreateRequest(key, 512.0f));
+			}
+			for (U64 key = 3u; key < 7u; ++key) {
+				requests.push_back(CreateRequest(key, 256.0f));
+			}
+			allocator.Allocate(requests);
+			Expect(ApproximatelyEqual(allocator.GetOccupancy(), 1.0, 1e-6));
+			Expect(AreTilesValid(allocator));
+
+			const auto old_tiles = allocator.GetTiles();
+			const std::vector< Tile > tiles(old_tiles.begin(), old_tiles.end());
+			U32x2 quadrant = { U32(-1), U32(-1) };
+			for (std::size_t i = 3u; i < 7u; ++i) {
+				quadrant[0] = std::min(quadrant[0], tiles[i].m_position[0]);
+				quadrant[1] = std::min(quadrant[1], tiles[i].m_position[1]);
+			}
+
+			// Replace the 256 tiles by a new 512 tile (requested first, so a
+			// repack would move the other tiles). The new tile only fits
+			// without repacking if the freed 256 tiles are merged.
+			requests.erase(requests.begin() + 3u, requests.end());
+			requests.insert(requests.begin(), CreateRequest(7u, 512.0f));
+			allocator.Allocate(requests);
+
+			const auto new_tiles = allocator.GetTiles();
+			Expect(512u == new_tiles[0].m_size);
+			Expect(quadrant[0] == new_tiles[0].m_position[0]);
+			Expect(quadrant[1] == new_tiles[0].m_position[1]);
+			Expect(tiles[0] == new_tiles[1]);
+			Expect(tiles[1] == new_tiles[2]);
+			Expect(tiles[2] == new_tiles[3]);
+			Expect(1u == allocator.GetNumberOfRelocations());
+		}
+
+		void TestRelocations() {
+			ShadowAtlasAllocator allocator(1024u, 128u, 512u);
+
+			std::vector< Request > requests;
+			for (U64 key = 0u; key < 6u; ++key) {
+				requests.push_back(CreateRequest(key, 128.0f + 32.0f * key));
+			}
+			allocator.Allocate(requests);
+			Expect(6u == allocator.GetNumberOfRelocations());
+
+			// Unchanged requests do not move any tile.
+			allocator.Allocate(requests);
+			Expect(0u == allocator.GetNumberOfRelocations());
+
+			// Jittered requests within the hysteresis band do not move any
+			// tile.
+			for (auto& request : requests) {
+				request.m_coverage *= 1.1f;
+			}
+			allocator.Allocate(requests);
+			Expect(0u == allocator.GetNumberOfRelocations());
+
+			// A new light only allocates its own tile.
+			requests.push_back(CreateRequest(6u, 256.0f));
+			allocator.Allocate(requests);
+			Expect(1u == allocator.GetNumberOfRelocations());
+
+			// A removed light does not move any other tile.
+			requests.erase(requests.begin() + 2u);
+			allocator.Allocate(requests);
+			Expect(0u == allocator.GetNumberOfRelocations());
+			Expect(AreTilesValid(allocator));
+
+			allocator.Clear();
+			Expect(allocator.GetTiles().empty());
+			Expect(0u == allocator.GetNumberOfRelocations());
+		}
+
+		void TestDestroyLight() {
+			ShadowAtlasAllocator allocator(1024u, 128u, 512u);
+
+			// The keys are the (stable) guids of the lights.
+			std::vector< Request > requests;
+			for (U64 key = 0u; key < 6u; ++key) {
+				const auto size = (0u == key % 2u) ? 256.0f : 128.0f;
+				requests.push_back(CreateRequest(100u + key, size));
+			}
+			allocator.Allocate(requests);
+
+			const auto old_tiles = allocator.GetTiles();
+			const std::vector< Tile > tiles(old_tiles.begin(), old_tiles.end());
+
+			// Destroying a light moves the last light into its slot (i.e. the
+			// lights are stored in a slot map).
+			requests[1] = requests.back();
+			requests.pop_back();
+			allocator.Allocate(requests);
+
+			// The tiles of the remaining lights are kept.
+			const auto new_tiles = allocator.GetTiles();
+			Expect(5u == new_tiles.size());
+			Expect(tiles[0] == new_tiles[0]);
+			Expect(tiles[5] == new_tiles[1]);
+			Expect(tiles[2] == new_tiles[2]);
+			Expect(tiles[3] == new_tiles[3]);
+			Expect(tiles[4] == new_tiles[4]);
+			Expect(0u == allocator.GetNumberOfRelocations());
+			Expect(AreTilesValid(allocator));
+		}
+	}
+
+	void TestShadowAtlasAllocator() {
+		TestHysteresis();
+		TestRepack();
+		TestScaleRecovery();
+		TestFreeMerging();
+		TestRelocations();
+		TestDestroyLight();
+	}
+}
\ No newline at end of file
@@ -0,0 +1,184 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "test.hpp"
+#include "tests.hpp"
+#include "resource\model\model_output.hpp"
+#include "resource\mesh\vertex.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <cstring>
+#include <initializer_list>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::test {
+
+	using namespace rendering;
+
+	namespace {
+
+		using Output = ModelOutput< VertexPositionNormalTexture, U32 >;
+
+		/**
+		 Creates a vertex with the given position, a normal along the z-axis
+		 and the given texture coordinates.
+
+		 @param[in]		x
+						The x-coordinate of the position.
+		 @param[in]		y
+						The y-coordinate of the position.
+		 @param[in]		z
+						The z-coordinate of the position.
+		 @return		The vertex.
+		 */
+		[[nodiscard]]
+		const VertexPositionNormalTexture CreateVertex(F32 x, F32 y, F32 z) noexcept {
+			VertexPositionNormalTexture vertex;
+			vertex.m_p   = Point3(x, y, z);
+			vertex.m_n   = Normal3(0.0f, 0.0f, 1.0f);
+			vertex.m_tex = UV(x, y);
+			return vertex;
+		}
+
+		/**
+		 Adds a model part with the given indices to the given model output.
+
+		 @param[in,out]	output
+						A reference to the model output.
+		 @param[in]		indices
+						The indices of the model part.
+		 */
+		void AddModelPart(Output& output, std::initializer_list< U32 > indices) {
+			ModelPart model_part;
+			model_part.m_start_index = static_cast< U32 >(output.m_index_buffer.size());
+			model_part.m_nb_indices  = static_cast< U32 >(indices.size());
+
+			output.m_index_buffer.insert(output.m_index_buffer.cend(), indices);
+			output.AddModelPart(std::move(model_part));
+		}
+
+		/**
+		 Creates a model output with two model parts sharing identical
+		 vertices: a unit square at z = 0 with duplicate corners, and a unit
+		 square at z = 2 with one corner of the first square, referenced
+		 both through the index of the first model part and through a
+		 duplicate vertex.
+
+		 @return		The model output.
+		 */
+		[[nodiscard]]
+		Output CreateSharedOutput() {
+			Output output;
+			output.m_vertex_buffer = {
+				CreateVertex(0.0f, 0.0f, 0.0f), // 0
+				CreateVertex(1.0f, 0.0f, 0.0f), // 1
+				CreateVertex(1.0f, 1.0f, 0.0f), // 2
+				CreateVertex(0.0f, 1.0f, 0.0f), // 3
+				CreateVertex(0.0f, 0.0f, 0.0f), // 4 = 0
+				CreateVertex(1.0f, 1.0f, 0.0f), // 5 = 2
+				CreateVertex(2.0f, 1.0f, 2.0f), // 6
+				CreateVertex(2.0f, 2.0f, 2.0f), // 7
+				CreateVertex(1.0f, 2.0f, 2.0f), // 8
+				CreateVertex(1.0f, 1.0f, 0.0f)  // 9 = 2
+			};
+
+			AddModelPart(output, { 0u, 1u, 2u, 4u, 5u, 3u });
+			AddModelPart(output, { 2u, 6u, 7u, 9u, 7u, 8u });
+
+			return output;
+		}
+
+		/**
+		 Checks whether the given vertices are bitwise identical.
+
+		 @param[in]		lhs
+						A reference to the first vertex.
+		 @param[in]		rhs
+						A reference to the second vertex.
+		 @return		@c true if the given vertices are bitwise identical.
+						@c false otherwise.
+		 */
+		[[nodiscard]]
+		bool AreIdentical(const VertexPositionNormalTexture& lhs,
+						  const VertexPositionNormalTexture& rhs) noexcept {
+			return 0 == std::memcmp(&lhs, &rhs, sizeof(VertexPositionNormalTexture));
+		}
+
+		void TestWeldModelParts() {
+			const auto original = CreateSharedOutput();
+			auto output = CreateSharedOutput();
+			output.WeldModelParts();
+
+			// The duplicates are welded within each model part only.
+			Expect(8u == output.m_vertex_buffer.size());
+			Expect(original.m_index_buffer.size() == output.m_index_buffer.size());
+			if (original.m_index_buffer.size() != output.m_index_buffer.size()) {
+				return;
+			}
+
+			// Each index refers to an identical vertex.
+			std::size_t nb_mismatches = 0u;
+			for (std::size_t i = 0u; i < output.m_index_buffer.size(); ++i) {
+				const auto& expected = original.m_vertex_buffer[original.m_index_buffer[i]];
+				const auto& actual   = output.m_vertex_buffer[output.m_index_buffer[i]];
+				nb_mismatches += AreIdentical(expected, actual) ? 0u : 1u;
+			}
+			Expect(0u == nb_mismatches);
+
+			// The model parts reference disjoint, contiguous vertex ranges.
+			const auto begin = output.m_index_buffer.cbegin();
+			const auto [min0, max0] = std::minmax_element(begin, begin + 6);
+			const auto [min1, max1] = std::minmax_element(begin + 6, begin + 12);
+			Expect(0u == *min0 && 3u == *max0);
+			Expect(4u == *min1 && 7u == *max1);
+		}
+
+		void TestNormalizeWeldedModelParts() {
+			const auto original = CreateSharedOutput();
+			auto output = CreateSharedOutput();
+			output.WeldModelParts();
+			output.NormalizeModelParts();
+
+			// The vertices are normalized once: in world space to the AABB
+			// [0,2]^3 and in object space of their model part.
+			std::size_t nb_mismatches = 0u;
+			for (const auto& model_part : output.m_model_parts) {
+				const auto translation = model_part.m_transform.GetTranslationView();
+				const auto scale       = model_part.m_transform.GetScaleView();
+
+				const std::size_t start = model_part.m_start_index;
+				const std::size_t end   = start + model_part.m_nb_indices;
+				for (auto i = start; i < end; ++i) {
+					const auto& expected = original.m_vertex_buffer[original.m_index_buffer[i]].m_p;
+					const auto& actual   = output.m_vertex_buffer[output.m_index_buffer[i]].m_p;
+					for (std::size_t j = 0u; j < 3u; ++j) {
+						const F64 p = translation[j] + scale[j] * actual[j];
+						if (!ApproximatelyEqual(p, 0.5 * (expected[j] - 1.0), 1e-5)) {
+							++nb_mismatches;
+						}
+					}
+				}
+			}
+			Expect(2u == output.m_model_parts.size());
+			Expect(0u == nb_mismatches);
+		}
+	}
+
+	void TestModelOutput() {
+		TestWeldModelParts();
+		TestNormalizeWeldedModelParts();
+	}
+}
\ No newline at end of file
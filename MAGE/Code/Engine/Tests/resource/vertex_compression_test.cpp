@@ -0,0 +1,282 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "test.hpp"
+#include "tests.hpp"
+#include "resource\mesh\vertex_compression.hpp"
+#include "string\format.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::test {
+
+	using namespace rendering;
+
+	namespace {
+
+		/**
+		 The maximum angle (in degrees) between a normal and its decoded
+		 octahedron encoding.
+		 */
+		constexpr F64 s_max_normal_error = 0.04;
+
+		/**
+		 Returns the angle (in degrees) between the given normals.
+
+		 @param[in]		n1
+						A reference to the first normal.
+		 @param[in]		n2
+						A reference to the second normal.
+		 @return		The angle (in degrees) between the given normals.
+		 */
+		[[nodiscard]]
+		F64 GetAngle(const Normal3& n1, const Normal3& n2) noexcept {
+			const F64 x1 = n1[0], y1 = n1[1], z1 = n1[2];
+			const F64 x2 = n2[0], y2 = n2[1], z2 = n2[2];
+
+			const auto cx  = y1 * z2 - z1 * y2;
+			const auto cy  = z1 * x2 - x1 * z2;
+			const auto cz  = x1 * y2 - y1 * x2;
+			const auto sin = std::sqrt(cx * cx + cy * cy + cz * cz);
+			const auto cos = x1 * x2 + y1 * y2 + z1 * z2;
+
+			return std::atan2(sin, cos) * (180.0 / 3.14159265358979323846);
+		}
+
+		/**
+		 Returns the maximum error of rounding the given value to a
+		 half-precision floating point value (i.e. half a unit in the last
+		 place, 11 bits of precision and a minimum normal exponent of -14).
+
+		 @param[in]		x
+						The value.
+		 @return		The maximum rounding error.
+		 */
+		[[nodiscard]]
+		F64 GetMaxHalfError(F64 x) noexcept {
+			return std::max(std::abs(x) * std::ldexp(1.0, -11),
+							std::ldexp(1.0, -25));
+		}
+
+		/**
+		 Creates a vertex with the given position, normal and texture
+		 coordinates.
+
+		 @param[in]		p
+						A reference to the position.
+		 @param[in]		n
+						A reference to the normal.
+		 @param[in]		tex
+						A reference to the texture coordinates.
+		 @return		The vertex.
+		 */
+		[[nodiscard]]
+		const VertexPositionNormalTexture CreateVertex(const Point3& p,
+													   const Normal3& n,
+													   const UV& tex) noexcept {
+			VertexPositionNormalTexture vertex;
+			vertex.m_p   = p;
+			vertex.m_n   = n;
+			vertex.m_tex = tex;
+			return vertex;
+		}
+
+		/**
+		 Creates the given number of random vertices inside the AABB with the
+		 given minimum and maximum point. The vertices also contain the
+		 corners of the AABB, the coordinate axes as normals and normals on
+		 the folds of the octahedron. The vertices are deterministic.
+
+		 @param[in]		p_min
+						A reference to the minimum point of the AABB.
+		 @param[in]		p_max
+						A reference to the maximum point of the AABB.
+		 @param[in]		nb_vertices
+						The number of random vertices.
+		 @return		A vector containing the vertices.
+		 */
+		[[nodiscard]]
+		std::vector< VertexPositionNormalTexture >
+			CreateVertices(const Point3& p_min, const Point3& p_max,
+						   std::size_t nb_vertices) {
+
+			std::mt19937 generator(0x4D414745u);
+			std::uniform_real_distribution< F32 > unit(0.0f, 1.0f);
+			std::normal_distribution< F32 > gaussian;
+			std::uniform_real_distribution< F32 > tex(-4.0f, 4.0f);
+
+			std::vector< VertexPositionNormalTexture > vertices;
+
+			// The corners of the AABB and the (signed) axes.
+			const Normal3 axes[] = {
+				{  1.0f,  0.0f,  0.0f }, { -1.0f,  0.0f,  0.0f },
+				{  0.0f,  1.0f,  0.0f }, {  0.0f, -1.0f,  0.0f },
+				{  0.0f,  0.0f,  1.0f }, {  0.0f,  0.0f, -1.0f }
+			};
+			for (std::size_t i = 0u; i < 8u; ++i) {
+				const Point3 p((i & 1u) ? p_max[0] : p_min[0],
+							   (i & 2u) ? p_max[1] : p_min[1],
+							   (i & 4u) ? p_max[2] : p_min[2]);
+				vertices.push_back(CreateVertex(p, axes[i % std::size(axes)],
+												UV(0.0f, 1.0f)));
+			}
+
+			const auto lerp = [](F32 a, F32 b, F32 t) noexcept {
+				return std::clamp(a + t * (b - a), std::min(a, b), std::max(a, b));
+			};
+
+			for (std::size_t i = 0u; i < nb_vertices; ++i) {
+				const Point3 p(lerp(p_min[0], p_max[0], unit(generator)),
+							   lerp(p_min[1], p_max[1], unit(generator)),
+							   lerp(p_min[2], p_max[2], unit(generator)));
+
+				// Every eighth normal lies on the xy-plane (i.e. on the fold of
+				// the octahedron).
+				const auto x = gaussian(generator);
+				const auto y = gaussian(generator);
+				const auto z = (0u == i % 8u) ? 0.0f : gaussian(generator);
+				const auto l = std::sqrt(x * x + y * y + z * z);
+				const Normal3 n = (0.0f < l) ? Normal3(x / l, y / l, z / l)
+											 : Normal3(0.0f, 0.0f, 1.0f);
+
+				vertices.push_back(CreateVertex(p, n, UV(tex(generator), unit(generator))));
+			}
+
+			return vertices;
+		}
+
+		/**
+		 Checks the error bounds of encoding and decoding the given vertices
+		 relative to the AABB with the given minimum and maximum point.
+
+		 @param[in]		p_min
+						A reference to the minimum point of the AABB.
+		 @param[in]		p_max
+						A reference to the maximum point of the AABB.
+		 */
+		void CheckErrorBounds(const Point3& p_min, const Point3& p_max) {
+			const auto vertices = CreateVertices(p_min, p_max, 100000u);
+			const AABB aabb(p_min, p_max);
+
+			const auto compact_vertices = EncodeVertices(gsl::make_span(vertices), aabb);
+			const auto decoded_vertices = DecodeVertices(gsl::make_span(compact_vertices), aabb);
+			Expect(vertices.size() == compact_vertices.size());
+			Expect(vertices.size() == decoded_vertices.size());
+			if (vertices.size() != decoded_vertices.size()) {
+				return;
+			}
+
+			F64 max_position_error[3] = {};
+			F64 max_normal_error      = 0.0;
+			std::size_t nb_position_violations = 0u;
+			std::size_t nb_normal_violations   = 0u;
+			std::size_t nb_tex_violations      = 0u;
+
+			for (std::size_t i = 0u; i < vertices.size(); ++i) {
+				const auto& vertex         = vertices[i];
+				const auto& decoded_vertex = decoded_vertices[i];
+
+				// Positions: half the quantization step, plus the rounding
+				// error of the single precision dequantization.
+				for (std::size_t j = 0u; j < 3u; ++j) {
+					const F64 extent = static_cast< F64 >(p_max[j]) - p_min[j];
+					const auto bound = extent / 131070.0
+						+ 4.0 * std::numeric_limits< F32 >::epsilon()
+							  * (std::abs(p_min[j]) + extent);
+					const auto error = std::abs(static_cast< F64 >(decoded_vertex.m_p[j])
+												- vertex.m_p[j]);
+					max_position_error[j] = std::max(max_position_error[j], error);
+					if (error > bound) {
+						++nb_position_violations;
+					}
+				}
+
+				// Normals: the stated angular error.
+				const auto angle = GetAngle(vertex.m_n, decoded_vertex.m_n);
+				max_normal_error = std::max(max_normal_error, angle);
+				if (angle > s_max_normal_error) {
+					++nb_normal_violations;
+				}
+
+				// Texture coordinates: the rounding error of half-precision
+				// floating point values.
+				for (std::size_t j = 0u; j < 2u; ++j) {
+					const F64 tex = vertex.m_tex[j];
+					if (std::abs(decoded_vertex.m_tex[j] - tex) > GetMaxHalfError(tex)) {
+						++nb_tex_violations;
+					}
+				}
+			}
+
+			Print("  Max position error: ({:.3g}, {:.3g}, {:.3g}), max normal error: {:.4f} degrees\n",
+				  max_position_error[0], max_position_error[1], max_position_error[2],
+				  max_normal_error);
+
+			Expect(0u == nb_position_violations);
+			Expect(0u == nb_normal_violations);
+			Expect(0u == nb_tex_violations);
+		}
+
+		void TestErrorBounds() {
+			CheckErrorBounds(Point3(-3.0f, -1.0f,  2.0f), Point3(5.0f, 7.0f,  2.5f));
+			CheckErrorBounds(Point3(-1.0f, -1.0f, -1.0f), Point3(1.0f, 1.0f,  1.0f));
+			CheckErrorBounds(Point3(100.0f, 250.0f, -900.0f), Point3(1300.0f, 260.0f, -100.0f));
+		}
+
+		void TestDegenerateAABB() {
+			// A flat mesh in the xz-plane.
+			const Point3 p_min(-2.0f, 3.0f, -2.0f);
+			const Point3 p_max( 2.0f, 3.0f,  2.0f);
+			const auto vertices = CreateVertices(p_min, p_max, 1000u);
+			const AABB aabb(p_min, p_max);
+
+			const auto compact_vertices = EncodeVertices(gsl::make_span(vertices), aabb);
+			const auto decoded_vertices = DecodeVertices(gsl::make_span(compact_vertices), aabb);
+
+			// Degenerate axes are quantized to the minimum of the AABB.
+			const auto on_plane = std::all_of(
+				decoded_vertices.cbegin(), decoded_vertices.cend(),
+				[](const VertexPositionNormalTexture& vertex) noexcept {
+					return 3.0f == vertex.m_p[1];
+				});
+			Expect(on_plane);
+		}
+
+		void TestZeroNormal() {
+			const std::vector< VertexPositionNormalTexture > vertices = {
+				CreateVertex(Point3(0.0f, 0.0f, 0.0f), Normal3(0.0f, 0.0f, 0.0f), UV(0.0f, 0.0f))
+			};
+			const AABB aabb(Point3(-1.0f, -1.0f, -1.0f), Point3(1.0f, 1.0f, 1.0f));
+
+			const auto compact_vertices = EncodeVertices(gsl::make_span(vertices), aabb);
+			const auto decoded_vertices = DecodeVertices(gsl::make_span(compact_vertices), aabb);
+
+			// Zero normals decode to a unit normal (i.e. no NaNs).
+			const auto& n = decoded_vertices[0].m_n;
+			Expect(ApproximatelyEqual(n[0] * n[0] + n[1] * n[1] + n[2] * n[2], 1.0, 1e-5));
+		}
+	}
+
+	void TestVertexCompression() {
+		TestErrorBounds();
+		TestDegenerateAABB();
+		TestZeroNormal();
+	}
+}
\ No newline at end of file
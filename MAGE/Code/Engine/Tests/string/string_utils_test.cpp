@@ -0,0 +1,245 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "test.hpp"
+#include "tests.hpp"
+#include "string\format.hpp"
+#include "string\string_utils.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <charconv>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <string>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::test {
+
+	namespace {
+
+		/**
+		 Converts the given string to a @c F32 value with @c std::from_chars
+		 only (i.e. the conversion used before the fast path).
+
+		 @param[in]		str
+						The string to convert.
+		 @return		A @c F32 value if the the conversion of the given
+						string succeeded.
+		 */
+		[[nodiscard]]
+		const std::optional< F32 > ReferenceStringToF32(std::string_view str) noexcept {
+			const char* const first = str.data();
+			const char* const last  = str.data() + str.size();
+			F32 result = {};
+			const auto [ptr, error_code] = std::from_chars(first, last, result);
+
+			if (last != ptr
+				|| std::errc::invalid_argument    == error_code
+				|| std::errc::result_out_of_range == error_code) {
+
+				return {};
+			}
+			else {
+				return result;
+			}
+		}
+
+		/**
+		 Checks whether @c StringTo< F32 > and @c std::from_chars convert the
+		 given string to the same (bit-identical) @c F32 value, or both fail.
+
+		 @param[in]		str
+						The string to convert.
+		 @return		@c true if both conversions agree. @c false otherwise.
+		 */
+		[[nodiscard]]
+		bool IsBitIdentical(std::string_view str) noexcept {
+			const auto result    = StringTo< F32 >(str);
+			const auto reference = ReferenceStringToF32(str);
+
+			if (bool(result) != bool(reference)) {
+				return false;
+			}
+			if (!result) {
+				return true;
+			}
+
+			U32 result_bits, reference_bits;
+			std::memcpy(&result_bits,    &*result,    sizeof(result_bits));
+			std::memcpy(&reference_bits, &*reference, sizeof(reference_bits));
+			return result_bits == reference_bits;
+		}
+
+		/**
+		 Checks whether @c StringTo< F32 > and @c std::from_chars agree on
+		 the given string, and prints the string if not.
+
+		 @param[in]		str
+						The string to convert.
+		 @param[in,out]	nb_mismatches
+						A reference to the number of mismatches.
+		 */
+		void CheckBitIdentical(std::string_view str, std::size_t& nb_mismatches) {
+			if (IsBitIdentical(str)) {
+				return;
+			}
+
+			// Only print the first few mismatches.
+			if (nb_mismatches < 8u) {
+				Print("  StringTo< F32 > mismatch for \"{}\"\n", str);
+			}
+			++nb_mismatches;
+		}
+
+		void TestStringToF32Values() {
+			Expect(1.5f    == StringTo< F32 >("1.5"));
+			Expect(-0.25f  == StringTo< F32 >("-0.25"));
+			Expect(100.0f  == StringTo< F32 >("1e2"));
+			Expect(100.0f  == StringTo< F32 >("1E+2"));
+			Expect(0.001f  == StringTo< F32 >("1e-3"));
+			Expect(0.1f    == StringTo< F32 >("0.1"));
+			Expect(12.0f   == StringTo< F32 >("12."));
+			Expect(0.5f    == StringTo< F32 >(".5"));
+
+			// Leading or trailing garbage, missing digits and out of range
+			// values are rejected.
+			Expect(!StringTo< F32 >(""));
+			Expect(!StringTo< F32 >("-"));
+			Expect(!StringTo< F32 >("."));
+			Expect(!StringTo< F32 >("+1"));
+			Expect(!StringTo< F32 >(" 1"));
+			Expect(!StringTo< F32 >("1 "));
+			Expect(!StringTo< F32 >("1.0x"));
+			Expect(!StringTo< F32 >("1e"));
+			Expect(!StringTo< F32 >("1e+"));
+			Expect(!StringTo< F32 >("1e40"));
+
+			// The sign of zero is preserved.
+			const auto negative_zero = StringTo< F32 >("-0.0");
+			Expect(bool(negative_zero) && std::signbit(*negative_zero));
+		}
+
+		void TestStringToF32EdgeCases() {
+			static constexpr const_zstring s_strings[] = {
+				"0", "-0", "0.0", "00000000000000000000", "1", "-1",
+				// F32 limits
+				"3.4028235e38", "3.4028236e38", "-3.4028235e38",
+				"1.17549435e-38", "1.1754942e-38", "1e-45", "1.4e-45",
+				"7e-46",
+				// Exact F32 midpoints (2^24 + 1 and 1 + 2^-24)
+				"16777217", "16777219", "33554434", "1.000000059604644775390625",
+				"1.0000000596046448",
+				// Beyond the fast path
+				"12345678901234567890", "1234567890123456789",
+				"9007199254740993", "9007199254740992", "0.00000000000000000000001",
+				"1e22", "1e23", "1e-22", "1e-23", "123456e-30", "1e0000", "1e00001",
+				// Lengths around the eight digit blocks
+				"1234567", "12345678", "123456789", "1234567.8", "12345678.9",
+				"0.12345678", "0.123456789", "-12345678.12345678",
+				// Special values
+				"inf", "-inf", "infinity", "nan", "-nan"
+			};
+
+			std::size_t nb_mismatches = 0u;
+			for (const auto str : s_strings) {
+				CheckBitIdentical(str, nb_mismatches);
+			}
+			Expect(0u == nb_mismatches);
+		}
+
+		void TestStringToF32Fuzz() {
+			std::mt19937 generator(0x4D414745u);
+			std::uniform_int_distribution< U32 > bits;
+			std::uniform_int_distribution< U32 > digit(0u, 9u);
+			std::uniform_int_distribution< U32 > length(0u, 12u);
+			std::uniform_int_distribution< S32 > exponent(-50, 50);
+			std::bernoulli_distribution coin;
+
+			std::size_t nb_mismatches = 0u;
+			std::string str;
+
+			// Printed F32 values
+			for (std::size_t i = 0u; i < 100000u; ++i) {
+				F32 value;
+				const auto value_bits = bits(generator);
+				std::memcpy(&value, &value_bits, sizeof(value));
+				if (!std::isfinite(value)) {
+					continue;
+				}
+
+				CheckBitIdentical(Format("{}",      value), nb_mismatches);
+				CheckBitIdentical(Format("{:.9g}",  value), nb_mismatches);
+				CheckBitIdentical(Format("{:.17g}", static_cast< F64 >(value)), nb_mismatches);
+				CheckBitIdentical(Format("{:e}",    value), nb_mismatches);
+				if (std::abs(value) < 1e9f) {
+					CheckBitIdentical(Format("{:.6f}", value), nb_mismatches);
+				}
+			}
+
+			// Near F32 midpoints
+			for (std::size_t i = 0u; i < 100000u; ++i) {
+				F32 value;
+				const auto value_bits = bits(generator) & 0x7EFFFFFFu;
+				std::memcpy(&value, &value_bits, sizeof(value));
+
+				const auto next     = std::nextafter(value, std::numeric_limits< F32 >::max());
+				const auto midpoint = (static_cast< F64 >(value) + static_cast< F64 >(next)) / 2.0;
+				CheckBitIdentical(Format("{:.17g}", midpoint), nb_mismatches);
+				CheckBitIdentical(Format("{:.16g}", midpoint), nb_mismatches);
+			}
+
+			// Random digit strings
+			for (std::size_t i = 0u; i < 200000u; ++i) {
+				str.clear();
+				if (coin(generator)) {
+					str += '-';
+				}
+				for (auto n = length(generator); 0u < n; --n) {
+					str += static_cast< char >('0' + digit(generator));
+				}
+				if (coin(generator)) {
+					str += '.';
+					for (auto n = length(generator); 0u < n; --n) {
+						str += static_cast< char >('0' + digit(generator));
+					}
+				}
+				if (coin(generator)) {
+					str += Format("e{}", exponent(generator));
+				}
+
+				CheckBitIdentical(str, nb_mismatches);
+			}
+
+			Expect(0u == nb_mismatches);
+		}
+
+		void TestStringToS32() {
+			Expect(42      == StringTo< S32 >("42"));
+			Expect(-7      == StringTo< S32 >("-7"));
+			Expect(!StringTo< S32 >(""));
+			Expect(!StringTo< S32 >("1/2"));
+			Expect(!StringTo< S32 >("2147483648"));
+		}
+	}
+
+	void TestStringUtils() {
+		TestStringToF32Values();
+		TestStringToF32EdgeCases();
+		TestStringToF32Fuzz();
+		TestStringToS32();
+	}
+}
\ No newline at end of file
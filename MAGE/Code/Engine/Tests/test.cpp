@@ -0,0 +1,47 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "test.hpp"
+#include "string\format.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::test {
+
+	namespace {
+
+		/**
+		 The number of failed expectations of the running test.
+		 */
+		std::size_t g_nb_failures = 0u;
+	}
+
+	void Report(bool success,
+				const char* expression,
+				const char* file,
+				int line) noexcept {
+
+		if (success) {
+			return;
+		}
+
+		++g_nb_failures;
+		Print("  Expectation \"{}\" failed in {}, line {}\n", expression, file, line);
+	}
+
+	bool Run(std::string_view name, TestFunction test) {
+		g_nb_failures = 0u;
+
+		Print("[ RUN  ] {}\n", name);
+		test();
+
+		const auto success = (0u == g_nb_failures);
+		Print("[ {} ] {}\n", success ? "PASS" : "FAIL", name);
+		return success;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,87 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "type\types.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <string_view>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Defines
+//-----------------------------------------------------------------------------
+#pragma region
+
+// Expect definition
+// Unlike Assert, Expect is active in all configurations and does not abort.
+#define Expect(expr) mage::test::Report((expr), #expr, __FILE__, __LINE__)
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations
+//-----------------------------------------------------------------------------
+namespace mage::test {
+
+	/**
+	 A pointer to a test function.
+	 */
+	using TestFunction = void (*)();
+
+	/**
+	 Reports the outcome of the given expectation of the running test.
+
+	 @param[in]		success
+					@c true if the expectation holds. @c false otherwise.
+	 @param[in]		expression
+					The expression of the expectation.
+	 @param[in]		file
+					The file containing the expectation.
+	 @param[in]		line
+					The line of the expectation.
+	 */
+	void Report(bool success,
+				const char* expression,
+				const char* file,
+				int line) noexcept;
+
+	/**
+	 Runs the given test.
+
+	 @param[in]		name
+					The name of the test.
+	 @param[in]		test
+					The test function.
+	 @return		@c true if all expectations of the given test hold.
+					@c false otherwise.
+	 */
+	bool Run(std::string_view name, TestFunction test);
+
+	/**
+	 Checks whether the given values are approximately equal.
+
+	 @param[in]		lhs
+					The first value.
+	 @param[in]		rhs
+					The second value.
+	 @param[in]		epsilon
+					The absolute tolerance.
+	 @return		@c true if the given values differ at most @a epsilon.
+					@c false otherwise.
+	 */
+	[[nodiscard]]
+	inline bool ApproximatelyEqual(F64 lhs, F64 rhs, F64 epsilon) noexcept {
+		return (lhs <= rhs + epsilon) && (rhs <= lhs + epsilon);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,39 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "test.hpp"
+#include "tests.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <cstdlib>
+
+#pragma endregion
+
+/**
+ The entry point of the engine tests. The tests only exercise CPU code and
+ do not require a display or Direct3D device.
+
+ @return		@c EXIT_SUCCESS if all tests pass. @c EXIT_FAILURE otherwise.
+ */
+int main() {
+	using namespace mage::test;
+
+	auto success = true;
+	success &= Run("LightClusterGrid", TestLightClusterGrid);
+	success &= Run("MeshOptimizer", TestMeshOptimizer);
+	success &= Run("ModelOutput", TestModelOutput);
+	success &= Run("RenderQueue", TestRenderQueue);
+	success &= Run("ShadowAtlasAllocator", TestShadowAtlasAllocator);
+	success &= Run("StringUtils", TestStringUtils);
+	success &= Run("VertexCompression", TestVertexCompression);
+
+	return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
\ No newline at end of file
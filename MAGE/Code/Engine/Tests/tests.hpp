@@ -0,0 +1,44 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Declarations
+//-----------------------------------------------------------------------------
+namespace mage::test {
+
+	/**
+	 Tests the assignment of lights to the clusters of light cluster grids.
+	 */
+	void TestLightClusterGrid();
+
+	/**
+	 Tests the vertex cache, overdraw and vertex fetch optimization of
+	 triangle lists.
+	 */
+	void TestMeshOptimizer();
+
+	/**
+	 Tests the per model part vertex welding and normalization of model
+	 outputs.
+	 */
+	void TestModelOutput();
+
+	/**
+	 Tests the sorting and instance batching of render queues.
+	 */
+	void TestRenderQueue();
+
+	/**
+	 Tests the packing, hysteresis and repacking of shadow atlas allocators.
+	 */
+	void TestShadowAtlasAllocator();
+
+	/**
+	 Tests the string conversions against the standard library.
+	 */
+	void TestStringUtils();
+
+	/**
+	 Tests the error bounds of compact vertices.
+	 */
+	void TestVertexCompression();
+}
\ No newline at end of file
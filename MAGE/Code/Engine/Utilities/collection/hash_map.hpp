@@ -0,0 +1,509 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "type\types.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <functional>
+#include <optional>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	/**
+	 A class of hash maps.
+
+	 A hash map stores its entries in a flat, power-of-two sized table and
+	 resolves collisions with linear probing. The hash of each key is stored
+	 next to its entry: probing compares hashes before comparing keys and
+	 growing the table never rehashes the keys. Erased entries are removed
+	 with backward shifting, which avoids tombstones.
+
+	 @tparam		KeyT
+					The key type.
+	 @tparam		ValueT
+					The value type.
+	 @tparam		HashT
+					The hash function type.
+	 @tparam		KeyEqualT
+					The key equality function type.
+	 */
+	template< typename KeyT,
+		      typename ValueT,
+		      typename HashT = std::hash< KeyT >,
+		      typename KeyEqualT = std::equal_to<> >
+	class HashMap {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		using key_type = KeyT;
+		using mapped_type = ValueT;
+		using value_type = std::pair< KeyT, ValueT >;
+		using size_type = std::size_t;
+		using hasher = HashT;
+		using key_equal = KeyEqualT;
+
+		//---------------------------------------------------------------------
+		// Class Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The stored hash of empty entries.
+		 */
+		static constexpr std::size_t s_empty_hash = 0u;
+
+		/**
+		 The minimum capacity of hash maps.
+		 */
+		static constexpr std::size_t s_min_capacity = 16u;
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		HashMap()
+			: m_hashes(),
+			m_entries(),
+			m_size(0u),
+			m_hasher(),
+			m_key_equal() {}
+
+		HashMap(const HashMap& map) = default;
+
+		HashMap(HashMap&& map) noexcept = default;
+
+		~HashMap() = default;
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		HashMap& operator=(const HashMap& map) = default;
+
+		HashMap& operator=(HashMap&& map) noexcept = default;
+
+		//---------------------------------------------------------------------
+		// Member Methods: Hashing
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the hash of the given key.
+
+		 The returned hash can be precomputed once and passed to the lookup
+		 and modifier methods of this hash map.
+
+		 @tparam		K
+						The (possibly heterogeneous) key type.
+		 @param[in]		key
+						A reference to the key.
+		 @return		The hash of the given key.
+		 */
+		template< typename K >
+		[[nodiscard]]
+		std::size_t hash(const K& key) const noexcept {
+			return m_hasher(key);
+		}
+
+		//---------------------------------------------------------------------
+		// Member Methods: Lookup
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the value corresponding to the given key.
+
+		 @tparam		K
+						The (possibly heterogeneous) key type.
+		 @param[in]		key
+						A reference to the key.
+		 @param[in]		hash
+						The hash of the given key.
+		 @return		A pointer to the value corresponding to the given
+						key. @c nullptr if this hash map does not contain the
+						given key.
+		 */
+		template< typename K >
+		[[nodiscard]]
+		ValueT* find(const K& key, std::size_t hash) noexcept {
+			const auto index = Find(key, Fix(hash));
+			return (s_invalid_index != index) ? &m_entries[index]->second
+				                              : nullptr;
+		}
+
+		/**
+		 Returns the value corresponding to the given key.
+
+		 @tparam		K
+						The (possibly heterogeneous) key type.
+		 @param[in]		key
+						A reference to the key.
+		 @param[in]		hash
+						The hash of the given key.
+		 @return		A pointer to the value corresponding to the given
+						key. @c nullptr if this hash map does not contain the
+						given key.
+		 */
+		template< typename K >
+		[[nodiscard]]
+		const ValueT* find(const K& key, std::size_t hash) const noexcept {
+			const auto index = Find(key, Fix(hash));
+			return (s_invalid_index != index) ? &m_entries[index]->second
+				                              : nullptr;
+		}
+
+		template< typename K >
+		[[nodiscard]]
+		ValueT* find(const K& key) noexcept {
+			return find(key, hash(key));
+		}
+
+		template< typename K >
+		[[nodiscard]]
+		const ValueT* find(const K& key) const noexcept {
+			return find(key, hash(key));
+		}
+
+		//---------------------------------------------------------------------
+		// Member Methods: Iterators
+		//---------------------------------------------------------------------
+
+		/**
+		 Applies the given action to each entry of this hash map.
+
+		 @tparam		ActionT
+						An action to perform on each entry. The action must
+						accept a @c const @c KeyT& and a @c ValueT&.
+		 @param[in]		action
+						The action.
+		 */
+		template< typename ActionT >
+		void for_each(ActionT&& action) {
+			for (auto& entry : m_entries) {
+				if (entry) {
+					action(static_cast< const KeyT& >(entry->first),
+						   entry->second);
+				}
+			}
+		}
+
+		//---------------------------------------------------------------------
+		// Member Methods: Capacity
+		//---------------------------------------------------------------------
+
+		[[nodiscard]]
+		bool empty() const noexcept {
+			return 0u == m_size;
+		}
+
+		[[nodiscard]]
+		size_type size() const noexcept {
+			return m_size;
+		}
+
+		[[nodiscard]]
+		size_type capacity() const noexcept {
+			return m_hashes.size();
+		}
+
+		/**
+		 Reserves enough capacity for the given number of entries without
+		 exceeding the maximum load factor.
+
+		 @param[in]		new_size
+						The number of entries.
+		 */
+		void reserve(size_type new_size) {
+			auto new_capacity = std::max(capacity(), s_min_capacity);
+			while (IsOverloaded(new_size, new_capacity)) {
+				new_capacity <<= 1u;
+			}
+
+			if (new_capacity != capacity()) {
+				Rehash(new_capacity);
+			}
+		}
+
+		//---------------------------------------------------------------------
+		// Member Methods: Modifiers
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a value in place for the given key if this hash map does
+		 not contain the given key yet.
+
+		 @tparam		ConstructorArgsT
+						The constructor argument types of the value.
+		 @param[in]		key
+						The key.
+		 @param[in]		hash
+						The hash of the given key.
+		 @param[in]		args
+						A reference to the constructor arguments for the value.
+		 @return		A pair containing a pointer to the value corresponding
+						to the given key and a boolean indicating whether the
+						value was inserted.
+		 */
+		template< typename... ConstructorArgsT >
+		std::pair< ValueT*, bool > try_emplace(KeyT key,
+											   std::size_t hash,
+											   ConstructorArgsT&&... args) {
+			hash = Fix(hash);
+
+			if (const auto index = Find(key, hash); s_invalid_index != index) {
+				return { &m_entries[index]->second, false };
+			}
+
+			if (IsOverloaded(m_size + 1u, capacity())) {
+				reserve(m_size + 1u);
+			}
+
+			const auto mask = capacity() - 1u;
+			auto index = hash & mask;
+			while (s_empty_hash != m_hashes[index]) {
+				index = (index + 1u) & mask;
+			}
+
+			m_entries[index].emplace(std::piecewise_construct,
+				std::forward_as_tuple(std::move(key)),
+				std::forward_as_tuple(std::forward< ConstructorArgsT >(args)...));
+			m_hashes[index] = hash;
+			++m_size;
+
+			return { &m_entries[index]->second, true };
+		}
+
+		template< typename... ConstructorArgsT >
+		std::pair< ValueT*, bool > try_emplace(KeyT key,
+											   ConstructorArgsT&&... args) {
+			const auto key_hash = hash(key);
+			return try_emplace(std::move(key), key_hash,
+							   std::forward< ConstructorArgsT >(args)...);
+		}
+
+		/**
+		 Erases the entry corresponding to the given key.
+
+		 @tparam		K
+						The (possibly heterogeneous) key type.
+		 @param[in]		key
+						A reference to the key.
+		 @param[in]		hash
+						The hash of the given key.
+		 @return		@c true if an entry was erased. @c false otherwise.
+		 */
+		template< typename K >
+		bool erase(const K& key, std::size_t hash) noexcept {
+			auto index = Find(key, Fix(hash));
+			if (s_invalid_index == index) {
+				return false;
+			}
+
+			// Shift the subsequent entries of the probe sequence backward.
+			const auto mask = capacity() - 1u;
+			for (auto next = (index + 1u) & mask;
+				 s_empty_hash != m_hashes[next];
+				 next = (next + 1u) & mask) {
+
+				const auto home = m_hashes[next] & mask;
+				// Distance from the home slot to the current slot.
+				const auto next_distance = (next  - home) & mask;
+				// Distance from the home slot to the free slot.
+				const auto free_distance = (index - home) & mask;
+				if (free_distance < next_distance) {
+					m_hashes[index]  = m_hashes[next];
+					m_entries[index] = std::move(m_entries[next]);
+					index = next;
+				}
+			}
+
+			m_hashes[index] = s_empty_hash;
+			m_entries[index].reset();
+			--m_size;
+
+			return true;
+		}
+
+		template< typename K >
+		bool erase(const K& key) noexcept {
+			return erase(key, hash(key));
+		}
+
+		/**
+		 Erases all entries of this hash map. The capacity is retained.
+		 */
+		void clear() noexcept {
+			for (std::size_t i = 0u; i < capacity(); ++i) {
+				m_hashes[i] = s_empty_hash;
+				m_entries[i].reset();
+			}
+
+			m_size = 0u;
+		}
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Class Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The invalid index.
+		 */
+		static constexpr std::size_t s_invalid_index = std::size_t(-1);
+
+		//---------------------------------------------------------------------
+		// Class Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Fixes the given hash (i.e. avoids collisions with the stored hash of
+		 empty entries).
+
+		 @param[in]		hash
+						The hash.
+		 @return		The fixed hash.
+		 */
+		[[nodiscard]]
+		static constexpr std::size_t Fix(std::size_t hash) noexcept {
+			return (s_empty_hash != hash) ? hash : ~s_empty_hash;
+		}
+
+		/**
+		 Checks whether the given number of entries exceeds the maximum load
+		 factor (i.e. 3/4) for the given capacity.
+
+		 @param[in]		size
+						The number of entries.
+		 @param[in]		capacity
+						The capacity.
+		 @return		@c true if the given number of entries exceeds the
+						maximum load factor for the given capacity. @c false
+						otherwise.
+		 */
+		[[nodiscard]]
+		static constexpr bool IsOverloaded(std::size_t size,
+										   std::size_t capacity) noexcept {
+			return 4u * size > 3u * capacity;
+		}
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the index of the entry corresponding to the given key.
+
+		 @tparam		K
+						The (possibly heterogeneous) key type.
+		 @param[in]		key
+						A reference to the key.
+		 @param[in]		hash
+						The fixed hash of the given key.
+		 @return		The index of the entry corresponding to the given key.
+						@c s_invalid_index if this hash map does not contain
+						the given key.
+		 */
+		template< typename K >
+		[[nodiscard]]
+		std::size_t Find(const K& key, std::size_t hash) const noexcept {
+			if (0u == m_size) {
+				return s_invalid_index;
+			}
+
+			const auto mask = capacity() - 1u;
+			for (auto index = hash & mask;
+				 s_empty_hash != m_hashes[index];
+				 index = (index + 1u) & mask) {
+
+				if (hash == m_hashes[index]
+					&& m_key_equal(m_entries[index]->first, key)) {
+					return index;
+				}
+			}
+
+			return s_invalid_index;
+		}
+
+		/**
+		 Moves all entries of this hash map to a table with the given
+		 capacity.
+
+		 @param[in]		new_capacity
+						The new capacity (a power of two).
+		 */
+		void Rehash(std::size_t new_capacity) {
+			std::vector< std::size_t > hashes(new_capacity, s_empty_hash);
+			std::vector< std::optional< value_type > > entries(new_capacity);
+
+			const auto mask = new_capacity - 1u;
+			for (std::size_t i = 0u; i < capacity(); ++i) {
+				if (s_empty_hash == m_hashes[i]) {
+					continue;
+				}
+
+				// The stored hashes are reused: the keys are not rehashed.
+				auto index = m_hashes[i] & mask;
+				while (s_empty_hash != hashes[index]) {
+					index = (index + 1u) & mask;
+				}
+
+				hashes[index]  = m_hashes[i];
+				entries[index] = std::move(m_entries[i]);
+			}
+
+			m_hashes.swap(hashes);
+			m_entries.swap(entries);
+		}
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 A vector containing the (fixed) hash of each entry of this hash map.
+		 Probing only touches this vector until the hashes match.
+		 */
+		std::vector< std::size_t > m_hashes;
+
+		/**
+		 A vector containing the entries of this hash map.
+		 */
+		std::vector< std::optional< value_type > > m_entries;
+
+		/**
+		 The number of entries of this hash map.
+		 */
+		std::size_t m_size;
+
+		/**
+		 The hash function of this hash map.
+		 */
+		HashT m_hasher;
+
+		/**
+		 The key equality function of this hash map.
+		 */
+		KeyEqualT m_key_equal;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,446 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "collection\vector.hpp"
+#include "type\types.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	/**
+	 A class of slot maps.
+
+	 A slot map stores its elements contiguously and identifies each element
+	 with a handle (i.e. a slot and a generation). Elements are inserted and
+	 erased in constant time: erased elements are replaced by the last
+	 element and their slots are recycled through an intrusive free list.
+	 The generation of a slot is incremented each time its element is
+	 erased, which allows to detect stale handles.
+
+	 @tparam		T
+					The element type.
+	 */
+	template< typename T >
+	class SlotMap {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		using value_type = T;
+		using size_type = std::size_t;
+		using difference_type = std::ptrdiff_t;
+		using reference = value_type&;
+		using const_reference = const value_type&;
+		using pointer = value_type*;
+		using const_pointer = const value_type*;
+
+		using iterator = typename AlignedVector< T >::iterator;
+		using const_iterator = typename AlignedVector< T >::const_iterator;
+		using reverse_iterator = typename AlignedVector< T >::reverse_iterator;
+		using const_reverse_iterator
+			= typename AlignedVector< T >::const_reverse_iterator;
+
+		/**
+		 A struct of slot map handles.
+		 */
+		struct Handle {
+
+			/**
+			 The slot of this handle.
+			 */
+			U32 m_slot;
+
+			/**
+			 The generation of this handle.
+			 */
+			U32 m_generation;
+		};
+
+		//---------------------------------------------------------------------
+		// Class Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The invalid slot (i.e. denoting the end of the free list).
+		 */
+		static constexpr U32 s_invalid_slot = U32(-1);
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		SlotMap()
+			: m_elements(),
+			m_element_slots(),
+			m_slots(),
+			m_free_slot(s_invalid_slot) {}
+
+		SlotMap(const SlotMap& slot_map) = default;
+
+		SlotMap(SlotMap&& slot_map) noexcept = default;
+
+		~SlotMap() = default;
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		SlotMap& operator=(const SlotMap& slot_map) = default;
+
+		SlotMap& operator=(SlotMap&& slot_map) noexcept = default;
+
+		//---------------------------------------------------------------------
+		// Member Methods: Element access
+		//---------------------------------------------------------------------
+
+		/**
+		 Checks whether the given handle refers to an element of this slot
+		 map.
+
+		 @param[in]		handle
+						The handle.
+		 @return		@c true if the given handle refers to an element of
+						this slot map. @c false otherwise (e.g., the element
+						has been erased).
+		 */
+		[[nodiscard]]
+		bool contains(Handle handle) const noexcept {
+			using std::size;
+			return handle.m_slot < size(m_slots)
+				&& m_slots[handle.m_slot].m_generation == handle.m_generation
+				&& s_invalid_slot != m_slots[handle.m_slot].m_index;
+		}
+
+		/**
+		 Returns the element referred to by the given handle.
+
+		 @param[in]		handle
+						The handle.
+		 @return		A pointer to the element referred to by the given
+						handle. @c nullptr if the given handle is stale.
+		 */
+		[[nodiscard]]
+		pointer get(Handle handle) noexcept {
+			return contains(handle)
+				? &m_elements[m_slots[handle.m_slot].m_index] : nullptr;
+		}
+
+		/**
+		 Returns the element referred to by the given handle.
+
+		 @param[in]		handle
+						The handle.
+		 @return		A pointer to the element referred to by the given
+						handle. @c nullptr if the given handle is stale.
+		 */
+		[[nodiscard]]
+		const_pointer get(Handle handle) const noexcept {
+			return contains(handle)
+				? &m_elements[m_slots[handle.m_slot].m_index] : nullptr;
+		}
+
+		/**
+		 Returns the element stored in the given slot.
+
+		 @pre			The given slot must contain an element.
+		 @param[in]		slot
+						The slot.
+		 @return		A reference to the element stored in the given slot.
+		 */
+		[[nodiscard]]
+		reference at_slot(U32 slot) noexcept {
+			return m_elements[m_slots[slot].m_index];
+		}
+
+		/**
+		 Returns the element stored in the given slot.
+
+		 @pre			The given slot must contain an element.
+		 @param[in]		slot
+						The slot.
+		 @return		A reference to the element stored in the given slot.
+		 */
+		[[nodiscard]]
+		const_reference at_slot(U32 slot) const noexcept {
+			return m_elements[m_slots[slot].m_index];
+		}
+
+		/**
+		 Returns the handle of the given element.
+
+		 @pre			The given element must be an element of this slot
+						map.
+		 @param[in]		element
+						A reference to the element.
+		 @return		The handle of the given element.
+		 */
+		[[nodiscard]]
+		Handle handle_of(const_reference element) const noexcept {
+			const auto index = static_cast< size_type >(&element - data());
+			const auto slot  = m_element_slots[index];
+			return { slot, m_slots[slot].m_generation };
+		}
+
+		[[nodiscard]]
+		pointer data() noexcept {
+			return m_elements.data();
+		}
+
+		[[nodiscard]]
+		const_pointer data() const noexcept {
+			return m_elements.data();
+		}
+
+		//---------------------------------------------------------------------
+		// Member Methods: Iterators
+		//---------------------------------------------------------------------
+
+		[[nodiscard]]
+		iterator begin() noexcept {
+			return m_elements.begin();
+		}
+
+		[[nodiscard]]
+		const_iterator begin() const noexcept {
+			return m_elements.begin();
+		}
+
+		[[nodiscard]]
+		const_iterator cbegin() const noexcept {
+			return m_elements.cbegin();
+		}
+
+		[[nodiscard]]
+		iterator end() noexcept {
+			return m_elements.end();
+		}
+
+		[[nodiscard]]
+		const_iterator end() const noexcept {
+			return m_elements.end();
+		}
+
+		[[nodiscard]]
+		const_iterator cend() const noexcept {
+			return m_elements.cend();
+		}
+
+		[[nodiscard]]
+		reverse_iterator rbegin() noexcept {
+			return m_elements.rbegin();
+		}
+
+		[[nodiscard]]
+		const_reverse_iterator rbegin() const noexcept {
+			return m_elements.rbegin();
+		}
+
+		[[nodiscard]]
+		const_reverse_iterator crbegin() const noexcept {
+			return m_elements.crbegin();
+		}
+
+		[[nodiscard]]
+		reverse_iterator rend() noexcept {
+			return m_elements.rend();
+		}
+
+		[[nodiscard]]
+		const_reverse_iterator rend() const noexcept {
+			return m_elements.rend();
+		}
+
+		[[nodiscard]]
+		const_reverse_iterator crend() const noexcept {
+			return m_elements.crend();
+		}
+
+		//---------------------------------------------------------------------
+		// Member Methods: Capacity
+		//---------------------------------------------------------------------
+
+		[[nodiscard]]
+		bool empty() const noexcept {
+			return m_elements.empty();
+		}
+
+		[[nodiscard]]
+		size_type size() const noexcept {
+			return m_elements.size();
+		}
+
+		void reserve(size_type new_capacity) {
+			m_elements.reserve(new_capacity);
+			m_element_slots.reserve(new_capacity);
+			m_slots.reserve(new_capacity);
+		}
+
+		//---------------------------------------------------------------------
+		// Member Methods: Modifiers
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs an element in place at the end of this slot map.
+
+		 @tparam		ConstructorArgsT
+						The constructor argument types of the element.
+		 @param[in]		args
+						A reference to the constructor arguments for the
+						element.
+		 @return		The handle of the element.
+		 */
+		template< typename... ConstructorArgsT >
+		Handle emplace(ConstructorArgsT&&... args) {
+			using std::size;
+
+			const auto index = static_cast< U32 >(size(m_elements));
+			m_elements.emplace_back(std::forward< ConstructorArgsT >(args)...);
+
+			U32 slot;
+			if (s_invalid_slot != m_free_slot) {
+				// Pop a slot from the free list.
+				slot = m_free_slot;
+				m_free_slot = m_slots[slot].m_next_free_slot;
+				m_slots[slot].m_index = index;
+			}
+			else {
+				slot = static_cast< U32 >(size(m_slots));
+				m_slots.push_back({ index, s_invalid_slot, 0u });
+			}
+
+			m_element_slots.push_back(slot);
+
+			return { slot, m_slots[slot].m_generation };
+		}
+
+		/**
+		 Erases the element referred to by the given handle. Stale handles
+		 are ignored.
+
+		 @param[in]		handle
+						The handle.
+		 */
+		void erase(Handle handle) {
+			if (!contains(handle)) {
+				return;
+			}
+
+			const auto index = m_slots[handle.m_slot].m_index;
+
+			// Replace the erased element with the last element.
+			const auto last_slot = m_element_slots.back();
+			if (last_slot != handle.m_slot) {
+				m_elements[index]          = std::move(m_elements.back());
+				m_element_slots[index]     = last_slot;
+				m_slots[last_slot].m_index = index;
+			}
+
+			m_elements.pop_back();
+			m_element_slots.pop_back();
+
+			Release(handle.m_slot);
+		}
+
+		/**
+		 Erases all elements of this slot map. All handles become stale.
+		 */
+		void clear() noexcept {
+			for (const auto slot : m_element_slots) {
+				Release(slot);
+			}
+
+			m_elements.clear();
+			m_element_slots.clear();
+		}
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		/**
+		 A struct of slots.
+		 */
+		struct Slot {
+
+			/**
+			 The index of the element of this slot.
+			 */
+			U32 m_index;
+
+			/**
+			 The next free slot (if this slot is free).
+			 */
+			U32 m_next_free_slot;
+
+			/**
+			 The generation of this slot.
+			 */
+			U32 m_generation;
+		};
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Releases the given slot and pushes it on the free list.
+
+		 @param[in]		slot
+						The slot.
+		 */
+		void Release(U32 slot) noexcept {
+			auto& released = m_slots[slot];
+			released.m_index          = s_invalid_slot;
+			released.m_next_free_slot = m_free_slot;
+			++released.m_generation;
+
+			m_free_slot = slot;
+		}
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 A vector containing the elements of this slot map.
+		 */
+		AlignedVector< T > m_elements;
+
+		/**
+		 A vector containing the slot of each element of this slot map.
+		 */
+		std::vector< U32 > m_element_slots;
+
+		/**
+		 A vector containing the slots of this slot map.
+		 */
+		std::vector< Slot > m_slots;
+
+		/**
+		 The head of the free list of this slot map.
+		 */
+		U32 m_free_slot;
+	};
+}
\ No newline at end of file
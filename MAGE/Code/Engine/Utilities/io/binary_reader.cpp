@@ -149,7 +149,12 @@ namespace mage {
 	}
 
 	void BigEndianBinaryReader::ReadFromMemory(gsl::span< const U8 > input) {
-		m_path = L"input string";
+		ReadFromMemory(input, L"input string");
+	}
+
+	void BigEndianBinaryReader::ReadFromMemory(gsl::span< const U8 > input,
+											   const std::filesystem::path& path) {
+		m_path = path;
 
 		m_pos  = input.data();
 		m_end  = input.data() + input.size();
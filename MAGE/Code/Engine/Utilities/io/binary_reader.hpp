@@ -289,6 +289,21 @@ namespace mage {
 		 */
 		void ReadFromMemory(gsl::span< const U8 > input);
 
+		/**
+		 Reads the input string which contains the bytes of the file
+		 associated with the given path.
+
+		 @param[in]		input
+						The input byte string.
+		 @param[in]		path
+						A reference to the path of the file containing the
+						given input string (used for reporting only).
+		 @throws		Exception
+						Failed to read from the given input string.
+		 */
+		void ReadFromMemory(gsl::span< const U8 > input,
+							const std::filesystem::path& path);
+
 	protected:
 
 		//---------------------------------------------------------------------
@@ -0,0 +1,68 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "type\types.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <cstring>
+#include <gsl\span>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	/**
+	 The initial checksum value (i.e. the 64-bit FNV offset basis).
+	 */
+	constexpr U64 g_checksum_seed = 0xCBF29CE484222325ull;
+
+	/**
+	 Computes the checksum of the given bytes.
+
+	 The checksum is a 64-bit FNV-1a hash over (little endian) 64-bit words
+	 instead of single bytes, which is sufficient for detecting corrupt or
+	 truncated files at memory bandwidth.
+
+	 @param[in]		data
+					The bytes.
+	 @param[in]		seed
+					The initial checksum value. This can be the checksum of
+					preceding bytes to checksum multiple byte ranges.
+	 @return		The checksum of the given bytes.
+	 */
+	[[nodiscard]]
+	inline U64 ComputeChecksum(gsl::span< const U8 > data,
+							   U64 seed = g_checksum_seed) noexcept {
+
+		constexpr U64 prime = 0x100000001B3ull;
+
+		auto checksum = seed;
+		auto first = data.data();
+		const auto last = data.data() + data.size();
+
+		for (; 8u <= static_cast< std::size_t >(last - first); first += 8u) {
+			U64 word;
+			std::memcpy(&word, first, sizeof(word));
+			checksum = (checksum ^ word) * prime;
+		}
+
+		for (; first != last; ++first) {
+			checksum = (checksum ^ *first) * prime;
+		}
+
+		return checksum;
+	}
+}
\ No newline at end of file
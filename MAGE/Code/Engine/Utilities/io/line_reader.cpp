@@ -4,92 +4,84 @@
 #pragma region
 
 #include "io\line_reader.hpp"
+#include "io\binary_reader.hpp"
 #include "logging\logging.hpp"
 
 #pragma endregion
 
-//-----------------------------------------------------------------------------
-// System Includes
-//-----------------------------------------------------------------------------
-#pragma region
-
-#include <fstream>
-#include <sstream>
-
-#pragma endregion
-
 //-----------------------------------------------------------------------------
 // Engine Definitions
 //-----------------------------------------------------------------------------
 namespace mage {
 
-	const std::regex LineReader::s_default_regex
-		= std::regex(R"((\"([^\"]*)\")|(\S+))");
+	namespace {
 
-	const LineReader::SelectionFunction LineReader::s_default_selection_function
-		= [](const std::smatch& match) {
-		return match[2].length() ? match[2] : match[3];
-	};
+		/**
+		 Checks whether the given character is a whitespace character.
+
+		 @param[in]		c
+						The character.
+		 @return		@c true if the given character is a whitespace
+						character. @c false otherwise.
+		 */
+		[[nodiscard]]
+		constexpr bool IsWhitespace(char c) noexcept {
+			return ' ' == c || ('\t' <= c && c <= '\r');
+		}
+	}
 
 	LineReader::LineReader()
-		: m_regex(),
-		m_selection_function(),
-		m_path(),
-		m_iterator(),
+		: m_path(),
+		m_line(),
+		m_token(),
+		m_has_token(false),
 		m_line_number(0) {}
 
-	LineReader::LineReader(LineReader&& reader) noexcept
-		: m_regex(std::move(reader.m_regex)),
-		m_selection_function(std::move(reader.m_selection_function)),
-		m_path(std::move(reader.m_path)),
-		m_iterator(reader.m_iterator),
-		m_line_number(reader.m_line_number) {}
+	LineReader::LineReader(LineReader&& reader) noexcept = default;
 
 	LineReader::~LineReader() = default;
 
-	LineReader& LineReader::operator=(LineReader&& reader) noexcept {
-		m_regex              = std::move(reader.m_regex);
-		m_selection_function = std::move(reader.m_selection_function);
-		m_path               = reader.m_path;
-		m_iterator           = reader.m_iterator;
-		m_line_number        = reader.m_line_number;
-		return *this;
-	}
-
-	void LineReader::ReadFromFile(const std::filesystem::path& path,
-								  const std::regex& regex,
-								  const SelectionFunction& selection_function) {
+	LineReader& LineReader::operator=(LineReader&& reader) noexcept = default;
 
-		m_path               = path;
-		m_regex              = regex;
-		m_selection_function = selection_function;
+	void LineReader::ReadFromFile(const std::filesystem::path& path) {
+		m_path = path;
 
 		// Preprocessing
 		Preprocess();
 
 		// Processing
-		std::ifstream stream(m_path.c_str());
-		ThrowIfFailed(stream.is_open(), "{}: could not open file.", m_path);
-		Process(stream);
+		UniquePtr< U8[] > data;
+		std::size_t size = 0u;
+		ReadBinaryFile(m_path, data, size);
+		Process({ reinterpret_cast< const char* >(data.get()), size });
 
 		// Postprocessing
 		Postprocess();
 	}
 
-	void LineReader::ReadFromMemory(const std::string& input,
-									const std::regex& regex,
-									const SelectionFunction& selection_function) {
+	void LineReader::ReadFromMemory(std::string_view input) {
+		m_path = L"input string";
 
-		m_path               = L"input string";
-		m_regex              = regex;
-		m_selection_function = selection_function;
+		// Preprocessing
+		Preprocess();
+
+		// Processing
+		Process(input);
+
+		// Postprocessing
+		Postprocess();
+	}
+
+	void LineReader::ReadFromMemory(std::string_view input,
+								   const std::filesystem::path& path,
+								   U32 first_line_number) {
+		m_path = path;
 
 		// Preprocessing
 		Preprocess();
 
 		// Processing
-		std::istringstream stream(input);
-		Process(stream);
+		Process(input, first_line_number);
 
 		// Postprocessing
 		Postprocess();
@@ -97,12 +89,21 @@ namespace mage {
 
 	void LineReader::Preprocess() {}
 
-	void LineReader::Process(std::istream& stream) {
-		m_line_number = 0u;
+	void LineReader::Process(std::string_view input, U32 first_line_number) {
+		m_line_number = first_line_number;
 
-		std::string line;
-		while (std::getline(stream, line)) {
-			m_iterator = std::sregex_iterator(line.cbegin(), line.cend(), m_regex);
+		while (!input.empty()) {
+			const auto end = input.find('\n');
+			m_line = input.substr(0u, end);
+			input.remove_prefix((std::string_view::npos != end) ? end + 1u
+								                                : input.size());
+
+			// Strip the carriage return of CRLF line endings.
+			if (!m_line.empty() && '\r' == m_line.back()) {
+				m_line.remove_suffix(1u);
+			}
+
+			ReadNextToken();
 			if (ContainsTokens()) {
 				ReadLine();
 			}
@@ -110,7 +111,9 @@ namespace mage {
 			++m_line_number;
 		}
 
-		m_iterator = {};
+		m_line      = {};
+		m_token     = {};
+		m_has_token = false;
 	}
 
 	void LineReader::Postprocess() {}
@@ -125,19 +128,49 @@ namespace mage {
 
 	[[nodiscard]]
 	bool LineReader::ContainsTokens() const noexcept {
-		static const std::sregex_iterator end_iterator;
-		return end_iterator != m_iterator;
+		return m_has_token;
 	}
 
 	[[nodiscard]]
 	const std::string_view LineReader::GetCurrentToken() const noexcept {
-		const auto token = m_selection_function(*m_iterator);
-		if (token.matched) {
-			return { &*token.first,
-				     static_cast< std::size_t >(token.second - token.first) };
+		return m_token;
+	}
+
+	void LineReader::ReadNextToken() noexcept {
+		// Skip the leading whitespace.
+		std::size_t first = 0u;
+		while (first < m_line.size() && IsWhitespace(m_line[first])) {
+			++first;
 		}
-		else {
-			return {};
+		m_line.remove_prefix(first);
+
+		if (m_line.empty()) {
+			m_token     = {};
+			m_has_token = false;
+			return;
 		}
+
+		m_has_token = true;
+
+		// Double-quoted string
+		if ('"' == m_line.front()) {
+			if (const auto last = m_line.find('"', 1u);
+				std::string_view::npos != last) {
+
+				m_token = m_line.substr(1u, last - 1u);
+				m_line.remove_prefix(last + 1u);
+				return;
+			}
+			// An unterminated double quote is part of a regular token.
+		}
+
+		// Sequence of non-whitespace characters
+		std::size_t last = 1u;
+		while (last < m_line.size() && !IsWhitespace(m_line[last])) {
+			++last;
+		}
+
+		m_token = m_line.substr(0u, last);
+		m_line.remove_prefix(last);
 	}
 }
@@ -14,8 +14,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include <istream>
-#include <regex>
+#include <string_view>
 
 #pragma endregion
 
@@ -26,36 +25,16 @@ namespace mage {
 
 	/**
 	 A class of line readers for reading (non-binary) text files line by line.
+
+	 The text is read as a whole and tokenized in place: tokens are views into
+	 the text. A token is either a sequence of non-whitespace characters or
+	 a double-quoted string (without the quotes), which may contain
+	 whitespace.
 	 */
 	class LineReader {
 
 	public:
 
-		//---------------------------------------------------------------------
-		// Class Member Types
-		//---------------------------------------------------------------------
-
-		/**
-		 The selection function type for extracting one @a std::ssub_match from
-		 a given @a std::smatch.
-		 */
-		using SelectionFunction
-			= std::function< const std::ssub_match(const std::smatch&) >;
-
-		//---------------------------------------------------------------------
-		// Class Member Variables
-		//---------------------------------------------------------------------
-
-		/**
-		 The default (line) regex for line readers.
-		 */
-		static const std::regex s_default_regex;
-
-		/**
-		 The default selection function for line readers.
-		 */
-		static const SelectionFunction s_default_selection_function;
-
 		//---------------------------------------------------------------------
 		// Assignment Operators
 		//---------------------------------------------------------------------
@@ -89,34 +68,39 @@ namespace mage {
 
 		 @param[in]		path
 						A reference to the path.
-		 @param[in]		regex
-						A reference to the (line) regex.
-		 @param[in]		selection_function
-						A reference to the selection function.
 		 @throws		Exception
 						Failed to read from the file.
 		 */
-		void ReadFromFile(const std::filesystem::path& path,
-						  const std::regex& regex = s_default_regex,
-						  const SelectionFunction& selection_function
-						  = s_default_selection_function);
+		void ReadFromFile(const std::filesystem::path& path);
 
 		/**
 		 Reads from the given input string.
 
 		 @param[in]		input
-						A reference to the input string.
-		 @param[in]		regex
-						A reference to the (line) regex.
-		 @param[in]		selection_function
-						A reference to the selection function.
+						The input string.
 		 @throws		Exception
 						Failed to read from the given input string.
 		 */
-		void ReadFromMemory(const std::string& input,
-							const std::regex& regex = s_default_regex,
-							const SelectionFunction& selection_function
-							= s_default_selection_function);
+		void ReadFromMemory(std::string_view input);
+
+		/**
+		 Reads from the given input string which is part of the file
+		 associated with the given path.
+
+		 @param[in]		input
+						The input string.
+		 @param[in]		path
+						A reference to the path of the file containing the
+						given input string (used for reporting only).
+		 @param[in]		first_line_number
+						The line number of the first line of the given input
+						string in the file associated with the given path.
+		 @throws		Exception
+						Failed to read from the given input string.
+		 */
+		void ReadFromMemory(std::string_view input,
+							const std::filesystem::path& path,
+							U32 first_line_number);
 
 	protected:
 
@@ -249,14 +233,17 @@ namespace mage {
 		virtual void Preprocess();
 
 		/**
-		 Processes the given input stream (line by line).
+		 Processes the given input string (line by line).
 
-		 @param[in]		stream
-						A reference to the input stream.
+		 @param[in]		input
+						The input string.
+		 @param[in]		first_line_number
+						The line number of the first line of the given input
+						string.
 		 @throws		Exception
-						Failed to process the given input stream.
+						Failed to process the given input string.
 		 */
-		void Process(std::istream& stream);
+		void Process(std::string_view input, U32 first_line_number = 0u);
 
 		/**
 		 Reads the current line of this line reader.
@@ -282,31 +269,35 @@ namespace mage {
 		[[nodiscard]]
 		const std::string_view GetCurrentToken() const noexcept;
 
+		/**
+		 Advances to the next token of the current line of this line reader.
+		 */
+		void ReadNextToken() noexcept;
+
 		//---------------------------------------------------------------------
 		// Member Variables
 		//---------------------------------------------------------------------
 
 		/**
-		 The current (line) regex of this line reader.
+		 The current path of this line reader.
 		 */
-		std::regex m_regex;
+		std::filesystem::path m_path;
 
 		/**
-		 The function for selecting the target submatch from the match of the
-		 regular expression represented by the regex of this strategy.
+		 The remaining (i.e. not yet tokenized) part of the current line of
+		 this line reader.
 		 */
-		SelectionFunction m_selection_function;
+		std::string_view m_line;
 
 		/**
-		 The current path of this line reader.
+		 The current token of the current line of this line reader.
 		 */
-		std::filesystem::path m_path;
+		std::string_view m_token;
 
 		/**
-		 An iterator to the current token of the current line of this line
-		 reader.
+		 A flag indicating whether this line reader has a current token.
 		 */
-		std::sregex_iterator m_iterator;
+		bool m_has_token;
 
 		/**
 		 The current line number of this line reader.
@@ -0,0 +1,176 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "memory\memory.hpp"
+#include "type\types.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <filesystem>
+#include <gsl\span>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	namespace details {
+
+		/**
+		 A struct of file view destructors (i.e. for unmapping file views).
+		 */
+		struct FileViewUnmapper {
+
+			/**
+			 Destructs the given file view.
+
+			 @param[in]		view
+							A pointer to the file view to destruct.
+			 */
+			void operator()(const void* view) const noexcept {
+				if (view) {
+					UnmapViewOfFile(view);
+				}
+			}
+		};
+	}
+
+	/**
+	 A class of memory-mapped files (i.e. read-only views of files).
+
+	 The bytes of a memory-mapped file are paged in on demand and are not
+	 limited to 32-bit sizes.
+	 */
+	class MappedFile {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a memory-mapped file for the file associated with the
+		 given path.
+
+		 @param[in]		path
+						A reference to the path.
+		 @throws		Exception
+						Failed to map the file.
+		 */
+		explicit MappedFile(const std::filesystem::path& path);
+
+		/**
+		 Constructs a memory-mapped file from the given memory-mapped file.
+
+		 @param[in]		file
+						A reference to the memory-mapped file to copy.
+		 */
+		MappedFile(const MappedFile& file) = delete;
+
+		/**
+		 Constructs a memory-mapped file by moving the given memory-mapped
+		 file.
+
+		 @param[in]		file
+						A reference to the memory-mapped file to move.
+		 */
+		MappedFile(MappedFile&& file) noexcept;
+
+		/**
+		 Destructs this memory-mapped file.
+		 */
+		~MappedFile();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given memory-mapped file to this memory-mapped file.
+
+		 @param[in]		file
+						A reference to the memory-mapped file to copy.
+		 @return		A reference to the copy of the given memory-mapped
+						file (i.e. this memory-mapped file).
+		 */
+		MappedFile& operator=(const MappedFile& file) = delete;
+
+		/**
+		 Moves the given memory-mapped file to this memory-mapped file.
+
+		 @param[in]		file
+						A reference to the memory-mapped file to move.
+		 @return		A reference to the moved memory-mapped file (i.e. this
+						memory-mapped file).
+		 */
+		MappedFile& operator=(MappedFile&& file) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the path of this memory-mapped file.
+
+		 @return		A reference to the path of this memory-mapped file.
+		 */
+		[[nodiscard]]
+		const std::filesystem::path& GetPath() const noexcept {
+			return m_path;
+		}
+
+		/**
+		 Returns the bytes of this memory-mapped file.
+
+		 @return		The bytes of this memory-mapped file. The bytes remain
+						valid during the lifetime of this memory-mapped file.
+		 */
+		[[nodiscard]]
+		gsl::span< const U8 > GetData() const noexcept {
+			return { static_cast< const U8* >(m_view.get()), m_size };
+		}
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The path of this memory-mapped file.
+		 */
+		std::filesystem::path m_path;
+
+		/**
+		 The handle of the file of this memory-mapped file.
+		 */
+		UniqueHandle m_file;
+
+		/**
+		 The handle of the file mapping object of this memory-mapped file.
+		 */
+		UniqueHandle m_mapping;
+
+		/**
+		 A pointer to the view of this memory-mapped file.
+		 */
+		UniquePtr< const void, details::FileViewUnmapper > m_view;
+
+		/**
+		 The size (in bytes) of this memory-mapped file.
+		 */
+		std::size_t m_size;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,161 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "parallel\job_system.hpp"
+#include "parallel\parallel.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	namespace {
+
+		/**
+		 A pointer to the job system of the worker thread (or @c nullptr if
+		 the calling thread is not a worker thread).
+		 */
+		thread_local const JobSystem* g_job_system = nullptr;
+
+		/**
+		 The index of the task queue of the worker thread.
+		 */
+		thread_local std::size_t g_queue_index = 0u;
+	}
+
+	JobSystem::JobSystem()
+		: JobSystem(std::max(std::size_t(NumberOfSystemCores()),
+							 std::size_t(1u)) - 1u) {}
+
+	JobSystem::JobSystem(std::size_t nb_workers)
+		: m_queues(),
+		m_workers(),
+		m_nb_pending_tasks(0u),
+		m_mutex(),
+		m_condition(),
+		m_terminate(false) {
+
+		m_queues.reserve(nb_workers + 1u);
+		for (std::size_t i = 0u; i <= nb_workers; ++i) {
+			m_queues.push_back(MakeUnique< TaskQueue >());
+		}
+
+		m_workers.reserve(nb_workers);
+		for (std::size_t i = 1u; i <= nb_workers; ++i) {
+			m_workers.emplace_back(&JobSystem::RunWorker, this, i);
+		}
+	}
+
+	JobSystem::~JobSystem() {
+		{
+			const std::lock_guard< std::mutex > lock(m_mutex);
+			m_terminate = true;
+		}
+		m_condition.notify_all();
+
+		for (auto& worker : m_workers) {
+			worker.join();
+		}
+	}
+
+	void JobSystem::Run(Job job, JobCounter& counter) {
+		counter.m_count.fetch_add(1u, std::memory_order_relaxed);
+		Schedule({ std::move(job), &counter });
+	}
+
+	void JobSystem::Wait(const JobCounter& counter) noexcept {
+		const auto index = GetQueueIndex();
+		while (!counter.IsDone()) {
+			if (!RunPendingTask(index)) {
+				std::this_thread::yield();
+			}
+		}
+	}
+
+	[[nodiscard]]
+	std::size_t JobSystem::GetQueueIndex() const noexcept {
+		return (this == g_job_system) ? g_queue_index : 0u;
+	}
+
+	void JobSystem::Schedule(Task&& task) {
+		{
+			// Increment under the lock to avoid lost wake-ups, and before
+			// publishing the task so that a thief never decrements first.
+			const std::lock_guard< std::mutex > lock(m_mutex);
+			m_nb_pending_tasks.fetch_add(1u, std::memory_order_relaxed);
+		}
+
+		auto& queue = *m_queues[GetQueueIndex()];
+		{
+			const std::lock_guard< std::mutex > lock(queue.m_mutex);
+			queue.m_tasks.push_back(std::move(task));
+		}
+		m_condition.notify_one();
+	}
+
+	bool JobSystem::RunPendingTask(std::size_t index) noexcept {
+		using std::size;
+
+		Task task;
+		bool found = false;
+
+		// Pop the most recent task of the own task queue.
+		{
+			auto& queue = *m_queues[index];
+			const std::lock_guard< std::mutex > lock(queue.m_mutex);
+			if (!queue.m_tasks.empty()) {
+				task = std::move(queue.m_tasks.back());
+				queue.m_tasks.pop_back();
+				found = true;
+			}
+		}
+
+		// Steal the oldest task of another task queue.
+		const auto nb_queues = size(m_queues);
+		for (std::size_t i = 1u; i < nb_queues && !found; ++i) {
+			auto& queue = *m_queues[(index + i) % nb_queues];
+			const std::lock_guard< std::mutex > lock(queue.m_mutex);
+			if (!queue.m_tasks.empty()) {
+				task = std::move(queue.m_tasks.front());
+				queue.m_tasks.pop_front();
+				found = true;
+			}
+		}
+
+		if (!found) {
+			return false;
+		}
+
+		m_nb_pending_tasks.fetch_sub(1u, std::memory_order_relaxed);
+
+		task.m_job();
+
+		task.m_counter->m_count.fetch_sub(1u, std::memory_order_release);
+		return true;
+	}
+
+	void JobSystem::RunWorker(std::size_t index) noexcept {
+		g_job_system  = this;
+		g_queue_index = index;
+
+		while (true) {
+			if (RunPendingTask(index)) {
+				continue;
+			}
+
+			std::unique_lock< std::mutex > lock(m_mutex);
+			m_condition.wait(lock, [this]() {
+				return m_terminate
+					|| 0u != m_nb_pending_tasks.load(std::memory_order_relaxed);
+			});
+
+			if (m_terminate) {
+				return;
+			}
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,451 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "memory\memory.hpp"
+#include "type\atomic_types.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <gsl\span>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	//-------------------------------------------------------------------------
+	// JobCounter
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A class of job counters.
+
+	 A job counter counts the number of unfinished jobs associated with it.
+	 Job counters are used to join jobs and to express dependencies between
+	 jobs.
+	 */
+	class JobCounter {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a job counter.
+		 */
+		JobCounter() noexcept
+			: m_count(0u) {}
+
+		/**
+		 Constructs a job counter from the given job counter.
+
+		 @param[in]		counter
+						A reference to the job counter to copy.
+		 */
+		JobCounter(const JobCounter& counter) = delete;
+
+		/**
+		 Constructs a job counter by moving the given job counter.
+
+		 @param[in]		counter
+						A reference to the job counter to move.
+		 */
+		JobCounter(JobCounter&& counter) = delete;
+
+		/**
+		 Destructs this job counter.
+		 */
+		~JobCounter() = default;
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given job counter to this job counter.
+
+		 @param[in]		counter
+						A reference to the job counter to copy.
+		 @return		A reference to the copy of the given job counter (i.e.
+						this job counter).
+		 */
+		JobCounter& operator=(const JobCounter& counter) = delete;
+
+		/**
+		 Moves the given job counter to this job counter.
+
+		 @param[in]		counter
+						A reference to the job counter to move.
+		 @return		A reference to the moved job counter (i.e. this job
+						counter).
+		 */
+		JobCounter& operator=(JobCounter&& counter) = delete;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Checks whether all jobs associated with this job counter are
+		 finished.
+
+		 @return		@c true if all jobs associated with this job counter
+						are finished. @c false otherwise.
+		 */
+		[[nodiscard]]
+		bool IsDone() const noexcept {
+			return 0u == m_count.load(std::memory_order_acquire);
+		}
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Friends
+		//---------------------------------------------------------------------
+
+		friend class JobSystem;
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The number of unfinished jobs of this job counter.
+		 */
+		AtomicU32 m_count;
+	};
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// JobSystem
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A class of job systems.
+
+	 A job system runs jobs on a fixed set of worker threads. Each worker
+	 thread owns a job queue. A worker thread pushes and pops jobs at the
+	 back of its own job queue and steals jobs from the front of the job
+	 queues of the other threads if its own job queue is empty. Threads
+	 which are not worker threads share a single job queue.
+
+	 Waiting for a job counter never blocks: the waiting thread runs pending
+	 jobs until all jobs of the job counter are finished. Jobs may thus
+	 create and wait for other jobs (i.e. fork/join).
+
+	 Jobs must not throw exceptions.
+	 */
+	class JobSystem {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		/**
+		 The type of jobs.
+		 */
+		using Job = std::function< void() >;
+
+		//---------------------------------------------------------------------
+		// Class Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The default number of iterations of a job of a parallel for loop.
+		 */
+		static constexpr std::size_t s_default_grain_size = 64u;
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a job system with one worker thread for each system core
+		 except the one of the calling thread.
+
+		 @throws		std::system_error
+						Failed to create the worker threads.
+		 */
+		JobSystem();
+
+		/**
+		 Constructs a job system.
+
+		 @param[in]		nb_workers
+						The number of worker threads. If zero, all jobs are run
+						by the waiting threads.
+		 @throws		std::system_error
+						Failed to create the worker threads.
+		 */
+		explicit JobSystem(std::size_t nb_workers);
+
+		/**
+		 Constructs a job system from the given job system.
+
+		 @param[in]		job_system
+						A reference to the job system to copy.
+		 */
+		JobSystem(const JobSystem& job_system) = delete;
+
+		/**
+		 Constructs a job system by moving the given job system.
+
+		 @param[in]		job_system
+						A reference to the job system to move.
+		 */
+		JobSystem(JobSystem&& job_system) = delete;
+
+		/**
+		 Destructs this job system. The pending jobs are discarded.
+		 */
+		~JobSystem();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given job system to this job system.
+
+		 @param[in]		job_system
+						A reference to the job system to copy.
+		 @return		A reference to the copy of the given job system (i.e.
+						this job system).
+		 */
+		JobSystem& operator=(const JobSystem& job_system) = delete;
+
+		/**
+		 Moves the given job system to this job system.
+
+		 @param[in]		job_system
+						A reference to the job system to move.
+		 @return		A reference to the moved job system (i.e. this job
+						system).
+		 */
+		JobSystem& operator=(JobSystem&& job_system) = delete;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the number of worker threads of this job system.
+
+		 @return		The number of worker threads of this job system.
+		 */
+		[[nodiscard]]
+		std::size_t GetNumberOfWorkers() const noexcept {
+			return m_workers.size();
+		}
+
+		/**
+		 Runs the given job.
+
+		 @param[in]		job
+						The job.
+		 @param[in,out]	counter
+						A reference to the job counter to associate the given
+						job with.
+		 */
+		void Run(Job job, JobCounter& counter);
+
+		/**
+		 Waits until all jobs of the given job counter are finished. The
+		 calling thread runs pending jobs while waiting.
+
+		 @param[in]		counter
+						A reference to the job counter.
+		 */
+		void Wait(const JobCounter& counter) noexcept;
+
+		/**
+		 Performs the given action for each index in the given range of
+		 indices in parallel. Returns after the given action has been
+		 performed for all indices.
+
+		 @tparam		ActionT
+						The action type.
+		 @param[in]		nb_iterations
+						The number of iterations (i.e. the indices range from
+						0 to @a nb_iterations - 1).
+		 @param[in]		action
+						A reference to the action (i.e. @c action(index)).
+		 @param[in]		grain_size
+						The number of iterations of a single job.
+		 */
+		template< typename ActionT >
+		void ParallelFor(std::size_t nb_iterations,
+						 ActionT&& action,
+						 std::size_t grain_size = s_default_grain_size);
+
+		/**
+		 Performs the given action for each element of the given range in
+		 parallel. Returns after the given action has been performed for all
+		 elements.
+
+		 @tparam		T
+						The element type.
+		 @tparam		ActionT
+						The action type.
+		 @param[in]		range
+						The range of elements.
+		 @param[in]		action
+						A reference to the action (i.e. @c action(element)).
+		 @param[in]		grain_size
+						The number of elements of a single job.
+		 */
+		template< typename T, typename ActionT >
+		void ParallelFor(gsl::span< T > range,
+						 ActionT&& action,
+						 std::size_t grain_size = s_default_grain_size);
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		/**
+		 A struct of tasks (i.e. scheduled jobs).
+		 */
+		struct Task {
+
+			/**
+			 The job of this task.
+			 */
+			Job m_job;
+
+			/**
+			 A pointer to the job counter of this task.
+			 */
+			JobCounter* m_counter;
+		};
+
+		/**
+		 A struct of task queues.
+		 */
+		struct TaskQueue {
+
+			/**
+			 The mutex of this task queue.
+			 */
+			std::mutex m_mutex;
+
+			/**
+			 The tasks of this task queue.
+			 */
+			std::deque< Task > m_tasks;
+		};
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the index of the task queue of the calling thread.
+
+		 @return		The index of the task queue of the calling thread.
+		 */
+		[[nodiscard]]
+		std::size_t GetQueueIndex() const noexcept;
+
+		/**
+		 Schedules the given task.
+
+		 @param[in]		task
+						A reference to the task to move.
+		 */
+		void Schedule(Task&& task);
+
+		/**
+		 Pops or steals a pending task and runs it.
+
+		 @param[in]		index
+						The index of the task queue of the calling thread.
+		 @return		@c true if a task has been run. @c false otherwise.
+		 */
+		bool RunPendingTask(std::size_t index) noexcept;
+
+		/**
+		 Runs the worker thread with the given index.
+
+		 @param[in]		index
+						The index of the worker thread.
+		 */
+		void RunWorker(std::size_t index) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 A vector containing the task queues of this job system. The first
+		 task queue is shared by all threads which are not worker threads.
+		 The other task queues belong to the worker threads.
+		 */
+		std::vector< UniquePtr< TaskQueue > > m_queues;
+
+		/**
+		 A vector containing the worker threads of this job system.
+		 */
+		std::vector< std::thread > m_workers;
+
+		/**
+		 The number of pending tasks of this job system.
+		 */
+		AtomicU32 m_nb_pending_tasks;
+
+		/**
+		 The mutex for putting the worker threads of this job system to
+		 sleep.
+		 */
+		std::mutex m_mutex;
+
+		/**
+		 The condition variable for waking the worker threads of this job
+		 system.
+		 */
+		std::condition_variable m_condition;
+
+		/**
+		 A flag indicating whether the worker threads of this job system must
+		 terminate.
+		 */
+		bool m_terminate;
+	};
+
+	#pragma endregion
+}
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "parallel\job_system.tpp"
+
+#pragma endregion
\ No newline at end of file
@@ -0,0 +1,64 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	template< typename ActionT >
+	void JobSystem::ParallelFor(std::size_t nb_iterations,
+								ActionT&& action,
+								std::size_t grain_size) {
+
+		grain_size = std::max(grain_size, std::size_t(1u));
+
+		// Run a single batch of iterations on the calling thread.
+		if (nb_iterations <= grain_size || m_workers.empty()) {
+			for (std::size_t i = 0u; i < nb_iterations; ++i) {
+				action(i);
+			}
+			return;
+		}
+
+		JobCounter counter;
+		for (std::size_t first = grain_size; first < nb_iterations;
+			 first += grain_size) {
+
+			const auto last = std::min(first + grain_size, nb_iterations);
+			Run([&action, first, last]() {
+				for (auto i = first; i < last; ++i) {
+					action(i);
+				}
+			}, counter);
+		}
+
+		// The calling thread performs the first batch of iterations itself.
+		for (std::size_t i = 0u; i < grain_size; ++i) {
+			action(i);
+		}
+
+		Wait(counter);
+	}
+
+	template< typename T, typename ActionT >
+	inline void JobSystem::ParallelFor(gsl::span< T > range,
+									   ActionT&& action,
+									   std::size_t grain_size) {
+
+		const auto data = range.data();
+		ParallelFor(static_cast< std::size_t >(range.size()),
+					[data, &action](std::size_t i) {
+						action(data[i]);
+					},
+					grain_size);
+	}
+}
\ No newline at end of file
@@ -5,6 +5,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
+#include "collection\hash_map.hpp"
 #include "type\types.hpp"
 
 #pragma endregion
@@ -14,8 +15,8 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include <map>
 #include <mutex>
+#include <shared_mutex>
 
 #pragma endregion
 
@@ -32,6 +33,10 @@ namespace mage {
 	/**
 	 A class of resource pools.
 
+	 Lookups of existing resources only acquire a shared lock and probe a hash
+	 map with the hash of the key, which is computed once per call. An
+	 exclusive lock is only acquired for inserting and removing resources.
+
 	 @tparam		KeyT
 					The key type.
 	 @tparam		ResourceT
@@ -230,7 +235,22 @@ namespace mage {
 		/**
 		 A resource map used by a resource pool.
 		 */
-		using ResourceMap = std::map< KeyT, WeakPtr< ResourceT > >;
+		using ResourceMap = HashMap< KeyT, WeakPtr< ResourceT > >;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Removes the resource corresponding to the given key from this
+		 resource pool.
+
+		 @param[in]		key
+						A reference to the key of the resource to remove.
+		 @param[in]		hash
+						The hash of the given key.
+		 */
+		void Remove(const KeyT& key, std::size_t hash);
 
 		//---------------------------------------------------------------------
 		// Member Variables
@@ -244,7 +264,7 @@ namespace mage {
 		/**
 		 The mutex for accessing the resource map of this resource pool.
 		 */
-		mutable std::mutex m_mutex;
+		mutable std::shared_mutex m_mutex;
 
 		/**
 		 A class of resources.
@@ -275,6 +295,8 @@ namespace mage {
 			 @param[in]		resource_key
 							A reference to the key of the resource in the
 							given resource pool.
+			 @param[in]		resource_hash
+							The hash of the given key.
 			 @param[in]		args
 							A forwarding reference to the arguments for creating a
 							new resource of type @c DerivedResourceT.
@@ -282,6 +304,7 @@ namespace mage {
 			template< typename... ConstructorArgsT >
 			Resource(ResourcePool& resource_pool,
 				     const KeyT& resource_key,
+				     std::size_t resource_hash,
 				     ConstructorArgsT&&... args);
 
 			/**
@@ -345,6 +368,11 @@ namespace mage {
 			 this resource.
 			 */
 			KeyT m_resource_key;
+
+			/**
+			 The hash of the key of this resource.
+			 */
+			std::size_t m_resource_hash;
 		};
 	};
 
@@ -564,7 +592,7 @@ namespace mage {
 		/**
 		 A resource map used by a persistent resource pool.
 		 */
-		using ResourceMap = std::map< KeyT, SharedPtr< ResourceT > >;
+		using ResourceMap = HashMap< KeyT, SharedPtr< ResourceT > >;
 
 		//---------------------------------------------------------------------
 		// Member Variables
@@ -579,7 +607,7 @@ namespace mage {
 		 The mutex for accessing the resource map of this persistent resource
 		 pool.
 		 */
-		mutable std::mutex m_mutex;
+		mutable std::shared_mutex m_mutex;
 	};
 
 	#pragma endregion
@@ -22,7 +22,7 @@ namespace mage {
 	template< typename KeyT, typename ResourceT >
 	[[nodiscard]]
 	inline bool ResourcePool< KeyT, ResourceT >::empty() const noexcept {
-		const std::scoped_lock lock(m_mutex);
+		const std::shared_lock lock(m_mutex);
 
 		using std::empty;
 		return empty(m_resource_map);
@@ -31,7 +31,7 @@ namespace mage {
 	template< typename KeyT, typename ResourceT >
 	[[nodiscard]]
 	inline std::size_t ResourcePool< KeyT, ResourceT >::size() const noexcept {
-		const std::scoped_lock lock(m_mutex);
+		const std::shared_lock lock(m_mutex);
 
 		using std::size;
 		return size(m_resource_map);
@@ -40,21 +40,13 @@ namespace mage {
 	template< typename KeyT, typename ResourceT >
 	[[nodiscard]]
 	bool ResourcePool< KeyT, ResourceT >::Contains(const KeyT& key) noexcept {
-		const std::scoped_lock lock(m_mutex);
+		const auto hash = m_resource_map.hash(key);
 
-		if (const auto it = m_resource_map.find(key);
-			it != m_resource_map.end()) {
-
-			const auto resource = it->second.lock();
-
-			if (resource) {
-				return true;
-			}
+		const std::shared_lock lock(m_mutex);
 
-			m_resource_map.erase(it);
-		}
-
-		return false;
+		// Expired resources are removed by their destructor.
+		const auto resource = m_resource_map.find(key, hash);
+		return resource && !resource->expired();
 	}
 
 	template< typename KeyT, typename ResourceT >
@@ -62,21 +54,13 @@ namespace mage {
 	SharedPtr< ResourceT > ResourcePool< KeyT, ResourceT >
 		::Get(const KeyT& key) noexcept {
 
-		const std::scoped_lock lock(m_mutex);
+		const auto hash = m_resource_map.hash(key);
 
-		if (const auto it = m_resource_map.find(key);
-			it != m_resource_map.end()) {
+		const std::shared_lock lock(m_mutex);
 
-			const auto resource = it->second.lock();
-
-			if (resource) {
-				return resource;
-			}
-
-			m_resource_map.erase(it);
-		}
-
-		return SharedPtr< ResourceT >();
+		// Expired resources are removed by their destructor.
+		const auto resource = m_resource_map.find(key, hash);
+		return resource ? resource->lock() : SharedPtr< ResourceT >();
 	}
 
 	template< typename KeyT, typename ResourceT >
@@ -93,36 +77,61 @@ namespace mage {
 	SharedPtr< ResourceT > ResourcePool< KeyT, ResourceT >
 		::GetOrCreateDerived(const KeyT& key, ConstructorArgsT&&... args) {
 
-		const std::scoped_lock lock(m_mutex);
+		const auto hash = m_resource_map.hash(key);
 
-		if (const auto it = m_resource_map.find(key);
-			it != m_resource_map.end()) {
+		// Fast path: the resource exists.
+		{
+			const std::shared_lock lock(m_mutex);
 
-			const auto resource = it->second.lock();
-			if (resource) {
-				return resource;
+			if (const auto resource = m_resource_map.find(key, hash)) {
+				if (auto shared_resource = resource->lock()) {
+					return shared_resource;
+				}
 			}
+		}
 
-			m_resource_map.erase(it);
+		// Slow path: the resource must be created (unless another thread
+		// created it in the meantime).
+		const std::scoped_lock lock(m_mutex);
+
+		const auto [resource, inserted]
+			= m_resource_map.try_emplace(key, hash);
+		if (!inserted) {
+			if (auto shared_resource = resource->lock()) {
+				return shared_resource;
+			}
 		}
 
-		const auto new_resource
-			= MakeAllocatedShared< Resource< DerivedResourceT > >
-			  (*this, key, std::forward< ConstructorArgsT >(args)...);
+		try {
+			const auto new_resource
+				= MakeAllocatedShared< Resource< DerivedResourceT > >
+				  (*this, key, hash, std::forward< ConstructorArgsT >(args)...);
 
-		m_resource_map.emplace(key, new_resource);
+			*resource = new_resource;
 
-		return new_resource;
+			return new_resource;
+		}
+		catch (...) {
+			m_resource_map.erase(key, hash);
+			throw;
+		}
 	}
 
 	template< typename KeyT, typename ResourceT >
-	void ResourcePool< KeyT, ResourceT >::Remove(const KeyT& key) {
+	inline void ResourcePool< KeyT, ResourceT >::Remove(const KeyT& key) {
+		Remove(key, m_resource_map.hash(key));
+	}
+
+	template< typename KeyT, typename ResourceT >
+	void ResourcePool< KeyT, ResourceT >::Remove(const KeyT& key,
+												 std::size_t hash) {
+
 		const std::scoped_lock lock(m_mutex);
 
-		if (const auto it = m_resource_map.find(key);
-			it != m_resource_map.end() && it->second.expired()) {
+		if (const auto resource = m_resource_map.find(key, hash);
+			resource && resource->expired()) {
 
-			m_resource_map.erase(it);
+			m_resource_map.erase(key, hash);
 		}
 	}
 
@@ -146,10 +155,12 @@ namespace mage {
 	ResourcePool< KeyT, ResourceT >::Resource< DerivedResourceT >
 		::Resource(ResourcePool& resource_pool,
 			       const KeyT& resource_key,
+			       std::size_t resource_hash,
 			       ConstructorArgsT&&... args)
 		: DerivedResourceT(std::forward< ConstructorArgsT >(args)...),
 		m_resource_pool(resource_pool),
-		m_resource_key(resource_key) {}
+		m_resource_key(resource_key),
+		m_resource_hash(resource_hash) {}
 
 	template< typename KeyT, typename ResourceT >
 	template< typename DerivedResourceT >
@@ -162,7 +173,7 @@ namespace mage {
 	ResourcePool< KeyT, ResourceT >::Resource< DerivedResourceT >
 		::~Resource() {
 
-		m_resource_pool.Remove(m_resource_key);
+		m_resource_pool.Remove(m_resource_key, m_resource_hash);
 	}
 
 	#pragma endregion
@@ -187,7 +198,7 @@ namespace mage {
 	inline bool PersistentResourcePool< KeyT, ResourceT >
 		::empty() const noexcept {
 
-		const std::scoped_lock lock(m_mutex);
+		const std::shared_lock lock(m_mutex);
 
 		using std::empty;
 		return empty(m_resource_map);
@@ -198,7 +209,7 @@ namespace mage {
 	inline std::size_t PersistentResourcePool< KeyT, ResourceT >
 		::size() const noexcept {
 
-		const std::scoped_lock lock(m_mutex);
+		const std::shared_lock lock(m_mutex);
 
 		using std::size;
 		return size(m_resource_map);
@@ -208,21 +219,23 @@ namespace mage {
 	[[nodiscard]]bool PersistentResourcePool< KeyT, ResourceT >
 		::Contains(const KeyT& key) noexcept {
 
-		const std::scoped_lock lock(m_mutex);
+		const auto hash = m_resource_map.hash(key);
 
-		const auto it = m_resource_map.find(key);
-		return (it != m_resource_map.end());
+		const std::shared_lock lock(m_mutex);
+
+		return nullptr != m_resource_map.find(key, hash);
 	}
 
 	template< typename KeyT, typename ResourceT >
 	[[nodiscard]]SharedPtr< ResourceT > PersistentResourcePool< KeyT, ResourceT >
 		::Get(const KeyT& key) noexcept {
 
-		const std::scoped_lock lock(m_mutex);
+		const auto hash = m_resource_map.hash(key);
 
-		const auto it = m_resource_map.find(key);
-		return (it != m_resource_map.end()) ? it->second
-			                                : SharedPtr< ResourceT >();
+		const std::shared_lock lock(m_mutex);
+
+		const auto resource = m_resource_map.find(key, hash);
+		return resource ? *resource : SharedPtr< ResourceT >();
 	}
 
 	template< typename KeyT, typename ResourceT >
@@ -239,18 +252,29 @@ namespace mage {
 	SharedPtr< ResourceT > PersistentResourcePool< KeyT, ResourceT >
 		::GetOrCreateDerived(const KeyT& key, ConstructorArgsT&&... args) {
 
-		const std::scoped_lock lock(m_mutex);
+		const auto hash = m_resource_map.hash(key);
+
+		// Fast path: the resource exists.
+		{
+			const std::shared_lock lock(m_mutex);
+
+			if (const auto resource = m_resource_map.find(key, hash)) {
+				return *resource;
+			}
+		}
 
-		if (const auto it = m_resource_map.find(key);
-			it != m_resource_map.end()) {
+		// Slow path: the resource must be created (unless another thread
+		// created it in the meantime).
+		const std::scoped_lock lock(m_mutex);
 
-			return it->second;
+		if (const auto resource = m_resource_map.find(key, hash)) {
+			return *resource;
 		}
 
 		const auto new_resource = MakeAllocatedShared< DerivedResourceT >
 			                      (std::forward< ConstructorArgsT >(args)...);
 
-		m_resource_map.emplace(key, new_resource);
+		m_resource_map.try_emplace(key, hash, new_resource);
 
 		return new_resource;
 	}
@@ -259,13 +283,11 @@ namespace mage {
 	void PersistentResourcePool< KeyT, ResourceT >
 		::Remove(const KeyT& key) {
 
-		const std::scoped_lock lock(m_mutex);
+		const auto hash = m_resource_map.hash(key);
 
-		if (const auto it = m_resource_map.find(key);
-			it != m_resource_map.end()) {
+		const std::scoped_lock lock(m_mutex);
 
-			m_resource_map.erase(it);
-		}
+		m_resource_map.erase(key, hash);
 	}
 
 	template< typename KeyT, typename ResourceT >
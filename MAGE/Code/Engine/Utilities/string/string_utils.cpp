@@ -12,6 +12,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
+#include <cstring>
 #include <limits>
 
 #pragma endregion
@@ -21,6 +22,222 @@
 //-----------------------------------------------------------------------------
 namespace mage {
 
+	namespace {
+
+		/**
+		 The exactly representable powers of ten of a @c F64 value.
+		 */
+		constexpr F64 s_powers_of_ten[] = {
+			1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,
+			1e8,  1e9,  1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+			1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+		};
+
+		/**
+		 Loads the eight characters starting at the given character.
+
+		 @param[in]		first
+						A pointer to the first character.
+		 @return		The eight characters packed in little-endian order.
+		 */
+		[[nodiscard]]
+		inline U64 LoadEightCharacters(const char* first) noexcept {
+			U64 characters;
+			std::memcpy(&characters, first, sizeof(characters));
+			return characters;
+		}
+
+		/**
+		 Checks whether the given eight characters are all decimal digits.
+
+		 @param[in]		characters
+						The eight characters packed in little-endian order.
+		 @return		@c true if the given eight characters are all decimal
+						digits. @c false otherwise.
+		 */
+		[[nodiscard]]
+		constexpr bool AreEightDigits(U64 characters) noexcept {
+			return 0u == (((characters + 0x4646464646464646ull)
+						 | (characters - 0x3030303030303030ull))
+						 & 0x8080808080808080ull);
+		}
+
+		/**
+		 Converts the given eight decimal digits to their value (SWAR).
+
+		 @param[in]		characters
+						The eight decimal digits packed in little-endian order.
+		 @return		The value of the given eight decimal digits.
+		 */
+		[[nodiscard]]
+		constexpr U64 ParseEightDigits(U64 characters) noexcept {
+			constexpr U64 mask = 0x000000FF000000FFull;
+			constexpr U64 mul1 = 100ull   + (1000000ull << 32u);
+			constexpr U64 mul2 = 1ull     + (10000ull   << 32u);
+
+			characters -= 0x3030303030303030ull;
+			// Pairs of digits
+			characters = (characters * 10u) + (characters >> 8u);
+			// Quadruples of digits
+			return (((characters & mask) * mul1)
+				  + (((characters >> 16u) & mask) * mul2)) >> 32u;
+		}
+
+		/**
+		 Parses the decimal digits starting at the given character.
+
+		 @param[in,out]	first
+						A reference to a pointer to the first character. The
+						pointer is advanced past the parsed digits.
+		 @param[in]		last
+						A pointer past the last character.
+		 @param[in,out]	value
+						A reference to the value to accumulate the parsed
+						digits to.
+		 */
+		inline void ParseDigits(const char*& first, const char* last,
+								U64& value) noexcept {
+
+			while (8 <= last - first
+				   && AreEightDigits(LoadEightCharacters(first))) {
+
+				value = 100000000u * value
+					  + ParseEightDigits(LoadEightCharacters(first));
+				first += 8;
+			}
+
+			while (first != last && '0' <= *first && *first <= '9') {
+				value = 10u * value + static_cast< U64 >(*first - '0');
+				++first;
+			}
+		}
+
+		/**
+		 Converts the given decimal string to a @c F32 value without
+		 resorting to @c std::from_chars.
+
+		 Only strings of at most 19 significant digits, whose value can be
+		 computed with a single correctly rounded @c F64 operation (i.e.
+		 Clinger's fast path), and whose @c F32 rounding is unambiguous, are
+		 converted. The result is identical to the result of
+		 @c std::from_chars.
+
+		 @param[in]		str
+						The string to convert.
+		 @param[out]	result
+						A reference to the @c F32 value.
+		 @return		@c true if the given string is converted. @c false
+						otherwise.
+		 */
+		[[nodiscard]]
+		bool FastStringToF32(std::string_view str, F32& result) noexcept {
+			const char*       first = str.data();
+			const char* const last  = str.data() + str.size();
+
+			const bool negative = (first != last && '-' == *first);
+			if (negative) {
+				++first;
+			}
+
+			// Integral part
+			U64 mantissa = 0u;
+			const char* const integral_first = first;
+			ParseDigits(first, last, mantissa);
+			auto nb_digits = first - integral_first;
+
+			// Fractional part
+			S64 exponent = 0;
+			if (first != last && '.' == *first) {
+				++first;
+				const char* const fractional_first = first;
+				ParseDigits(first, last, mantissa);
+				exponent   = fractional_first - first;
+				nb_digits += first - fractional_first;
+			}
+
+			if (0 == nb_digits || 19 < nb_digits) {
+				return false;
+			}
+
+			// Exponent part
+			if (first != last && ('e' == *first || 'E' == *first)) {
+				++first;
+
+				const bool negative_exponent = (first != last && '-' == *first);
+				if (first != last && ('-' == *first || '+' == *first)) {
+					++first;
+				}
+
+				U64 explicit_exponent = 0u;
+				const char* const exponent_first = first;
+				ParseDigits(first, last, explicit_exponent);
+				if (exponent_first == first || 4 < first - exponent_first) {
+					return false;
+				}
+
+				exponent += negative_exponent
+					      ? -static_cast< S64 >(explicit_exponent)
+					      :  static_cast< S64 >(explicit_exponent);
+			}
+
+			if (first != last) {
+				return false;
+			}
+
+			if (0u == mantissa) {
+				result = negative ? -0.0f : 0.0f;
+				return true;
+			}
+
+			// The mantissa and power of ten must be exactly representable.
+			if ((1ull << 53u) < mantissa || exponent < -22 || 22 < exponent) {
+				return false;
+			}
+
+			auto value = static_cast< F64 >(mantissa);
+			value = (exponent < 0) ? value / s_powers_of_ten[-exponent]
+				                   : value * s_powers_of_ten[ exponent];
+
+			// The correctly rounded F64 value rounds to the correctly rounded
+			// F32 value, unless it is a F32 midpoint or not a normal F32
+			// value.
+			U64 bits;
+			std::memcpy(&bits, &value, sizeof(bits));
+			if (0x10000000ull == (bits & 0x1FFFFFFFull)
+				|| value < static_cast< F64 >(std::numeric_limits< F32 >::min())
+				|| value > static_cast< F64 >(std::numeric_limits< F32 >::max())) {
+
+				return false;
+			}
+
+			result = static_cast< F32 >(negative ? -value : value);
+			return true;
+		}
+	}
+
+	template<>
+	[[nodiscard]]
+	const std::optional< F32 > StringTo(std::string_view str) noexcept {
+		if (F32 result; FastStringToF32(str, result)) {
+			return result;
+		}
+
+		const char* const first = str.data();
+		const char* const last  = str.data() + str.size();
+		F32 result = {};
+		const auto [ptr, error_code] = std::from_chars(first, last, result);
+
+		if (last != ptr
+			|| std::errc::invalid_argument    == error_code
+			|| std::errc::result_out_of_range == error_code) {
+
+			return {};
+		}
+		else {
+			return result;
+		}
+	}
+
 	DWORD UTF8toUTF16::Convert(std::string_view s) {
 		if (static_cast< std::size_t >(std::numeric_limits< int >::max()) < s.size()) {
 			return ERROR_INVALID_PARAMETER;
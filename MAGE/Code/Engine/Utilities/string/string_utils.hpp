@@ -46,6 +46,21 @@ namespace mage {
 	[[nodiscard]]
 	const std::optional< T > StringTo(std::string_view str) noexcept;
 
+	/**
+	 Converts the given string to a @c F32 value.
+
+	 Short decimal strings are converted without @c std::from_chars. The
+	 result is identical to the result of @c std::from_chars.
+
+	 @param[in]		str
+					The string to convert.
+	 @return		A @c F32 value if the the conversion of the given string
+					succeeded.
+	 */
+	template<>
+	[[nodiscard]]
+	const std::optional< F32 > StringTo(std::string_view str) noexcept;
+
 	/**
 	 Converts the prefix of the given string to a @c T value.
 